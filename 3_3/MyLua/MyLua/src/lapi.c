@@ -336,7 +336,7 @@ LUA_API int lua_compare (lua_State *L, int index1, int index2, int op) {
 
 
 LUA_API size_t lua_stringtonumber (lua_State *L, const char *s) {
-  size_t sz = luaO_str2num(s, L->top);
+  size_t sz = luaO_str2num(L, s, L->top);
   if (sz != 0)
     api_incr_top(L);
   return sz;
@@ -442,6 +442,36 @@ LUA_API const void *lua_topointer (lua_State *L, int idx) {
 }
 
 
+/*
+** If the value at 'idx' is a table whose array part is packed and not
+** empty, sets '*p' to its elements t[1..n] (a C array of integers or of
+** floats), '*n' to their number, and returns their kind; returns 0
+** otherwise. The elements may be read, and rearranged or overwritten
+** with numbers of the same subtype (with LUA_USE_NANBOX, integers that
+** fit in 47 bits), while nothing else changes the table.
+*/
+LUA_API int lua_numarray (lua_State *L, int idx, void **p, lua_Integer *n) {
+  int kind = 0;
+#if defined(LUA_USE_NUMARRAY)
+  StkId o;
+  lua_lock(L);
+  o = index2addr(L, idx);
+  if (ttistable(o) && ispacked(hvalue(o)) && hvalue(o)->sizeused > 0 &&
+      sizeof(lua_Integer) == sizeof(PackedNum) &&  /* plain C arrays? */
+      sizeof(lua_Number) == sizeof(PackedNum)) {
+    Table *t = hvalue(o);
+    *p = t->packed;
+    *n = cast(lua_Integer, t->sizeused);
+    kind = (t->arraykind == ARRAY_INTS) ? LUA_NUMARRAYINT : LUA_NUMARRAYFLT;
+  }
+  lua_unlock(L);
+#else
+  UNUSED(L); UNUSED(idx); UNUSED(p); UNUSED(n);
+#endif
+  return kind;
+}
+
+
 
 /*
 ** push functions (C -> stack)
@@ -466,7 +496,7 @@ LUA_API void lua_pushnumber (lua_State *L, lua_Number n) {
 
 LUA_API void lua_pushinteger (lua_State *L, lua_Integer n) {
   lua_lock(L);
-  setivalue(L->top, n);
+  setivalue(L, L->top, n);
   api_incr_top(L);
   lua_unlock(L);
 }
@@ -565,6 +595,10 @@ LUA_API void lua_pushboolean (lua_State *L, int b) {
 
 LUA_API void lua_pushlightuserdata (lua_State *L, void *p) {
   lua_lock(L);
+#if defined(LUA_USE_NANBOX)
+  api_check(L, (cast(size_t, p) >> NB_TAGSHIFT) == 0,
+               "pointer does not fit in a boxed value");
+#endif
   setpvalue(L->top, p);
   api_incr_top(L);
   lua_unlock(L);
@@ -636,7 +670,7 @@ LUA_API int lua_geti (lua_State *L, int idx, lua_Integer n) {
     api_incr_top(L);
   }
   else {
-    setivalue(L->top, n);
+    setivalue(L, L->top, n);
     api_incr_top(L);
     luaV_finishget(L, t, L->top - 1, L->top - 1, slot);
   }
@@ -790,7 +824,7 @@ LUA_API void lua_seti (lua_State *L, int idx, lua_Integer n) {
   if (luaV_fastset(L, t, n, slot, luaH_getint, L->top - 1))
     L->top--;  /* pop value */
   else {
-    setivalue(L->top, n);
+    setivalue(L, L->top, n);
     api_incr_top(L);
     luaV_finishset(L, t, L->top - 1, L->top - 2, slot);
     L->top -= 2;  /* pop value and key */
@@ -1338,33 +1372,60 @@ static void reverse_strt(lua_State *L) {
 }
 
 
-static void get_str_next(TString *s, hash_map_t *pre_allgc, hash_map_t *pre_strt) {
-  *(void**)hash_map_at(pre_allgc, s) = s->next;
-  *(void**)hash_map_at(pre_strt, s) = s->u.hnext;
-}
-
-
-static void get_all_next(lua_State *L, Table *t, hash_map_t *pre_allgc, hash_map_t *pre_strt) {
-  *(void**)hash_map_at(pre_allgc, t) = t->next;
+/*
+** the get_*_next functions return 0 when a container cannot get memory
+*/
+static int get_str_next(TString *s, hash_map_t *pre_allgc, hash_map_t *pre_strt,
+                        hash_set_t *pending) {
+  void **pre = cast(void**, hash_map_at(pre_allgc, s));
+  if (pre == NULL)
+    return 0;
+  *pre = s->next;
+  pre = cast(void**, hash_map_at(pre_strt, s));
+  if (pre == NULL)
+    return 0;
+  *pre = s->u.hnext;
+  hash_set_insert(pending, s);
+  return (hash_set_count(pending, s) > 0);  /* (may be there already) */
+}
+
+
+static int get_all_next(lua_State *L, Table *t, hash_map_t *pre_allgc, hash_map_t *pre_strt,
+                        hash_set_t *pending) {
+  void **pre = cast(void**, hash_map_at(pre_allgc, t));
+  if (pre == NULL)
+    return 0;
+  *pre = t->next;
   /* tableõ */
   unsigned int i;
-  for (i = 0; i < t->sizearray; i++) {  /* 鲿 */
-    if (ttistable(&t->array[i]))
-      get_all_next(L, hvalue(&t->array[i]), pre_allgc, pre_strt);
-    else if (ttisstring(&t->array[i]))
-      get_str_next(tsvalue(&t->array[i]), pre_allgc, pre_strt);
+  for (i = 0; i < sizevalarray(t); i++) {  /* 鲿 */
+    if (ttistable(&t->array[i])) {
+      if (!get_all_next(L, hvalue(&t->array[i]), pre_allgc, pre_strt, pending))
+        return 0;
+    }
+    else if (ttisstring(&t->array[i])) {
+      if (!get_str_next(tsvalue(&t->array[i]), pre_allgc, pre_strt, pending))
+        return 0;
+    }
   }
   Node* n;
   Node* limit = gnode(t, cast(size_t, sizenode(t)));
   for (n = gnode(t, 0); n < limit; n++) {  /* ϣ */
-    if (ttistable(gval(n)))
-      get_all_next(L, hvalue(gval(n)), pre_allgc, pre_strt);
-    else if (ttisstring(gval(n)))
-      get_str_next(tsvalue(gval(n)), pre_allgc, pre_strt);
+    if (ttistable(gval(n))) {
+      if (!get_all_next(L, hvalue(gval(n)), pre_allgc, pre_strt, pending))
+        return 0;
+    }
+    else if (ttisstring(gval(n))) {
+      if (!get_str_next(tsvalue(gval(n)), pre_allgc, pre_strt, pending))
+        return 0;
+    }
     
-    if (ttisstring(gkey(n)))
-      get_str_next(tsvalue(gkey(n)), pre_allgc, pre_strt);
+    if (ttisstring(gkey(n))) {
+      if (!get_str_next(tsvalue(gkey(n)), pre_allgc, pre_strt, pending))
+        return 0;
+    }
   }
+  return 1;
 }
 
 static void resize_strt (lua_State *L, stringtable *tb, int newsize) {
@@ -1403,15 +1464,35 @@ static void strt_destroy(lua_State *L, stringtable *strt) {
   luaM_freearray(L, strt->hash, strt->size);
 }
 
-static void copy_str(lua_State* L, TString **s, stringtable *tb) {
-  TString *src = *s;
+#if defined(LUA_USE_NANBOX)
+
+#define isintbox(o)	(ttisinteger(o) && iscollectable(o))
+
+/* boxed integers are plain numbers, so they are always copied */
+static void copy_int(lua_State* L, TValue *o) {
+  IntBox *dest = (IntBox*)malloc(sizeof(IntBox));
+  UNUSED(L);
+  memcpy(dest, gco2ib(gcvalue(o)), sizeof(IntBox));
+  setgcovalue(L, o, obj2gco(dest));
+}
+
+#else
+
+#define isintbox(o)	0
+#define copy_int(L,o)	((void)0)
+
+#endif
+
+
+static void copy_str(lua_State* L, TValue *o, stringtable *tb) {
+  TString *src = tsvalue(o);
   TString *dest = NULL;
 
   /* long stringֱӸ */
-  if (ttislngstring((TValue*)s)) {
-    dest = (TString*)malloc(sizelstring(src->shrlen));
-    memcpy(dest, src, sizelstring(src->shrlen));
-    *s = dest;
+  if (ttislngstring(o)) {
+    dest = (TString*)malloc(sizelstring(src->u.lnglen));
+    memcpy(dest, src, sizelstring(src->u.lnglen));
+    setgcovalue(L, o, obj2gco(dest));
     return;
   }
 
@@ -1425,13 +1506,13 @@ static void copy_str(lua_State* L, TString **s, stringtable *tb) {
     if (l == tmp->shrlen &&
         (memcmp(str, getstr(tmp), l * sizeof(char)) == 0)) {
       /* found! */
-      *s = tmp;
+      setgcovalue(L, o, obj2gco(tmp));
       return;
     }
 
   dest = (TString*)malloc(sizelstring(src->shrlen));
   memcpy(dest, src, sizelstring(src->shrlen));
-  *s = dest;
+  setgcovalue(L, o, obj2gco(dest));
 
   /* ʱstrt */
   if (tb->nuse >= tb->size && tb->size <= MAX_INT/2) {
@@ -1444,30 +1525,38 @@ static void copy_str(lua_State* L, TString **s, stringtable *tb) {
 }
 
 
-static void copy_table(lua_State* L, Table **t, stringtable *tb) {
+static void copy_table(lua_State* L, TValue *o, stringtable *tb) {
   /*  */
-  Table *src = *t;
+  Table *src = hvalue(o);
   Table *dest = (Table*)malloc(sizeof(Table));
   memcpy(dest, src, sizeof(Table));
-  *t = dest;
+  setgcovalue(L, o, obj2gco(dest));
 
   /* 鲿 */
-  if (dest->sizearray != 0) {
+#if defined(LUA_USE_NUMARRAY)
+  if (ispacked(dest) && dest->sizearray != 0) {  /* numbers only */
+    dest->packed = (PackedNum*)malloc(dest->sizearray * sizeof(PackedNum));
+    memcpy(dest->packed, src->packed, dest->sizearray * sizeof(PackedNum));
+  }
+#endif
+  if (sizevalarray(dest) != 0) {
     dest->array = (TValue*)malloc(dest->sizearray * sizeof(TValue));
     memcpy(dest->array, src->array, dest->sizearray * sizeof(TValue));
   }
   unsigned int i;
-  for (i = 0; i < dest->sizearray; i++) {
+  for (i = 0; i < sizevalarray(dest); i++) {
     if (ttistable(&dest->array[i]))
       copy_table(L, &dest->array[i], tb);
     else if (ttisstring(&dest->array[i]))
       copy_str(L, &dest->array[i], tb);
+    else if (isintbox(&dest->array[i]))
+      copy_int(L, &dest->array[i]);
   }
 
   /* ϣ */
   if (allocsizenode(dest) != 0) {
-    dest->node = (Node*)malloc(sizenode(dest) * sizeof(Node));
-    memcpy(dest->node, src->node, sizenode(dest) * sizeof(Node));
+    dest->node = (Node*)malloc(sizenodevector(sizenode(dest)));
+    memcpy(dest->node, src->node, sizenodevector(sizenode(dest)));
   }
   Node* n;
   Node* limit = gnode(dest, cast(size_t, sizenode(dest)));
@@ -1476,135 +1565,223 @@ static void copy_table(lua_State* L, Table **t, stringtable *tb) {
       copy_table(L, &n->i_val, tb);
     else if (ttisstring(gval(n)))
       copy_str(L, &n->i_val, tb);
+    else if (isintbox(gval(n)))
+      copy_int(L, &n->i_val);
     
     if (ttisstring(gkey(n)))
-      copy_str(L, &n->i_key, tb);
+      copy_str(L, cast(TValue *, gkey(n)), tb);
+    else if (isintbox(gkey(n)))
+      copy_int(L, cast(TValue *, gkey(n)));
   }
 }
 
-static void detach_str(lua_State *L, TString **s, hash_map_t *pre_allgc,
-              hash_map_t *pre_strt, hash_set_t *visited, stringtable *tb) {
+/*
+** update the recorded predecessor of 'o'. An object that was not recorded
+** is never detached, so nothing is inserted (and nothing is allocated).
+*/
+static void set_pre(hash_map_t *pre, void *o, void *p) {
+  if (hash_map_count(pre, o) > 0)
+    *(void**)hash_map_at(pre, o) = p;
+}
+
+
+static void detach_str(lua_State *L, TValue *o, hash_map_t *pre_allgc,
+              hash_map_t *pre_strt, hash_set_t *pending, stringtable *tb) {
+  TString *s = tsvalue(o);
   global_State* g = G(L);
   hash_set_iterator_t it_hs;
   hash_set_t *monopolize = g->monopolize;
   
   /* Ѿʹٴ */
-  it_hs = hash_set_find(visited, *s);
-  if (!iterator_equal(it_hs, hash_set_end(visited)))
+  if (hash_set_erase(pending, s) == 0)
     return;
-
-  hash_set_insert(visited, *s);
-  it_hs = hash_set_find(monopolize, *s);
+  it_hs = hash_set_find(monopolize, s);
   /* ⲿ */
   if (iterator_equal(it_hs, hash_set_end(monopolize))) {
-    copy_str(L, s, tb);
+    copy_str(L, o, tb);
   }
   /* ڲ */
   else {
     /* allgc */
-    if (*(void**)hash_map_at(pre_allgc, *s) == NULL) {
-      g->allgc = (*s)->next;
+    if (*(void**)hash_map_at(pre_allgc, s) == NULL) {
+      g->allgc = s->next;
     }
     else {
-      cast(GCObject*, *(void**)hash_map_at(pre_allgc, *s))->next = (*s)->next;
+      cast(GCObject*, *(void**)hash_map_at(pre_allgc, s))->next = s->next;
     }
-    *(void**)hash_map_at(pre_allgc, (*s)->next) = *(void**)hash_map_at(pre_allgc, *s);
-    (*s)->next = NULL;
+    set_pre(pre_allgc, s->next, *(void**)hash_map_at(pre_allgc, s));
+    s->next = NULL;
 
     /* long stringstrt */
-    if (ttislngstring((TValue*)s))
+    if (ttislngstring(o))
       return;
 
     /* strtа */
-    if (*(void**)hash_map_at(pre_strt, *s) == NULL) {
-      g->strt.hash[lmod((*s)->hash, g->strt.size)] = (*s)->u.hnext;
+    if (*(void**)hash_map_at(pre_strt, s) == NULL) {
+      g->strt.hash[lmod(s->hash, g->strt.size)] = s->u.hnext;
     }
     else {
-      cast(TString*, *(void**)hash_map_at(pre_strt, *s))->u.hnext = (*s)->u.hnext;
+      cast(TString*, *(void**)hash_map_at(pre_strt, s))->u.hnext = s->u.hnext;
     }
-    *(void**)hash_map_at(pre_strt, (*s)->u.hnext) = *(void**)hash_map_at(pre_strt, *s);
-    (*s)->u.hnext = NULL;
+    set_pre(pre_strt, s->u.hnext, *(void**)hash_map_at(pre_strt, s));
+    s->u.hnext = NULL;
     g->strt.nuse--;
   }
 }
 
 
-static void detach_table_aux(lua_State *L, Table **t, hash_map_t *pre_allgc,
-                  hash_map_t *pre_strt, hash_set_t *visited, stringtable *tb) {
+static void detach_table_aux(lua_State *L, TValue *o, hash_map_t *pre_allgc,
+                  hash_map_t *pre_strt, hash_set_t *pending, stringtable *tb) {
+  Table *t = hvalue(o);
   unsigned int i;
   Node* n;
   Node* limit;
   global_State* g = G(L);
   hash_set_t *monopolize = g->monopolize;
-  hash_set_iterator_t it_hs = hash_set_find(monopolize, *t);
+  hash_set_iterator_t it_hs = hash_set_find(monopolize, t);
 
   /* monopolizeУ˵tableⲿõģҪ */
   if (iterator_equal(it_hs, hash_set_end(monopolize))) {
-    copy_table(L, t, tb);
+    copy_table(L, o, tb);
   }
   /* allgcа룬ҵݹõĶ */
   else {
-    if (*(void**)hash_map_at(pre_allgc, *t) == NULL) { // ýڵǵһڵ
-      g->allgc = (*t)->next;
+    if (*(void**)hash_map_at(pre_allgc, t) == NULL) { // ýڵǵһڵ
+      g->allgc = t->next;
     }
     else { // ǵһڵ
-      cast(GCObject*, *(void**)hash_map_at(pre_allgc, *t))->next = (*t)->next;
+      cast(GCObject*, *(void**)hash_map_at(pre_allgc, t))->next = t->next;
     }
     // ±ڵĺһڵnextpre_allgcļ¼nextʱ
-    *(void**)hash_map_at(pre_allgc, (*t)->next) = *(void**)hash_map_at(pre_allgc, *t);
-    (*t)->next = NULL;
+    set_pre(pre_allgc, t->next, *(void**)hash_map_at(pre_allgc, t));
+    t->next = NULL;
 
     /* ݹtableõ */
-    for (i = 0; i < (*t)->sizearray; i++) { /* 鲿 */
-      if (ttistable(&(*t)->array[i]))
-        detach_table_aux(L, &(*t)->array[i], pre_allgc, pre_strt, visited, tb);
-      else if (ttisstring(&(*t)->array[i]))
-        detach_str(L, &(*t)->array[i], pre_allgc, pre_strt, visited, tb);
+    for (i = 0; i < sizevalarray(t); i++) { /* 鲿 */
+      if (ttistable(&t->array[i]))
+        detach_table_aux(L, &t->array[i], pre_allgc, pre_strt, pending, tb);
+      else if (ttisstring(&t->array[i]))
+        detach_str(L, &t->array[i], pre_allgc, pre_strt, pending, tb);
+      else if (isintbox(&t->array[i]))
+        copy_int(L, &t->array[i]);
     }
-    limit = gnode(*t, cast(size_t, sizenode(*t)));
-    for (n = gnode(*t, 0); n < limit; n++) { /* ϣ */
+    limit = gnode(t, cast(size_t, sizenode(t)));
+    for (n = gnode(t, 0); n < limit; n++) { /* ϣ */
       if (ttistable(gval(n))) { 
-        detach_table_aux(L, &n->i_val, pre_allgc, pre_strt, visited, tb);
+        detach_table_aux(L, &n->i_val, pre_allgc, pre_strt, pending, tb);
       }
       else if (ttisstring(gval(n)))
-        detach_str(L, &n->i_val, pre_allgc, pre_strt, visited, tb);
+        detach_str(L, &n->i_val, pre_allgc, pre_strt, pending, tb);
+      else if (isintbox(gval(n)))
+        copy_int(L, &n->i_val);
 
       if (ttisstring(gkey(n))) 
-        detach_str(L, &n->i_key, pre_allgc, pre_strt, visited, tb);
+        detach_str(L, cast(TValue *, gkey(n)), pre_allgc, pre_strt, pending, tb);
+      else if (isintbox(gkey(n)))
+        copy_int(L, cast(TValue *, gkey(n)));
     }
   }
 }
 
 
-static void detach_table(lua_State *L, Table **t) {
-  hash_map_t* pre_allgc = create_hash_map(void*, void*);; /* ¼allgcеǰһڵ */
-  hash_map_t* pre_strt = create_hash_map(void*, void*);; /* ¼stringstrtеǰһڵ */
-  hash_set_t* visited = create_hash_set(void*); /* 洢Ѿʹstring󣬱ظ */
-  stringtable strt; /* 洢short stringظ */
+#if defined(LUA_USE_SHAPES) || defined(LUA_USE_INCREHASH)
+/*
+** shapes belong to this state, and a table being rehashed keeps part of
+** its entries outside 'node': give every table to be exported a single
+** regular hash part before detaching it
+*/
+static void unshape_all(lua_State *L, Table *t) {
+  unsigned int i;
+  Node* n;
+  Node* limit;
+#if defined(LUA_USE_SHAPES)
+  luaH_unshape(L, t);
+#endif
+#if defined(LUA_USE_INCREHASH)
+  luaH_finishrehash(L, t);
+#endif
+  for (i = 0; i < sizevalarray(t); i++) {
+    if (ttistable(&t->array[i]))
+      unshape_all(L, hvalue(&t->array[i]));
+  }
+  limit = gnode(t, cast(size_t, sizenode(t)));
+  for (n = gnode(t, 0); n < limit; n++) {
+    if (ttistable(gval(n)))
+      unshape_all(L, hvalue(gval(n)));
+  }
+}
+#endif
 
-  // ʼ
-  hash_map_init(pre_allgc);
-  hash_map_init(pre_strt);
-  hash_set_init(visited);
-  strt_init(L, &strt);
 
+static void destroy_detach_maps(hash_map_t *pre_allgc, hash_map_t *pre_strt, hash_set_t *pending) {
+  if (pre_allgc != NULL)
+    hash_map_destroy(pre_allgc);
+  if (pre_strt != NULL)
+    hash_map_destroy(pre_strt);
+  if (pending != NULL)
+    hash_set_destroy(pending);
+}
+
+
+/*
+** record the previous node of every object reachable from 't' before
+** anything is detached, so a container that cannot get memory leaves the
+** lists as they were; returns 0 in that case
+*/
+static int prepare_detach(lua_State *L, Table *t, hash_map_t *pre_allgc, hash_map_t *pre_strt,
+                          hash_set_t *pending) {
+  int ok;
   // תallgcstrtַ 
   reverse_allgc(L);
   reverse_strt(L);
   // ȡǰһڵ
-  get_all_next(L, *t, pre_allgc, pre_strt);
-
+  ok = get_all_next(L, t, pre_allgc, pre_strt, pending);
   // ָ
   reverse_allgc(L);
   reverse_strt(L);
+  return ok;
+}
+
+
+static void detach_table(lua_State *L, TValue *o) {
+  global_State *g = G(L);
+  hash_map_t* pre_allgc; /* ¼allgcеǰһڵ */
+  hash_map_t* pre_strt; /* ¼stringstrtеǰһڵ */
+  hash_set_t* pending; /* 洢δstring󣬱ظ */
+  stringtable strt; /* 洢short stringظ */
+  int emergency = 0;
+
+#if defined(LUA_USE_SHAPES) || defined(LUA_USE_INCREHASH)
+  unshape_all(L, hvalue(o));  /* (may allocate: before touching lists) */
+#endif
+  strt_init(L, &strt);
+  // ʼ
+  for (;;) {
+    pre_allgc = create_hash_map_with_allocator(&g->cstlalloc, void*, void*);
+    pre_strt = create_hash_map_with_allocator(&g->cstlalloc, void*, void*);
+    pending = create_hash_set_with_allocator(&g->cstlalloc, void*);
+    if (pre_allgc != NULL && pre_strt != NULL && pending != NULL) {
+      hash_map_init(pre_allgc);
+      hash_map_init(pre_strt);
+      hash_set_init(pending);
+      if (prepare_detach(L, hvalue(o), pre_allgc, pre_strt, pending))
+        break;
+    }
+    destroy_detach_maps(pre_allgc, pre_strt, pending);
+    if (emergency) {  /* still no memory after a collection? */
+      strt_destroy(L, &strt);
+      luaD_throw(L, LUA_ERRMEM);
+    }
+    luaC_fullgc(L, 1);  /* try to free some memory... */
+    emergency = 1;
+  }
 
   // GCObject
-  detach_table_aux(L, t, pre_allgc, pre_strt, visited, &strt);
+  /* (the containers only find and erase from now on, so they cannot fail) */
+  detach_table_aux(L, o, pre_allgc, pre_strt, pending, &strt);
 
   // 
-  hash_map_destroy(pre_allgc);
-  hash_map_destroy(pre_strt);
-  hash_set_destroy(visited);
+  destroy_detach_maps(pre_allgc, pre_strt, pending);
   strt_destroy(L, &strt);
 }
 
@@ -1614,6 +1791,7 @@ static void detach_table(lua_State *L, Table **t) {
 */
 LUA_API void *lua_export_table (lua_State *L, const char *name) {
   StkId o;
+  TValue v;
   Table *t = NULL;
   Table *tmp = NULL;
   lua_lock(L);
@@ -1627,7 +1805,9 @@ LUA_API void *lua_export_table (lua_State *L, const char *name) {
   lua_remove(L, -1);
 
   // tableа 
-  detach_table(L, &t);
+  sethvalue(L, &v, t);
+  detach_table(L, &v);
+  t = hvalue(&v);
 
   if (t == tmp) {
     // жȫֱԸtable
@@ -1680,6 +1860,18 @@ static void merge_str(lua_State *L, TString *ts) {
   g->strt.nuse++;
 }
 
+#if defined(LUA_USE_NANBOX)
+static void merge_int(lua_State *L, GCObject *o) {
+  global_State* g = G(L);
+  o->marked = luaC_white(g);
+  changewhite(o);
+  o->next = g->allgc;
+  g->allgc = o;
+}
+#else
+#define merge_int(L,o)	((void)0)
+#endif
+
 static void merge_table(lua_State *L, Table *t) {
   global_State* g = G(L);
 
@@ -1691,11 +1883,13 @@ static void merge_table(lua_State *L, Table *t) {
 
   /* ݹ鴦tableõĶ */
   unsigned int i;
-  for (i = 0; i < t->sizearray; i++) {  /* 鲿 */
+  for (i = 0; i < sizevalarray(t); i++) {  /* 鲿 */
     if (ttistable(&t->array[i]))
       merge_table(L, hvalue(&t->array[i]));
     else if (ttisstring(&t->array[i]))
       merge_str(L, tsvalue(&t->array[i]));
+    else if (isintbox(&t->array[i]))
+      merge_int(L, gcvalue(&t->array[i]));
   }
   Node* n;
   Node* limit = gnode(t, cast(size_t, sizenode(t)));
@@ -1704,9 +1898,13 @@ static void merge_table(lua_State *L, Table *t) {
       merge_table(L, hvalue(gval(n)));
     else if (ttisstring(gval(n)))
       merge_str(L, tsvalue(gval(n)));
+    else if (isintbox(gval(n)))
+      merge_int(L, gcvalue(gval(n)));
 
     if (ttisstring(gkey(n)))
       merge_str(L, tsvalue(gkey(n)));
+    else if (isintbox(gkey(n)))
+      merge_int(L, gcvalue(gkey(n)));
   }
 
   /*
@@ -1714,7 +1912,7 @@ static void merge_table(lua_State *L, Table *t) {
   ** keyhashֵҵģҪԹϣֽrehashʹNode
   ** ȷλϡresizerehash
   */
-  luaH_resize(L, t, t->sizearray, allocsizenode(t));
+  luaH_resize(L, t, t->sizearray, allockeys(t));
 }
 
 
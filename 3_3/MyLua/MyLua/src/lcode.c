@@ -40,12 +40,13 @@
 ** If expression is a numeric constant, fills 'v' with its value
 ** and returns 1. Otherwise, returns 0.
 */
-static int tonumeral(const expdesc *e, TValue *v) {
+static int tonumeral(lua_State *L, const expdesc *e, TValue *v) {
+  UNUSED(L);  /* only NaN-boxed integers may need the state */
   if (hasjumps(e))
     return 0;  /* not a numeral */
   switch (e->k) {
     case VKINT:
-      if (v) setivalue(v, e->u.ival);
+      if (v) setivalue(L, v, e->u.ival);
       return 1;
     case VKFLT:
       if (v) setfltvalue(v, e->u.nval);
@@ -442,7 +443,7 @@ static int addk (FuncState *fs, TValue *key, TValue *v) {
   k = fs->nk;
   /* numerical value does not need GC barrier;
      table has no metatable, so it does not need to invalidate cache */
-  setivalue(idx, k);
+  setivalue(L, idx, k);
   luaM_growvector(L, f->k, k, f->sizek, TValue, MAXARG_Ax, "constants");
   while (oldsize < f->sizek) setnilvalue(&f->k[oldsize++]);
   setobj(L, &f->k[k], v);
@@ -471,7 +472,7 @@ int luaK_stringK (FuncState *fs, TString *s) {
 int luaK_intK (FuncState *fs, lua_Integer n) {
   TValue k, o;
   setpvalue(&k, cast(void*, cast(size_t, n)));
-  setivalue(&o, n);
+  setivalue(fs->ls->L, &o, n);
   return addk(fs, &k, &o);
 }
 
@@ -978,7 +979,8 @@ static int validop (int op, TValue *v1, TValue *v2) {
 static int constfolding (FuncState *fs, int op, expdesc *e1,
                                                 const expdesc *e2) {
   TValue v1, v2, res;
-  if (!tonumeral(e1, &v1) || !tonumeral(e2, &v2) || !validop(op, &v1, &v2))
+  if (!tonumeral(fs->ls->L, e1, &v1) || !tonumeral(fs->ls->L, e2, &v2) ||
+      !validop(op, &v1, &v2))
     return 0;  /* non-numeric operands or not safe to fold */
   luaO_arith(fs->ls->L, op, &v1, &v2, &res);  /* does operation */
   if (ttisinteger(&res)) {
@@ -1102,7 +1104,7 @@ void luaK_infix (FuncState *fs, BinOpr op, expdesc *v) {
     case OPR_MOD: case OPR_POW:
     case OPR_BAND: case OPR_BOR: case OPR_BXOR:
     case OPR_SHL: case OPR_SHR: {
-      if (!tonumeral(v, NULL))
+      if (!tonumeral(fs->ls->L, v, NULL))
         luaK_exp2RK(fs, v);
       /* else keep numeral, which may be folded with 2nd operand */
       break;
@@ -11,6 +11,7 @@
 
 
 #include <stddef.h>
+#include <string.h>
 
 #include "lua.h"
 
@@ -106,6 +107,8 @@ Proto *luaF_newproto (lua_State *L) {
   f->code = NULL;
   f->cache = NULL;
   f->sizecode = 0;
+  f->icache = NULL;
+  f->sizeicache = 0;
   f->lineinfo = NULL;
   f->sizelineinfo = 0;
   f->upvalues = NULL;
@@ -122,8 +125,20 @@ Proto *luaF_newproto (lua_State *L) {
 }
 
 
+/*
+** create the inline caches of a prototype whose code is complete; each
+** entry is a node index, so any initial value is a valid (missing) guess
+*/
+void luaF_initicache (lua_State *L, Proto *f) {
+  f->icache = luaM_newvector(L, f->sizecode, unsigned int);
+  f->sizeicache = f->sizecode;
+  memset(f->icache, 0, f->sizecode * sizeof(unsigned int));
+}
+
+
 void luaF_freeproto (lua_State *L, Proto *f) {
   luaM_freearray(L, f->code, f->sizecode);
+  luaM_freearray(L, f->icache, f->sizeicache);
   luaM_freearray(L, f->p, f->sizep);
   luaM_freearray(L, f->k, f->sizek);
   luaM_freearray(L, f->lineinfo, f->sizelineinfo);
@@ -106,6 +106,16 @@ static void reallymarkobject (global_State *g, GCObject *o);
 */
 #define gnodelast(h)	gnode(h, cast(size_t, sizenode(h)))
 
+/*
+** next hash part of a table after 'h': a table being rehashed keeps
+** its old nodes in a second one (see ltable.c)
+*/
+#if defined(LUA_USE_INCREHASH)
+#define nexthash(h)	((h)->oldhash)
+#else
+#define nexthash(h)	NULL
+#endif
+
 
 /*
 ** link collectable object 'o' into list pointed by 'p'
@@ -142,6 +152,12 @@ static int iscleared (global_State *g, const TValue *o) {
     markobject(g, tsvalue(o));  /* strings are 'values', so are never weak */
     return 0;
   }
+#if defined(LUA_USE_NANBOX)
+  else if (ttisinteger(o)) {  /* boxed integer? */
+    markobject(g, gcvalue(o));  /* a number, so never weak either */
+    return 0;
+  }
+#endif
   else return iswhite(gcvalue(o));
 }
 
@@ -246,6 +262,13 @@ static void reallymarkobject (global_State *g, GCObject *o) {
       g->GCmemtrav += sizelstring(gco2ts(o)->u.lnglen);
       break;
     }
+#if defined(LUA_USE_NANBOX)
+    case LUA_TNUMINT: {  /* boxed integer */
+      gray2black(o);
+      g->GCmemtrav += sizeof(IntBox);
+      break;
+    }
+#endif
     case LUA_TUSERDATA: {
       TValue uvalue;
       markobjectN(g, gco2u(o)->metatable);  /* mark its metatable */
@@ -303,6 +326,24 @@ static void markbeingfnz (global_State *g) {
 }
 
 
+#if defined(LUA_USE_SHAPES)
+/*
+** mark the keys of all shapes. A shape may outlive the last marked
+** table using it (it is only freed with its tables), and other tables
+** may still reach it through transitions, so its keys must stay valid.
+** (Each key is the last key of some shape, so marking these is enough.)
+*/
+static void markshapes (global_State *g) {
+  int i;
+  for (i = 0; i < g->sizeshapetab; i++) {
+    Shape *s;
+    for (s = g->shapetab[i]; s != NULL; s = s->hnext)
+      markobject(g, s->key);
+  }
+}
+#endif
+
+
 /*
 ** Mark all values stored in marked open upvalues from non-marked threads.
 ** (Values from marked threads were already marked when traversing the
@@ -359,19 +400,27 @@ static void restartcollection (global_State *g) {
 ** put it in 'weak' list, to be cleared.
 */
 static void traverseweakvalue (global_State *g, Table *h) {
-  Node *n, *limit = gnodelast(h);
+  Table *hp;
+  Node *n, *limit;
   /* if there is array part, assume it may have white values (it is not
      worth traversing it now just to check) */
-  int hasclears = (h->sizearray > 0);
-  for (n = gnode(h, 0); n < limit; n++) {  /* traverse hash part */
-    checkdeadkey(n);
-    if (ttisnil(gval(n)))  /* entry is empty? */
-      removeentry(n);  /* remove it */
-    else {
-      lua_assert(!ttisnil(gkey(n)));
-      markvalue(g, gkey(n));  /* mark key */
-      if (!hasclears && iscleared(g, gval(n)))  /* is there a white value? */
-        hasclears = 1;  /* table will have to be cleared */
+  int hasclears = (sizevalarray(h) > 0);
+#if defined(LUA_USE_SHAPES)
+  if (h->shape != NULL && h->shape->nkeys > 0)
+    hasclears = 1;  /* same for the slots */
+#endif
+  for (hp = h; hp != NULL; hp = nexthash(hp)) {
+    limit = gnodelast(hp);
+    for (n = gnode(hp, 0); n < limit; n++) {  /* traverse hash part */
+      checkdeadkey(n);
+      if (ttisnil(gval(n)))  /* entry is empty? */
+        removeentry(n);  /* remove it */
+      else {
+        lua_assert(!ttisnil(gkey(n)));
+        markvalue(g, gkey(n));  /* mark key */
+        if (!hasclears && iscleared(g, gval(n)))  /* is there a white value? */
+          hasclears = 1;  /* table will have to be cleared */
+      }
     }
   }
   if (g->gcstate == GCSpropagate)
@@ -395,28 +444,42 @@ static int traverseephemeron (global_State *g, Table *h) {
   int marked = 0;  /* true if an object is marked in this traversal */
   int hasclears = 0;  /* true if table has white keys */
   int hasww = 0;  /* true if table has entry "white-key -> white-value" */
-  Node *n, *limit = gnodelast(h);
+  Table *hp;
+  Node *n, *limit;
   unsigned int i;
   /* traverse array part */
-  for (i = 0; i < h->sizearray; i++) {
+  for (i = 0; i < sizevalarray(h); i++) {
     if (valiswhite(&h->array[i])) {
       marked = 1;
       reallymarkobject(g, gcvalue(&h->array[i]));
     }
   }
-  /* traverse hash part */
-  for (n = gnode(h, 0); n < limit; n++) {
-    checkdeadkey(n);
-    if (ttisnil(gval(n)))  /* entry is empty? */
-      removeentry(n);  /* remove it */
-    else if (iscleared(g, gkey(n))) {  /* key is not marked (yet)? */
-      hasclears = 1;  /* table must be cleared */
-      if (valiswhite(gval(n)))  /* value not marked yet? */
-        hasww = 1;  /* white-white entry */
+#if defined(LUA_USE_SHAPES)
+  if (h->shape != NULL) {  /* slot keys are strings, so never cleared */
+    for (i = 0; i < cast(unsigned int, h->shape->nkeys); i++) {
+      if (valiswhite(&h->slots[i])) {
+        marked = 1;
+        reallymarkobject(g, gcvalue(&h->slots[i]));
+      }
     }
-    else if (valiswhite(gval(n))) {  /* value not marked yet? */
-      marked = 1;
-      reallymarkobject(g, gcvalue(gval(n)));  /* mark it now */
+  }
+#endif
+  /* traverse hash part */
+  for (hp = h; hp != NULL; hp = nexthash(hp)) {
+    limit = gnodelast(hp);
+    for (n = gnode(hp, 0); n < limit; n++) {
+      checkdeadkey(n);
+      if (ttisnil(gval(n)))  /* entry is empty? */
+        removeentry(n);  /* remove it */
+      else if (iscleared(g, gkey(n))) {  /* key is not marked (yet)? */
+        hasclears = 1;  /* table must be cleared */
+        if (valiswhite(gval(n)))  /* value not marked yet? */
+          hasww = 1;  /* white-white entry */
+      }
+      else if (valiswhite(gval(n))) {  /* value not marked yet? */
+        marked = 1;
+        reallymarkobject(g, gcvalue(gval(n)));  /* mark it now */
+      }
     }
   }
   /* link table into proper list */
@@ -431,18 +494,28 @@ static int traverseephemeron (global_State *g, Table *h) {
 
 
 static void traversestrongtable (global_State *g, Table *h) {
-  Node *n, *limit = gnodelast(h);
+  Table *hp;
+  Node *n, *limit;
   unsigned int i;
-  for (i = 0; i < h->sizearray; i++)  /* traverse array part */
+  for (i = 0; i < sizevalarray(h); i++)  /* traverse array part */
     markvalue(g, &h->array[i]);
-  for (n = gnode(h, 0); n < limit; n++) {  /* traverse hash part */
-    checkdeadkey(n);
-    if (ttisnil(gval(n)))  /* entry is empty? */
-      removeentry(n);  /* remove it */
-    else {
-      lua_assert(!ttisnil(gkey(n)));
-      markvalue(g, gkey(n));  /* mark key */
-      markvalue(g, gval(n));  /* mark value */
+#if defined(LUA_USE_SHAPES)
+  if (h->shape != NULL) {  /* traverse slots (keys are in the shape) */
+    for (i = 0; i < cast(unsigned int, h->shape->nkeys); i++)
+      markvalue(g, &h->slots[i]);
+  }
+#endif
+  for (hp = h; hp != NULL; hp = nexthash(hp)) {
+    limit = gnodelast(hp);
+    for (n = gnode(hp, 0); n < limit; n++) {  /* traverse hash part */
+      checkdeadkey(n);
+      if (ttisnil(gval(n)))  /* entry is empty? */
+        removeentry(n);  /* remove it */
+      else {
+        lua_assert(!ttisnil(gkey(n)));
+        markvalue(g, gkey(n));  /* mark key */
+        markvalue(g, gval(n));  /* mark value */
+      }
     }
   }
 }
@@ -466,7 +539,17 @@ static lu_mem traversetable (global_State *g, Table *h) {
   }
   else  /* not weak */
     traversestrongtable(g, h);
-  return sizeof(Table) + sizeof(TValue) * h->sizearray +
+  return sizeof(Table) + sizeof(TValue) * sizevalarray(h) +
+#if defined(LUA_USE_NUMARRAY)
+                         sizeof(PackedNum) * (h->sizearray - sizevalarray(h)) +
+#endif
+#if defined(LUA_USE_SHAPES)
+                         sizeof(TValue) * h->sizeslots +
+#endif
+#if defined(LUA_USE_INCREHASH)
+                         (h->oldhash == NULL ? 0 : sizeof(Table) +
+                            sizeof(Node) * allocsizenode(h->oldhash)) +
+#endif
                          sizeof(Node) * cast(size_t, allocsizenode(h));
 }
 
@@ -490,6 +573,7 @@ static int traverseproto (global_State *g, Proto *f) {
   for (i = 0; i < f->sizelocvars; i++)  /* mark local-variable names */
     markobjectN(g, f->locvars[i].varname);
   return sizeof(Proto) + sizeof(Instruction) * f->sizecode +
+                         sizeof(unsigned int) * f->sizeicache +
                          sizeof(Proto *) * f->sizep +
                          sizeof(TValue) * f->sizek +
                          sizeof(int) * f->sizelineinfo +
@@ -638,14 +722,16 @@ static void convergeephemerons (global_State *g) {
 */
 static void clearkeys (global_State *g, GCObject *l, GCObject *f) {
   for (; l != f; l = gco2t(l)->gclist) {
-    Table *h = gco2t(l);
-    Node *n, *limit = gnodelast(h);
-    for (n = gnode(h, 0); n < limit; n++) {
-      if (!ttisnil(gval(n)) && (iscleared(g, gkey(n)))) {
-        setnilvalue(gval(n));  /* remove value ... */
+    Table *hp;
+    for (hp = gco2t(l); hp != NULL; hp = nexthash(hp)) {
+      Node *n, *limit = gnodelast(hp);
+      for (n = gnode(hp, 0); n < limit; n++) {
+        if (!ttisnil(gval(n)) && (iscleared(g, gkey(n)))) {
+          setnilvalue(gval(n));  /* remove value ... */
+        }
+        if (ttisnil(gval(n)))  /* is entry empty? */
+          removeentry(n);  /* remove entry from table */
       }
-      if (ttisnil(gval(n)))  /* is entry empty? */
-        removeentry(n);  /* remove entry from table */
     }
   }
 }
@@ -658,17 +744,30 @@ static void clearkeys (global_State *g, GCObject *l, GCObject *f) {
 static void clearvalues (global_State *g, GCObject *l, GCObject *f) {
   for (; l != f; l = gco2t(l)->gclist) {
     Table *h = gco2t(l);
-    Node *n, *limit = gnodelast(h);
+    Table *hp;
+    Node *n, *limit;
     unsigned int i;
-    for (i = 0; i < h->sizearray; i++) {
+    for (i = 0; i < sizevalarray(h); i++) {
       TValue *o = &h->array[i];
       if (iscleared(g, o))  /* value was collected? */
         setnilvalue(o);  /* remove value */
     }
-    for (n = gnode(h, 0); n < limit; n++) {
-      if (!ttisnil(gval(n)) && iscleared(g, gval(n))) {
-        setnilvalue(gval(n));  /* remove value ... */
-        removeentry(n);  /* and remove entry from table */
+#if defined(LUA_USE_SHAPES)
+    if (h->shape != NULL) {
+      for (i = 0; i < cast(unsigned int, h->shape->nkeys); i++) {
+        TValue *o = &h->slots[i];
+        if (iscleared(g, o))  /* value was collected? */
+          setnilvalue(o);  /* remove value (key stays in the shape) */
+      }
+    }
+#endif
+    for (hp = h; hp != NULL; hp = nexthash(hp)) {
+      limit = gnodelast(hp);
+      for (n = gnode(hp, 0); n < limit; n++) {
+        if (!ttisnil(gval(n)) && iscleared(g, gval(n))) {
+          setnilvalue(gval(n));  /* remove value ... */
+          removeentry(n);  /* and remove entry from table */
+        }
       }
     }
   }
@@ -716,6 +815,9 @@ static void freeobj (lua_State *L, GCObject *o) {
       luaM_freemem(L, o, sizelstring(gco2ts(o)->u.lnglen));
       break;
     }
+#if defined(LUA_USE_NANBOX)
+    case LUA_TNUMINT: luaM_freemem(L, o, sizeof(IntBox)); break;
+#endif
     default: lua_assert(0);
   }
 }
@@ -992,6 +1094,9 @@ static l_mem atomic (lua_State *L) {
   /* registry and global metatables may be changed by API */
   markvalue(g, &g->l_registry);
   markmt(g);  /* mark global metatables */
+#if defined(LUA_USE_SHAPES)
+  markshapes(g);
+#endif
   /* remark occasional upvalues of (maybe) dead threads */
   remarkupvals(g);
   propagateall(g);  /* propagate changes */
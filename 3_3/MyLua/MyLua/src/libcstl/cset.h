@@ -36,6 +36,9 @@ extern "C" {
 #include "cstl_avl_tree_iterator.h"
 #include "cstl_avl_tree_private.h"
 #include "cstl_avl_tree.h"
+#include "cstl_bp_tree_iterator.h"
+#include "cstl_bp_tree_private.h"
+#include "cstl_bp_tree.h"
 #include "cstl_rb_tree_iterator.h"
 #include "cstl_rb_tree_private.h"
 #include "cstl_rb_tree.h"
@@ -29,6 +29,8 @@
 #include "cfunctional.h"
 #include "calgorithm.h"
 
+#include "cstl_algo_nonmutating_aux.h"
+
 /** local constant declaration and local macro section **/
 
 /** local data type declaration and local struct, union, enum section **/
@@ -251,6 +253,11 @@ range_t algo_mismatch_if(
         bfun_op = _fun_get_binary(it_first1, _EQUAL_FUN);
     }
 
+    /* contiguous ranges of builtin integer type are compared as raw bytes */
+    if (_algo_mismatch_builtin(it_first1, it_last1, it_first2, bfun_op, &r_range)) {
+        return r_range;
+    }
+
     if (bfun_op == fun_default_binary) {
         bfun_op = _fun_get_binary(it_first1, _LESS_FUN);
         for (;
@@ -295,9 +302,10 @@ bool_t algo_equal(input_iterator_t it_first1, input_iterator_t it_last1, input_i
 bool_t algo_equal_if(
     input_iterator_t it_first1, input_iterator_t it_last1, input_iterator_t it_first2, bfun_t bfun_op)
 {
-    bool_t b_result = false;
-    bool_t b_less = false;
-    bool_t b_greater = false;
+    bool_t  b_result = false;
+    bool_t  b_less = false;
+    bool_t  b_greater = false;
+    range_t r_range;
 
     assert(_iterator_valid_range(it_first1, it_last1, _INPUT_ITERATOR));
     assert(_iterator_limit_type(it_first2, _INPUT_ITERATOR));
@@ -307,6 +315,11 @@ bool_t algo_equal_if(
         bfun_op = _fun_get_binary(it_first1, _EQUAL_FUN);
     }
 
+    /* contiguous ranges of builtin integer type are compared as raw bytes */
+    if (_algo_mismatch_builtin(it_first1, it_last1, it_first2, bfun_op, &r_range)) {
+        return iterator_equal(r_range.it_begin, it_last1);
+    }
+
     if (bfun_op == fun_default_binary) {
         bfun_op = _fun_get_binary(it_first1, _LESS_FUN);
         for (; !iterator_equal(it_first1, it_last1); it_first1 = iterator_next(it_first1), it_first2 = iterator_next(it_first2)) {
@@ -372,6 +385,10 @@ forward_iterator_t algo_search_if(
     if (t_len2 == 0) {
         return it_first1;
     }
+    /* contiguous ranges of builtin integer type are searched as raw bytes */
+    if (_algo_search_builtin(it_first1, it_last1, it_first2, it_last2, bfun_op, &it_index1)) {
+        return it_index1;
+    }
 
     if (bfun_op == fun_default_binary) {
         bfun_op = _fun_get_binary(it_first1, _LESS_FUN);
@@ -0,0 +1,619 @@
+/*
+ *  The implementation of non-mutating algorithm auxiliary functions.
+ *  Copyright (C)  2008 - 2014  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+/** include section **/
+#include "cstl_def.h"
+#include "cstl_alloc.h"
+#include "cstl_types.h"
+#include "citerator.h"
+#include "cstring.h"
+#include "cfunctional.h"
+#include "calgorithm.h"
+
+#include "cstl_algo_nonmutating_aux.h"
+
+/*
+ * SSE2 is the baseline of x86-64, AVX2 is selected at runtime. define CSTL_ALGO_NO_SIMD to use the scalar loop only.
+ */
+#ifndef CSTL_ALGO_NO_SIMD
+#if defined(_MSC_VER) && (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#include <intrin.h>
+#include <immintrin.h>
+#define _ALGO_SIMD_X86
+#define _ALGO_AVX2_TARGET
+#elif defined(__GNUC__) && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#include <immintrin.h>
+#define _ALGO_SIMD_X86
+#define _ALGO_AVX2_TARGET __attribute__((target("avx2")))
+#endif
+#endif
+
+/** local constant declaration and local macro section **/
+#define _ALGO_SIMD_WIDTH    32  /* the widest vector register in bytes */
+
+/** local data type declaration and local struct, union, enum section **/
+#ifdef _MSC_VER
+typedef unsigned __int64    _algo_word_t;
+#else
+typedef unsigned long long  _algo_word_t;
+#endif
+
+typedef enum _tagalgosimdlevel
+{
+    _ALGO_SIMD_UNKNOWN, _ALGO_SIMD_SSE2, _ALGO_SIMD_AVX2
+}_algo_simd_level_t;
+
+/* builtin integer type which can be compared as raw bytes */
+typedef struct _tagalgointeger
+{
+    bfun_t _bfun_equal;     /* builtin equal function of the type */
+    size_t _t_typesize;
+}_algo_integer_t;
+
+/** local function prototype section **/
+/**
+ * Get the element size of contiguous range when the elements can be compared as raw bytes.
+ * @param it_iter       Iterator of the range.
+ * @param bfun_op       Equal predicate.
+ * @return  The element size or 0 if the range must be compared by the generic way.
+ */
+static size_t _algo_get_builtin_integer_size(iterator_t it_iter, bfun_t bfun_op);
+
+/**
+ * Test two elements are equal as raw bytes.
+ * @param cpby_first    First element.
+ * @param cpby_second   Second element.
+ * @param t_typesize    Element size.
+ * @return  true if the two elements are equal, otherwise false.
+ */
+static bool_t _algo_raw_equal(const _byte_t* cpby_first, const _byte_t* cpby_second, size_t t_typesize);
+
+/**
+ * Locates the first element that equal to the value as raw bytes.
+ * @param cpby_first    First element.
+ * @param t_len         Element count.
+ * @param t_typesize    Element size.
+ * @param cpby_value    The value.
+ * @return  The index of the first matched element or t_len.
+ */
+static size_t _algo_raw_find(const _byte_t* cpby_first, size_t t_len, size_t t_typesize, const _byte_t* cpby_value);
+
+#ifdef _ALGO_SIMD_X86
+/**
+ * Get the vector instruction set supported by cpu, the result is cached.
+ * @return  SIMD level.
+ */
+static _algo_simd_level_t _algo_get_simd_level(void);
+
+/**
+ * Keep one bit at the first byte of each element whose all bytes are matched.
+ * @param n_mask        Byte mask.
+ * @param t_typesize    Element size.
+ * @return  Element mask.
+ */
+static unsigned int _algo_element_mask(unsigned int n_mask, size_t t_typesize);
+
+/**
+ * Index of the lowest set bit.
+ * @param n_mask        Mask, must not be 0.
+ * @return  Bit index.
+ */
+static size_t _algo_lowest_bit(unsigned int n_mask);
+
+/**
+ * Count of the set bits.
+ * @param n_mask        Mask.
+ * @return  Bit count.
+ */
+static size_t _algo_bit_count(unsigned int n_mask);
+
+/**
+ * Scan the whole vectors for the value, the tail of the range is left for the scalar loop.
+ * @param cpby_first    First element.
+ * @param t_len         Element count.
+ * @param t_typesize    Element size.
+ * @param cpby_pattern  The value repeated to the vector width.
+ * @return  Index of the first matched element, or index of the first element that is not scanned.
+ */
+static size_t _algo_find_sse2(const _byte_t* cpby_first, size_t t_len, size_t t_typesize, const _byte_t* cpby_pattern);
+static size_t _algo_find_avx2(const _byte_t* cpby_first, size_t t_len, size_t t_typesize, const _byte_t* cpby_pattern);
+
+/**
+ * Count the value in the whole vectors, the tail of the range is left for the scalar loop.
+ * @param cpby_first    First element.
+ * @param t_len         Element count.
+ * @param t_typesize    Element size.
+ * @param cpby_pattern  The value repeated to the vector width.
+ * @param pt_scanned    Set to the count of scanned elements.
+ * @return  Count of matched elements in the scanned elements.
+ */
+static size_t _algo_count_sse2(
+    const _byte_t* cpby_first, size_t t_len, size_t t_typesize, const _byte_t* cpby_pattern, size_t* pt_scanned);
+static size_t _algo_count_avx2(
+    const _byte_t* cpby_first, size_t t_len, size_t t_typesize, const _byte_t* cpby_pattern, size_t* pt_scanned);
+
+/**
+ * Compare the whole vectors of two ranges, the tail of the range is left for the scalar loop.
+ * @param cpby_first1   First element of the first range.
+ * @param cpby_first2   First element of the second range.
+ * @param t_len         Element count.
+ * @param t_typesize    Element size.
+ * @return  Index of the first different element, or index of the first element that is not compared.
+ */
+static size_t _algo_mismatch_sse2(const _byte_t* cpby_first1, const _byte_t* cpby_first2, size_t t_len, size_t t_typesize);
+static size_t _algo_mismatch_avx2(const _byte_t* cpby_first1, const _byte_t* cpby_first2, size_t t_len, size_t t_typesize);
+#endif /* _ALGO_SIMD_X86 */
+
+/** exported global variable definition section **/
+
+/** local global variable definition section **/
+static const _algo_integer_t _sgt_algo_integer[] = {
+    {fun_equal_char, sizeof(char)},
+    {fun_equal_uchar, sizeof(unsigned char)},
+    {fun_equal_short, sizeof(short)},
+    {fun_equal_ushort, sizeof(unsigned short)},
+    {fun_equal_int, sizeof(int)},
+    {fun_equal_uint, sizeof(unsigned int)},
+    {fun_equal_long, sizeof(long)},
+    {fun_equal_ulong, sizeof(unsigned long)},
+#ifndef _MSC_VER
+    {fun_equal_long_long, sizeof(long long)},
+    {fun_equal_ulong_long, sizeof(unsigned long long)}
+#endif
+};
+
+#ifdef _ALGO_SIMD_X86
+static _algo_simd_level_t _sgt_algo_simd_level = _ALGO_SIMD_UNKNOWN;
+#endif
+
+/** exported function implementation section **/
+/**
+ * Locates the first element that equal to specified value in contiguous range of C builtin integer type.
+ */
+bool_t _algo_find_builtin(
+    input_iterator_t it_first, input_iterator_t it_last, const void* cpv_value, bfun_t bfun_op, input_iterator_t* pit_result)
+{
+    size_t t_typesize = 0;
+    size_t t_len = 0;
+
+    assert(_iterator_valid_range(it_first, it_last, _INPUT_ITERATOR));
+    assert(cpv_value != NULL);
+    assert(pit_result != NULL);
+
+    if ((t_typesize = _algo_get_builtin_integer_size(it_first, bfun_op)) == 0) {
+        return false;
+    }
+
+    t_len = (_VECTOR_ITERATOR_COREPOS(it_last) - _VECTOR_ITERATOR_COREPOS(it_first)) / t_typesize;
+    *pit_result = iterator_next_n(it_first,
+        (int)_algo_raw_find(_VECTOR_ITERATOR_COREPOS(it_first), t_len, t_typesize, (const _byte_t*)cpv_value));
+    return true;
+}
+
+/**
+ * Counts the elements that equal to specified value in contiguous range of C builtin integer type.
+ */
+bool_t _algo_count_builtin(
+    input_iterator_t it_first, input_iterator_t it_last, const void* cpv_value, bfun_t bfun_op, size_t* pt_count)
+{
+    const _byte_t* cpby_first = NULL;
+    size_t         t_typesize = 0;
+    size_t         t_len = 0;
+    size_t         t_count = 0;
+    size_t         i = 0;
+#ifdef _ALGO_SIMD_X86
+    _byte_t        aby_pattern[_ALGO_SIMD_WIDTH];
+#endif
+
+    assert(_iterator_valid_range(it_first, it_last, _INPUT_ITERATOR));
+    assert(cpv_value != NULL);
+    assert(pt_count != NULL);
+
+    if ((t_typesize = _algo_get_builtin_integer_size(it_first, bfun_op)) == 0) {
+        return false;
+    }
+
+    cpby_first = _VECTOR_ITERATOR_COREPOS(it_first);
+    t_len = (_VECTOR_ITERATOR_COREPOS(it_last) - cpby_first) / t_typesize;
+#ifdef _ALGO_SIMD_X86
+    for (i = 0; i < _ALGO_SIMD_WIDTH; i += t_typesize) {
+        memcpy(aby_pattern + i, cpv_value, t_typesize);
+    }
+    if (_algo_get_simd_level() == _ALGO_SIMD_AVX2) {
+        t_count = _algo_count_avx2(cpby_first, t_len, t_typesize, aby_pattern, &i);
+    } else {
+        t_count = _algo_count_sse2(cpby_first, t_len, t_typesize, aby_pattern, &i);
+    }
+#endif
+    for (; i < t_len; ++i) {
+        if (_algo_raw_equal(cpby_first + i * t_typesize, (const _byte_t*)cpv_value, t_typesize)) {
+            t_count++;
+        }
+    }
+
+    *pt_count = t_count;
+    return true;
+}
+
+/**
+ * Locates the first position where two contiguous ranges of C builtin integer type differ.
+ */
+bool_t _algo_mismatch_builtin(
+    input_iterator_t it_first1, input_iterator_t it_last1, input_iterator_t it_first2, bfun_t bfun_op, range_t* pr_range)
+{
+    const _byte_t* cpby_first1 = NULL;
+    const _byte_t* cpby_first2 = NULL;
+    size_t         t_typesize = 0;
+    size_t         t_len = 0;
+    size_t         i = 0;
+
+    assert(_iterator_valid_range(it_first1, it_last1, _INPUT_ITERATOR));
+    assert(pr_range != NULL);
+
+    if ((t_typesize = _algo_get_builtin_integer_size(it_first1, bfun_op)) == 0 ||
+        _algo_get_builtin_integer_size(it_first2, bfun_op) != t_typesize) {
+        return false;
+    }
+
+    cpby_first1 = _VECTOR_ITERATOR_COREPOS(it_first1);
+    cpby_first2 = _VECTOR_ITERATOR_COREPOS(it_first2);
+    t_len = (_VECTOR_ITERATOR_COREPOS(it_last1) - cpby_first1) / t_typesize;
+#ifdef _ALGO_SIMD_X86
+    if (_algo_get_simd_level() == _ALGO_SIMD_AVX2) {
+        i = _algo_mismatch_avx2(cpby_first1, cpby_first2, t_len, t_typesize);
+    } else {
+        i = _algo_mismatch_sse2(cpby_first1, cpby_first2, t_len, t_typesize);
+    }
+#endif
+    for (; i < t_len; ++i) {
+        if (!_algo_raw_equal(cpby_first1 + i * t_typesize, cpby_first2 + i * t_typesize, t_typesize)) {
+            break;
+        }
+    }
+
+    pr_range->it_begin = iterator_next_n(it_first1, (int)i);
+    pr_range->it_end = iterator_next_n(it_first2, (int)i);
+    return true;
+}
+
+/**
+ * Searches for the first occurrence of a sequence in contiguous range of C builtin integer type.
+ */
+bool_t _algo_search_builtin(
+    forward_iterator_t it_first1, forward_iterator_t it_last1,
+    forward_iterator_t it_first2, forward_iterator_t it_last2, bfun_t bfun_op, forward_iterator_t* pit_result)
+{
+    const _byte_t* cpby_first1 = NULL;
+    const _byte_t* cpby_first2 = NULL;
+    size_t         t_typesize = 0;
+    size_t         t_len1 = 0;
+    size_t         t_len2 = 0;
+    size_t         t_pos = 0;
+
+    assert(_iterator_valid_range(it_first1, it_last1, _FORWARD_ITERATOR));
+    assert(_iterator_valid_range(it_first2, it_last2, _FORWARD_ITERATOR));
+    assert(pit_result != NULL);
+
+    if ((t_typesize = _algo_get_builtin_integer_size(it_first1, bfun_op)) == 0 ||
+        _algo_get_builtin_integer_size(it_first2, bfun_op) != t_typesize) {
+        return false;
+    }
+
+    cpby_first1 = _VECTOR_ITERATOR_COREPOS(it_first1);
+    cpby_first2 = _VECTOR_ITERATOR_COREPOS(it_first2);
+    t_len1 = (_VECTOR_ITERATOR_COREPOS(it_last1) - cpby_first1) / t_typesize;
+    t_len2 = (_VECTOR_ITERATOR_COREPOS(it_last2) - cpby_first2) / t_typesize;
+    assert(t_len2 > 0);
+
+    *pit_result = it_last1;
+    while (t_len1 - t_pos >= t_len2) {
+        /* locate the candidate by the first element of sequence, then compare the rest */
+        t_pos += _algo_raw_find(cpby_first1 + t_pos * t_typesize, t_len1 - t_len2 + 1 - t_pos, t_typesize, cpby_first2);
+        if (t_len1 - t_pos < t_len2) {
+            break;
+        }
+        if (memcmp(cpby_first1 + (t_pos + 1) * t_typesize, cpby_first2 + t_typesize, (t_len2 - 1) * t_typesize) == 0) {
+            *pit_result = iterator_next_n(it_first1, (int)t_pos);
+            break;
+        }
+        t_pos++;
+    }
+
+    return true;
+}
+
+/** local function implementation section **/
+/**
+ * Get the element size of contiguous range when the elements can be compared as raw bytes.
+ */
+static size_t _algo_get_builtin_integer_size(iterator_t it_iter, bfun_t bfun_op)
+{
+    size_t t_typesize = 0;
+    size_t i = 0;
+
+    if ((_ITERATOR_CONTAINER_TYPE(it_iter) != _VECTOR_CONTAINER &&
+         _ITERATOR_CONTAINER_TYPE(it_iter) != _BASIC_STRING_CONTAINER) ||
+        _iterator_get_typestyle(it_iter) != _TYPE_C_BUILTIN) {
+        return 0;
+    }
+
+    t_typesize = _iterator_get_typeinfo(it_iter)->_pt_type->_t_typesize;
+    if (t_typesize != 1 && t_typesize != 2 && t_typesize != 4 && t_typesize != 8) {
+        return 0;
+    }
+    for (i = 0; i < sizeof(_sgt_algo_integer) / sizeof(_sgt_algo_integer[0]); ++i) {
+        if (_sgt_algo_integer[i]._bfun_equal == bfun_op && _sgt_algo_integer[i]._t_typesize == t_typesize) {
+            return t_typesize;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Test two elements are equal as raw bytes.
+ */
+static bool_t _algo_raw_equal(const _byte_t* cpby_first, const _byte_t* cpby_second, size_t t_typesize)
+{
+    /* the elements of vector_t and basic_string_t are aligned for their type */
+    switch (t_typesize) {
+        case 1:  return *cpby_first == *cpby_second ? true : false;
+        case 2:  return *(unsigned short*)cpby_first == *(unsigned short*)cpby_second ? true : false;
+        case 4:  return *(unsigned int*)cpby_first == *(unsigned int*)cpby_second ? true : false;
+        default: return *(_algo_word_t*)cpby_first == *(_algo_word_t*)cpby_second ? true : false;
+    }
+}
+
+/**
+ * Locates the first element that equal to the value as raw bytes.
+ */
+static size_t _algo_raw_find(const _byte_t* cpby_first, size_t t_len, size_t t_typesize, const _byte_t* cpby_value)
+{
+    size_t  i = 0;
+#ifdef _ALGO_SIMD_X86
+    _byte_t aby_pattern[_ALGO_SIMD_WIDTH];
+#endif
+
+#ifdef _ALGO_SIMD_X86
+    /* repeat the value to the vector width, the element size always divides the width */
+    for (i = 0; i < _ALGO_SIMD_WIDTH; i += t_typesize) {
+        memcpy(aby_pattern + i, cpby_value, t_typesize);
+    }
+    if (_algo_get_simd_level() == _ALGO_SIMD_AVX2) {
+        i = _algo_find_avx2(cpby_first, t_len, t_typesize, aby_pattern);
+    } else {
+        i = _algo_find_sse2(cpby_first, t_len, t_typesize, aby_pattern);
+    }
+#endif
+    for (; i < t_len; ++i) {
+        if (_algo_raw_equal(cpby_first + i * t_typesize, cpby_value, t_typesize)) {
+            break;
+        }
+    }
+
+    return i;
+}
+
+#ifdef _ALGO_SIMD_X86
+/**
+ * Get the vector instruction set supported by cpu.
+ */
+static _algo_simd_level_t _algo_get_simd_level(void)
+{
+    if (_sgt_algo_simd_level == _ALGO_SIMD_UNKNOWN) {
+        bool_t b_avx2 = false;
+#ifdef _MSC_VER
+        int an_info[4];
+        __cpuid(an_info, 0);
+        if (an_info[0] >= 7) {
+            /* the os must save the ymm registers */
+            __cpuid(an_info, 1);
+            if ((an_info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 6) == 6) {
+                __cpuidex(an_info, 7, 0);
+                b_avx2 = (an_info[1] & (1 << 5)) != 0 ? true : false;
+            }
+        }
+#else
+        __builtin_cpu_init();
+        b_avx2 = __builtin_cpu_supports("avx2") ? true : false;
+#endif
+        _sgt_algo_simd_level = b_avx2 ? _ALGO_SIMD_AVX2 : _ALGO_SIMD_SSE2;
+    }
+
+    return _sgt_algo_simd_level;
+}
+
+/**
+ * Keep one bit at the first byte of each element whose all bytes are matched.
+ */
+static unsigned int _algo_element_mask(unsigned int n_mask, size_t t_typesize)
+{
+    switch (t_typesize) {
+        case 1:
+            return n_mask;
+        case 2:
+            return n_mask & (n_mask >> 1) & 0x55555555;
+        case 4:
+            n_mask &= n_mask >> 1;
+            return n_mask & (n_mask >> 2) & 0x11111111;
+        default:
+            n_mask &= n_mask >> 1;
+            n_mask &= n_mask >> 2;
+            return n_mask & (n_mask >> 4) & 0x01010101;
+    }
+}
+
+/**
+ * Index of the lowest set bit.
+ */
+static size_t _algo_lowest_bit(unsigned int n_mask)
+{
+#ifdef _MSC_VER
+    unsigned long ul_index = 0;
+    _BitScanForward(&ul_index, n_mask);
+    return ul_index;
+#else
+    return (size_t)__builtin_ctz(n_mask);
+#endif
+}
+
+/**
+ * Count of the set bits.
+ */
+static size_t _algo_bit_count(unsigned int n_mask)
+{
+    /* the popcnt instruction is not implied by SSE2 */
+    n_mask = n_mask - ((n_mask >> 1) & 0x55555555);
+    n_mask = (n_mask & 0x33333333) + ((n_mask >> 2) & 0x33333333);
+    return (((n_mask + (n_mask >> 4)) & 0x0f0f0f0f) * 0x01010101) >> 24;
+}
+
+/**
+ * Scan the whole vectors for the value by SSE2.
+ */
+static size_t _algo_find_sse2(const _byte_t* cpby_first, size_t t_len, size_t t_typesize, const _byte_t* cpby_pattern)
+{
+    __m128i      m_value = _mm_loadu_si128((const __m128i*)cpby_pattern);
+    size_t       t_bytes = t_len * t_typesize;
+    size_t       i = 0;
+    unsigned int n_mask = 0;
+
+    for (i = 0; i + sizeof(__m128i) <= t_bytes; i += sizeof(__m128i)) {
+        n_mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(cpby_first + i)), m_value));
+        if ((n_mask = _algo_element_mask(n_mask, t_typesize)) != 0) {
+            return (i + _algo_lowest_bit(n_mask)) / t_typesize;
+        }
+    }
+
+    return i / t_typesize;
+}
+
+/**
+ * Scan the whole vectors for the value by AVX2.
+ */
+_ALGO_AVX2_TARGET
+static size_t _algo_find_avx2(const _byte_t* cpby_first, size_t t_len, size_t t_typesize, const _byte_t* cpby_pattern)
+{
+    __m256i      m_value = _mm256_loadu_si256((const __m256i*)cpby_pattern);
+    size_t       t_bytes = t_len * t_typesize;
+    size_t       i = 0;
+    unsigned int n_mask = 0;
+
+    for (i = 0; i + sizeof(__m256i) <= t_bytes; i += sizeof(__m256i)) {
+        n_mask = (unsigned int)_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(cpby_first + i)), m_value));
+        if ((n_mask = _algo_element_mask(n_mask, t_typesize)) != 0) {
+            return (i + _algo_lowest_bit(n_mask)) / t_typesize;
+        }
+    }
+
+    return i / t_typesize;
+}
+
+/**
+ * Count the value in the whole vectors by SSE2.
+ */
+static size_t _algo_count_sse2(
+    const _byte_t* cpby_first, size_t t_len, size_t t_typesize, const _byte_t* cpby_pattern, size_t* pt_scanned)
+{
+    __m128i      m_value = _mm_loadu_si128((const __m128i*)cpby_pattern);
+    size_t       t_bytes = t_len * t_typesize;
+    size_t       t_count = 0;
+    size_t       i = 0;
+    unsigned int n_mask = 0;
+
+    for (i = 0; i + sizeof(__m128i) <= t_bytes; i += sizeof(__m128i)) {
+        n_mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(cpby_first + i)), m_value));
+        t_count += _algo_bit_count(_algo_element_mask(n_mask, t_typesize));
+    }
+
+    *pt_scanned = i / t_typesize;
+    return t_count;
+}
+
+/**
+ * Count the value in the whole vectors by AVX2.
+ */
+_ALGO_AVX2_TARGET
+static size_t _algo_count_avx2(
+    const _byte_t* cpby_first, size_t t_len, size_t t_typesize, const _byte_t* cpby_pattern, size_t* pt_scanned)
+{
+    __m256i      m_value = _mm256_loadu_si256((const __m256i*)cpby_pattern);
+    size_t       t_bytes = t_len * t_typesize;
+    size_t       t_count = 0;
+    size_t       i = 0;
+    unsigned int n_mask = 0;
+
+    for (i = 0; i + sizeof(__m256i) <= t_bytes; i += sizeof(__m256i)) {
+        n_mask = (unsigned int)_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(cpby_first + i)), m_value));
+        t_count += _algo_bit_count(_algo_element_mask(n_mask, t_typesize));
+    }
+
+    *pt_scanned = i / t_typesize;
+    return t_count;
+}
+
+/**
+ * Compare the whole vectors of two ranges by SSE2.
+ */
+static size_t _algo_mismatch_sse2(const _byte_t* cpby_first1, const _byte_t* cpby_first2, size_t t_len, size_t t_typesize)
+{
+    size_t       t_bytes = t_len * t_typesize;
+    size_t       i = 0;
+    unsigned int n_mask = 0;
+
+    for (i = 0; i + sizeof(__m128i) <= t_bytes; i += sizeof(__m128i)) {
+        n_mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(
+            _mm_loadu_si128((const __m128i*)(cpby_first1 + i)), _mm_loadu_si128((const __m128i*)(cpby_first2 + i))));
+        if (n_mask != 0xffff) {
+            return (i + _algo_lowest_bit(~n_mask)) / t_typesize;
+        }
+    }
+
+    return i / t_typesize;
+}
+
+/**
+ * Compare the whole vectors of two ranges by AVX2.
+ */
+_ALGO_AVX2_TARGET
+static size_t _algo_mismatch_avx2(const _byte_t* cpby_first1, const _byte_t* cpby_first2, size_t t_len, size_t t_typesize)
+{
+    size_t       t_bytes = t_len * t_typesize;
+    size_t       i = 0;
+    unsigned int n_mask = 0;
+
+    for (i = 0; i + sizeof(__m256i) <= t_bytes; i += sizeof(__m256i)) {
+        n_mask = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+            _mm256_loadu_si256((const __m256i*)(cpby_first1 + i)), _mm256_loadu_si256((const __m256i*)(cpby_first2 + i))));
+        if (n_mask != 0xffffffff) {
+            return (i + _algo_lowest_bit(~n_mask)) / t_typesize;
+        }
+    }
+
+    return i / t_typesize;
+}
+#endif /* _ALGO_SIMD_X86 */
+
+/** eof **/
+
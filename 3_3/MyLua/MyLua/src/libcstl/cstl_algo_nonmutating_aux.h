@@ -0,0 +1,102 @@
+/*
+ *  The auxiliary function of non-mutating algorithm.
+ *  Copyright (C)  2008 - 2014  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+#ifndef _CSTL_ALGO_NONMUTATING_AUX_H_
+#define _CSTL_ALGO_NONMUTATING_AUX_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** include section **/
+
+/** constant declaration and macro section **/
+
+/** data type declaration and struct, union, enum section **/
+
+/** exported global variable declaration section **/
+
+/** exported function prototype section **/
+/**
+ * Locates the first element that equal to specified value in contiguous range of C builtin integer type.
+ * @param it_first      An input iterator addressing the position of the first element in the range.
+ * @param it_last       An input iterator addressing the position one past the final element in the range.
+ * @param cpv_value     The value to be searched for.
+ * @param bfun_op       The equal predicate.
+ * @param pit_result    Set to the first occurrence of the value or it_last, only when the range is searched.
+ * @return  true if the range is searched, false if the range must be searched by the generic way.
+ * @remarks The range is searched only when it belongs to vector_t or basic_string_t, the element type is C builtin
+ *          integer type and bfun_op is the builtin equal function of that type. the elements are compared as raw
+ *          bytes by SSE2 or AVX2 when the cpu supports, otherwise by scalar loop.
+ */
+extern bool_t _algo_find_builtin(
+    input_iterator_t it_first, input_iterator_t it_last, const void* cpv_value, bfun_t bfun_op, input_iterator_t* pit_result);
+
+/**
+ * Counts the elements that equal to specified value in contiguous range of C builtin integer type.
+ * @param it_first      An input iterator addressing the position of the first element in the range.
+ * @param it_last       An input iterator addressing the position one past the final element in the range.
+ * @param cpv_value     The value to be counted.
+ * @param bfun_op       The equal predicate.
+ * @param pt_count      Set to the number of matched elements, only when the range is counted.
+ * @return  true if the range is counted, false if the range must be counted by the generic way.
+ * @remarks The same restriction as _algo_find_builtin().
+ */
+extern bool_t _algo_count_builtin(
+    input_iterator_t it_first, input_iterator_t it_last, const void* cpv_value, bfun_t bfun_op, size_t* pt_count);
+
+/**
+ * Locates the first position where two contiguous ranges of C builtin integer type differ.
+ * @param it_first1     An input iterator addressing the position of the first element in the first range.
+ * @param it_last1      An input iterator addressing the position one past the final element in the first range.
+ * @param it_first2     An input iterator addressing the position of the first element in the second range.
+ * @param bfun_op       The equal predicate.
+ * @param pr_range      Set to the mismatched positions of two ranges, only when the ranges are compared.
+ * @return  true if the ranges are compared, false if the ranges must be compared by the generic way.
+ * @remarks Both ranges must belong to vector_t or basic_string_t, other restriction is the same as _algo_find_builtin().
+ */
+extern bool_t _algo_mismatch_builtin(
+    input_iterator_t it_first1, input_iterator_t it_last1, input_iterator_t it_first2, bfun_t bfun_op, range_t* pr_range);
+
+/**
+ * Searches for the first occurrence of a sequence in contiguous range of C builtin integer type.
+ * @param it_first1     A forward iterator addressing the position of the first element in the range to be searched.
+ * @param it_last1      A forward iterator addressing the position one past the final element in the range to be searched.
+ * @param it_first2     A forward iterator addressing the position of the first element in the sequence to be matched.
+ * @param it_last2      A forward iterator addressing the position one past the final element in the sequence to be matched.
+ * @param bfun_op       The equal predicate.
+ * @param pit_result    Set to the first occurrence of the sequence or it_last1, only when the range is searched.
+ * @return  true if the range is searched, false if the range must be searched by the generic way.
+ * @remarks The first element of the sequence is located by _algo_find_builtin() way, and the rest are compared as
+ *          raw bytes. Both ranges must belong to vector_t or basic_string_t and the sequence must not be empty.
+ */
+extern bool_t _algo_search_builtin(
+    forward_iterator_t it_first1, forward_iterator_t it_last1,
+    forward_iterator_t it_first2, forward_iterator_t it_last2, bfun_t bfun_op, forward_iterator_t* pit_result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CSTL_ALGO_NONMUTATING_AUX_H_ */
+/** eof **/
+
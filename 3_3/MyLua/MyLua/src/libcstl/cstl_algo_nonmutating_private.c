@@ -29,6 +29,8 @@
 #include "cfunctional.h"
 #include "calgorithm.h"
 
+#include "cstl_algo_nonmutating_aux.h"
+
 /** local constant declaration and local macro section **/
 
 /** local data type declaration and local struct, union, enum section **/
@@ -73,6 +75,12 @@ input_iterator_t _algo_find_varg(input_iterator_t it_first, input_iterator_t it_
 
     bfun_op = _fun_get_binary(it_first, _EQUAL_FUN);
     assert(bfun_op != NULL);
+    /* contiguous range of builtin integer type is searched as raw bytes */
+    if (_algo_find_builtin(it_first, it_last, pv_value, bfun_op, &it_first)) {
+        _iterator_deallocate_destroy_elem(it_first, pv_value);
+        return it_first;
+    }
+
     if (bfun_op == fun_default_binary) {
         bfun_op = _fun_get_binary(it_first, _LESS_FUN);
         for (; !iterator_equal(it_first, it_last); it_first = iterator_next(it_first)) {
@@ -145,6 +153,12 @@ size_t _algo_count_varg(input_iterator_t it_first, input_iterator_t it_last, va_
 
     bfun_op = _fun_get_binary(it_first, _EQUAL_FUN);
     assert(bfun_op != NULL);
+    /* contiguous range of builtin integer type is counted as raw bytes */
+    if (_algo_count_builtin(it_first, it_last, pv_value, bfun_op, &t_count)) {
+        _iterator_deallocate_destroy_elem(it_first, pv_value);
+        return t_count;
+    }
+
     if (bfun_op == fun_default_binary) {
         bfun_op = _fun_get_binary(it_first, _LESS_FUN);
         for (; !iterator_equal(it_first, it_last); it_first = iterator_next(it_first)) {
@@ -199,9 +199,13 @@ void algo_sort_if(random_access_iterator_t it_first, random_access_iterator_t it
     }
 
     if (!iterator_equal(it_first, it_last)) {
-        pv_value = _iterator_allocate_init_elem(it_first);
-
         t_len = iterator_distance(it_first, it_last);
+        /* contiguous builtin scalar range is sorted as raw keys */
+        if (t_len > _CSTL_ALGO_SORT_THRESHOLD && _algo_sort_builtin(it_first, it_last, bfun_op)) {
+            return;
+        }
+
+        pv_value = _iterator_allocate_init_elem(it_first);
         if (t_len > _CSTL_ALGO_SORT_THRESHOLD) {
             _algo_intro_sort_if(it_first, it_last, bfun_op, _algo_lg(t_len)*2, pv_value);
         } else {
@@ -244,6 +248,9 @@ output_iterator_t algo_merge_if(
     if (bfun_op == NULL) {
         bfun_op = _fun_get_binary(it_first1, _LESS_FUN);
     }
+    if (_algo_set_builtin(it_first1, it_last1, it_first2, it_last2, it_result, bfun_op, _ALGO_SET_MERGE, &it_result)) {
+        return it_result;
+    }
 
     while (!iterator_equal(it_first1, it_last1) && !iterator_equal(it_first2, it_last2)) {
         (*bfun_op)(iterator_get_pointer(it_first2), iterator_get_pointer(it_first1), &b_cmp);
@@ -535,6 +542,9 @@ output_iterator_t algo_set_union_if(
     if (bfun_op == NULL) {
         bfun_op = _fun_get_binary(it_first1, _LESS_FUN);
     }
+    if (_algo_set_builtin(it_first1, it_last1, it_first2, it_last2, it_result, bfun_op, _ALGO_SET_UNION, &it_result)) {
+        return it_result;
+    }
     while (!iterator_equal(it_first1, it_last1) && !iterator_equal(it_first2, it_last2)) {
         (*bfun_op)(iterator_get_pointer(it_first1), iterator_get_pointer(it_first2), &b_cmp);
         if (b_cmp) {        /* it_first1 < it_first2 */
@@ -589,6 +599,9 @@ output_iterator_t algo_set_intersection_if(
     if (bfun_op == NULL) {
         bfun_op = _fun_get_binary(it_first1, _LESS_FUN);
     }
+    if (_algo_set_builtin(it_first1, it_last1, it_first2, it_last2, it_result, bfun_op, _ALGO_SET_INTERSECTION, &it_result)) {
+        return it_result;
+    }
     while (!iterator_equal(it_first1, it_last1) && !iterator_equal(it_first2, it_last2)) {
         (*bfun_op)(iterator_get_pointer(it_first1), iterator_get_pointer(it_first2), &b_cmp);
         if (b_cmp) {        /* it_first1 < it_first2 */
@@ -641,6 +654,9 @@ output_iterator_t algo_set_difference_if(
     if (bfun_op == NULL) {
         bfun_op = _fun_get_binary(it_first1, _LESS_FUN);
     }
+    if (_algo_set_builtin(it_first1, it_last1, it_first2, it_last2, it_result, bfun_op, _ALGO_SET_DIFFERENCE, &it_result)) {
+        return it_result;
+    }
     while (!iterator_equal(it_first1, it_last1) && !iterator_equal(it_first2, it_last2)) {
         (*bfun_op)(iterator_get_pointer(it_first1), iterator_get_pointer(it_first2), &b_cmp);
         if (b_cmp) {        /* it_first1 < it_first2 */
@@ -693,6 +709,9 @@ output_iterator_t algo_set_symmetric_difference_if(
     if (bfun_op == NULL) {
         bfun_op = _fun_get_binary(it_first1, _LESS_FUN);
     }
+    if (_algo_set_builtin(it_first1, it_last1, it_first2, it_last2, it_result, bfun_op, _ALGO_SET_SYMMETRIC_DIFFERENCE, &it_result)) {
+        return it_result;
+    }
     while (!iterator_equal(it_first1, it_last1) && !iterator_equal(it_first2, it_last2)) {
         (*bfun_op)(iterator_get_pointer(it_first1), iterator_get_pointer(it_first2), &b_cmp);
         if (b_cmp) {        /* it_first1 < it_first2 */
@@ -32,14 +32,262 @@
 #include "cstl_algo_sorting_aux.h"
 
 /** local constant declaration and local macro section **/
+#define _ALGO_KEY_SORT_THRESHOLD    16   /* the threshold of insertion sort and quick sort for keys */
+#define _ALGO_KEY_RADIX_THRESHOLD   256  /* the threshold of intro sort and radix sort for keys */
+#define _ALGO_KEY_RADIX_BITS        8
+#define _ALGO_KEY_RADIX_BUCKETS     (1 << _ALGO_KEY_RADIX_BITS)
+#define _ALGO_KEY_RADIX_MASK        (_ALGO_KEY_RADIX_BUCKETS - 1)
+#define _ALGO_KEY_BYTES             sizeof(_algo_key_t)
+#define _ALGO_SET_GALLOP_RATIO      16   /* gallop when one range is this times longer than the other */
+
+/* t_first is before t_second in the order of the range, the range is in descending order when b_greater is true */
+#define _ALGO_SET_LESS(t_first, t_second, b_greater)    ((b_greater) ? (t_second) < (t_first) : (t_first) < (t_second))
+
+/*
+ * The set operations of one element type. _algo_set_bound_##suffix finds the first position from t_pos that is not
+ * before t_value (or after t_value when b_upper is true), by doubling steps then binary search when b_gallop is true.
+ */
+#define _ALGO_SET_KERNEL(suffix, type_t)\
+    static size_t _algo_set_bound_##suffix(\
+        const type_t* cpt_first, size_t t_pos, size_t t_len, type_t t_value, bool_t b_greater, bool_t b_upper, bool_t b_gallop)\
+    {\
+        size_t t_low = t_pos;\
+        size_t t_high = t_pos;\
+        size_t t_step = 1;\
+        size_t t_mid = 0;\
+        if (!b_gallop) {\
+            while (t_pos < t_len && (b_upper ? !_ALGO_SET_LESS(t_value, cpt_first[t_pos], b_greater) :\
+                                                _ALGO_SET_LESS(cpt_first[t_pos], t_value, b_greater))) {\
+                t_pos++;\
+            }\
+            return t_pos;\
+        }\
+        while (t_high < t_len && (b_upper ? !_ALGO_SET_LESS(t_value, cpt_first[t_high], b_greater) :\
+                                             _ALGO_SET_LESS(cpt_first[t_high], t_value, b_greater))) {\
+            t_low = t_high + 1;\
+            t_high = t_len - t_high > t_step ? t_high + t_step : t_len;\
+            t_step *= 2;\
+        }\
+        while (t_low < t_high) {\
+            t_mid = t_low + (t_high - t_low) / 2;\
+            if (b_upper ? !_ALGO_SET_LESS(t_value, cpt_first[t_mid], b_greater) :\
+                           _ALGO_SET_LESS(cpt_first[t_mid], t_value, b_greater)) {\
+                t_low = t_mid + 1;\
+            } else {\
+                t_high = t_mid;\
+            }\
+        }\
+        return t_low;\
+    }\
+    static void _algo_set_##suffix(\
+        const _byte_t* cpby_first1, size_t t_len1, const _byte_t* cpby_first2, size_t t_len2,\
+        bool_t b_greater, _algo_set_op_t t_op, _algo_set_output_t* pt_output)\
+    {\
+        const type_t* cpt_first1 = (const type_t*)cpby_first1;\
+        const type_t* cpt_first2 = (const type_t*)cpby_first2;\
+        bool_t        b_gallop = t_len1 / _ALGO_SET_GALLOP_RATIO > t_len2 || t_len2 / _ALGO_SET_GALLOP_RATIO > t_len1;\
+        size_t        t_pos1 = 0;\
+        size_t        t_pos2 = 0;\
+        size_t        t_next = 0;\
+        while (t_pos1 < t_len1 && t_pos2 < t_len2) {\
+            if (t_op == _ALGO_SET_MERGE) {\
+                if (!_ALGO_SET_LESS(cpt_first2[t_pos2], cpt_first1[t_pos1], b_greater)) {\
+                    t_next = _algo_set_bound_##suffix(cpt_first1, t_pos1, t_len1, cpt_first2[t_pos2], b_greater, true, b_gallop);\
+                    _algo_set_emit(pt_output, (const _byte_t*)(cpt_first1 + t_pos1), t_next - t_pos1);\
+                    t_pos1 = t_next;\
+                } else {\
+                    t_next = _algo_set_bound_##suffix(cpt_first2, t_pos2, t_len2, cpt_first1[t_pos1], b_greater, false, b_gallop);\
+                    _algo_set_emit(pt_output, (const _byte_t*)(cpt_first2 + t_pos2), t_next - t_pos2);\
+                    t_pos2 = t_next;\
+                }\
+            } else if (_ALGO_SET_LESS(cpt_first1[t_pos1], cpt_first2[t_pos2], b_greater)) {\
+                t_next = _algo_set_bound_##suffix(cpt_first1, t_pos1, t_len1, cpt_first2[t_pos2], b_greater, false, b_gallop);\
+                if (t_op != _ALGO_SET_INTERSECTION) {\
+                    _algo_set_emit(pt_output, (const _byte_t*)(cpt_first1 + t_pos1), t_next - t_pos1);\
+                }\
+                t_pos1 = t_next;\
+            } else if (_ALGO_SET_LESS(cpt_first2[t_pos2], cpt_first1[t_pos1], b_greater)) {\
+                t_next = _algo_set_bound_##suffix(cpt_first2, t_pos2, t_len2, cpt_first1[t_pos1], b_greater, false, b_gallop);\
+                if (t_op == _ALGO_SET_UNION || t_op == _ALGO_SET_SYMMETRIC_DIFFERENCE) {\
+                    _algo_set_emit(pt_output, (const _byte_t*)(cpt_first2 + t_pos2), t_next - t_pos2);\
+                }\
+                t_pos2 = t_next;\
+            } else {\
+                if (t_op == _ALGO_SET_UNION || t_op == _ALGO_SET_INTERSECTION) {\
+                    if (pt_output->_pby_result != NULL) {\
+                        *(type_t*)pt_output->_pby_result = cpt_first1[t_pos1];\
+                        pt_output->_pby_result += sizeof(type_t);\
+                        pt_output->_t_count++;\
+                    } else {\
+                        _algo_set_emit(pt_output, (const _byte_t*)(cpt_first1 + t_pos1), 1);\
+                    }\
+                }\
+                t_pos1++;\
+                t_pos2++;\
+            }\
+        }\
+        if (t_op != _ALGO_SET_INTERSECTION) {\
+            _algo_set_emit(pt_output, (const _byte_t*)(cpt_first1 + t_pos1), t_len1 - t_pos1);\
+            if (t_op != _ALGO_SET_DIFFERENCE) {\
+                _algo_set_emit(pt_output, (const _byte_t*)(cpt_first2 + t_pos2), t_len2 - t_pos2);\
+            }\
+        }\
+    }
 
 /** local data type declaration and local struct, union, enum section **/
+#ifdef _MSC_VER
+typedef unsigned __int64    _algo_key_t;
+typedef __int64             _algo_skey_t;
+#else
+typedef unsigned long long  _algo_key_t;
+typedef long long           _algo_skey_t;
+#endif
+
+typedef enum _tagalgoscalarkind
+{
+    _ALGO_SCALAR_SIGNED, _ALGO_SCALAR_UNSIGNED, _ALGO_SCALAR_FLOAT
+}_algo_scalar_kind_t;
+
+/* builtin scalar type which can be sorted as raw key */
+typedef struct _tagalgoscalar
+{
+    bfun_t              _bfun_less;     /* builtin less function of the type */
+    bfun_t              _bfun_greater;  /* builtin greater function of the type */
+    size_t              _t_typesize;
+    _algo_scalar_kind_t _t_kind;
+}_algo_scalar_t;
+
+/* the destination range of set operations */
+typedef struct _tagalgosetoutput
+{
+    output_iterator_t _it_result;   /* the next position if destination range is not contiguous */
+    _byte_t*          _pby_result;  /* the next position if destination range is contiguous, else NULL */
+    size_t            _t_typesize;
+    size_t            _t_count;     /* element count that is written */
+}_algo_set_output_t;
+
+/* the set operations of builtin integer type */
+typedef struct _tagalgosetkernel
+{
+    size_t _t_typesize;
+    bool_t _b_signed;
+    void (*_pfun_set)(
+        const _byte_t* cpby_first1, size_t t_len1, const _byte_t* cpby_first2, size_t t_len2,
+        bool_t b_greater, _algo_set_op_t t_op, _algo_set_output_t* pt_output);
+}_algo_set_kernel_t;
 
 /** local function prototype section **/
+/**
+ * Get the builtin scalar type for the predicate.
+ * @param bfun_op       Predicate.
+ * @param t_typesize    Element type size.
+ * @param pb_greater    Set true if the predicate is greater function.
+ * @return  The builtin scalar type or NULL if the predicate is not a builtin less or greater function.
+ */
+static const _algo_scalar_t* _algo_get_builtin_scalar(bfun_t bfun_op, size_t t_typesize, bool_t* pb_greater);
+
+/**
+ * Convert element to unsigned key, the order of keys is the order of elements.
+ * @param cpby_elem     Element.
+ * @param cpt_scalar    Element type.
+ * @param b_greater     Convert for descending order.
+ * @return  The key.
+ */
+static _algo_key_t _algo_load_key(const _byte_t* cpby_elem, const _algo_scalar_t* cpt_scalar, bool_t b_greater);
+
+/**
+ * Convert key back to element.
+ * @param pby_elem      Element.
+ * @param cpt_scalar    Element type.
+ * @param b_greater     Key is converted for descending order.
+ * @param t_key         The key.
+ * @return  void.
+ */
+static void _algo_store_key(_byte_t* pby_elem, const _algo_scalar_t* cpt_scalar, bool_t b_greater, _algo_key_t t_key);
+
+/**
+ * LSD radix sort for keys, the passes that all keys have the same digit are skipped.
+ * @param pt_key        Keys.
+ * @param pt_buffer     Buffer which size is same as keys.
+ * @param t_len         Key count.
+ * @param t_bytes       Significant bytes of keys.
+ * @return  The sorted keys, pt_key or pt_buffer.
+ */
+static _algo_key_t* _algo_radix_sort_key(_algo_key_t* pt_key, _algo_key_t* pt_buffer, size_t t_len, size_t t_bytes);
+
+/**
+ * Intro sort for keys, the range is left partially sorted for the last insertion sort.
+ * @param pt_first      First key.
+ * @param pt_last       Last key.
+ * @param t_depth       Range depth.
+ * @return  void.
+ */
+static void _algo_intro_sort_key(_algo_key_t* pt_first, _algo_key_t* pt_last, size_t t_depth);
+
+/**
+ * Heap sort for keys.
+ * @param pt_key        Keys.
+ * @param t_len         Key count.
+ * @return  void.
+ */
+static void _algo_heap_sort_key(_algo_key_t* pt_key, size_t t_len);
+
+/**
+ * Insertion sort for keys.
+ * @param pt_key        Keys.
+ * @param t_len         Key count.
+ * @return  void.
+ */
+static void _algo_insertion_sort_key(_algo_key_t* pt_key, size_t t_len);
+
+/**
+ * Write elements to the destination range of set operations.
+ * @param pt_output     Destination range.
+ * @param cpby_elem     First element.
+ * @param t_count       Element count.
+ * @return  void.
+ */
+static void _algo_set_emit(_algo_set_output_t* pt_output, const _byte_t* cpby_elem, size_t t_count);
 
 /** exported global variable definition section **/
 
 /** local global variable definition section **/
+static const _algo_scalar_t _sgt_algo_scalar[] = {
+    {fun_less_char, fun_greater_char, sizeof(char), (char)-1 < 0 ? _ALGO_SCALAR_SIGNED : _ALGO_SCALAR_UNSIGNED},
+    {fun_less_uchar, fun_greater_uchar, sizeof(unsigned char), _ALGO_SCALAR_UNSIGNED},
+    {fun_less_short, fun_greater_short, sizeof(short), _ALGO_SCALAR_SIGNED},
+    {fun_less_ushort, fun_greater_ushort, sizeof(unsigned short), _ALGO_SCALAR_UNSIGNED},
+    {fun_less_int, fun_greater_int, sizeof(int), _ALGO_SCALAR_SIGNED},
+    {fun_less_uint, fun_greater_uint, sizeof(unsigned int), _ALGO_SCALAR_UNSIGNED},
+    {fun_less_long, fun_greater_long, sizeof(long), _ALGO_SCALAR_SIGNED},
+    {fun_less_ulong, fun_greater_ulong, sizeof(unsigned long), _ALGO_SCALAR_UNSIGNED},
+#ifndef _MSC_VER
+    {fun_less_long_long, fun_greater_long_long, sizeof(long long), _ALGO_SCALAR_SIGNED},
+    {fun_less_ulong_long, fun_greater_ulong_long, sizeof(unsigned long long), _ALGO_SCALAR_UNSIGNED},
+#endif
+    {fun_less_float, fun_greater_float, sizeof(float), _ALGO_SCALAR_FLOAT},
+    {fun_less_double, fun_greater_double, sizeof(double), _ALGO_SCALAR_FLOAT}
+};
+
+_ALGO_SET_KERNEL(s8, signed char)
+_ALGO_SET_KERNEL(u8, unsigned char)
+_ALGO_SET_KERNEL(s16, short)
+_ALGO_SET_KERNEL(u16, unsigned short)
+_ALGO_SET_KERNEL(s32, int)
+_ALGO_SET_KERNEL(u32, unsigned int)
+_ALGO_SET_KERNEL(s64, _algo_skey_t)
+_ALGO_SET_KERNEL(u64, _algo_key_t)
+
+static const _algo_set_kernel_t _sgt_algo_set_kernel[] = {
+    {sizeof(signed char), true, _algo_set_s8},
+    {sizeof(unsigned char), false, _algo_set_u8},
+    {sizeof(short), true, _algo_set_s16},
+    {sizeof(unsigned short), false, _algo_set_u16},
+    {sizeof(int), true, _algo_set_s32},
+    {sizeof(unsigned int), false, _algo_set_u32},
+    {sizeof(_algo_skey_t), true, _algo_set_s64},
+    {sizeof(_algo_key_t), false, _algo_set_u64}
+};
 
 /** exported function implementation section **/
 /**
@@ -260,5 +508,435 @@ void _algo_intro_sort_if(
     _algo_intro_sort_if(it_pivot, it_last, bfun_op, t_depth, pv_value);
 }
 
+/**
+ * Sort a contiguous range of C builtin scalar type directly.
+ */
+bool_t _algo_sort_builtin(random_access_iterator_t it_first, random_access_iterator_t it_last, bfun_t bfun_op)
+{
+    const _algo_scalar_t* cpt_scalar = NULL;
+    bool_t                b_greater = false;
+    _byte_t*              pby_elem = NULL;
+    _algo_key_t*          pt_key = NULL;
+    _algo_key_t*          pt_result = NULL;
+    size_t                t_len = 0;
+    size_t                i = 0;
+
+    assert(_iterator_valid_range(it_first, it_last, _RANDOM_ACCESS_ITERATOR));
+    assert(bfun_op != NULL);
+
+    if ((_ITERATOR_CONTAINER_TYPE(it_first) != _VECTOR_CONTAINER &&
+         _ITERATOR_CONTAINER_TYPE(it_first) != _BASIC_STRING_CONTAINER) ||
+        _iterator_get_typestyle(it_first) != _TYPE_C_BUILTIN) {
+        return false;
+    }
+    cpt_scalar = _algo_get_builtin_scalar(bfun_op, _iterator_get_typeinfo(it_first)->_pt_type->_t_typesize, &b_greater);
+    if (cpt_scalar == NULL) {
+        return false;
+    }
+
+    t_len = iterator_distance(it_first, it_last);
+    if (t_len < 2) {
+        return true;
+    }
+    /* the radix sort needs another buffer for keys */
+    pt_key = (_algo_key_t*)malloc(sizeof(_algo_key_t) * t_len * (t_len >= _ALGO_KEY_RADIX_THRESHOLD ? 2 : 1));
+    if (pt_key == NULL) {
+        return false;
+    }
+
+    /* vector_t and basic_string_t iterators point to the element directly */
+    pby_elem = _VECTOR_ITERATOR_COREPOS(it_first);
+    for (i = 0; i < t_len; ++i, pby_elem += cpt_scalar->_t_typesize) {
+        pt_key[i] = _algo_load_key(pby_elem, cpt_scalar, b_greater);
+    }
+
+    if (t_len >= _ALGO_KEY_RADIX_THRESHOLD) {
+        pt_result = _algo_radix_sort_key(pt_key, pt_key + t_len, t_len, cpt_scalar->_t_typesize);
+    } else {
+        _algo_intro_sort_key(pt_key, pt_key + t_len, _algo_lg(t_len) * 2);
+        _algo_insertion_sort_key(pt_key, t_len);
+        pt_result = pt_key;
+    }
+
+    pby_elem = _VECTOR_ITERATOR_COREPOS(it_first);
+    for (i = 0; i < t_len; ++i, pby_elem += cpt_scalar->_t_typesize) {
+        _algo_store_key(pby_elem, cpt_scalar, b_greater, pt_result[i]);
+    }
+
+    free(pt_key);
+    return true;
+}
+
+/**
+ * Merge, unite, intersect or difference two sorted contiguous ranges of C builtin integer type directly.
+ */
+bool_t _algo_set_builtin(
+    input_iterator_t it_first1, input_iterator_t it_last1, input_iterator_t it_first2, input_iterator_t it_last2,
+    output_iterator_t it_result, bfun_t bfun_op, _algo_set_op_t t_op, output_iterator_t* pit_result)
+{
+    const _algo_scalar_t*     cpt_scalar = NULL;
+    const _algo_set_kernel_t* cpt_kernel = NULL;
+    _algo_set_output_t        t_output;
+    bool_t                    b_greater = false;
+    size_t                    t_typesize = 0;
+    size_t                    i = 0;
+
+    assert(_iterator_valid_range(it_first1, it_last1, _INPUT_ITERATOR));
+    assert(_iterator_valid_range(it_first2, it_last2, _INPUT_ITERATOR));
+    assert(pit_result != NULL);
+
+    if ((_ITERATOR_CONTAINER_TYPE(it_first1) != _VECTOR_CONTAINER &&
+         _ITERATOR_CONTAINER_TYPE(it_first1) != _BASIC_STRING_CONTAINER) ||
+        (_ITERATOR_CONTAINER_TYPE(it_first2) != _VECTOR_CONTAINER &&
+         _ITERATOR_CONTAINER_TYPE(it_first2) != _BASIC_STRING_CONTAINER) ||
+        _iterator_get_typestyle(it_first1) != _TYPE_C_BUILTIN || bfun_op == NULL) {
+        return false;
+    }
+    t_typesize = _iterator_get_typeinfo(it_first1)->_pt_type->_t_typesize;
+    cpt_scalar = _algo_get_builtin_scalar(bfun_op, t_typesize, &b_greater);
+    /* the builtin predicates of floating point type compare with epsilon, so they are left to the generic way */
+    if (cpt_scalar == NULL || cpt_scalar->_t_kind == _ALGO_SCALAR_FLOAT) {
+        return false;
+    }
+    for (i = 0; i < sizeof(_sgt_algo_set_kernel) / sizeof(_sgt_algo_set_kernel[0]); ++i) {
+        if (_sgt_algo_set_kernel[i]._t_typesize == t_typesize &&
+            _sgt_algo_set_kernel[i]._b_signed == (cpt_scalar->_t_kind == _ALGO_SCALAR_SIGNED)) {
+            cpt_kernel = &_sgt_algo_set_kernel[i];
+            break;
+        }
+    }
+    if (cpt_kernel == NULL) {
+        return false;
+    }
+
+    t_output._it_result = it_result;
+    t_output._pby_result = NULL;
+    t_output._t_typesize = t_typesize;
+    t_output._t_count = 0;
+    if (_ITERATOR_CONTAINER_TYPE(it_result) == _VECTOR_CONTAINER ||
+        _ITERATOR_CONTAINER_TYPE(it_result) == _BASIC_STRING_CONTAINER) {
+        t_output._pby_result = _VECTOR_ITERATOR_COREPOS(it_result);
+    }
+
+    /* vector_t and basic_string_t iterators point to the element directly */
+    cpt_kernel->_pfun_set(
+        _VECTOR_ITERATOR_COREPOS(it_first1), iterator_distance(it_first1, it_last1),
+        _VECTOR_ITERATOR_COREPOS(it_first2), iterator_distance(it_first2, it_last2), b_greater, t_op, &t_output);
+
+    *pit_result = t_output._pby_result != NULL ? iterator_next_n(it_result, (int)t_output._t_count) : t_output._it_result;
+    return true;
+}
+
+/** local function implementation section **/
+/**
+ * Get the builtin scalar type for the predicate.
+ */
+static const _algo_scalar_t* _algo_get_builtin_scalar(bfun_t bfun_op, size_t t_typesize, bool_t* pb_greater)
+{
+    size_t i = 0;
+
+    assert(pb_greater != NULL);
+
+    for (i = 0; i < sizeof(_sgt_algo_scalar) / sizeof(_sgt_algo_scalar[0]); ++i) {
+        if (_sgt_algo_scalar[i]._t_typesize != t_typesize || t_typesize > _ALGO_KEY_BYTES) {
+            continue;
+        }
+        if (_sgt_algo_scalar[i]._bfun_less == bfun_op || _sgt_algo_scalar[i]._bfun_greater == bfun_op) {
+            /* the float keys are converted from the IEEE 754 single or double format */
+            if (_sgt_algo_scalar[i]._t_kind == _ALGO_SCALAR_FLOAT &&
+                t_typesize != sizeof(unsigned int) && t_typesize != sizeof(_algo_key_t)) {
+                return NULL;
+            }
+            *pb_greater = _sgt_algo_scalar[i]._bfun_greater == bfun_op ? true : false;
+            return &_sgt_algo_scalar[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Convert element to unsigned key.
+ */
+static _algo_key_t _algo_load_key(const _byte_t* cpby_elem, const _algo_scalar_t* cpt_scalar, bool_t b_greater)
+{
+    _algo_key_t  t_key = 0;
+    _algo_key_t  t_sign = (_algo_key_t)1 << (cpt_scalar->_t_typesize * 8 - 1);
+    _algo_key_t  t_mask = t_sign | (t_sign - 1);
+    unsigned int n_bits = 0;
+
+    switch (cpt_scalar->_t_kind) {
+        case _ALGO_SCALAR_SIGNED:
+            switch (cpt_scalar->_t_typesize) {
+                case 1:  t_key = (_algo_key_t)(_algo_skey_t)*(signed char*)cpby_elem;  break;
+                case 2:  t_key = (_algo_key_t)(_algo_skey_t)*(short*)cpby_elem;        break;
+                case 4:  t_key = (_algo_key_t)(_algo_skey_t)*(int*)cpby_elem;          break;
+                default: t_key = (_algo_key_t)*(_algo_skey_t*)cpby_elem;               break;
+            }
+            /* move the sign bit so that negative numbers are before positive numbers */
+            t_key = (t_key ^ t_sign) & t_mask;
+            break;
+        case _ALGO_SCALAR_UNSIGNED:
+            switch (cpt_scalar->_t_typesize) {
+                case 1:  t_key = *(unsigned char*)cpby_elem;    break;
+                case 2:  t_key = *(unsigned short*)cpby_elem;   break;
+                case 4:  t_key = *(unsigned int*)cpby_elem;     break;
+                default: t_key = *(_algo_key_t*)cpby_elem;      break;
+            }
+            break;
+        case _ALGO_SCALAR_FLOAT:
+            if (cpt_scalar->_t_typesize == sizeof(unsigned int)) {
+                memcpy(&n_bits, cpby_elem, sizeof(unsigned int));
+                t_key = n_bits;
+            } else {
+                memcpy(&t_key, cpby_elem, sizeof(_algo_key_t));
+            }
+            /* flip all bits of negative numbers and the sign bit of positive numbers */
+            t_key = (t_key & t_sign) != 0 ? ~t_key & t_mask : t_key | t_sign;
+            break;
+        default:
+            assert(false);
+            break;
+    }
+
+    return b_greater ? ~t_key & t_mask : t_key;
+}
+
+/**
+ * Convert key back to element.
+ */
+static void _algo_store_key(_byte_t* pby_elem, const _algo_scalar_t* cpt_scalar, bool_t b_greater, _algo_key_t t_key)
+{
+    _algo_key_t  t_sign = (_algo_key_t)1 << (cpt_scalar->_t_typesize * 8 - 1);
+    _algo_key_t  t_mask = t_sign | (t_sign - 1);
+    unsigned int n_bits = 0;
+
+    if (b_greater) {
+        t_key = ~t_key & t_mask;
+    }
+
+    switch (cpt_scalar->_t_kind) {
+        case _ALGO_SCALAR_SIGNED:
+            t_key ^= t_sign;
+            switch (cpt_scalar->_t_typesize) {
+                case 1:  *(signed char*)pby_elem = (signed char)t_key;  break;
+                case 2:  *(short*)pby_elem = (short)t_key;              break;
+                case 4:  *(int*)pby_elem = (int)t_key;                  break;
+                default: *(_algo_skey_t*)pby_elem = (_algo_skey_t)t_key; break;
+            }
+            break;
+        case _ALGO_SCALAR_UNSIGNED:
+            switch (cpt_scalar->_t_typesize) {
+                case 1:  *(unsigned char*)pby_elem = (unsigned char)t_key;      break;
+                case 2:  *(unsigned short*)pby_elem = (unsigned short)t_key;    break;
+                case 4:  *(unsigned int*)pby_elem = (unsigned int)t_key;        break;
+                default: *(_algo_key_t*)pby_elem = t_key;                       break;
+            }
+            break;
+        case _ALGO_SCALAR_FLOAT:
+            t_key = (t_key & t_sign) != 0 ? t_key ^ t_sign : ~t_key & t_mask;
+            if (cpt_scalar->_t_typesize == sizeof(unsigned int)) {
+                n_bits = (unsigned int)t_key;
+                memcpy(pby_elem, &n_bits, sizeof(unsigned int));
+            } else {
+                memcpy(pby_elem, &t_key, sizeof(_algo_key_t));
+            }
+            break;
+        default:
+            assert(false);
+            break;
+    }
+}
+
+/**
+ * LSD radix sort for keys.
+ */
+static _algo_key_t* _algo_radix_sort_key(_algo_key_t* pt_key, _algo_key_t* pt_buffer, size_t t_len, size_t t_bytes)
+{
+    size_t       at_count[_ALGO_KEY_BYTES][_ALGO_KEY_RADIX_BUCKETS];
+    size_t       t_pass = 0;
+    size_t       t_offset = 0;
+    size_t       t_digit = 0;
+    size_t       i = 0;
+    _algo_key_t* pt_swap = NULL;
+
+    assert(pt_key != NULL && pt_buffer != NULL);
+    assert(t_bytes > 0 && t_bytes <= _ALGO_KEY_BYTES);
+
+    /* count all digits in one scan */
+    memset(at_count, 0x00, sizeof(at_count));
+    for (i = 0; i < t_len; ++i) {
+        for (t_pass = 0; t_pass < t_bytes; ++t_pass) {
+            at_count[t_pass][(size_t)(pt_key[i] >> (t_pass * _ALGO_KEY_RADIX_BITS)) & _ALGO_KEY_RADIX_MASK]++;
+        }
+    }
+
+    for (t_pass = 0; t_pass < t_bytes; ++t_pass) {
+        t_digit = (size_t)(pt_key[0] >> (t_pass * _ALGO_KEY_RADIX_BITS)) & _ALGO_KEY_RADIX_MASK;
+        if (at_count[t_pass][t_digit] == t_len) {
+            continue;
+        }
+
+        /* convert counts to offsets */
+        for (i = 0, t_offset = 0; i < _ALGO_KEY_RADIX_BUCKETS; ++i) {
+            t_digit = at_count[t_pass][i];
+            at_count[t_pass][i] = t_offset;
+            t_offset += t_digit;
+        }
+        for (i = 0; i < t_len; ++i) {
+            t_digit = (size_t)(pt_key[i] >> (t_pass * _ALGO_KEY_RADIX_BITS)) & _ALGO_KEY_RADIX_MASK;
+            pt_buffer[at_count[t_pass][t_digit]++] = pt_key[i];
+        }
+
+        pt_swap = pt_key;
+        pt_key = pt_buffer;
+        pt_buffer = pt_swap;
+    }
+
+    return pt_key;
+}
+
+/**
+ * Intro sort for keys.
+ */
+static void _algo_intro_sort_key(_algo_key_t* pt_first, _algo_key_t* pt_last, size_t t_depth)
+{
+    _algo_key_t* pt_begin = NULL;
+    _algo_key_t* pt_end = NULL;
+    _algo_key_t  t_pivot = 0;
+    _algo_key_t  t_first = 0;
+    _algo_key_t  t_middle = 0;
+    _algo_key_t  t_back = 0;
+    _algo_key_t  t_swap = 0;
+
+    assert(pt_first != NULL && pt_last != NULL && pt_first <= pt_last);
+
+    while (pt_last - pt_first > _ALGO_KEY_SORT_THRESHOLD) {
+        if (t_depth == 0) {
+            _algo_heap_sort_key(pt_first, (size_t)(pt_last - pt_first));
+            return;
+        }
+        t_depth--;
+
+        /* median of three */
+        t_first = *pt_first;
+        t_middle = pt_first[(pt_last - pt_first) / 2];
+        t_back = *(pt_last - 1);
+        if (t_first < t_middle) {
+            t_pivot = t_middle < t_back ? t_middle : (t_first < t_back ? t_back : t_first);
+        } else {
+            t_pivot = t_first < t_back ? t_first : (t_middle < t_back ? t_back : t_middle);
+        }
+
+        /* the pivot is in the range, so the scans need not check the bound */
+        pt_begin = pt_first;
+        pt_end = pt_last;
+        for (;;) {
+            while (*pt_begin < t_pivot) {
+                ++pt_begin;
+            }
+            --pt_end;
+            while (t_pivot < *pt_end) {
+                --pt_end;
+            }
+            if (!(pt_begin < pt_end)) {
+                break;
+            }
+            t_swap = *pt_begin;
+            *pt_begin = *pt_end;
+            *pt_end = t_swap;
+            ++pt_begin;
+        }
+
+        /* recurse into the smaller part to bound the stack */
+        if (pt_begin - pt_first < pt_last - pt_begin) {
+            _algo_intro_sort_key(pt_first, pt_begin, t_depth);
+            pt_first = pt_begin;
+        } else {
+            _algo_intro_sort_key(pt_begin, pt_last, t_depth);
+            pt_last = pt_begin;
+        }
+    }
+}
+
+/**
+ * Heap sort for keys.
+ */
+static void _algo_heap_sort_key(_algo_key_t* pt_key, size_t t_len)
+{
+    size_t      t_start = t_len / 2;
+    size_t      t_end = t_len;
+    size_t      t_parent = 0;
+    size_t      t_child = 0;
+    _algo_key_t t_value = 0;
+
+    assert(pt_key != NULL);
+
+    while (t_end > 1) {
+        if (t_start > 0) {
+            /* make heap */
+            t_value = pt_key[--t_start];
+        } else {
+            /* pop heap */
+            t_value = pt_key[--t_end];
+            pt_key[t_end] = pt_key[0];
+        }
+
+        for (t_parent = t_start; (t_child = t_parent * 2 + 1) < t_end; t_parent = t_child) {
+            if (t_child + 1 < t_end && pt_key[t_child] < pt_key[t_child + 1]) {
+                ++t_child;
+            }
+            if (!(t_value < pt_key[t_child])) {
+                break;
+            }
+            pt_key[t_parent] = pt_key[t_child];
+        }
+        pt_key[t_parent] = t_value;
+    }
+}
+
+/**
+ * Insertion sort for keys.
+ */
+static void _algo_insertion_sort_key(_algo_key_t* pt_key, size_t t_len)
+{
+    size_t      i = 0;
+    size_t      j = 0;
+    _algo_key_t t_value = 0;
+
+    assert(pt_key != NULL);
+
+    for (i = 1; i < t_len; ++i) {
+        t_value = pt_key[i];
+        for (j = i; j > 0 && t_value < pt_key[j - 1]; --j) {
+            pt_key[j] = pt_key[j - 1];
+        }
+        pt_key[j] = t_value;
+    }
+}
+
+/**
+ * Write elements to the destination range of set operations.
+ */
+static void _algo_set_emit(_algo_set_output_t* pt_output, const _byte_t* cpby_elem, size_t t_count)
+{
+    size_t i = 0;
+
+    if (t_count == 0) {
+        return;
+    }
+
+    if (pt_output->_pby_result != NULL) {
+        memmove(pt_output->_pby_result, cpby_elem, t_count * pt_output->_t_typesize);
+        pt_output->_pby_result += t_count * pt_output->_t_typesize;
+    } else {
+        for (i = 0; i < t_count; ++i, cpby_elem += pt_output->_t_typesize) {
+            iterator_set_value(pt_output->_it_result, cpby_elem);
+            pt_output->_it_result = iterator_next(pt_output->_it_result);
+        }
+    }
+    pt_output->_t_count += t_count;
+}
+
 /** eof **/
 
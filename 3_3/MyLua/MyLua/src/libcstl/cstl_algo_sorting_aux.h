@@ -32,6 +32,11 @@ extern "C" {
 /** constant declaration and macro section **/
 
 /** data type declaration and struct, union, enum section **/
+/* the operations on two sorted ranges */
+typedef enum _tagalgosetop
+{
+    _ALGO_SET_MERGE, _ALGO_SET_UNION, _ALGO_SET_INTERSECTION, _ALGO_SET_DIFFERENCE, _ALGO_SET_SYMMETRIC_DIFFERENCE
+}_algo_set_op_t;
 
 /** exported global variable declaration section **/
 
@@ -79,6 +84,39 @@ extern void _algo_insertion_sort_if(random_access_iterator_t it_first, random_ac
 extern void _algo_intro_sort_if(
     random_access_iterator_t it_first, random_access_iterator_t it_last, bfun_t bfun_op, size_t t_depth, void* pv_value);
 
+/**
+ * Sort a contiguous range of C builtin scalar type directly.
+ * @param it_first      A random-access iterator addressing the position of the first element in the range.
+ * @param it_last       A random-access iterator addressing the position of the last element in the range.
+ * @param bfun_op       User-defined predicate function object that defines the comparison criterion to be satisfied by successive elements in the ordering.
+ * @return  true if the range is sorted, false if the range must be sorted by the generic way.
+ * @remarks The range is sorted only when it belongs to vector_t or basic_string_t, the element type is C builtin integer or
+ *          floating point type and bfun_op is the builtin less or greater function of that type, the elements are then
+ *          sorted as raw keys by radix sort or intro sort without calling bfun_op.
+ */
+extern bool_t _algo_sort_builtin(random_access_iterator_t it_first, random_access_iterator_t it_last, bfun_t bfun_op);
+
+/**
+ * Merge, unite, intersect or difference two sorted contiguous ranges of C builtin integer type directly.
+ * @param it_first1     An input iterator addressing the position of the first element in the first range.
+ * @param it_last1      An input iterator addressing the position one past the final element in the first range.
+ * @param it_first2     An input iterator addressing the position of the first element in the second range.
+ * @param it_last2      An input iterator addressing the position one past the final element in the second range.
+ * @param it_result     An output iterator addressing the first position in the destination range.
+ * @param bfun_op       User-defined predicate function object that defines the comparison criterion of the ranges.
+ * @param t_op          The operation.
+ * @param pit_result    Set to the position one past the final element in the destination range, only when the
+ *                      ranges are processed.
+ * @return  true if the ranges are processed, false if the ranges must be processed by the generic way.
+ * @remarks Both ranges must belong to vector_t or basic_string_t, the element type is C builtin integer type and bfun_op
+ *          is the builtin less or greater function of that type. the elements are compared as raw keys, the runs
+ *          between two matched elements are found by galloping search when one range is much longer than the other,
+ *          and copied as a whole when the destination range is contiguous too.
+ */
+extern bool_t _algo_set_builtin(
+    input_iterator_t it_first1, input_iterator_t it_last1, input_iterator_t it_first2, input_iterator_t it_last2,
+    output_iterator_t it_result, bfun_t bfun_op, _algo_set_op_t t_op, output_iterator_t* pit_result);
+
 #ifdef __cplusplus
 }
 #endif
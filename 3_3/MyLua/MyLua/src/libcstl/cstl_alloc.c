@@ -27,15 +27,59 @@
 
 #include "cstl_alloc_aux.h"
 
+#ifdef CSTL_MEMORY_MANAGEMENT
+#   ifdef _MSC_VER
+#       include <windows.h>
+#   else
+#       include <pthread.h>
+#   endif
+#endif /* CSTL_MEMORY_MANAGEMENT */
+
 /** local constant declaration and local macro section **/
+#ifdef CSTL_MEMORY_MANAGEMENT
+/* the size classes, the spans and the global counters are shared by the containers of all threads */
+#   ifdef _MSC_VER
+#       define _ALLOC_LOCK()    AcquireSRWLockExclusive(&_gt_memlock)
+#       define _ALLOC_UNLOCK()  ReleaseSRWLockExclusive(&_gt_memlock)
+#   else
+#       define _ALLOC_LOCK()    pthread_mutex_lock(&_gt_memlock)
+#       define _ALLOC_UNLOCK()  pthread_mutex_unlock(&_gt_memlock)
+#   endif
+#endif /* CSTL_MEMORY_MANAGEMENT */
 
 /** local data type declaration and local struct, union, enum section **/
 
 /** local function prototype section **/
+/**
+ * Follow the forward chain of pool and move the reference of container to the final pool.
+ * @param ppt_pool      the pool reference of container.
+ * @return the final pool.
+ * @remarks if ppt_pool == NULL or *ppt_pool == NULL, then function of the behavior is undefined.
+ */
+static _alloc_pool_t* _alloc_pool_resolve(_alloc_pool_t** ppt_pool);
+
+/**
+ * Get new chunk for pool.
+ * @param pt_pool       pool.
+ * @return false if the allocator context refuses the chunk, otherwise true.
+ * @remarks if pt_pool == NULL, then function of the behavior is undefined.
+ */
+static bool_t _alloc_pool_grow(_alloc_pool_t* pt_pool);
 
 /** exported global variable definition section **/
 
 /** local global variable definition section **/
+#ifdef CSTL_MEMORY_MANAGEMENT
+static _memclass_t* _gapt_memclass[_MEM_LINK_COUNT];  /* size classes of all allocators, created when first used */
+static size_t       _gt_largebytes = 0;               /* live bytes of all allocators that are not from size classes */
+static size_t       _gat_allochit[_MEM_LINK_COUNT];   /* allocations served by existing slabs, kept by shrink */
+static size_t       _gat_allocmiss[_MEM_LINK_COUNT];  /* allocations that get new slab, kept by shrink */
+#ifdef _MSC_VER
+static SRWLOCK         _gt_memlock = SRWLOCK_INIT;                /* lock of size classes, spans and counters */
+#else
+static pthread_mutex_t _gt_memlock = PTHREAD_MUTEX_INITIALIZER;   /* lock of size classes, spans and counters */
+#endif
+#endif /* CSTL_MEMORY_MANAGEMENT */
 
 /** exported function implementation section **/
 #ifdef CSTL_MEMORY_MANAGEMENT
@@ -49,25 +93,12 @@ void _alloc_init(_alloc_t* pt_allocator)
 
     assert(pt_allocator != NULL);
 
-    pt_allocator->_t_mempoolsize = 0;
-    pt_allocator->_t_mempoolindex = 0;
-    pt_allocator->_pby_mempool = NULL;
-    
     for (i = 0; i < _MEM_LINK_COUNT; ++i) {
-        pt_allocator->_apt_memlink[i] = NULL;
-    }
-
-    /* initialize memory pool */
-    pt_allocator->_t_mempoolcount = _MEM_POOL_DEFAULT_COUNT;
-    pt_allocator->_ppby_mempoolcontainer = (_byte_t**)malloc(pt_allocator->_t_mempoolcount * sizeof(_byte_t*));
-    if (pt_allocator->_ppby_mempoolcontainer != NULL) {
-        for (i = 0; i < pt_allocator->_t_mempoolcount; ++i) {
-            pt_allocator->_ppby_mempoolcontainer[i] = NULL;
-        }
-    } else {
-        fprintf(stderr, "CSTL FATAL ERROR: memory allocation error!\n");
-        exit(EXIT_FAILURE);
+        pt_allocator->_at_usecount[i] = 0;
     }
+    pt_allocator->_t_largebytes = 0;
+    pt_allocator->_t_context._pfun_realloc = NULL;
+    pt_allocator->_t_context._pv_userdata = NULL;
 }
 
 /**
@@ -79,22 +110,15 @@ void _alloc_destroy(_alloc_t* pt_allocator)
 
     assert(pt_allocator != NULL);
 
-    /* destroy memory pool */
-    for (i = 0; i < pt_allocator->_t_mempoolcount; ++i) {
-        free(pt_allocator->_ppby_mempoolcontainer[i]);
-        pt_allocator->_ppby_mempoolcontainer[i] = NULL;
-    }
-    free(pt_allocator->_ppby_mempoolcontainer);
-    pt_allocator->_ppby_mempoolcontainer = NULL;
-
+    /* the memory blocks are in the shared slabs, they must be released by the container */
     for (i = 0; i < _MEM_LINK_COUNT; ++i) {
-        pt_allocator->_apt_memlink[i] = NULL;
+        assert(pt_allocator->_at_usecount[i] == 0);
+        pt_allocator->_at_usecount[i] = 0;
     }
-
-    pt_allocator->_pby_mempool = NULL;
-    pt_allocator->_t_mempoolindex = 0;
-    pt_allocator->_t_mempoolsize = 0;
-    pt_allocator->_t_mempoolcount = 0;
+    _ALLOC_LOCK();
+    _gt_largebytes -= pt_allocator->_t_largebytes;
+    _ALLOC_UNLOCK();
+    pt_allocator->_t_largebytes = 0;
 }
 
 /**
@@ -102,27 +126,55 @@ void _alloc_destroy(_alloc_t* pt_allocator)
  */
 void* _alloc_allocate(_alloc_t* pt_allocator, size_t t_size, size_t t_count)
 {
-    void*       pv_allocmem = NULL;               /* allocated memory pointer */
-    _memlink_t* pt_link = NULL;                   /* memory link */
-    size_t      t_allocsize = t_size * t_count;   /* allocated memory size */
+    _memclass_t* pt_class = NULL;                 /* size class */
+    _memslab_t*  pt_slab = NULL;                  /* slab that memory block comes from */
+    _memlink_t*  pt_link = NULL;                  /* memory link */
+    size_t       t_allocsize = t_size * t_count;  /* allocated memory size */
+    size_t       t_index = 0;
 
     assert(pt_allocator != NULL);
 
-    if (t_allocsize > _MEM_SMALL_MEM_SIZE_MAX) {
-        pv_allocmem = _alloc_malloc(t_allocsize);
-        assert(pv_allocmem != NULL);
-    } else {
-        pt_link = pt_allocator->_apt_memlink[_MEM_LINK_INDEX(t_allocsize)];
-        if (pt_link == NULL) {
-            _alloc_apply_formated_memory(pt_allocator, _MEM_ROUND_UP(t_allocsize));
-            pt_link = pt_allocator->_apt_memlink[_MEM_LINK_INDEX(t_allocsize)];
-            assert(pt_link != NULL);
+    if (t_allocsize > _MEM_SMALL_MEM_SIZE_MAX || pt_allocator->_t_context._pfun_realloc != NULL) {
+        void* pv_allocmem = _alloc_malloc_context(&pt_allocator->_t_context, t_allocsize);
+
+        if (pv_allocmem != NULL) {
+            pt_allocator->_t_largebytes += t_allocsize;
+            _ALLOC_LOCK();
+            _gt_largebytes += t_allocsize;
+            _ALLOC_UNLOCK();
         }
-        pt_allocator->_apt_memlink[_MEM_LINK_INDEX(t_allocsize)] = pt_link->_pui_nextmem;
-        pv_allocmem = (void*)pt_link;
+        return pv_allocmem;
     }
 
-    return pv_allocmem;
+    t_index = _MEM_LINK_INDEX(t_allocsize);
+    _ALLOC_LOCK();
+    pt_class = _gapt_memclass[t_index];
+    if (pt_class == NULL) {
+        pt_class = _gapt_memclass[t_index] = _alloc_create_memclass(t_index);
+    }
+
+    pt_slab = pt_class->_pt_partial;
+    if (pt_slab != NULL) {
+        _gat_allochit[t_index]++;
+    } else {
+        pt_slab = _alloc_get_slab(pt_class);
+        _alloc_link_slab(&pt_class->_pt_partial, pt_slab);
+        _gat_allocmiss[t_index]++;
+    }
+
+    pt_link = pt_slab->_pt_freelist;
+    assert(pt_link != NULL);
+    pt_slab->_pt_freelist = pt_link->_pui_nextmem;
+    pt_slab->_t_usecount++;
+    pt_class->_t_usecount++;
+    pt_allocator->_at_usecount[t_index]++;
+    if (pt_slab->_pt_freelist == NULL) {
+        _alloc_unlink_slab(&pt_class->_pt_partial, pt_slab);
+        _alloc_link_slab(&pt_class->_pt_full, pt_slab);
+    }
+    _ALLOC_UNLOCK();
+
+    return (void*)pt_link;
 }
 
 /**
@@ -130,45 +182,152 @@ void* _alloc_allocate(_alloc_t* pt_allocator, size_t t_size, size_t t_count)
  */
 void _alloc_deallocate(_alloc_t* pt_allocator, void* pv_allocmem, size_t t_size, size_t t_count)
 {
-    size_t t_allocsize = t_size * t_count; /* allocated memory size */
+    _memclass_t* pt_class = NULL;
+    _memslab_t*  pt_slab = NULL;
+    size_t       t_allocsize = t_size * t_count; /* allocated memory size */
+    size_t       t_index = 0;
 
     assert(pt_allocator != NULL);
     assert(pv_allocmem != NULL);
 
-    if (t_allocsize > _MEM_SMALL_MEM_SIZE_MAX) {
-        _alloc_free(pv_allocmem);
-    } else {
-        ((_memlink_t*)pv_allocmem)->_pui_nextmem = pt_allocator->_apt_memlink[_MEM_LINK_INDEX(t_allocsize)];
-        pt_allocator->_apt_memlink[_MEM_LINK_INDEX(t_allocsize)] = ((_memlink_t*)pv_allocmem);
+    if (t_allocsize > _MEM_SMALL_MEM_SIZE_MAX || pt_allocator->_t_context._pfun_realloc != NULL) {
+        assert(pt_allocator->_t_largebytes >= t_allocsize);
+        pt_allocator->_t_largebytes -= t_allocsize;
+        _ALLOC_LOCK();
+        _gt_largebytes -= t_allocsize;
+        _ALLOC_UNLOCK();
+        _alloc_free_context(&pt_allocator->_t_context, pv_allocmem, t_allocsize);
+        return;
+    }
+
+    t_index = _MEM_LINK_INDEX(t_allocsize);
+    _ALLOC_LOCK();
+    pt_class = _gapt_memclass[t_index];
+    assert(pt_class != NULL);
+    assert(pt_allocator->_at_usecount[t_index] > 0);
+    pt_slab = _alloc_get_slab_of_memory(pt_class, pv_allocmem);
+    assert(pt_slab->_t_usecount > 0);
+
+    if (pt_slab->_pt_freelist == NULL) {
+        _alloc_unlink_slab(&pt_class->_pt_full, pt_slab);
+        _alloc_link_slab(&pt_class->_pt_partial, pt_slab);
+    }
+    ((_memlink_t*)pv_allocmem)->_pui_nextmem = pt_slab->_pt_freelist;
+    pt_slab->_pt_freelist = (_memlink_t*)pv_allocmem;
+    pt_slab->_t_usecount--;
+    pt_class->_t_usecount--;
+    pt_allocator->_at_usecount[t_index]--;
+
+    /* the empty slab is cached or given back to system */
+    if (pt_slab->_t_usecount == 0) {
+        _alloc_unlink_slab(&pt_class->_pt_partial, pt_slab);
+        _alloc_put_slab(pt_class, pt_slab);
     }
+    _ALLOC_UNLOCK();
 }
 
-#ifndef NDEBUG
 /**
- * Test alloc_t is initialized.
+ * Get the memory usage statistics of all allocators.
  */
-bool_t _alloc_is_inited(const _alloc_t* cpt_allocator)
+void alloc_get_stats(alloc_stats_t* pt_stats)
+{
+    size_t i = 0;
+
+    assert(pt_stats != NULL);
+
+    _ALLOC_LOCK();
+    pt_stats->_t_livebytes = _gt_largebytes;
+    pt_stats->_t_cachedbytes = _alloc_get_span_bytes();
+    for (i = 0; i < _MEM_LINK_COUNT; ++i) {
+        const _memclass_t*   cpt_class = _gapt_memclass[i];
+        alloc_class_stats_t* pt_class_stats = &pt_stats->_at_class[i];
+
+        pt_class_stats->_t_blocksize = _alloc_get_class_size(i);
+        pt_class_stats->_t_allochit = _gat_allochit[i];
+        pt_class_stats->_t_allocmiss = _gat_allocmiss[i];
+        if (cpt_class == NULL) {
+            pt_class_stats->_t_slabcount = 0;
+            pt_class_stats->_t_usecount = 0;
+            continue;
+        }
+
+        pt_class_stats->_t_slabcount = cpt_class->_t_slabcount;
+        pt_class_stats->_t_usecount = cpt_class->_t_usecount;
+
+        pt_stats->_t_livebytes += cpt_class->_t_usecount * cpt_class->_t_blocksize;
+        pt_stats->_t_cachedbytes -= cpt_class->_t_usecount * cpt_class->_t_blocksize;
+    }
+    _ALLOC_UNLOCK();
+}
+
+/**
+ * Get the memory that allocator holds.
+ */
+size_t _alloc_memory_usage(const _alloc_t* cpt_allocator)
 {
+    size_t t_bytes = 0;
     size_t i = 0;
 
     assert(cpt_allocator != NULL);
 
-    if (cpt_allocator->_t_mempoolsize != 0 || cpt_allocator->_t_mempoolindex != 0 || cpt_allocator->_pby_mempool != NULL) {
-        return false;
+    t_bytes = cpt_allocator->_t_largebytes;
+    for (i = 0; i < _MEM_LINK_COUNT; ++i) {
+        if (cpt_allocator->_at_usecount[i] != 0) {
+            t_bytes += cpt_allocator->_at_usecount[i] * _alloc_get_class_size(i);
+        }
     }
 
+    return t_bytes;
+}
+
+/**
+ * Release the cached memory of size classes to system.
+ */
+void _alloc_shrink(_alloc_t* pt_allocator)
+{
+    _memclass_t* pt_class = NULL;
+    _memslab_t*  pt_slab = NULL;
+    size_t       i = 0;
+
+    assert(pt_allocator != NULL);
+
+    _ALLOC_LOCK();
     for (i = 0; i < _MEM_LINK_COUNT; ++i) {
-        if (cpt_allocator->_apt_memlink[i] != NULL) {
-            return false;
+        if ((pt_class = _gapt_memclass[i]) == NULL) {
+            continue;
+        }
+
+        while (pt_class->_pt_empty != NULL) {
+            pt_slab = pt_class->_pt_empty;
+            _alloc_unlink_slab(&pt_class->_pt_empty, pt_slab);
+            _alloc_free_slab(pt_slab);
+            pt_class->_t_emptycount--;
+            pt_class->_t_slabcount--;
+        }
+        if (pt_class->_t_slabcount == 0) {
+            _alloc_destroy_memclass(pt_class);
+            _gapt_memclass[i] = NULL;
         }
     }
+    _ALLOC_UNLOCK();
+}
+
+#ifndef NDEBUG
+/**
+ * Test alloc_t is initialized.
+ */
+bool_t _alloc_is_inited(const _alloc_t* cpt_allocator)
+{
+    size_t i = 0;
+
+    assert(cpt_allocator != NULL);
 
-    if (cpt_allocator->_t_mempoolcount != _MEM_POOL_DEFAULT_COUNT || cpt_allocator->_ppby_mempoolcontainer == NULL) {
+    if (cpt_allocator->_t_largebytes != 0) {
         return false;
     }
 
-    for (i = 0; i < cpt_allocator->_t_mempoolcount; ++i) {
-        if (cpt_allocator->_ppby_mempoolcontainer[i] != NULL) {
+    for (i = 0; i < _MEM_LINK_COUNT; ++i) {
+        if (cpt_allocator->_at_usecount[i] != 0) {
             return false;
         }
     }
@@ -184,7 +343,11 @@ bool_t _alloc_is_inited(const _alloc_t* cpt_allocator)
  */
 void _alloc_init(_alloc_t* pt_allocator)
 {
-    pt_allocator = NULL;
+    assert(pt_allocator != NULL);
+
+    pt_allocator->_t_livebytes = 0;
+    pt_allocator->_t_context._pfun_realloc = NULL;
+    pt_allocator->_t_context._pv_userdata = NULL;
 }
 
 /**
@@ -192,7 +355,9 @@ void _alloc_init(_alloc_t* pt_allocator)
  */
 void _alloc_destroy(_alloc_t* pt_allocator)
 {
-    pt_allocator = NULL;
+    assert(pt_allocator != NULL);
+
+    pt_allocator->_t_livebytes = 0;
 }
 
 /**
@@ -203,8 +368,14 @@ void* _alloc_allocate(_alloc_t* pt_allocator, size_t t_size, size_t t_count)
     /* total allocated memory size */
     size_t t_allocsize = t_size * t_count;
 
-    pt_allocator = NULL;
-    return _alloc_malloc(t_allocsize);
+    void*  pv_allocmem = NULL;
+
+    assert(pt_allocator != NULL);
+
+    if ((pv_allocmem = _alloc_malloc_context(&pt_allocator->_t_context, t_allocsize)) != NULL) {
+        pt_allocator->_t_livebytes += t_allocsize;
+    }
+    return pv_allocmem;
 }
 
 /**
@@ -212,12 +383,42 @@ void* _alloc_allocate(_alloc_t* pt_allocator, size_t t_size, size_t t_count)
  */
 void _alloc_deallocate(_alloc_t* pt_allocator, void* pv_allocmem, size_t t_size, size_t t_count)
 {
+    assert(pt_allocator != NULL);
     assert(pv_allocmem != NULL);
 
-    pt_allocator = NULL;
-    t_size = 0;
-    t_count = 0;
-    _alloc_free(pv_allocmem);
+    pt_allocator->_t_livebytes -= t_size * t_count;
+    _alloc_free_context(&pt_allocator->_t_context, pv_allocmem, t_size * t_count);
+}
+
+/**
+ * Get the memory usage statistics of all allocators.
+ */
+void alloc_get_stats(alloc_stats_t* pt_stats)
+{
+    assert(pt_stats != NULL);
+
+    /* the allocators are not counted globally, so the hot path touches no shared state */
+    pt_stats->_t_livebytes = 0;
+    pt_stats->_t_cachedbytes = 0;
+}
+
+/**
+ * Get the memory that allocator holds.
+ */
+size_t _alloc_memory_usage(const _alloc_t* cpt_allocator)
+{
+    assert(cpt_allocator != NULL);
+
+    return cpt_allocator->_t_livebytes;
+}
+
+/**
+ * Release the cached memory of size classes to system.
+ */
+void _alloc_shrink(_alloc_t* pt_allocator)
+{
+    /* nothing is cached */
+    assert(pt_allocator != NULL);
 }
 
 #ifndef NDEBUG
@@ -226,13 +427,30 @@ void _alloc_deallocate(_alloc_t* pt_allocator, void* pv_allocmem, size_t t_size,
  */
 bool_t _alloc_is_inited(const _alloc_t* cpt_allocator)
 {
-    cpt_allocator = NULL;
-    return true;
+    assert(cpt_allocator != NULL);
+
+    return cpt_allocator->_t_livebytes == 0;
 }
 #endif /* NDEBUG */
 
 #endif /* CSTL_MEMORY_MANAGEMENT */
 
+/**
+ * Set the allocator context of _alloc_t.
+ */
+void _alloc_set_context(_alloc_t* pt_allocator, const alloc_context_t* cpt_context)
+{
+    assert(pt_allocator != NULL);
+    assert(_alloc_is_inited(pt_allocator));
+
+    if (cpt_context != NULL) {
+        pt_allocator->_t_context = *cpt_context;
+    } else {
+        pt_allocator->_t_context._pfun_realloc = NULL;
+        pt_allocator->_t_context._pv_userdata = NULL;
+    }
+}
+
 /**
  * Set the out of memory handler and return the old handler.
  */
@@ -244,7 +462,293 @@ void (*_alloc_set_malloc_handler(void (*pfun_newhandler)(void)))(void)
     return pfun_oldhandler;
 }
 
+/**
+ * Allocate the memory of a temporary value.
+ */
+void* _alloc_allocate_temp(_alloc_t* pt_allocator, size_t t_size)
+{
+    assert(pt_allocator != NULL);
+
+    /* the value does not belong to the container, so it is not taken from the context that may refuse it */
+    if (pt_allocator->_t_context._pfun_realloc != NULL) {
+        return _alloc_malloc(t_size);
+    } else {
+        return _alloc_allocate(pt_allocator, t_size, 1);
+    }
+}
+
+/**
+ * Release the memory of a temporary value.
+ */
+void _alloc_deallocate_temp(_alloc_t* pt_allocator, void* pv_allocmem, size_t t_size)
+{
+    assert(pt_allocator != NULL);
+    assert(pv_allocmem != NULL);
+
+    if (pt_allocator->_t_context._pfun_realloc != NULL) {
+        _alloc_free(pv_allocmem);
+    } else {
+        _alloc_deallocate(pt_allocator, pv_allocmem, t_size, 1);
+    }
+}
+
+/**
+ * Create node pool.
+ */
+_alloc_pool_t* _alloc_pool_create(const alloc_context_t* cpt_context, size_t t_nodesize, size_t t_batch)
+{
+    _alloc_pool_t* pt_pool = NULL;
+
+    assert(t_nodesize > 0);
+
+    if ((pt_pool = (_alloc_pool_t*)_alloc_malloc_context(cpt_context, sizeof(_alloc_pool_t))) == NULL) {
+        return NULL;
+    }
+    if (cpt_context != NULL) {
+        pt_pool->_t_context = *cpt_context;
+    } else {
+        pt_pool->_t_context._pfun_realloc = NULL;
+        pt_pool->_t_context._pv_userdata = NULL;
+    }
+    /* node must be able to hold the free link and be aligned */
+    t_nodesize = t_nodesize < sizeof(void*) ? sizeof(void*) : t_nodesize;
+    pt_pool->_t_nodesize = (t_nodesize + 7) & ~(size_t)7;
+    pt_pool->_pv_freelist = NULL;
+    pt_pool->_pt_chunk = NULL;
+    pt_pool->_pby_bump = NULL;
+    pt_pool->_pby_bumpend = NULL;
+    pt_pool->_t_usecount = 0;
+    pt_pool->_t_bytes = 0;
+    pt_pool->_t_nextbatch = t_batch > 0 ? t_batch : _MEM_POOL_BATCH_MIN;
+    pt_pool->_t_refcount = 1;
+    pt_pool->_pt_forward = NULL;
+
+    return pt_pool;
+}
+
+/**
+ * Allocate one node from pool.
+ */
+void* _alloc_pool_allocate(_alloc_pool_t** ppt_pool)
+{
+    _alloc_pool_t* pt_pool = NULL;
+    void*          pv_node = NULL;
+
+    assert(ppt_pool != NULL);
+    assert(*ppt_pool != NULL);
+
+    pt_pool = _alloc_pool_resolve(ppt_pool);
+    if (pt_pool->_pv_freelist != NULL) {
+        pv_node = pt_pool->_pv_freelist;
+        pt_pool->_pv_freelist = *(void**)pv_node;
+    } else {
+        if ((pt_pool->_pby_bump == NULL || pt_pool->_pby_bump + pt_pool->_t_nodesize > pt_pool->_pby_bumpend) &&
+            !_alloc_pool_grow(pt_pool)) {
+            return NULL;
+        }
+        pv_node = pt_pool->_pby_bump;
+        pt_pool->_pby_bump += pt_pool->_t_nodesize;
+    }
+    pt_pool->_t_usecount++;
+
+    return pv_node;
+}
+
+/**
+ * Release node to pool.
+ */
+void _alloc_pool_deallocate(_alloc_pool_t** ppt_pool, void* pv_node)
+{
+    _alloc_pool_t* pt_pool = NULL;
+
+    assert(ppt_pool != NULL);
+    assert(*ppt_pool != NULL);
+    assert(pv_node != NULL);
+
+    pt_pool = _alloc_pool_resolve(ppt_pool);
+    assert(pt_pool->_t_usecount > 0);
+    *(void**)pv_node = pt_pool->_pv_freelist;
+    pt_pool->_pv_freelist = pv_node;
+    pt_pool->_t_usecount--;
+}
+
+/**
+ * Share the pool between two containers.
+ */
+void _alloc_pool_share(_alloc_pool_t** ppt_dest, _alloc_pool_t** ppt_src)
+{
+    _alloc_pool_t*  pt_dest = NULL;
+    _alloc_pool_t*  pt_src = NULL;
+    _alloc_chunk_t* pt_chunk = NULL;
+    void**          ppv_tail = NULL;
+
+    assert(ppt_dest != NULL);
+    assert(ppt_src != NULL);
+
+    if (*ppt_src == NULL) {
+        return;
+    }
+    pt_src = _alloc_pool_resolve(ppt_src);
+    if (*ppt_dest == NULL) {
+        pt_src->_t_refcount++;
+        *ppt_dest = pt_src;
+        return;
+    }
+    pt_dest = _alloc_pool_resolve(ppt_dest);
+    if (pt_dest == pt_src) {
+        return;
+    }
+
+    assert(pt_dest->_t_nodesize == pt_src->_t_nodesize);
+    assert(pt_dest->_t_context._pfun_realloc == pt_src->_t_context._pfun_realloc &&
+           pt_dest->_t_context._pv_userdata == pt_src->_t_context._pv_userdata);
+
+    /* the unused space of source chunk becomes free nodes */
+    while (pt_src->_pby_bump != NULL && pt_src->_pby_bump + pt_src->_t_nodesize <= pt_src->_pby_bumpend) {
+        *(void**)pt_src->_pby_bump = pt_src->_pv_freelist;
+        pt_src->_pv_freelist = pt_src->_pby_bump;
+        pt_src->_pby_bump += pt_src->_t_nodesize;
+    }
+    /* append free nodes and chunks of source to destination */
+    if (pt_src->_pv_freelist != NULL) {
+        for (ppv_tail = (void**)pt_src->_pv_freelist; *ppv_tail != NULL; ppv_tail = (void**)*ppv_tail) {
+            continue;
+        }
+        *ppv_tail = pt_dest->_pv_freelist;
+        pt_dest->_pv_freelist = pt_src->_pv_freelist;
+    }
+    if (pt_src->_pt_chunk != NULL) {
+        for (pt_chunk = pt_src->_pt_chunk; pt_chunk->_pt_next != NULL; pt_chunk = pt_chunk->_pt_next) {
+            continue;
+        }
+        pt_chunk->_pt_next = pt_dest->_pt_chunk;
+        pt_dest->_pt_chunk = pt_src->_pt_chunk;
+    }
+    pt_dest->_t_usecount += pt_src->_t_usecount;
+    pt_dest->_t_bytes += pt_src->_t_bytes;
+
+    pt_src->_pv_freelist = NULL;
+    pt_src->_pt_chunk = NULL;
+    pt_src->_pby_bump = NULL;
+    pt_src->_pby_bumpend = NULL;
+    pt_src->_t_usecount = 0;
+    pt_src->_t_bytes = 0;
+    /* the source pool forwards to destination for the other containers that use it */
+    pt_src->_pt_forward = pt_dest;
+    pt_dest->_t_refcount++;
+
+    pt_dest->_t_refcount++;
+    _alloc_pool_release(ppt_src);
+    *ppt_src = pt_dest;
+}
+
+/**
+ * Release the pool reference of container.
+ */
+void _alloc_pool_release(_alloc_pool_t** ppt_pool)
+{
+    _alloc_pool_t*  pt_pool = NULL;
+    _alloc_pool_t*  pt_forward = NULL;
+    _alloc_chunk_t* pt_chunk = NULL;
+    alloc_context_t t_context;
+
+    assert(ppt_pool != NULL);
+
+    pt_pool = *ppt_pool;
+    *ppt_pool = NULL;
+    while (pt_pool != NULL) {
+        assert(pt_pool->_t_refcount > 0);
+        if (--pt_pool->_t_refcount > 0) {
+            break;
+        }
+
+        t_context = pt_pool->_t_context;
+        pt_forward = pt_pool->_pt_forward;
+        assert(pt_pool->_t_usecount == 0);
+        while (pt_pool->_pt_chunk != NULL) {
+            pt_chunk = pt_pool->_pt_chunk;
+            pt_pool->_pt_chunk = pt_chunk->_pt_next;
+            _alloc_free_context(&t_context, pt_chunk, pt_chunk->_t_bytes);
+        }
+        _alloc_free_context(&t_context, pt_pool, sizeof(_alloc_pool_t));
+        /* the forward pool loses one reference */
+        pt_pool = pt_forward;
+    }
+}
+
+/**
+ * Get the memory that pool holds.
+ */
+size_t _alloc_pool_memory_usage(const _alloc_pool_t* cpt_pool)
+{
+    if (cpt_pool == NULL) {
+        return 0;
+    }
+
+    while (cpt_pool->_pt_forward != NULL) {
+        cpt_pool = cpt_pool->_pt_forward;
+    }
+
+    return sizeof(_alloc_pool_t) + cpt_pool->_t_bytes;
+}
+
 /** local function implementation section **/
+/**
+ * Follow the forward chain of pool and move the reference of container to the final pool.
+ */
+static _alloc_pool_t* _alloc_pool_resolve(_alloc_pool_t** ppt_pool)
+{
+    _alloc_pool_t* pt_final = NULL;
+
+    assert(ppt_pool != NULL);
+    assert(*ppt_pool != NULL);
+
+    pt_final = *ppt_pool;
+    if (pt_final->_pt_forward == NULL) {
+        return pt_final;
+    }
+
+    while (pt_final->_pt_forward != NULL) {
+        pt_final = pt_final->_pt_forward;
+    }
+    pt_final->_t_refcount++;
+    _alloc_pool_release(ppt_pool);
+    *ppt_pool = pt_final;
+
+    return pt_final;
+}
+
+/**
+ * Get new chunk for pool.
+ */
+static bool_t _alloc_pool_grow(_alloc_pool_t* pt_pool)
+{
+    _alloc_chunk_t* pt_chunk = NULL;
+    size_t          t_header = (sizeof(_alloc_chunk_t) + 7) & ~(size_t)7;
+    size_t          t_bytes = 0;
+
+    assert(pt_pool != NULL);
+
+    t_bytes = t_header + pt_pool->_t_nextbatch * pt_pool->_t_nodesize;
+    if ((pt_chunk = (_alloc_chunk_t*)_alloc_malloc_context(&pt_pool->_t_context, t_bytes)) == NULL) {
+        return false;
+    }
+    pt_chunk->_t_bytes = t_bytes;
+    pt_chunk->_pt_next = pt_pool->_pt_chunk;
+    pt_pool->_pt_chunk = pt_chunk;
+    pt_pool->_t_bytes += t_bytes;
+    pt_pool->_pby_bump = (_byte_t*)pt_chunk + t_header;
+    pt_pool->_pby_bumpend = (_byte_t*)pt_chunk + t_bytes;
+
+    /* the chunk size doubles until _MEM_POOL_CHUNK_MAX */
+    if (pt_pool->_t_nextbatch * 2 * pt_pool->_t_nodesize <= _MEM_POOL_CHUNK_MAX) {
+        pt_pool->_t_nextbatch *= 2;
+    } else if (pt_pool->_t_nextbatch * pt_pool->_t_nodesize > _MEM_POOL_CHUNK_MAX) {
+        pt_pool->_t_nextbatch = _MEM_POOL_CHUNK_MAX / pt_pool->_t_nodesize > 0 ? _MEM_POOL_CHUNK_MAX / pt_pool->_t_nodesize : 1;
+    }
+
+    return true;
+}
 
 /** eof **/
 
@@ -30,18 +30,53 @@ extern "C" {
 /** include section **/
 
 /** constant declaration and macro section **/
+
+/** data type declaration and struct, union, enum section **/
+/*
+ * Allocator context that container gets its memory from. _pfun_realloc has the same contract as lua_Alloc:
+ * _pfun_realloc(_pv_userdata, NULL, 0, t_newsize) allocates memory, returns NULL if the memory can not be allocated.
+ * _pfun_realloc(_pv_userdata, pv_mem, t_oldsize, 0) frees memory and t_oldsize is the allocated size.
+ * Only vector, hash_set, hash_multiset, hash_map and hash_multimap can be created with a context. list, slist, deque,
+ * the trees, string and the key and value buffers of pair_t always get memory from the default allocator.
+ */
+typedef struct _tagalloccontext
+{
+    void* (*_pfun_realloc)(void* pv_userdata, void* pv_mem, size_t t_oldsize, size_t t_newsize);
+    void*  _pv_userdata;
+}alloc_context_t;
+
 #ifdef CSTL_MEMORY_MANAGEMENT
 
 #define _MEM_ALIGNMENT              8     /* boundary for small memory block */
-#define _MEM_SMALL_MEM_SIZE_MAX     128   /* the maxinum size of small memory */
-#define _MEM_LINK_COUNT             _MEM_SMALL_MEM_SIZE_MAX/_MEM_ALIGNMENT
-#define _MEM_CHUNK_COUNT            16    /* default chunk count getted from pool */
-#define _MEM_POOL_DEFAULT_COUNT     16    /* memory pool count */
+#define _MEM_SMALL_CLASS_MAX        128   /* size classes below this size are _MEM_ALIGNMENT apart */
+#define _MEM_SMALL_CLASS_COUNT      (_MEM_SMALL_CLASS_MAX / _MEM_ALIGNMENT)
+#ifndef _MEM_LARGE_CLASS_DOUBLINGS
+#define _MEM_LARGE_CLASS_DOUBLINGS  5     /* power of two steps above _MEM_SMALL_CLASS_MAX, 5 means 4096 bytes */
+#endif
+#define _MEM_LARGE_CLASS_STEPS      4     /* size classes in each power of two step */
+#define _MEM_SMALL_MEM_SIZE_MAX     (_MEM_SMALL_CLASS_MAX << _MEM_LARGE_CLASS_DOUBLINGS) /* the maxinum size of small memory */
+#define _MEM_LINK_COUNT             (_MEM_SMALL_CLASS_COUNT + _MEM_LARGE_CLASS_STEPS * _MEM_LARGE_CLASS_DOUBLINGS)
+#ifndef _MEM_SLAB_MIN_SIZE
+#define _MEM_SLAB_MIN_SIZE          4096  /* the mininum slab size, one page */
+#endif
+#define _MEM_SLAB_MIN_BLOCKS        8     /* the mininum block count in one slab */
+#ifndef _MEM_SLAB_EMPTY_CACHED
+#define _MEM_SLAB_EMPTY_CACHED      1     /* empty slabs kept by each size class before release them to system */
+#endif
+#ifndef _MEM_SPAN_SIZE
+#define _MEM_SPAN_SIZE              65536 /* the size of span that slabs are carved from, one slab at least */
+#endif
+#define _MEM_SLAB_SIZE_COUNT        16    /* slab sizes, the powers of 2 from _MEM_SLAB_MIN_SIZE */
+#if _MEM_SPAN_SIZE / _MEM_SLAB_MIN_SIZE > 32
+#   error "a span holds 32 slabs at most, the free slabs of span are kept in a bit mask"
+#endif
 
 /* round up the size of memory to the multiple of 8 */
 #define _MEM_ROUND_UP(memsize)      (((memsize) + _MEM_ALIGNMENT - 1) & ~(_MEM_ALIGNMENT - 1))
 /* get the memory link index with memsize */
-#define _MEM_LINK_INDEX(memsize)    (((memsize) + _MEM_ALIGNMENT - 1) / _MEM_ALIGNMENT - 1)
+#define _MEM_LINK_INDEX(memsize)\
+    ((memsize) <= _MEM_SMALL_CLASS_MAX ? ((memsize) + _MEM_ALIGNMENT - 1) / _MEM_ALIGNMENT - 1 :\
+                                          _alloc_get_class_index(memsize))
 
 /** data type declaration and struct, union, enum section **/
 typedef union _tagmemlink
@@ -50,25 +85,123 @@ typedef union _tagmemlink
     _byte_t            _pby_mem[1];    /* represent memory block */
 }_memlink_t;
 
+/*
+ * The slab is aligned to its size, so the slab of a memory block can be found by masking the block address.
+ * The memory blocks follow the slab header.
+ */
+typedef struct _tagmemslab
+{
+    struct _tagmemslab* _pt_prev;      /* previous slab in the class list */
+    struct _tagmemslab* _pt_next;      /* next slab in the class list */
+    _memlink_t*         _pt_freelist;  /* free memory blocks in this slab */
+    size_t              _t_usecount;   /* allocated memory blocks in this slab */
+    struct _tagmemspan* _pt_span;      /* span that slab comes from */
+}_memslab_t;
+
+/*
+ * Slabs of one size are carved from spans that get from system, a span is aligned to the slab size and holds
+ * several small slabs, so the alignment costs little memory. A slab is committed when it is carved and decommitted
+ * when it is released, so a span that is kept by one slab holds the memory of that slab only. The span is released
+ * when all its slabs are free.
+ */
+typedef struct _tagmemspan
+{
+    struct _tagmemspan* _pt_prev;      /* previous span in the list of its slab size */
+    struct _tagmemspan* _pt_next;      /* next span in the list of its slab size */
+    void*               _pv_map;       /* memory that gets from system, include the space for alignment */
+    size_t              _t_mapsize;    /* size of the memory that gets from system */
+    _byte_t*            _pby_mem;      /* memory of slabs, aligned to the slab size */
+    size_t              _t_slabsize;   /* slab size */
+    size_t              _t_slabcount;  /* slab count of span */
+    size_t              _t_freemask;   /* bit i is set when slab i is free, the free slabs are decommitted */
+    size_t              _t_usecount;   /* slabs in use */
+}_memspan_t;
+
+typedef struct _tagmemclass
+{
+    size_t      _t_blocksize;     /* memory block size */
+    size_t      _t_slabsize;      /* slab size */
+    size_t      _t_blockcount;    /* memory block count in one slab */
+    _memslab_t* _pt_partial;      /* slabs that have free memory block */
+    _memslab_t* _pt_full;         /* slabs that have no free memory block */
+    _memslab_t* _pt_empty;        /* empty slabs cached for reuse */
+    size_t      _t_emptycount;    /* empty slab count */
+    size_t      _t_slabcount;     /* slab count, include the empty slabs */
+    size_t      _t_usecount;      /* allocated memory block count */
+}_memclass_t;
+
+/*
+ * The size classes and their slabs are shared by all allocators, so a small container does not hold a slab for each
+ * size class that it uses. The allocator only counts the memory blocks that it gets from the size classes.
+ */
 typedef struct _tagalloc
 {
-    _memlink_t* _apt_memlink[_MEM_LINK_COUNT];   /* memory list */
-    _byte_t**   _ppby_mempoolcontainer;          /* memory pool container */
-    _byte_t*    _pby_mempool;                    /* memory pool start */
-    size_t      _t_mempoolsize;                  /* memory pool size */
-    size_t      _t_mempoolindex;                 /* memory pool index */
-    size_t      _t_mempoolcount;                 /* memory pool count */
+    size_t          _at_usecount[_MEM_LINK_COUNT];  /* allocated memory block count of each size class */
+    size_t          _t_largebytes;                  /* live bytes allocated from system or context directly */
+    alloc_context_t _t_context;                     /* allocator context, memory is not pooled when it is set */
 }_alloc_t;
 
+typedef struct _tagallocclassstats
+{
+    size_t _t_blocksize;    /* memory block size */
+    size_t _t_slabcount;    /* slab count, include the empty slabs */
+    size_t _t_usecount;     /* allocated memory block count */
+    size_t _t_allochit;     /* allocations served by existing slabs */
+    size_t _t_allocmiss;    /* allocations that get new slab from system */
+}alloc_class_stats_t;
+
+typedef struct _tagallocstats
+{
+    size_t              _t_livebytes;    /* bytes allocated by all allocators and not released */
+    size_t              _t_cachedbytes;  /* bytes of committed slabs that are not allocated */
+    alloc_class_stats_t _at_class[_MEM_LINK_COUNT];
+}alloc_stats_t;
+
 #else
 
 typedef struct _tagalloc
 {
-    int n_avoid_vc_error_c2016;
+    size_t          _t_livebytes;  /* bytes allocated and not released */
+    alloc_context_t _t_context;    /* allocator context */
 }_alloc_t;
 
+typedef struct _tagallocstats
+{
+    size_t _t_livebytes;    /* always 0, the allocators are not counted globally */
+    size_t _t_cachedbytes;  /* always 0 */
+}alloc_stats_t;
+
 #endif /* CSTL_MEMORY_MANAGEMENT */
 
+#define _MEM_POOL_BATCH_MIN         16     /* node count of the first chunk of node pool */
+#define _MEM_POOL_CHUNK_MAX         65536  /* chunk of node pool grows until this size */
+
+/*
+ * Node pool for node based containers. Nodes of one size are carved from chunks that get from allocator context,
+ * the chunk size doubles until _MEM_POOL_CHUNK_MAX. Pools are shared when nodes move between containers, the pool
+ * that merged into another pool forwards to it until all containers that use it are released.
+ */
+typedef struct _tagallocchunk
+{
+    struct _tagallocchunk* _pt_next;  /* next chunk */
+    size_t                 _t_bytes;  /* chunk size, include this header */
+}_alloc_chunk_t;
+
+typedef struct _tagallocpool
+{
+    alloc_context_t        _t_context;    /* allocator context that chunks get from */
+    size_t                 _t_nodesize;   /* node size, rounded up to the multiple of 8 */
+    void*                  _pv_freelist;  /* released nodes, linked by the first pointer of node */
+    _alloc_chunk_t*        _pt_chunk;     /* chunks of the pool */
+    _byte_t*               _pby_bump;     /* unused space of the newest chunk */
+    _byte_t*               _pby_bumpend;  /* end of the newest chunk */
+    size_t                 _t_usecount;   /* allocated node count */
+    size_t                 _t_bytes;      /* bytes held by chunks */
+    size_t                 _t_nextbatch;  /* node count of the next chunk */
+    size_t                 _t_refcount;   /* containers and pools that refer to this pool */
+    struct _tagallocpool*  _pt_forward;   /* the pool that this pool merged into */
+}_alloc_pool_t;
+
 /** exported global variable declaration section **/
 
 /** exported function prototype section **/
@@ -80,12 +213,23 @@ typedef struct _tagalloc
  */
 extern void _alloc_init(_alloc_t* pt_allocator);
 
+/**
+ * Set the allocator context of _alloc_t.
+ * @param pt_allocator  pointer that points to allocator.
+ * @param cpt_context   allocator context.
+ * @return void.
+ * @remarks if pt_allocator == NULL, then function of the behavior is undefined. the allocator must not own any memory.
+ *          if cpt_context == NULL, then the allocator gets memory from system.
+ */
+extern void _alloc_set_context(_alloc_t* pt_allocator, const alloc_context_t* cpt_context);
+
 /**
  * Destroy the _alloc_t.
  * @param pt_allocator  pointer that points to allocator.
  * @return void.
  * @remarks if pt_allocator == NULL, then function of the behavior is undefined. if pt_allocator is not initialized by
- *          _alloc_init, then function of the behavior is undefined.
+ *          _alloc_init, then function of the behavior is undefined. the memory blocks of allocator must be released
+ *          before. the allocator context is kept, so the memory of container can be released through it after destroy.
  */
 extern void _alloc_destroy(_alloc_t* pt_allocator);
 
@@ -94,9 +238,10 @@ extern void _alloc_destroy(_alloc_t* pt_allocator);
  * @param pt_allocator  pointer that points to allocator.
  * @param t_size        memory size.
  * @param t_count       memory count.
- * @return point to the allocated memory.
+ * @return point to the allocated memory, NULL if the allocator context refuses the allocation.
  * @remarks if pt_allocator == NULL, then function of the behavior is undefined. if allocator is not initialized by
  *          _alloc_init, then function of the behavior is undefined. the size of allocated memory is t_size * t_count.
+ *          the allocator without context never returns NULL.
  */
 extern void* _alloc_allocate(_alloc_t* pt_allocator, size_t t_size, size_t t_count);
 
@@ -113,6 +258,117 @@ extern void* _alloc_allocate(_alloc_t* pt_allocator, size_t t_size, size_t t_cou
  */
 extern void _alloc_deallocate(_alloc_t* pt_allocator, void* pv_allocmem, size_t t_size, size_t t_count);
 
+/**
+ * Allocate the memory of a temporary value that is released before the container function returns.
+ * @param pt_allocator  pointer that points to allocator.
+ * @param t_size        memory size.
+ * @return point to the allocated memory.
+ * @remarks if pt_allocator == NULL, then function of the behavior is undefined. if allocator is not initialized by
+ *          _alloc_init, then function of the behavior is undefined. the memory is taken from system instead of the
+ *          allocator context, so the lookup of container never fails because the context refuses the memory.
+ */
+extern void* _alloc_allocate_temp(_alloc_t* pt_allocator, size_t t_size);
+
+/**
+ * Release the memory of a temporary value.
+ * @param pt_allocator  pointer that point to allocator.
+ * @param pv_allocmem   pointer that point to allocated memory.
+ * @param t_size        allocated memory size.
+ * @return void.
+ * @remarks if pt_allocator == NULL or pv_allocmem == NULL, then function of the behavior is undefined. pv_allocmem
+ *          must be allocated by _alloc_allocate_temp with the same allocator and size.
+ */
+extern void _alloc_deallocate_temp(_alloc_t* pt_allocator, void* pv_allocmem, size_t t_size);
+
+/**
+ * Get the memory usage statistics of all allocators.
+ * @param pt_stats       statistics.
+ * @return void.
+ * @remarks if pt_stats == NULL, then function of the behavior is undefined. the size classes are shared by all
+ *          containers, so the statistics cover all of them, the memory of one container is reported by its
+ *          memory_usage function. the hit rate of one size class is _t_allochit / (_t_allochit + _t_allocmiss).
+ *          the hit and miss counts are kept when the size class is released by shrink. without
+ *          CSTL_MEMORY_MANAGEMENT all statistics are 0, the memory_usage function of container still works.
+ */
+extern void alloc_get_stats(alloc_stats_t* pt_stats);
+
+/**
+ * Get the memory that allocator holds.
+ * @param cpt_allocator  allocator.
+ * @return the bytes of memory that allocator gets from size classes, system or allocator context.
+ * @remarks if cpt_allocator == NULL, then function of the behavior is undefined. the memory blocks are counted with
+ *          the block size of their size class, the free memory blocks in the shared slabs are not counted.
+ */
+extern size_t _alloc_memory_usage(const _alloc_t* cpt_allocator);
+
+/**
+ * Release the cached memory of size classes to system.
+ * @param pt_allocator  allocator.
+ * @return void.
+ * @remarks if pt_allocator == NULL, then function of the behavior is undefined. the empty slabs of all size classes
+ *          are released and the size classes that have no slab are destroyed, the allocated memory blocks are not
+ *          affected.
+ */
+extern void _alloc_shrink(_alloc_t* pt_allocator);
+
+/**
+ * Create node pool.
+ * @param cpt_context   allocator context, NULL means system.
+ * @param t_nodesize    node size.
+ * @param t_batch       node count of the first chunk, 0 means _MEM_POOL_BATCH_MIN.
+ * @return new pool that is referred by the caller, NULL if the allocator context refuses the allocation.
+ * @remarks if t_nodesize == 0, then function of the behavior is undefined.
+ */
+extern _alloc_pool_t* _alloc_pool_create(const alloc_context_t* cpt_context, size_t t_nodesize, size_t t_batch);
+
+/**
+ * Allocate one node from pool.
+ * @param ppt_pool      the pool reference of container.
+ * @return point to the allocated node, NULL if the allocator context refuses a new chunk.
+ * @remarks if ppt_pool == NULL or *ppt_pool == NULL, then function of the behavior is undefined. if the pool has been
+ *          merged into another pool, the reference is moved to the final pool.
+ */
+extern void* _alloc_pool_allocate(_alloc_pool_t** ppt_pool);
+
+/**
+ * Release node to pool.
+ * @param ppt_pool      the pool reference of container.
+ * @param pv_node       node.
+ * @return void.
+ * @remarks if ppt_pool == NULL, *ppt_pool == NULL or pv_node == NULL, then function of the behavior is undefined.
+ *          pv_node must be allocated from the pool or the pools that merged into it.
+ */
+extern void _alloc_pool_deallocate(_alloc_pool_t** ppt_pool, void* pv_node);
+
+/**
+ * Share the pool between two containers, so nodes can move between them.
+ * @param ppt_dest      the pool reference of destination container.
+ * @param ppt_src       the pool reference of source container.
+ * @return void.
+ * @remarks if ppt_dest == NULL or ppt_src == NULL, then function of the behavior is undefined. if the two pools are
+ *          different, the source pool is merged into destination pool and both references point to it. the node
+ *          size and allocator context of two pools must be the same.
+ */
+extern void _alloc_pool_share(_alloc_pool_t** ppt_dest, _alloc_pool_t** ppt_src);
+
+/**
+ * Release the pool reference of container.
+ * @param ppt_pool      the pool reference of container.
+ * @return void.
+ * @remarks if ppt_pool == NULL, then function of the behavior is undefined. the chunks are released when the last
+ *          reference is released, all nodes must be released to the pool before. *ppt_pool is set to NULL.
+ */
+extern void _alloc_pool_release(_alloc_pool_t** ppt_pool);
+
+/**
+ * Get the memory that pool holds.
+ * @param cpt_pool      pool.
+ * @return the bytes of chunks and pool header.
+ * @remarks if cpt_pool == NULL, then return 0. the final pool of forward chain is counted, so the containers that
+ *          share the pool report the same chunks.
+ */
+extern size_t _alloc_pool_memory_usage(const _alloc_pool_t* cpt_pool);
+
 #ifndef NDEBUG
 /**
  * Test alloc_t is initialized.
@@ -127,7 +383,9 @@ extern bool_t _alloc_is_inited(const _alloc_t* cpt_allocator);
  * Set the out of memory handler and return the old handler.
  * @param pfun_newhandler  new out of memory handler.
  * @return old hanlder.
- * @remarks if pfun_newhandler == NULL, than delete the out of memory handler.
+ * @remarks if pfun_newhandler == NULL, than delete the out of memory handler. the handler is also called when the
+ *          span of size classes can not be got, the allocator lock is held then, so the handler must not use the
+ *          containers.
  */
 extern void (*_alloc_set_malloc_handler(void (*pfun_newhandler)(void)))(void);
 
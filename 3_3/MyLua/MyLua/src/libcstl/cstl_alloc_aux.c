@@ -27,16 +27,97 @@
 
 #include "cstl_alloc_aux.h"
 
+#ifdef CSTL_MEMORY_MANAGEMENT
+#   ifdef _MSC_VER
+#       include <windows.h>
+#   else
+#       include <sys/mman.h>
+#   endif
+#endif /* CSTL_MEMORY_MANAGEMENT */
+
 /** local constant declaration and local macro section **/
 
 /** local data type declaration and local struct, union, enum section **/
 
 /** local function prototype section **/
+#ifdef CSTL_MEMORY_MANAGEMENT
+/**
+ * Get the span list index of slab size.
+ * @param t_slabsize  slab size.
+ * @return span list index.
+ * @remarks if t_slabsize is not power of 2 or less than _MEM_SLAB_MIN_SIZE, then the function of behavior is
+ *          undefined.
+ */
+static size_t _alloc_get_span_index(size_t t_slabsize);
+
+/**
+ * Link span to the head of span list.
+ * @param ppt_list  span list.
+ * @param pt_span   span.
+ * @return void.
+ */
+static void _alloc_link_span(_memspan_t** ppt_list, _memspan_t* pt_span);
+
+/**
+ * Unlink span from span list.
+ * @param ppt_list  span list.
+ * @param pt_span   span.
+ * @return void.
+ * @remarks if pt_span is not in ppt_list, then the function of behavior is undefined.
+ */
+static void _alloc_unlink_span(_memspan_t** ppt_list, _memspan_t* pt_span);
+
+/**
+ * Map the memory of span that is aligned to the slab size.
+ * @param pt_span  span that slab size and slab count are set.
+ * @return false if system can not give the memory, otherwise true.
+ * @remarks on windows the memory is reserved only and the slabs are committed when they are carved, on other systems
+ *          the pages are committed when they are touched.
+ */
+static bool_t _alloc_map_span(_memspan_t* pt_span);
+
+/**
+ * Unmap the memory of span.
+ * @param pt_span  span.
+ * @return void.
+ */
+static void _alloc_unmap_span(_memspan_t* pt_span);
+
+/**
+ * Commit the memory of slab.
+ * @param pby_slab    slab.
+ * @param t_slabsize  slab size.
+ * @return false if system can not give the memory, otherwise true.
+ * @remarks the pages are committed when they are touched except on windows.
+ */
+static bool_t _alloc_commit_slab(_byte_t* pby_slab, size_t t_slabsize);
+
+/**
+ * Give the memory of slab back to system and keep its address space.
+ * @param pby_slab    slab.
+ * @param t_slabsize  slab size.
+ * @return void.
+ * @remarks the content of slab is lost.
+ */
+static void _alloc_decommit_slab(_byte_t* pby_slab, size_t t_slabsize);
+
+/**
+ * Call the out of memory handler when the span or slab can not be got from system.
+ * @return void.
+ * @remarks the program exits when there is no out of memory handler.
+ */
+static void _alloc_span_out_of_memory(void);
+#endif /* CSTL_MEMORY_MANAGEMENT */
 
 /** exported global variable definition section **/
 void (*_gpfun_malloc_handler)(void) = NULL;
 
 /** local global variable definition section **/
+#ifdef CSTL_MEMORY_MANAGEMENT
+static _memspan_t* _gapt_memspan[_MEM_SLAB_SIZE_COUNT];  /* spans that have free slab, one list for each slab size */
+static _memspan_t* _gapt_memspanfull[_MEM_SLAB_SIZE_COUNT]; /* spans that all slabs are used */
+static size_t      _gt_spanbytes = 0;                    /* bytes of committed slabs */
+#endif /* CSTL_MEMORY_MANAGEMENT */
 
 /** exported function implementation section **/
 /**
@@ -84,127 +165,448 @@ void _alloc_free(void* pv_allocmem)
     free(pv_allocmem);
 }
 
+/**
+ * Malloc memory from allocator context.
+ */
+void* _alloc_malloc_context(const alloc_context_t* cpt_context, size_t t_memsize)
+{
+    void* pv_allocmem = NULL;
+
+    if (cpt_context == NULL || cpt_context->_pfun_realloc == NULL) {
+        return _alloc_malloc(t_memsize);
+    }
+
+    /* the owner of context decides what to do when it refuses the memory, so the failure is returned */
+    pv_allocmem = cpt_context->_pfun_realloc(cpt_context->_pv_userdata, NULL, 0, t_memsize);
+
+    return pv_allocmem;
+}
+
+/**
+ * Free memory to allocator context.
+ */
+void _alloc_free_context(const alloc_context_t* cpt_context, void* pv_allocmem, size_t t_memsize)
+{
+    assert(pv_allocmem != NULL);
+
+    if (cpt_context == NULL || cpt_context->_pfun_realloc == NULL) {
+        _alloc_free(pv_allocmem);
+    } else {
+        cpt_context->_pfun_realloc(cpt_context->_pv_userdata, pv_allocmem, t_memsize, 0);
+    }
+}
+
 #ifdef CSTL_MEMORY_MANAGEMENT
 /**
- * Apply a formated memory list.
+ * Get the size class index of memory size.
+ */
+size_t _alloc_get_class_index(size_t t_memsize)
+{
+    size_t t_shift = 0;     /* the highest bit of t_memsize - 1 */
+    size_t t_value = 0;
+
+    assert(t_memsize > _MEM_SMALL_CLASS_MAX && t_memsize <= _MEM_SMALL_MEM_SIZE_MAX);
+
+    for (t_value = (t_memsize - 1) >> 1; t_value != 0; t_value >>= 1) {
+        t_shift++;
+    }
+
+    /* _MEM_SMALL_CLASS_MAX is 2^7, every power of two step holds _MEM_LARGE_CLASS_STEPS classes */
+    return _MEM_SMALL_CLASS_COUNT + (t_shift - 7) * _MEM_LARGE_CLASS_STEPS +
+           ((t_memsize - 1) >> (t_shift - 2)) - _MEM_LARGE_CLASS_STEPS;
+}
+
+/**
+ * Get the memory block size of size class.
  */
-void _alloc_apply_formated_memory(_alloc_t* pt_allocator, size_t t_allocsize)
+size_t _alloc_get_class_size(size_t t_index)
 {
-    size_t      t_alloccount = _MEM_CHUNK_COUNT;
+    size_t t_step = 0;
+
+    assert(t_index < _MEM_LINK_COUNT);
+
+    if (t_index < _MEM_SMALL_CLASS_COUNT) {
+        return (t_index + 1) * _MEM_ALIGNMENT;
+    }
+
+    t_step = t_index - _MEM_SMALL_CLASS_COUNT;
+    return (t_step % _MEM_LARGE_CLASS_STEPS + _MEM_LARGE_CLASS_STEPS + 1) << (t_step / _MEM_LARGE_CLASS_STEPS + 5);
+}
+
+/**
+ * Create size class.
+ */
+_memclass_t* _alloc_create_memclass(size_t t_index)
+{
+    _memclass_t* pt_class = (_memclass_t*)_alloc_malloc(sizeof(_memclass_t));
+    size_t       t_needsize = 0;
+
+    pt_class->_t_blocksize = _alloc_get_class_size(t_index);
+    t_needsize = _MEM_ROUND_UP(sizeof(_memslab_t)) + pt_class->_t_blocksize * _MEM_SLAB_MIN_BLOCKS;
+    for (pt_class->_t_slabsize = _MEM_SLAB_MIN_SIZE; pt_class->_t_slabsize < t_needsize; pt_class->_t_slabsize <<= 1) {
+        continue;
+    }
+    pt_class->_t_blockcount = (pt_class->_t_slabsize - _MEM_ROUND_UP(sizeof(_memslab_t))) / pt_class->_t_blocksize;
+
+    pt_class->_pt_partial = NULL;
+    pt_class->_pt_full = NULL;
+    pt_class->_pt_empty = NULL;
+    pt_class->_t_emptycount = 0;
+    pt_class->_t_slabcount = 0;
+    pt_class->_t_usecount = 0;
+
+    return pt_class;
+}
+
+/**
+ * Destroy size class and release all slabs of it to system.
+ */
+void _alloc_destroy_memclass(_memclass_t* pt_class)
+{
+    _memslab_t*  apt_list[3];
+    _memslab_t*  pt_slab = NULL;
+    size_t       i = 0;
+
+    assert(pt_class != NULL);
+
+    apt_list[0] = pt_class->_pt_partial;
+    apt_list[1] = pt_class->_pt_full;
+    apt_list[2] = pt_class->_pt_empty;
+    for (i = 0; i < sizeof(apt_list) / sizeof(apt_list[0]); ++i) {
+        while (apt_list[i] != NULL) {
+            pt_slab = apt_list[i];
+            apt_list[i] = pt_slab->_pt_next;
+            _alloc_free_slab(pt_slab);
+        }
+    }
+
+    _alloc_free(pt_class);
+}
+
+/**
+ * Get a slab that all memory blocks are free.
+ */
+_memslab_t* _alloc_get_slab(_memclass_t* pt_class)
+{
+    _memslab_t* pt_slab = NULL;
     _memlink_t* pt_link = NULL;
     size_t      i = 0;
 
-    assert(pt_allocator != NULL);
+    assert(pt_class != NULL);
+
+    if (pt_class->_pt_empty != NULL) {
+        pt_slab = pt_class->_pt_empty;
+        _alloc_unlink_slab(&pt_class->_pt_empty, pt_slab);
+        pt_class->_t_emptycount--;
+        return pt_slab;
+    }
 
-    pt_link = (_memlink_t*)_alloc_get_memory_chunk(pt_allocator, t_allocsize, &t_alloccount);
-    assert(pt_link != NULL);
+    pt_slab = _alloc_malloc_slab(pt_class->_t_slabsize);
+    pt_slab->_pt_prev = NULL;
+    pt_slab->_pt_next = NULL;
+    pt_slab->_t_usecount = 0;
 
-    /* format the apply memory block to memory list format */
-    pt_allocator->_apt_memlink[_MEM_LINK_INDEX(t_allocsize)] = pt_link;
-    for (i = 0; i < t_alloccount; ++i) {
-        if (i == t_alloccount - 1) {
+    /* format the slab to memory list format */
+    pt_link = (_memlink_t*)((_byte_t*)pt_slab + _MEM_ROUND_UP(sizeof(_memslab_t)));
+    pt_slab->_pt_freelist = pt_link;
+    for (i = 0; i < pt_class->_t_blockcount; ++i) {
+        if (i == pt_class->_t_blockcount - 1) {
             pt_link->_pui_nextmem = NULL;
         } else {
-            pt_link->_pui_nextmem = (_memlink_t*)((_byte_t*)pt_link + t_allocsize);
+            pt_link->_pui_nextmem = (_memlink_t*)((_byte_t*)pt_link + pt_class->_t_blocksize);
         }
         pt_link = pt_link->_pui_nextmem;
     }
+    pt_class->_t_slabcount++;
+
+    return pt_slab;
 }
 
 /**
- * Get memory chunk from memory pool.
+ * Put the empty slab back.
  */
-_byte_t* _alloc_get_memory_chunk(_alloc_t* pt_allocator, size_t t_allocsize, size_t* pt_alloccount)
+void _alloc_put_slab(_memclass_t* pt_class, _memslab_t* pt_slab)
 {
-    size_t    t_totalsize = 0;     /* total size of alloc */
-    _byte_t*  pby_allocmem = NULL;  /* the allocated memory block */
-    size_t    t_getmemsize = 0;    /* bytes to get memory from system heap */
-    size_t    i = 0;
+    assert(pt_class != NULL);
+    assert(pt_slab != NULL);
+    assert(pt_slab->_t_usecount == 0);
 
-    assert(pt_allocator != NULL);
-    assert(pt_alloccount != NULL);
+    if (pt_class->_t_emptycount < _MEM_SLAB_EMPTY_CACHED) {
+        _alloc_link_slab(&pt_class->_pt_empty, pt_slab);
+        pt_class->_t_emptycount++;
+    } else {
+        _alloc_free_slab(pt_slab);
+        pt_class->_t_slabcount--;
+    }
+}
 
-    t_totalsize = t_allocsize * (*pt_alloccount);
+/**
+ * Link slab to the head of slab list.
+ */
+void _alloc_link_slab(_memslab_t** ppt_list, _memslab_t* pt_slab)
+{
+    assert(ppt_list != NULL);
+    assert(pt_slab != NULL);
 
-    if (pt_allocator->_t_mempoolsize >= t_totalsize) {
-        pby_allocmem = pt_allocator->_pby_mempool;
-        pt_allocator->_pby_mempool = pby_allocmem + t_totalsize;
-        pt_allocator->_t_mempoolsize -= t_totalsize;
-        
-        return pby_allocmem;
-    } else if (pt_allocator->_t_mempoolsize >= t_allocsize) {
-        *pt_alloccount = pt_allocator->_t_mempoolsize / t_allocsize;
-        t_totalsize = t_allocsize * (*pt_alloccount);
+    pt_slab->_pt_prev = NULL;
+    pt_slab->_pt_next = *ppt_list;
+    if (*ppt_list != NULL) {
+        (*ppt_list)->_pt_prev = pt_slab;
+    }
+    *ppt_list = pt_slab;
+}
 
-        pby_allocmem = pt_allocator->_pby_mempool;
-        pt_allocator->_pby_mempool = pby_allocmem + t_totalsize;
-        pt_allocator->_t_mempoolsize -= t_totalsize;
+/**
+ * Unlink slab from slab list.
+ */
+void _alloc_unlink_slab(_memslab_t** ppt_list, _memslab_t* pt_slab)
+{
+    assert(ppt_list != NULL);
+    assert(pt_slab != NULL);
 
-        return pby_allocmem;
+    if (pt_slab->_pt_prev != NULL) {
+        pt_slab->_pt_prev->_pt_next = pt_slab->_pt_next;
     } else {
-        /* if the memory pool conatiner is full */
-        assert(pt_allocator->_t_mempoolindex <= pt_allocator->_t_mempoolcount);
-        /* take the small memory block to the memory list */
-        if (pt_allocator->_t_mempoolsize > 0) {
-            ((_memlink_t*)pt_allocator->_pby_mempool)->_pui_nextmem = 
-                pt_allocator->_apt_memlink[_MEM_LINK_INDEX(pt_allocator->_t_mempoolsize)];
-            pt_allocator->_apt_memlink[_MEM_LINK_INDEX(pt_allocator->_t_mempoolsize)] =
-                (_memlink_t*)pt_allocator->_pby_mempool;
-            pt_allocator->_t_mempoolsize = 0;
-        }
-
-        t_getmemsize = 2 * t_totalsize;
-        pt_allocator->_pby_mempool = (_byte_t*)malloc(t_getmemsize);
-
-        if (pt_allocator->_pby_mempool == NULL) {
-            /* search the memory list for unuse memory that meet the size */
-            for (i = t_allocsize; i < _MEM_SMALL_MEM_SIZE_MAX; i += _MEM_ALIGNMENT) {
-                pt_allocator->_pby_mempool = (_byte_t*)pt_allocator->_apt_memlink[_MEM_LINK_INDEX(i)];
-                if (pt_allocator->_pby_mempool != NULL) {
-                    pt_allocator->_apt_memlink[_MEM_LINK_INDEX(i)] = ((_memlink_t*)pt_allocator->_pby_mempool)->_pui_nextmem;
-                    pt_allocator->_t_mempoolsize = i;
+        assert(*ppt_list == pt_slab);
+        *ppt_list = pt_slab->_pt_next;
+    }
+    if (pt_slab->_pt_next != NULL) {
+        pt_slab->_pt_next->_pt_prev = pt_slab->_pt_prev;
+    }
+    pt_slab->_pt_prev = NULL;
+    pt_slab->_pt_next = NULL;
+}
 
-                    return _alloc_get_memory_chunk(pt_allocator, t_allocsize, pt_alloccount);
-                }
-            }
-            pt_allocator->_pby_mempool = (_byte_t*)_alloc_malloc_out_of_memory(t_getmemsize);
+/**
+ * Malloc slab that aligned to its size.
+ */
+_memslab_t* _alloc_malloc_slab(size_t t_slabsize)
+{
+    size_t       t_spanindex = _alloc_get_span_index(t_slabsize);
+    _memspan_t** ppt_list = &_gapt_memspan[t_spanindex];
+    _memspan_t*  pt_span = *ppt_list;
+    _memslab_t*  pt_slab = NULL;
+    size_t       t_slabindex = 0;
+
+    if (pt_span == NULL) {
+        pt_span = (_memspan_t*)_alloc_malloc(sizeof(_memspan_t));
+        pt_span->_t_slabsize = t_slabsize;
+        pt_span->_t_slabcount = t_slabsize < _MEM_SPAN_SIZE ? _MEM_SPAN_SIZE / t_slabsize : 1;
+        while (!_alloc_map_span(pt_span)) {
+            _alloc_span_out_of_memory();
         }
+        pt_span->_t_freemask = ((((size_t)1 << (pt_span->_t_slabcount - 1)) - 1) << 1) | 1;
+        pt_span->_t_usecount = 0;
+        _alloc_link_span(ppt_list, pt_span);
+    }
 
-        /* if the memory pool container is full */
-        if (pt_allocator->_t_mempoolindex == pt_allocator->_t_mempoolcount) {
-            _byte_t** ppby_oldmempool = pt_allocator->_ppby_mempoolcontainer;
-
-            pt_allocator->_t_mempoolcount += _MEM_POOL_DEFAULT_COUNT;
-            pt_allocator->_ppby_mempoolcontainer = (_byte_t**)malloc(pt_allocator->_t_mempoolcount * sizeof(_byte_t*));
-            if (pt_allocator->_ppby_mempoolcontainer != NULL) {
-                for (i = 0; i < pt_allocator->_t_mempoolcount; ++i) {
-                    pt_allocator->_ppby_mempoolcontainer[i] = NULL;
-                }
-                memcpy(pt_allocator->_ppby_mempoolcontainer, ppby_oldmempool,
-                    (pt_allocator->_t_mempoolcount - _MEM_POOL_DEFAULT_COUNT) * sizeof(_byte_t*));
-                free(ppby_oldmempool);
-                assert(pt_allocator->_t_mempoolindex < pt_allocator->_t_mempoolcount);
-            } else {
-                fprintf(stderr, "CSTL FATAL ERROR: memory allocation error!\n");
-                exit(EXIT_FAILURE);
-            }
-        }
-        pt_allocator->_ppby_mempoolcontainer[pt_allocator->_t_mempoolindex++] = pt_allocator->_pby_mempool;
+    /* the lowest free slab is used, so the slabs at the end of span are seldom committed */
+    assert(pt_span->_t_freemask != 0);
+    while ((pt_span->_t_freemask & ((size_t)1 << t_slabindex)) == 0) {
+        t_slabindex++;
+    }
+    pt_slab = (_memslab_t*)(pt_span->_pby_mem + t_slabindex * t_slabsize);
+    while (!_alloc_commit_slab((_byte_t*)pt_slab, t_slabsize)) {
+        _alloc_span_out_of_memory();
+    }
+    pt_span->_t_freemask &= ~((size_t)1 << t_slabindex);
+    pt_span->_t_usecount++;
+    if (pt_span->_t_usecount == pt_span->_t_slabcount) {
+        _alloc_unlink_span(ppt_list, pt_span);
+        _alloc_link_span(&_gapt_memspanfull[t_spanindex], pt_span);
+    }
+    _gt_spanbytes += t_slabsize;
+    pt_slab->_pt_span = pt_span;
 
-        /* apply memory from system heap success or call _alloc_malloc_out_of_memory success */
-        pt_allocator->_t_mempoolsize = t_getmemsize;
+    return pt_slab;
+}
 
-        pby_allocmem = pt_allocator->_pby_mempool;
-        pt_allocator->_pby_mempool = pby_allocmem + t_totalsize;
-        pt_allocator->_t_mempoolsize -= t_totalsize;
+/**
+ * Free slab.
+ */
+void _alloc_free_slab(_memslab_t* pt_slab)
+{
+    _memspan_t*  pt_span = NULL;
+    _memspan_t** ppt_list = NULL;
+    size_t       t_spanindex = 0;
+    size_t       t_slabindex = 0;
+
+    assert(pt_slab != NULL);
+    assert(pt_slab->_pt_span != NULL);
+
+    pt_span = pt_slab->_pt_span;
+    t_spanindex = _alloc_get_span_index(pt_span->_t_slabsize);
+    ppt_list = &_gapt_memspan[t_spanindex];
+    t_slabindex = (size_t)((_byte_t*)pt_slab - pt_span->_pby_mem) / pt_span->_t_slabsize;
+    assert(pt_span->_t_usecount > 0);
+    assert((pt_span->_t_freemask & ((size_t)1 << t_slabindex)) == 0);
+    if (pt_span->_t_usecount == pt_span->_t_slabcount) {
+        _alloc_unlink_span(&_gapt_memspanfull[t_spanindex], pt_span);
+        _alloc_link_span(ppt_list, pt_span);
+    }
+    pt_span->_t_usecount--;
+    _gt_spanbytes -= pt_span->_t_slabsize;
 
-        return pby_allocmem;
+    if (pt_span->_t_usecount == 0) {
+        _alloc_unlink_span(ppt_list, pt_span);
+        _alloc_unmap_span(pt_span);
+        _alloc_free(pt_span);
+    } else {
+        /* the header of slab is lost too, the free slab is found by the mask of span */
+        _alloc_decommit_slab((_byte_t*)pt_slab, pt_span->_t_slabsize);
+        pt_span->_t_freemask |= (size_t)1 << t_slabindex;
     }
 }
 
+/**
+ * Get the memory of all spans.
+ */
+size_t _alloc_get_span_bytes(void)
+{
+    return _gt_spanbytes;
+}
+
 #endif /* CSTL_MEMORY_MANAGEMENT */
 
 /** local function implementation section **/
+#ifdef CSTL_MEMORY_MANAGEMENT
+/**
+ * Get the span list index of slab size.
+ */
+static size_t _alloc_get_span_index(size_t t_slabsize)
+{
+    size_t t_index = 0;
+
+    assert(t_slabsize >= _MEM_SLAB_MIN_SIZE);
+
+    for (t_slabsize /= _MEM_SLAB_MIN_SIZE; t_slabsize > 1; t_slabsize >>= 1) {
+        t_index++;
+    }
+    assert(t_index < _MEM_SLAB_SIZE_COUNT);
+
+    return t_index;
+}
+
+/**
+ * Link span to the head of span list.
+ */
+static void _alloc_link_span(_memspan_t** ppt_list, _memspan_t* pt_span)
+{
+    assert(ppt_list != NULL);
+    assert(pt_span != NULL);
+
+    pt_span->_pt_prev = NULL;
+    pt_span->_pt_next = *ppt_list;
+    if (*ppt_list != NULL) {
+        (*ppt_list)->_pt_prev = pt_span;
+    }
+    *ppt_list = pt_span;
+}
+
+/**
+ * Unlink span from span list.
+ */
+static void _alloc_unlink_span(_memspan_t** ppt_list, _memspan_t* pt_span)
+{
+    assert(ppt_list != NULL);
+    assert(pt_span != NULL);
+
+    if (pt_span->_pt_prev != NULL) {
+        pt_span->_pt_prev->_pt_next = pt_span->_pt_next;
+    } else {
+        assert(*ppt_list == pt_span);
+        *ppt_list = pt_span->_pt_next;
+    }
+    if (pt_span->_pt_next != NULL) {
+        pt_span->_pt_next->_pt_prev = pt_span->_pt_prev;
+    }
+    pt_span->_pt_prev = NULL;
+    pt_span->_pt_next = NULL;
+}
+
+/**
+ * Map the memory of span that is aligned to the slab size.
+ */
+static bool_t _alloc_map_span(_memspan_t* pt_span)
+{
+    assert(pt_span != NULL);
+
+#ifdef _MSC_VER
+    /* the extra slab size makes room for the alignment, it is reserved only */
+    pt_span->_t_mapsize = pt_span->_t_slabsize * (pt_span->_t_slabcount + 1);
+    pt_span->_pv_map = VirtualAlloc(NULL, pt_span->_t_mapsize, MEM_RESERVE, PAGE_NOACCESS);
+    if (pt_span->_pv_map == NULL) {
+        return false;
+    }
+    pt_span->_pby_mem = (_byte_t*)(((size_t)pt_span->_pv_map + pt_span->_t_slabsize - 1) &
+                                   ~(pt_span->_t_slabsize - 1));
+#else
+    /* the span is heap memory, so the leak checkers still see the pointers that are kept in slabs */
+    pt_span->_t_mapsize = pt_span->_t_slabsize * pt_span->_t_slabcount;
+    if (posix_memalign(&pt_span->_pv_map, pt_span->_t_slabsize, pt_span->_t_mapsize) != 0) {
+        return false;
+    }
+    pt_span->_pby_mem = (_byte_t*)pt_span->_pv_map;
+#endif
+
+    return true;
+}
+
+/**
+ * Unmap the memory of span.
+ */
+static void _alloc_unmap_span(_memspan_t* pt_span)
+{
+    assert(pt_span != NULL);
+
+#ifdef _MSC_VER
+    VirtualFree(pt_span->_pv_map, 0, MEM_RELEASE);
+#else
+    free(pt_span->_pv_map);
+#endif
+}
+
+/**
+ * Commit the memory of slab.
+ */
+static bool_t _alloc_commit_slab(_byte_t* pby_slab, size_t t_slabsize)
+{
+    assert(pby_slab != NULL);
+
+#ifdef _MSC_VER
+    return VirtualAlloc(pby_slab, t_slabsize, MEM_COMMIT, PAGE_READWRITE) != NULL;
+#else
+    (void)t_slabsize;
+    return true;
+#endif
+}
+
+/**
+ * Give the memory of slab back to system and keep its address space.
+ */
+static void _alloc_decommit_slab(_byte_t* pby_slab, size_t t_slabsize)
+{
+    assert(pby_slab != NULL);
+
+#ifdef _MSC_VER
+    VirtualFree(pby_slab, t_slabsize, MEM_DECOMMIT);
+#else
+    madvise(pby_slab, t_slabsize, MADV_DONTNEED);
+#endif
+}
+
+/**
+ * Call the out of memory handler when the span or slab can not be got from system.
+ */
+static void _alloc_span_out_of_memory(void)
+{
+    if (_gpfun_malloc_handler == NULL) {
+        fprintf(stderr, "CSTL FATAL ERROR: memory allocation error!\n");
+        exit(EXIT_FAILURE);
+    }
+    (*_gpfun_malloc_handler)();
+}
+#endif /* CSTL_MEMORY_MANAGEMENT */
 
 /** eof **/
 
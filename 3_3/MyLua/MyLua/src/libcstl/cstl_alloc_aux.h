@@ -59,30 +59,147 @@ extern void* _alloc_malloc(size_t t_memsize);
  */
 extern void _alloc_free(void* pv_allocmem);
 
+/**
+ * Malloc memory from allocator context.
+ * @param cpt_context  allocator context.
+ * @param t_memsize    memory size.
+ * @return point to the allocated memory, NULL if the context refuses the allocation.
+ * @remarks if cpt_context == NULL or the allocate function of context is NULL, then the memory is allocated from
+ *          system and the out of memory handler is called when system can not allocate memory. the failure of
+ *          context is returned to the caller, the out of memory handler is not called for it.
+ */
+extern void* _alloc_malloc_context(const alloc_context_t* cpt_context, size_t t_memsize);
+
+/**
+ * Free memory to allocator context.
+ * @param cpt_context  allocator context.
+ * @param pv_allocmem  memory.
+ * @param t_memsize    memory size.
+ * @return void.
+ * @remarks if pv_allocmem == NULL, then the function of behavior is undefined. pv_allocmem must be allocated by
+ *          _alloc_malloc_context with the same context and size.
+ */
+extern void _alloc_free_context(const alloc_context_t* cpt_context, void* pv_allocmem, size_t t_memsize);
+
+/**
+ * Test the two allocator contexts are the same.
+ * @param cpt_first   first allocator context.
+ * @param cpt_second  second allocator context.
+ * @return if the two contexts have the same function and user data return true, otherwise return false.
+ */
+#define _alloc_same_context(cpt_first, cpt_second)\
+    ((cpt_first)->_pfun_realloc == (cpt_second)->_pfun_realloc &&\
+     (cpt_first)->_pv_userdata == (cpt_second)->_pv_userdata)
+
 #ifdef CSTL_MEMORY_MANAGEMENT
+/*
+ * The size classes and spans are shared by all threads, the functions below that change them or read their counters
+ * are called by cstl_alloc.c with the allocator lock held.
+ */
+
+/**
+ * Get the size class index of memory size.
+ * @param t_memsize  memory size.
+ * @return size class index.
+ * @remarks if t_memsize <= _MEM_SMALL_CLASS_MAX or t_memsize > _MEM_SMALL_MEM_SIZE_MAX, then the function of
+ *          behavior is undefined.
+ */
+extern size_t _alloc_get_class_index(size_t t_memsize);
+
+/**
+ * Get the memory block size of size class.
+ * @param t_index  size class index.
+ * @return memory block size.
+ * @remarks if t_index >= _MEM_LINK_COUNT, then the function of behavior is undefined.
+ */
+extern size_t _alloc_get_class_size(size_t t_index);
+
+/**
+ * Create size class.
+ * @param t_index  size class index.
+ * @return pointer that point to size class.
+ * @remarks the slab size is the power of 2 that hold _MEM_SLAB_MIN_BLOCKS memory blocks at least.
+ */
+extern _memclass_t* _alloc_create_memclass(size_t t_index);
+
 /**
- * Apply a formated memory list.
- * @param pt_allocator  pointer that point to allocator.
- * @param t_allocsize   the size of allocated memory.
+ * Destroy size class and release all slabs of it to system.
+ * @param pt_class  pointer that point to size class.
  * @return void.
- * @remarks if pt_allocator == NULL then the function of behavior is undefined.
+ * @remarks if pt_class == NULL, then the function of behavior is undefined.
  */
-extern void _alloc_apply_formated_memory(_alloc_t* pt_allocator, size_t t_allocsize);
+extern void _alloc_destroy_memclass(_memclass_t* pt_class);
 
 /**
- * Get memory chunk from memory pool.
- * @param pt_allocator   pointer pointes to allocator.
- * @param t_allocsize    the size of allocated memory chunk.
- * @param pn_alloccount  the number of allocated memory chunk.
- * @return pointer pointes to allocated chunk.
- * @remarks if pt_allocator == NULL or pn_alloccount == NULL, then the function of behavior is undefined.
- *          if the total size of allocated memory chunk is less than the size of memory pool, then allocated
- *          memory chunk from memory pool directly. if the size of memory pool is less than total size of
- *          allocated memory chunk, but greater than or equal to the size of only one memory chunk, than
- *          allocated appropriate number of memory chunk, then update the allocate count. otherwise allocated
- *          larger memory pool from allocated memory chunk.
+ * Get a slab that all memory blocks are free.
+ * @param pt_class  pointer that point to size class.
+ * @return pointer that point to slab.
+ * @remarks if pt_class == NULL, then the function of behavior is undefined. the cached empty slab is used first,
+ *          otherwise a new slab is applied from system and formated to memory list.
+ */
+extern _memslab_t* _alloc_get_slab(_memclass_t* pt_class);
+
+/**
+ * Put the empty slab back.
+ * @param pt_class  pointer that point to size class.
+ * @param pt_slab   pointer that point to empty slab.
+ * @return void.
+ * @remarks if pt_class == NULL or pt_slab == NULL, then the function of behavior is undefined. the slab is cached
+ *          when the class has less than _MEM_SLAB_EMPTY_CACHED empty slabs, otherwise it is released to system.
+ */
+extern void _alloc_put_slab(_memclass_t* pt_class, _memslab_t* pt_slab);
+
+/**
+ * Get the slab that memory block belongs to.
+ * @param cpt_class    pointer that point to size class.
+ * @param pv_allocmem  memory block.
+ * @return pointer that point to slab.
+ */
+#define _alloc_get_slab_of_memory(cpt_class, pv_allocmem)\
+    ((_memslab_t*)((_byte_t*)(pv_allocmem) - ((size_t)(pv_allocmem) & ((cpt_class)->_t_slabsize - 1))))
+
+/**
+ * Malloc slab that aligned to its size.
+ * @param t_slabsize  slab size.
+ * @return pointer that point to slab, only the _pt_span of slab header is set.
+ * @remarks if t_slabsize is not power of 2 or less than _MEM_SLAB_MIN_SIZE, then the function of behavior is
+ *          undefined. the slab is carved from a span that has free slab and committed, a new span is applied from
+ *          system when there is no such span. the out of memory handler is called when system can not give the
+ *          memory.
+ */
+extern _memslab_t* _alloc_malloc_slab(size_t t_slabsize);
+
+/**
+ * Free slab.
+ * @param pt_slab  slab.
+ * @return void.
+ * @remarks if pt_slab is not allocated by _alloc_malloc_slab, then the function of behavior is undefined. the slab is
+ *          decommitted, the span of slab is released to system when all its slabs are free.
+ */
+extern void _alloc_free_slab(_memslab_t* pt_slab);
+
+/**
+ * Get the memory of all spans.
+ * @return the bytes of slabs that are committed.
+ */
+extern size_t _alloc_get_span_bytes(void);
+
+/**
+ * Link slab to the head of slab list.
+ * @param ppt_list  slab list.
+ * @param pt_slab   slab.
+ * @return void.
+ */
+extern void _alloc_link_slab(_memslab_t** ppt_list, _memslab_t* pt_slab);
+
+/**
+ * Unlink slab from slab list.
+ * @param ppt_list  slab list.
+ * @param pt_slab   slab.
+ * @return void.
+ * @remarks if pt_slab is not in ppt_list, then the function of behavior is undefined.
  */
-extern _byte_t* _alloc_get_memory_chunk(_alloc_t* pt_allocator, size_t t_allocsize, size_t* pt_alloccount);
+extern void _alloc_unlink_slab(_memslab_t** ppt_list, _memslab_t* pt_slab);
 
 #endif /* CSTL_MEMORY_MANAGEMENT */
 
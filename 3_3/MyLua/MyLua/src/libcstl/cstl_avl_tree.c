@@ -79,6 +79,9 @@ void _avl_tree_init(_avl_tree_t* pt_avl_tree, bfun_t t_compare)
     } else {
         pt_avl_tree->_t_compare = _GET_AVL_TREE_TYPE_LESS_FUNCTION(pt_avl_tree);
     }
+    /* the default compare function can be replaced by the less function without output */
+    pt_avl_tree->_t_fastcompare = pt_avl_tree->_t_compare == _GET_AVL_TREE_TYPE_LESS_FUNCTION(pt_avl_tree) ?
+        _GET_AVL_TREE_TYPE_LESS_FAST_FUNCTION(pt_avl_tree) : NULL;
 }
 
 /**
@@ -436,16 +439,14 @@ _avl_tree_iterator_t _avl_tree_lower_bound(const _avl_tree_t* cpt_avl_tree, cons
     if (!_avl_tree_empty(cpt_avl_tree)) {
         pt_prev = cpt_avl_tree->_t_avlroot._pt_parent;
 
-        b_less = b_greater = _GET_AVL_TREE_TYPE_SIZE(cpt_avl_tree);
-        _avl_tree_elem_compare_auxiliary(cpt_avl_tree, cpv_value, pt_prev->_pby_data, &b_less);
-        _avl_tree_elem_compare_auxiliary(cpt_avl_tree, pt_prev->_pby_data, cpv_value, &b_greater);
+        b_less = _avl_tree_elem_less_auxiliary(cpt_avl_tree, cpv_value, pt_prev->_pby_data);
+        b_greater = _avl_tree_elem_less_auxiliary(cpt_avl_tree, pt_prev->_pby_data, cpv_value);
 
         pt_cur = (b_less || !b_greater) ? pt_prev->_pt_left : pt_prev->_pt_right;
         while (pt_cur != NULL) {
             pt_prev = pt_cur;
-            b_less = b_greater = _GET_AVL_TREE_TYPE_SIZE(cpt_avl_tree);
-            _avl_tree_elem_compare_auxiliary(cpt_avl_tree, cpv_value, pt_prev->_pby_data, &b_less);
-            _avl_tree_elem_compare_auxiliary(cpt_avl_tree, pt_prev->_pby_data, cpv_value, &b_greater);
+            b_less = _avl_tree_elem_less_auxiliary(cpt_avl_tree, cpv_value, pt_prev->_pby_data);
+            b_greater = _avl_tree_elem_less_auxiliary(cpt_avl_tree, pt_prev->_pby_data, cpv_value);
 
             pt_cur = (b_less || !b_greater) ? pt_prev->_pt_left : pt_prev->_pt_right;
         }
@@ -485,15 +486,13 @@ _avl_tree_iterator_t _avl_tree_upper_bound(const _avl_tree_t* cpt_avl_tree, cons
 
     if (!_avl_tree_empty(cpt_avl_tree)) {
         pt_prev = cpt_avl_tree->_t_avlroot._pt_parent;
-        b_result = _GET_AVL_TREE_TYPE_SIZE(cpt_avl_tree);
-        _avl_tree_elem_compare_auxiliary(cpt_avl_tree, cpv_value, pt_prev->_pby_data, &b_result);
+        b_result = _avl_tree_elem_less_auxiliary(cpt_avl_tree, cpv_value, pt_prev->_pby_data);
 
         pt_cur = b_result ? pt_prev->_pt_left : pt_prev->_pt_right;
         while(pt_cur != NULL)
         {
             pt_prev = pt_cur;
-            b_result = _GET_AVL_TREE_TYPE_SIZE(cpt_avl_tree);
-            _avl_tree_elem_compare_auxiliary(cpt_avl_tree, cpv_value, pt_prev->_pby_data, &b_result);
+            b_result = _avl_tree_elem_less_auxiliary(cpt_avl_tree, cpv_value, pt_prev->_pby_data);
 
             pt_cur = b_result ? pt_prev->_pt_left : pt_prev->_pt_right;
         }
@@ -1207,6 +1206,17 @@ size_t _avl_tree_erase(_avl_tree_t* pt_avl_tree, const void* cpv_value)
     return t_count;
 }
 
+/**
+ * Get the memory that avl tree allocates.
+ */
+size_t _avl_tree_memory_usage(const _avl_tree_t* cpt_avl_tree)
+{
+    assert(cpt_avl_tree != NULL);
+    assert(_avl_tree_is_inited(cpt_avl_tree));
+
+    return _alloc_memory_usage(&cpt_avl_tree->_t_allocator);
+}
+
 /** local function implementation section **/
 
 /** eof **/
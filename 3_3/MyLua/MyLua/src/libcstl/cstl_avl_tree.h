@@ -482,6 +482,15 @@ extern void _avl_tree_erase_range(_avl_tree_t* pt_avl_tree, _avl_tree_iterator_t
  */
 extern size_t _avl_tree_erase(_avl_tree_t* pt_avl_tree, const void* cpv_value);
 
+/**
+ * Get the memory that avl tree allocates.
+ * @param cpt_avl_tree      avl tree container.
+ * @return the bytes of nodes.
+ * @remarks if cpt_avl_tree == NULL then the behavior is undefined. cpt_avl_tree must be initialized, otherwise
+ *          the behavior is undefined. the _avl_tree_t itself is not counted.
+ */
+extern size_t _avl_tree_memory_usage(const _avl_tree_t* cpt_avl_tree);
+
 #ifdef __cplusplus
 }
 #endif
@@ -213,14 +213,12 @@ _avlnode_t* _avl_tree_find_value(const _avl_tree_t* cpt_avl_tree, const _avlnode
         return NULL;
     }
 
-    b_result = _GET_AVL_TREE_TYPE_SIZE(cpt_avl_tree);
-    _avl_tree_elem_compare_auxiliary(cpt_avl_tree, cpv_value, cpt_root->_pby_data, &b_result);
+    b_result = _avl_tree_elem_less_auxiliary(cpt_avl_tree, cpv_value, cpt_root->_pby_data);
     if (b_result) {
         return _avl_tree_find_value(cpt_avl_tree, cpt_root->_pt_left, cpv_value);
     }
 
-    b_result = _GET_AVL_TREE_TYPE_SIZE(cpt_avl_tree);
-    _avl_tree_elem_compare_auxiliary(cpt_avl_tree, cpt_root->_pby_data, cpv_value, &b_result);
+    b_result = _avl_tree_elem_less_auxiliary(cpt_avl_tree, cpt_root->_pby_data, cpv_value);
     if (b_result) {
         return _avl_tree_find_value(cpt_avl_tree, cpt_root->_pt_right, cpv_value);
     } else {
@@ -443,8 +441,7 @@ _avl_tree_insert_result_t _avl_tree_insert_avlnode(
 
     /* compare the value and current node */
     /* if value < current node then insert into left subtree */
-    b_result = _GET_AVL_TREE_TYPE_SIZE(cpt_avl_tree);
-    _avl_tree_elem_compare_auxiliary(cpt_avl_tree, cpv_value, pt_root->_pby_data, &b_result);
+    b_result = _avl_tree_elem_less_auxiliary(cpt_avl_tree, cpv_value, pt_root->_pby_data);
     if (b_result) {
         t_insert_result = _avl_tree_insert_avlnode(cpt_avl_tree, pt_root->_pt_left, cpv_value);
         pt_root->_pt_left = t_insert_result._pt_adjust;
@@ -527,25 +524,40 @@ void _avl_tree_init_elem_auxiliary(_avl_tree_t* pt_avl_tree, _avlnode_t* pt_node
 }
 
 /**
- * Element compare function auxiliary
+ * Element less function auxiliary
  */
-void _avl_tree_elem_compare_auxiliary(
-    const _avl_tree_t* cpt_avl_tree, const void* cpv_first, const void* cpv_second, void* pv_output)
+bool_t _avl_tree_elem_less_auxiliary(const _avl_tree_t* cpt_avl_tree, const void* cpv_first, const void* cpv_second)
 {
     assert(cpt_avl_tree != NULL);
     assert(cpv_first != NULL);
     assert(cpv_second != NULL);
-    assert(pv_output != NULL);
     assert(_avl_tree_is_inited(cpt_avl_tree));
 
-    if (strncmp(_GET_AVL_TREE_TYPE_BASENAME(cpt_avl_tree), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0 &&
-        cpt_avl_tree->_t_compare != _GET_AVL_TREE_TYPE_LESS_FUNCTION(cpt_avl_tree)) {
-        cpt_avl_tree->_t_compare(string_c_str((string_t*)cpv_first), string_c_str((string_t*)cpv_second), pv_output);
+    if (cpt_avl_tree->_t_fastcompare != NULL) {
+        return cpt_avl_tree->_t_fastcompare(cpv_first, cpv_second);
     } else {
-        cpt_avl_tree->_t_compare(cpv_first, cpv_second, pv_output);
+        bool_t b_result = _GET_AVL_TREE_TYPE_SIZE(cpt_avl_tree);
+        if (strncmp(_GET_AVL_TREE_TYPE_BASENAME(cpt_avl_tree), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0 &&
+            cpt_avl_tree->_t_compare != _GET_AVL_TREE_TYPE_LESS_FUNCTION(cpt_avl_tree)) {
+            cpt_avl_tree->_t_compare(
+                string_c_str((string_t*)cpv_first), string_c_str((string_t*)cpv_second), &b_result);
+        } else {
+            cpt_avl_tree->_t_compare(cpv_first, cpv_second, &b_result);
+        }
+        return b_result;
     }
 }
 
+/**
+ * Element compare function auxiliary
+ */
+void _avl_tree_elem_compare_auxiliary(
+    const _avl_tree_t* cpt_avl_tree, const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(pv_output != NULL);
+    *(bool_t*)pv_output = _avl_tree_elem_less_auxiliary(cpt_avl_tree, cpv_first, cpv_second);
+}
+
 /** local function implementation section **/
 
 /** eof **/
@@ -37,6 +37,7 @@ extern "C" {
 #define _GET_AVL_TREE_TYPE_INIT_FUNCTION(pt_avl_tree)    ((pt_avl_tree)->_t_typeinfo._pt_type->_t_typeinit)
 #define _GET_AVL_TREE_TYPE_COPY_FUNCTION(pt_avl_tree)    ((pt_avl_tree)->_t_typeinfo._pt_type->_t_typecopy)
 #define _GET_AVL_TREE_TYPE_LESS_FUNCTION(pt_avl_tree)    ((pt_avl_tree)->_t_typeinfo._pt_type->_t_typeless)
+#define _GET_AVL_TREE_TYPE_LESS_FAST_FUNCTION(pt_avl_tree) ((pt_avl_tree)->_t_typeinfo._pt_type->_t_typelessfast)
 #define _GET_AVL_TREE_TYPE_DESTROY_FUNCTION(pt_avl_tree) ((pt_avl_tree)->_t_typeinfo._pt_type->_t_typedestroy)
 #define _GET_AVL_TREE_TYPE_STYLE(pt_avl_tree)            ((pt_avl_tree)->_t_typeinfo._t_style)
 
@@ -243,7 +244,20 @@ extern _avlnode_t* _avl_tree_rebalance(_avlnode_t* pt_root);
 extern void _avl_tree_init_elem_auxiliary(_avl_tree_t* pt_avl_tree, _avlnode_t* pt_node);
 
 /**
- * Element compare function auxiliary
+ * Element less function auxiliary
+ * @param cpt_avl_tree          avl tree.
+ * @param cpv_first             first element.
+ * @param cpv_second            second element.
+ * @return true if first element is less than second element, otherwise false.
+ * @remarks if cpt_avl_tree == NULL or cpv_first == NULL or cpv_second == NULL, the behavior is undefined. the result is
+ *          returned by the cached less function of element type directly when the compare function is the default
+ *          one, otherwise the compare function is called. cpt_avl_tree must be initialized, otherwise the behavior is
+ *          undefined.
+ */
+extern bool_t _avl_tree_elem_less_auxiliary(const _avl_tree_t* cpt_avl_tree, const void* cpv_first, const void* cpv_second);
+
+/**
+ * Element compare function auxiliary, the shim of _avl_tree_elem_less_auxiliary().
  * @param cpt_avl_tree          avl tree.
  * @param cpv_first             first element.
  * @param cpv_second            second element.
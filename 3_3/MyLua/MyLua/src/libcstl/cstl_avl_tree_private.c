@@ -65,6 +65,7 @@ bool_t _create_avl_tree_auxiliary(_avl_tree_t* pt_avl_tree, const char* s_typena
 
     pt_avl_tree->_t_nodecount = 0;
     pt_avl_tree->_t_compare = NULL;
+    pt_avl_tree->_t_fastcompare = NULL;
 
     _alloc_init(&pt_avl_tree->_t_allocator);
     return true;
@@ -89,6 +90,7 @@ void _avl_tree_destroy_auxiliary(_avl_tree_t* pt_avl_tree)
 
     pt_avl_tree->_t_nodecount = 0;
     pt_avl_tree->_t_compare = NULL;
+    pt_avl_tree->_t_fastcompare = NULL;
 }
 
 /** local function implementation section **/
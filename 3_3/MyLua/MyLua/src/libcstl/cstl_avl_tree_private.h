@@ -70,6 +70,7 @@ typedef struct _tagavltree
 
     /* compare function for the inserting order */
     bfun_t            _t_compare;
+    lfun_t            _t_fastcompare; /* the type less function without output or NULL */
 }_avl_tree_t;
 
 /** exported global variable declaration section **/
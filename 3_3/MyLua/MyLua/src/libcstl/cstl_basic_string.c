@@ -68,8 +68,13 @@ void basic_string_init_copy(basic_string_t* pt_dest, const basic_string_t* cpt_s
     assert(_basic_string_is_inited(cpt_src));
     assert(_basic_string_same_type(pt_dest, cpt_src));
 
-    pt_dest->_pby_string = cpt_src->_pby_string;
-    _basic_string_rep_increase_shared(_basic_string_rep_get_representation(pt_dest->_pby_string));
+    /* the local rep is never shared */
+    if (_basic_string_rep_get_representation(cpt_src->_pby_string)->_t_islocal) {
+        basic_string_init_copy_substring(pt_dest, cpt_src, 0, NPOS);
+    } else {
+        pt_dest->_pby_string = cpt_src->_pby_string;
+        _basic_string_rep_increase_shared(_basic_string_rep_get_representation(pt_dest->_pby_string));
+    }
 }
 
 /**
@@ -1112,9 +1117,23 @@ void basic_string_swap(basic_string_t* pt_first, basic_string_t* pt_second)
     assert(_basic_string_same_type(pt_first, pt_second));
 
     if (pt_first != pt_second && pt_first->_pby_string != pt_second->_pby_string) {
-        _byte_t* pby_tmp = pt_first->_pby_string;
-        pt_first->_pby_string = pt_second->_pby_string;
-        pt_second->_pby_string = pby_tmp;
+        _byte_t* pby_first = pt_first->_pby_string;
+        _byte_t* pby_second = pt_second->_pby_string;
+
+        /* the local rep holds c built-in elements only, so it is swapped by bytes */
+        if (pby_first == pt_first->_pby_localdata || pby_second == pt_second->_pby_localdata) {
+            _basic_string_rep_t t_reptmp = pt_first->_t_localrep;
+            _byte_t             pby_datatmp[_BASIC_STRING_LOCAL_SIZE];
+
+            memcpy(pby_datatmp, pt_first->_pby_localdata, _BASIC_STRING_LOCAL_SIZE);
+            pt_first->_t_localrep = pt_second->_t_localrep;
+            memcpy(pt_first->_pby_localdata, pt_second->_pby_localdata, _BASIC_STRING_LOCAL_SIZE);
+            pt_second->_t_localrep = t_reptmp;
+            memcpy(pt_second->_pby_localdata, pby_datatmp, _BASIC_STRING_LOCAL_SIZE);
+        }
+
+        pt_first->_pby_string = pby_second == pt_second->_pby_localdata ? pt_first->_pby_localdata : pby_second;
+        pt_second->_pby_string = pby_first == pt_first->_pby_localdata ? pt_second->_pby_localdata : pby_first;
     }
 }
 
@@ -1160,7 +1179,12 @@ void basic_string_assign(basic_string_t* pt_dest, const basic_string_t* cpt_src)
     assert(_basic_string_is_inited(cpt_src));
     assert(_basic_string_same_type(pt_dest, cpt_src));
 
-    if (pt_dest->_pby_string != cpt_src->_pby_string) {
+    if (_basic_string_rep_get_representation(cpt_src->_pby_string)->_t_islocal) {
+        /* the local rep is never shared */
+        if (pt_dest != cpt_src) {
+            basic_string_assign_substring(pt_dest, cpt_src, 0, NPOS);
+        }
+    } else if (pt_dest->_pby_string != cpt_src->_pby_string) {
         _basic_string_rep_reduce_shared(
             _basic_string_rep_get_representation(pt_dest->_pby_string),
             _GET_BASIC_STRING_TYPE_DESTROY_FUNCTION(pt_dest), &pt_dest->_t_typeinfo);
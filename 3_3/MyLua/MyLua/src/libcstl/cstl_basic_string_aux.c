@@ -312,11 +312,8 @@ _basic_string_rep_t* _basic_string_clone_representation(const basic_string_t* cp
     assert(cpt_basic_string != NULL);
     assert(_basic_string_is_inited(cpt_basic_string));
 
-    prep_clone = _create_basic_string_representation(
-        basic_string_size(cpt_basic_string) + t_addsize,
-        basic_string_capacity(cpt_basic_string),
-        _GET_BASIC_STRING_TYPE_SIZE(cpt_basic_string));
-    assert(prep_clone != NULL);
+    prep_clone = _basic_string_create_representation_auxiliary(
+        cpt_basic_string, basic_string_size(cpt_basic_string) + t_addsize, basic_string_capacity(cpt_basic_string));
 
     pby_dest = _basic_string_rep_get_data(prep_clone);
     pby_src = cpt_basic_string->_pby_string;
@@ -793,9 +790,7 @@ _basic_string_rep_t* _basic_string_rep_construct(
     assert(cpt_basic_string != NULL);
     assert(_basic_string_is_inited(cpt_basic_string) || _basic_string_is_created(cpt_basic_string));
 
-    prep = _create_basic_string_representation(
-        t_newcapacity, t_oldcapacity, _GET_BASIC_STRING_TYPE_SIZE(cpt_basic_string));
-    assert(prep != NULL);
+    prep = _basic_string_create_representation_auxiliary(cpt_basic_string, t_newcapacity, t_oldcapacity);
     _basic_string_rep_set_length(prep, t_len);
     _basic_string_rep_set_sharable(prep);
     _basic_string_init_elem_range_auxiliary((basic_string_t*)cpt_basic_string, _basic_string_rep_get_data(prep), t_len);
@@ -803,6 +798,41 @@ _basic_string_rep_t* _basic_string_rep_construct(
     return prep;
 }
 
+/**
+ * Create basic_string representation in local storage or in heap.
+ */
+_basic_string_rep_t* _basic_string_create_representation_auxiliary(
+    const basic_string_t* cpt_basic_string, size_t t_newcapacity, size_t t_oldcapacity)
+{
+    _basic_string_rep_t* prep = NULL;
+    size_t               t_typesize = 0;
+
+    assert(cpt_basic_string != NULL);
+
+    /*
+     * Only the c built-in elements except char* are stored locally, they can be copied by bytes when swap.
+     * The local rep can not be used when it still holds the current elements.
+     */
+    t_typesize = _GET_BASIC_STRING_TYPE_SIZE(cpt_basic_string);
+    if (_GET_BASIC_STRING_TYPE_STYLE(cpt_basic_string) == _TYPE_C_BUILTIN &&
+        strncmp(_GET_BASIC_STRING_TYPE_BASENAME(cpt_basic_string), _C_STRING_TYPE, _TYPE_NAME_SIZE) != 0 &&
+        (t_newcapacity + 1) * t_typesize <= _BASIC_STRING_LOCAL_SIZE &&
+        cpt_basic_string->_pby_string != cpt_basic_string->_pby_localdata) {
+        prep = (_basic_string_rep_t*)&cpt_basic_string->_t_localrep;
+        assert(_basic_string_rep_get_data(prep) == cpt_basic_string->_pby_localdata);
+        prep->_t_elemsize = t_typesize;
+        prep->_t_capacity = _BASIC_STRING_LOCAL_SIZE / t_typesize - 1;
+        prep->_t_length = 0;
+        prep->_n_refcount = -1;
+        prep->_t_islocal = true;
+    } else {
+        prep = _create_basic_string_representation(t_newcapacity, t_oldcapacity, t_typesize);
+        assert(prep != NULL);
+    }
+
+    return prep;
+}
+
 /**
  * Copy element with terminator.
  */
@@ -233,6 +233,18 @@ extern bool_t _basic_string_substring_find(
 extern _basic_string_rep_t* _basic_string_rep_construct(
     const basic_string_t* cpt_basic_string, size_t t_len, size_t t_newcapacity, size_t t_oldcapacity);
 
+/**
+ * Create basic_string representation in local storage or in heap.
+ * @param cpt_basic_string  basic string container.
+ * @param t_newcapacity     new capacity.
+ * @param t_oldcapacity     old capacity.
+ * @return representation, it is not initialized.
+ * @remarks cpt_basic_string must be not NULL. the short string of c built-in elements except char* uses
+ *          the local storage in basic_string_t when the local storage does not hold the current elements.
+ */
+extern _basic_string_rep_t* _basic_string_create_representation_auxiliary(
+    const basic_string_t* cpt_basic_string, size_t t_newcapacity, size_t t_oldcapacity);
+
 /**
  * Copy element with terminator.
  * @param cpt_basic_string  basic string container.
@@ -66,6 +66,7 @@ _basic_string_rep_t* _create_basic_string_representation(size_t t_newcapacity, s
     prep->_t_elemsize = t_elemsize;
     prep->_n_refcount = -1;
     prep->_t_length = 0;
+    prep->_t_islocal = false;
 
     return prep;
 }
@@ -112,7 +113,10 @@ _basic_string_rep_t* _basic_string_rep_reduce_shared(
                 pby_string += pt_rep->_t_elemsize;
             }
         }
-        free(pt_rep);
+        /* the local rep is a part of basic_string_t */
+        if (!pt_rep->_t_islocal) {
+            free(pt_rep);
+        }
         return NULL;
     } else {
         return pt_rep;
@@ -242,6 +246,11 @@ bool_t _create_basic_string_auxiliary(basic_string_t* pt_basic_string, const cha
     }
 
     pt_basic_string->_pby_string = NULL;
+    pt_basic_string->_t_localrep._t_elemsize = _GET_BASIC_STRING_TYPE_SIZE(pt_basic_string);
+    pt_basic_string->_t_localrep._t_length = 0;
+    pt_basic_string->_t_localrep._t_capacity = 0;
+    pt_basic_string->_t_localrep._n_refcount = -1;
+    pt_basic_string->_t_localrep._t_islocal = true;
     return true;
 }
 
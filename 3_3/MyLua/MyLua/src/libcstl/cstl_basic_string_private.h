@@ -30,6 +30,8 @@ extern "C" {
 /** include section **/
 
 /** constant declaration and macro section **/
+/* bytes of local storage for short string, include the terminator */
+#define _BASIC_STRING_LOCAL_SIZE    32
 
 /** data type declaration and struct, union, enum section **/
 /**
@@ -40,7 +42,12 @@ extern "C" {
  *                     _t_length;
  *                     _t_capacity;
  *                     _n_refcount;
+ *                     _t_islocal;
  *   _pby_string ----> data
+ *
+ * The representation of short string with c built-in elements is stored in the _t_localrep and
+ * _pby_localdata of basic_string_t itself, so it needs no malloc and it is never shared.
+ * Long string is stored in heap and is shared by reference count.
  */
 typedef struct _tag_basic_string_rep
 {
@@ -48,6 +55,7 @@ typedef struct _tag_basic_string_rep
     size_t _t_length;
     size_t _t_capacity;
     int    _n_refcount;
+    bool_t _t_islocal;  /* representation is stored in basic_string_t */
 }_basic_string_rep_t;
 
 typedef struct _tagbasicstring
@@ -57,6 +65,10 @@ typedef struct _tagbasicstring
 
     /* pointer to actual element string */
     _byte_t* _pby_string;
+
+    /* local representation and data for short string, data must follow the representation */
+    _basic_string_rep_t _t_localrep;
+    _byte_t             _pby_localdata[_BASIC_STRING_LOCAL_SIZE];
 }basic_string_t;
 
 /** exported global variable declaration section **/
@@ -81,7 +93,7 @@ extern _basic_string_rep_t* _create_basic_string_representation(size_t t_newcapa
  * @param ufun_destroy       destroy for element.
  * @param _typeinfo_t*       type info.
  * @return new rep that reduced shared or NULL if the rep is deleted.
- * @remarks pt_rep and ufun_destroy, must not be NULL.
+ * @remarks pt_rep and ufun_destroy, must not be NULL. the local rep is never freed, only its elements are destroyed.
  */
 extern _basic_string_rep_t* _basic_string_rep_reduce_shared(_basic_string_rep_t* pt_rep, ufun_t ufun_destroy, _typeinfo_t* pt_typeinfo);
 
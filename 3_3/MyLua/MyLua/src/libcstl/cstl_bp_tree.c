@@ -0,0 +1,855 @@
+/*
+ *  The implementation of b+ tree.
+ *  Copyright (C)  2008 - 2014  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+/** include section **/
+#include "cstl_def.h"
+#include "cstl_alloc.h"
+#include "cstl_types.h"
+#include "citerator.h"
+#include "cstring.h"
+
+#include "cstl_bp_tree_iterator.h"
+#include "cstl_bp_tree_private.h"
+#include "cstl_bp_tree.h"
+
+#include "cstl_bp_tree_aux.h"
+
+/** local constant declaration and local macro section **/
+
+/** local data type declaration and local struct, union, enum section **/
+
+/** local function prototype section **/
+
+/** exported global variable definition section **/
+
+/** local global variable definition section **/
+
+/** exported function implementation section **/
+/**
+ * Create b+ tree container.
+ */
+_bp_tree_t* _create_bp_tree(const char* s_typename)
+{
+    _bp_tree_t* pt_bp_tree = NULL;
+
+    if ((pt_bp_tree = (_bp_tree_t*)malloc(sizeof(_bp_tree_t))) == NULL) {
+        return NULL;
+    }
+
+    if (!_create_bp_tree_auxiliary(pt_bp_tree, s_typename)) {
+        free(pt_bp_tree);
+        return NULL;
+    }
+
+    return pt_bp_tree;
+}
+
+/**
+ * Initialize b+ tree container.
+ */
+void _bp_tree_init(_bp_tree_t* pt_bp_tree, bfun_t t_compare)
+{
+    assert(pt_bp_tree != NULL);
+    assert(_bp_tree_is_created(pt_bp_tree));
+
+    if (t_compare != NULL) {
+        pt_bp_tree->_t_compare = t_compare;
+    } else {
+        pt_bp_tree->_t_compare = _GET_BP_TREE_TYPE_LESS_FUNCTION(pt_bp_tree);
+    }
+    /* the default compare function can be replaced by the less function without output */
+    pt_bp_tree->_t_fastcompare = pt_bp_tree->_t_compare == _GET_BP_TREE_TYPE_LESS_FUNCTION(pt_bp_tree) ?
+        _GET_BP_TREE_TYPE_LESS_FAST_FUNCTION(pt_bp_tree) : NULL;
+}
+
+/**
+ * Destroy b+ tree.
+ */
+void _bp_tree_destroy(_bp_tree_t* pt_bp_tree)
+{
+    assert(pt_bp_tree != NULL);
+    assert(_bp_tree_is_inited(pt_bp_tree) || _bp_tree_is_created(pt_bp_tree));
+
+    _bp_tree_destroy_auxiliary(pt_bp_tree);
+    free(pt_bp_tree);
+}
+
+/**
+ * Initialize b+ tree container with b+ tree.
+ */
+void _bp_tree_init_copy(_bp_tree_t* pt_dest, const _bp_tree_t* cpt_src)
+{
+    _bp_tree_iterator_t it_iter;
+    _bp_tree_iterator_t it_begin;
+    _bp_tree_iterator_t it_end;
+
+    assert(pt_dest != NULL);
+    assert(cpt_src != NULL);
+    assert(_bp_tree_is_created(pt_dest));
+    assert(_bp_tree_is_inited(cpt_src));
+    assert(_bp_tree_same_type(pt_dest, cpt_src));
+
+    /* init the b+ tree with the src b+ tree */
+    _bp_tree_init(pt_dest,  cpt_src->_t_compare);
+    it_begin = _bp_tree_begin(cpt_src);
+    it_end = _bp_tree_end(cpt_src);
+
+    /* insert all elements of src into dest */
+    for (it_iter = it_begin;
+         !_bp_tree_iterator_equal(it_iter, it_end);
+         it_iter = _bp_tree_iterator_next(it_iter)) {
+        _bp_tree_insert_equal(pt_dest, _bp_tree_iterator_get_pointer_ignore_cstr(it_iter));
+    }
+}
+
+/**
+ * Initialize b+ tree container with specific range.
+ */
+void _bp_tree_init_copy_equal_range(_bp_tree_t* pt_dest, iterator_t it_begin, iterator_t it_end)
+{
+    assert(pt_dest != NULL);
+    assert(_bp_tree_is_created(pt_dest));
+    assert(_bp_tree_same_iterator_type(pt_dest, it_begin));
+    assert(_bp_tree_same_iterator_type(pt_dest, it_end));
+    assert(iterator_equal(it_begin, it_end) || _iterator_before(it_begin, it_end));
+
+    _bp_tree_init(pt_dest, NULL);
+    _bp_tree_insert_equal_range(pt_dest, it_begin, it_end);
+}
+
+/**
+ * Initialize b+ tree container with specific array.
+ */
+void _bp_tree_init_copy_equal_array(_bp_tree_t* pt_dest, const void* cpv_array, size_t t_count)
+{
+    assert(pt_dest != NULL);
+    assert(_bp_tree_is_created(pt_dest));
+    assert(cpv_array != NULL);
+
+    _bp_tree_init(pt_dest, NULL);
+    _bp_tree_insert_equal_array(pt_dest, cpv_array, t_count);
+}
+
+/**
+ * Initialize b+ tree container with specific range.
+ */
+void _bp_tree_init_copy_unique_range(_bp_tree_t* pt_dest, iterator_t it_begin, iterator_t it_end)
+{
+    assert(pt_dest != NULL);
+    assert(_bp_tree_is_created(pt_dest));
+    assert(_bp_tree_same_iterator_type(pt_dest, it_begin));
+    assert(_bp_tree_same_iterator_type(pt_dest, it_end));
+    assert(iterator_equal(it_begin, it_end) || _iterator_before(it_begin, it_end));
+
+    _bp_tree_init(pt_dest, NULL);
+    _bp_tree_insert_unique_range(pt_dest, it_begin, it_end);
+}
+
+/**
+ * Initialize b+ tree container with specific array.
+ */
+void _bp_tree_init_copy_unique_array(_bp_tree_t* pt_dest, const void* cpv_array, size_t t_count)
+{
+    assert(pt_dest != NULL);
+    assert(_bp_tree_is_created(pt_dest));
+    assert(cpv_array != NULL);
+
+    _bp_tree_init(pt_dest, NULL);
+    _bp_tree_insert_unique_array(pt_dest, cpv_array, t_count);
+}
+
+/**
+ * Initialize b+ tree container with specific range and compare function.
+ */
+void _bp_tree_init_copy_equal_range_ex(_bp_tree_t* pt_dest, iterator_t it_begin, iterator_t it_end, bfun_t t_compare)
+{
+    assert(pt_dest != NULL);
+    assert(_bp_tree_is_created(pt_dest));
+    assert(_bp_tree_same_iterator_type(pt_dest, it_begin));
+    assert(_bp_tree_same_iterator_type(pt_dest, it_end));
+    assert(iterator_equal(it_begin, it_end) || _iterator_before(it_begin, it_end));
+
+    _bp_tree_init(pt_dest, t_compare);
+    _bp_tree_insert_equal_range(pt_dest, it_begin, it_end);
+}
+
+/**
+ * Initialize b+ tree container with specific array and compare function.
+ */
+void _bp_tree_init_copy_equal_array_ex(_bp_tree_t* pt_dest, const void* cpv_array, size_t t_count, bfun_t t_compare)
+{
+    assert(pt_dest != NULL);
+    assert(_bp_tree_is_created(pt_dest));
+    assert(cpv_array != NULL);
+
+    _bp_tree_init(pt_dest, t_compare);
+    _bp_tree_insert_equal_array(pt_dest, cpv_array, t_count);
+}
+
+/**
+ * Initialize b+ tree container with specific range and compare function.
+ */
+void _bp_tree_init_copy_unique_range_ex(_bp_tree_t* pt_dest, iterator_t it_begin, iterator_t it_end, bfun_t t_compare)
+{
+    assert(pt_dest != NULL);
+    assert(_bp_tree_is_created(pt_dest));
+    assert(_bp_tree_same_iterator_type(pt_dest, it_begin));
+    assert(_bp_tree_same_iterator_type(pt_dest, it_end));
+    assert(iterator_equal(it_begin, it_end) || _iterator_before(it_begin, it_end));
+
+    _bp_tree_init(pt_dest, t_compare);
+    _bp_tree_insert_unique_range(pt_dest, it_begin, it_end);
+}
+
+/**
+ * Initialize b+ tree container with specific array and compare function.
+ */
+void _bp_tree_init_copy_unique_array_ex(_bp_tree_t* pt_dest, const void* cpv_array, size_t t_count, bfun_t t_compare)
+{
+    assert(pt_dest != NULL);
+    assert(_bp_tree_is_created(pt_dest));
+    assert(cpv_array != NULL);
+
+    _bp_tree_init(pt_dest, t_compare);
+    _bp_tree_insert_unique_array(pt_dest, cpv_array, t_count);
+}
+
+/**
+ * Assign b+ tree container.
+ */
+void _bp_tree_assign(_bp_tree_t* pt_dest, const _bp_tree_t* cpt_src)
+{
+    assert(pt_dest != NULL);
+    assert(cpt_src != NULL);
+    assert(_bp_tree_is_inited(pt_dest));
+    assert(_bp_tree_is_inited(cpt_src));
+    assert(_bp_tree_same_type_ex(pt_dest, cpt_src));
+
+    if (!_bp_tree_equal(pt_dest, cpt_src)) {
+        _bp_tree_iterator_t it_iter;
+        _bp_tree_iterator_t it_begin;
+        _bp_tree_iterator_t it_end;
+
+        /* clear dest b+ tree */
+        _bp_tree_clear(pt_dest);
+        it_begin = _bp_tree_begin(cpt_src);
+        it_end = _bp_tree_end(cpt_src);
+
+        /* insert all elements of src into dest */
+        for (it_iter = it_begin;
+             !_bp_tree_iterator_equal(it_iter, it_end);
+             it_iter = _bp_tree_iterator_next(it_iter)) {
+            _bp_tree_insert_equal(pt_dest, _bp_tree_iterator_get_pointer_ignore_cstr(it_iter));
+        }
+    }
+}
+
+/**
+ * Test if a b+ tree is empty.
+ */
+bool_t _bp_tree_empty(const _bp_tree_t* cpt_bp_tree)
+{
+    assert(cpt_bp_tree != NULL);
+    assert(_bp_tree_is_inited(cpt_bp_tree));
+
+    return cpt_bp_tree->_t_nodecount == 0 ? true : false;
+}
+
+/**
+ * Get the number of elements int the b+ tree.
+ */
+size_t _bp_tree_size(const _bp_tree_t* cpt_bp_tree)
+{
+    assert(cpt_bp_tree != NULL);
+    assert(_bp_tree_is_inited(cpt_bp_tree));
+
+    return cpt_bp_tree->_t_nodecount;
+}
+
+/**
+ * Get the maximum number of elements int the b+ tree.
+ */
+size_t _bp_tree_max_size(const _bp_tree_t* cpt_bp_tree)
+{
+    assert(cpt_bp_tree != NULL);
+    assert(_bp_tree_is_inited(cpt_bp_tree));
+
+    return (size_t)(-1) / _GET_BP_TREE_TYPE_SIZE(cpt_bp_tree);
+}
+
+/**
+ * Return an iterator that addresses the first element in the b+ tree.
+ */
+_bp_tree_iterator_t _bp_tree_begin(const _bp_tree_t* cpt_bp_tree)
+{
+    assert(cpt_bp_tree != NULL);
+    assert(_bp_tree_is_inited(cpt_bp_tree));
+
+    return _bp_tree_get_iterator(cpt_bp_tree, cpt_bp_tree->_pt_first, 0);
+}
+
+/**
+ * Return an iterator that addresses the location succeeding the last element in the b+ tree.
+ */
+_bp_tree_iterator_t _bp_tree_end(const _bp_tree_t* cpt_bp_tree)
+{
+    assert(cpt_bp_tree != NULL);
+    assert(_bp_tree_is_inited(cpt_bp_tree));
+
+    return _bp_tree_get_iterator(cpt_bp_tree, NULL, 0);
+}
+
+_bp_tree_reverse_iterator_t _bp_tree_rbegin(const _bp_tree_t* cpt_bp_tree)
+{
+    assert(cpt_bp_tree != NULL);
+
+    if (cpt_bp_tree->_pt_last != NULL) {
+        return _bp_tree_get_iterator(cpt_bp_tree, cpt_bp_tree->_pt_last, cpt_bp_tree->_pt_last->_un_count - 1);
+    } else {
+        return _bp_tree_get_iterator(cpt_bp_tree, NULL, 0);
+    }
+}
+
+_bp_tree_reverse_iterator_t _bp_tree_rend(const _bp_tree_t* cpt_bp_tree)
+{
+    assert(cpt_bp_tree != NULL);
+
+    return _bp_tree_get_iterator(cpt_bp_tree, NULL, 0);
+}
+
+/**
+ * Return the compare function of key.
+ */
+bfun_t _bp_tree_key_comp(const _bp_tree_t* cpt_bp_tree)
+{
+    assert(cpt_bp_tree != NULL);
+    assert(_bp_tree_is_inited(cpt_bp_tree));
+
+    return cpt_bp_tree->_t_compare;
+}
+
+/**
+ * Find specific element.
+ */
+_bp_tree_iterator_t _bp_tree_find(const _bp_tree_t* cpt_bp_tree, const void* cpv_value)
+{
+    _bp_tree_iterator_t it_iter;
+    bool_t              b_result = false;
+
+    assert(cpt_bp_tree != NULL);
+    assert(cpv_value != NULL);
+    assert(_bp_tree_is_inited(cpt_bp_tree));
+
+    it_iter = _bp_tree_lower_bound(cpt_bp_tree, cpv_value);
+    if (_BP_TREE_ITERATOR_COREPOS(it_iter) != NULL) {
+        b_result = _bp_tree_elem_less_auxiliary(
+            cpt_bp_tree, cpv_value, _bp_tree_iterator_get_pointer_ignore_cstr(it_iter));
+        if (b_result) {
+            it_iter = _bp_tree_end(cpt_bp_tree);
+        }
+    }
+
+    return it_iter;
+}
+
+/**
+ * Erases all the elements of a b+ tree.
+ */
+void _bp_tree_clear(_bp_tree_t* pt_bp_tree)
+{
+    assert(pt_bp_tree != NULL);
+    assert(_bp_tree_is_inited(pt_bp_tree));
+
+    /* destroy all elements */
+    pt_bp_tree->_pt_root = _bp_tree_destroy_subtree(pt_bp_tree, pt_bp_tree->_pt_root);
+    assert(pt_bp_tree->_pt_root == NULL);
+    pt_bp_tree->_pt_first = NULL;
+    pt_bp_tree->_pt_last = NULL;
+    pt_bp_tree->_t_nodecount = 0;
+}
+
+/**
+ * Return the number of specific elements in a b+ tree
+ */
+size_t _bp_tree_count(const _bp_tree_t* cpt_bp_tree, const void* cpv_value)
+{
+    range_t r_range;
+
+    assert(cpt_bp_tree != NULL);
+    assert(cpv_value != NULL);
+    assert(_bp_tree_is_inited(cpt_bp_tree));
+
+    r_range = _bp_tree_equal_range(cpt_bp_tree, cpv_value);
+    return abs(_bp_tree_iterator_distance(r_range.it_begin, r_range.it_end));
+}
+
+/**
+ * Return an iterator to the first element that is equal to or greater than a specific element.
+ */
+_bp_tree_iterator_t _bp_tree_lower_bound(const _bp_tree_t* cpt_bp_tree, const void* cpv_value)
+{
+    _bpnode_t* pt_leaf = NULL;
+    size_t     t_index = 0;
+
+    assert(cpt_bp_tree != NULL);
+    assert(cpv_value != NULL);
+    assert(_bp_tree_is_inited(cpt_bp_tree));
+
+    if (!_bp_tree_empty(cpt_bp_tree)) {
+        pt_leaf = _bp_tree_find_leaf(cpt_bp_tree, cpv_value, false, &t_index);
+    }
+
+    return _bp_tree_get_iterator(cpt_bp_tree, pt_leaf, t_index);
+}
+
+/**
+ * Return an iterator to the first element that is greater than a specific element.
+ */
+_bp_tree_iterator_t _bp_tree_upper_bound(const _bp_tree_t* cpt_bp_tree, const void* cpv_value)
+{
+    _bpnode_t* pt_leaf = NULL;
+    size_t     t_index = 0;
+
+    assert(cpt_bp_tree != NULL);
+    assert(cpv_value != NULL);
+    assert(_bp_tree_is_inited(cpt_bp_tree));
+
+    if (!_bp_tree_empty(cpt_bp_tree)) {
+        pt_leaf = _bp_tree_find_leaf(cpt_bp_tree, cpv_value, true, &t_index);
+    }
+
+    return _bp_tree_get_iterator(cpt_bp_tree, pt_leaf, t_index);
+}
+
+/**
+ * Return an iterator range that is equal to a specific element.
+ */
+range_t _bp_tree_equal_range(const _bp_tree_t* cpt_bp_tree, const void* cpv_value)
+{
+    range_t r_range;
+
+    assert(cpt_bp_tree != NULL);
+    assert(cpv_value != NULL);
+    assert(_bp_tree_is_inited(cpt_bp_tree));
+
+    r_range.it_begin = _bp_tree_lower_bound(cpt_bp_tree, cpv_value);
+    r_range.it_end = _bp_tree_upper_bound(cpt_bp_tree, cpv_value);
+
+    return r_range;
+}
+
+/**
+ * Tests if the two b+ tree are equal.
+ */
+bool_t _bp_tree_equal(const _bp_tree_t* cpt_first, const _bp_tree_t* cpt_second)
+{
+    _bp_tree_iterator_t it_first;
+    _bp_tree_iterator_t it_first_begin;
+    _bp_tree_iterator_t it_first_end;
+    _bp_tree_iterator_t it_second;
+    _bp_tree_iterator_t it_second_begin;
+    _bp_tree_iterator_t it_second_end;
+    bool_t               b_less = false;
+    bool_t               b_greater = false;
+
+    assert(cpt_first != NULL);
+    assert(cpt_second != NULL);
+    assert(_bp_tree_is_inited(cpt_first));
+    assert(_bp_tree_is_inited(cpt_second));
+    assert(_bp_tree_same_type_ex(cpt_first, cpt_second));
+
+    if (cpt_first == cpt_second) {
+        return true;
+    }
+
+    /* test b+ tree size */
+    if (_bp_tree_size(cpt_first) != _bp_tree_size(cpt_second)) {
+        return false;
+    }
+
+    it_first_begin = _bp_tree_begin(cpt_first);
+    it_first_end = _bp_tree_end(cpt_first);
+    it_second_begin = _bp_tree_begin(cpt_second);
+    it_second_end = _bp_tree_end(cpt_second);
+
+    /* test each element */
+    for (it_first = it_first_begin, it_second = it_second_begin;
+         !_bp_tree_iterator_equal(it_first, it_first_end) && !_bp_tree_iterator_equal(it_second, it_second_end);
+         it_first = _bp_tree_iterator_next(it_first), it_second = _bp_tree_iterator_next(it_second)) {
+        b_less = b_greater = _GET_BP_TREE_TYPE_SIZE(cpt_first);
+        _GET_BP_TREE_TYPE_LESS_FUNCTION(cpt_first)(
+            _bp_tree_iterator_get_pointer_ignore_cstr(it_first),
+            _bp_tree_iterator_get_pointer_ignore_cstr(it_second), &b_less);
+        _GET_BP_TREE_TYPE_LESS_FUNCTION(cpt_first)(
+            _bp_tree_iterator_get_pointer_ignore_cstr(it_second),
+            _bp_tree_iterator_get_pointer_ignore_cstr(it_first), &b_greater);
+        if (b_less || b_greater) {
+            return false;
+        }
+    }
+    assert(_bp_tree_iterator_equal(it_first, it_first_end) && _bp_tree_iterator_equal(it_second, it_second_end));
+
+    return true;
+}
+
+/**
+ * Tests if the two b+ tree are not equal.
+ */
+bool_t _bp_tree_not_equal(const _bp_tree_t* cpt_first, const _bp_tree_t* cpt_second)
+{
+    return !_bp_tree_equal(cpt_first, cpt_second);
+}
+
+/**
+ * Tests if the first b+ tree is less than the second b+ tree.
+ */
+bool_t _bp_tree_less(const _bp_tree_t* cpt_first, const _bp_tree_t* cpt_second)
+{
+    _bp_tree_iterator_t it_first;
+    _bp_tree_iterator_t it_first_begin;
+    _bp_tree_iterator_t it_first_end;
+    _bp_tree_iterator_t it_second;
+    _bp_tree_iterator_t it_second_begin;
+    _bp_tree_iterator_t it_second_end;
+    bool_t               b_result = false;
+
+    assert(cpt_first != NULL);
+    assert(cpt_second != NULL);
+    assert(_bp_tree_is_inited(cpt_first));
+    assert(_bp_tree_is_inited(cpt_second));
+    assert(_bp_tree_same_type_ex(cpt_first, cpt_second));
+
+    it_first_begin = _bp_tree_begin(cpt_first);
+    it_first_end = _bp_tree_end(cpt_first);
+    it_second_begin = _bp_tree_begin(cpt_second);
+    it_second_end = _bp_tree_end(cpt_second);
+
+    /* test each element */
+    for (it_first = it_first_begin, it_second = it_second_begin;
+         !_bp_tree_iterator_equal(it_first, it_first_end) && !_bp_tree_iterator_equal(it_second, it_second_end);
+         it_first = _bp_tree_iterator_next(it_first), it_second = _bp_tree_iterator_next(it_second)) {
+        b_result = _GET_BP_TREE_TYPE_SIZE(cpt_first);
+        _GET_BP_TREE_TYPE_LESS_FUNCTION(cpt_first)(
+            _bp_tree_iterator_get_pointer_ignore_cstr(it_first),
+            _bp_tree_iterator_get_pointer_ignore_cstr(it_second), &b_result);
+        if (b_result) {
+            return true;
+        }
+        b_result = _GET_BP_TREE_TYPE_SIZE(cpt_first);
+        _GET_BP_TREE_TYPE_LESS_FUNCTION(cpt_first)(
+            _bp_tree_iterator_get_pointer_ignore_cstr(it_second),
+            _bp_tree_iterator_get_pointer_ignore_cstr(it_first), &b_result);
+        if (b_result) {
+            return false;
+        }
+    }
+
+    return _bp_tree_size(cpt_first) < _bp_tree_size(cpt_second) ? true : false;
+}
+
+/**
+ * Tests if the first b+ tree is less than or equal to the second b+ tree.
+ */
+bool_t _bp_tree_less_equal(const _bp_tree_t* cpt_first, const _bp_tree_t* cpt_second)
+{
+    return (_bp_tree_less(cpt_first, cpt_second) || _bp_tree_equal(cpt_first, cpt_second)) ? true : false;
+}
+
+/**
+ * Tests if the first b+ tree is greater than the second b+ tree.
+ */
+bool_t _bp_tree_greater(const _bp_tree_t* cpt_first, const _bp_tree_t* cpt_second)
+{
+    return _bp_tree_less(cpt_second, cpt_first);
+}
+
+/**
+ * Tests if the first b+ tree is greater than or equal to the second b+ tree.
+ */
+bool_t _bp_tree_greater_equal(const _bp_tree_t* cpt_first, const _bp_tree_t* cpt_second)
+{
+    return (_bp_tree_greater(cpt_first, cpt_second) || _bp_tree_equal(cpt_first, cpt_second)) ? true : false;
+}
+
+/**
+ * Swap the datas of first bp_tree and second bp_tree.
+ */
+void _bp_tree_swap(_bp_tree_t* pt_first, _bp_tree_t* pt_second)
+{
+    _bp_tree_t t_temp;
+
+    assert(pt_first != NULL);
+    assert(pt_second != NULL);
+    assert(_bp_tree_is_inited(pt_first));
+    assert(_bp_tree_is_inited(pt_second));
+    assert(_bp_tree_same_type_ex(pt_first, pt_second));
+
+    if (_bp_tree_equal(pt_first, pt_second)) {
+        return;
+    }
+
+    /* the nodes never point to the b+ tree, so swap the b+ tree directly */
+    t_temp = *pt_first;
+    *pt_first = *pt_second;
+    *pt_second = t_temp;
+}
+
+/**
+ * Inserts an element into a b+ tree.
+ */
+_bp_tree_iterator_t _bp_tree_insert_equal(_bp_tree_t* pt_bp_tree, const void* cpv_value)
+{
+    _bpnode_t* pt_leaf = NULL;
+    size_t     t_index = 0;
+
+    assert(pt_bp_tree != NULL);
+    assert(cpv_value != NULL);
+    assert(_bp_tree_is_inited(pt_bp_tree));
+
+    if (_bp_tree_empty(pt_bp_tree)) {
+        pt_leaf = _bp_tree_create_bpnode(pt_bp_tree, true);
+        pt_bp_tree->_pt_root = pt_leaf;
+        pt_bp_tree->_pt_first = pt_leaf;
+        pt_bp_tree->_pt_last = pt_leaf;
+    } else {
+        /* the equal elements are inserted after the existing elements */
+        pt_leaf = _bp_tree_find_leaf(pt_bp_tree, cpv_value, true, &t_index);
+    }
+
+    return _bp_tree_insert_value(pt_bp_tree, pt_leaf, t_index, cpv_value);
+}
+
+/**
+ * Inserts an unique element into a b+ tree.
+ */
+_bp_tree_iterator_t _bp_tree_insert_unique(_bp_tree_t* pt_bp_tree, const void* cpv_value)
+{
+    _bp_tree_iterator_t it_iter;
+    _bpnode_t*          pt_leaf = NULL;
+    size_t              t_index = 0;
+    bool_t              b_result = false;
+
+    assert(pt_bp_tree != NULL);
+    assert(cpv_value != NULL);
+    assert(_bp_tree_is_inited(pt_bp_tree));
+
+    /* if the b+ tree is empty */
+    if (_bp_tree_empty(pt_bp_tree)) {
+        return _bp_tree_insert_equal(pt_bp_tree, cpv_value);
+    } else {
+        /* find the lower bound of value, the value is exist if it is not less than the lower bound */
+        pt_leaf = _bp_tree_find_leaf(pt_bp_tree, cpv_value, false, &t_index);
+        it_iter = _bp_tree_get_iterator(pt_bp_tree, pt_leaf, t_index);
+        if (_BP_TREE_ITERATOR_COREPOS(it_iter) != NULL) {
+            b_result = _bp_tree_elem_less_auxiliary(
+                pt_bp_tree, cpv_value, _bp_tree_iterator_get_pointer_ignore_cstr(it_iter));
+            if (!b_result) {
+                return _bp_tree_end(pt_bp_tree);
+            }
+        }
+
+        /* insert value into b+ tree */
+        return _bp_tree_insert_value(pt_bp_tree, pt_leaf, t_index, cpv_value);
+    }
+}
+
+/**
+ * Inserts an range into a b+ tree.
+ */
+void _bp_tree_insert_equal_range(_bp_tree_t* pt_bp_tree, iterator_t it_begin, iterator_t it_end)
+{
+    iterator_t it_iter;
+
+    assert(pt_bp_tree != NULL);
+    assert(_bp_tree_is_inited(pt_bp_tree));
+    assert(_bp_tree_same_iterator_type(pt_bp_tree, it_begin));
+    assert(_bp_tree_same_iterator_type(pt_bp_tree, it_end));
+    assert(iterator_equal(it_begin, it_end) || _iterator_before(it_begin, it_end));
+
+    for (it_iter = it_begin; !iterator_equal(it_iter, it_end); it_iter = iterator_next(it_iter)) {
+        _bp_tree_insert_equal(pt_bp_tree, _iterator_get_pointer_ignore_cstr(it_iter));
+    }
+}
+
+/**
+ * Inserts an array into a b+ tree.
+ */
+void _bp_tree_insert_equal_array(_bp_tree_t* pt_bp_tree, const void* cpv_array, size_t t_count)
+{
+    size_t i = 0;
+
+    assert(pt_bp_tree != NULL);
+    assert(_bp_tree_is_inited(pt_bp_tree));
+    assert(cpv_array != NULL);
+
+    /*
+     * Copy the elements from src array to dest b+ tree.
+     * The array of c builtin and user define or cstl builtin are different,
+     * the elements of c builtin array are element itself, but the elements of 
+     * c string, user define or cstl are pointer of element.
+     */
+    if (strncmp(_GET_BP_TREE_TYPE_BASENAME(pt_bp_tree), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+        /*
+         * We need built a string_t for c string element.
+         */
+        string_t* pstr_elem = create_string();
+        assert(pstr_elem != NULL);
+        string_init(pstr_elem);
+        for (i = 0; i < t_count; ++i) {
+            string_assign_cstr(pstr_elem, *((const char**)cpv_array + i));
+            _bp_tree_insert_equal(pt_bp_tree, pstr_elem);
+        }
+        string_destroy(pstr_elem);
+    } else if (_GET_BP_TREE_TYPE_STYLE(pt_bp_tree) == _TYPE_C_BUILTIN) {
+        for (i = 0; i < t_count; ++i) {
+            _bp_tree_insert_equal(pt_bp_tree, (unsigned char*)cpv_array + i * _GET_BP_TREE_TYPE_SIZE(pt_bp_tree));
+        }
+    } else {
+        for (i = 0; i < t_count; ++i) {
+            _bp_tree_insert_equal(pt_bp_tree, *((void**)cpv_array + i));
+        }
+    }
+}
+
+/**
+ * Inserts an range of unique element into a b+ tree.
+ */
+void _bp_tree_insert_unique_range(_bp_tree_t* pt_bp_tree, iterator_t it_begin, iterator_t it_end)
+{
+    iterator_t it_iter;
+
+    assert(pt_bp_tree != NULL);
+    assert(_bp_tree_is_inited(pt_bp_tree));
+    assert(_bp_tree_same_iterator_type(pt_bp_tree, it_begin));
+    assert(_bp_tree_same_iterator_type(pt_bp_tree, it_end));
+    assert(iterator_equal(it_begin, it_end) || _iterator_before(it_begin, it_end));
+
+    for (it_iter = it_begin; !iterator_equal(it_iter, it_end); it_iter = iterator_next(it_iter)) {
+        _bp_tree_insert_unique(pt_bp_tree, _iterator_get_pointer_ignore_cstr(it_iter));
+    }
+}
+
+/**
+ * Inserts an array of unique element into a b+ tree.
+ */
+void _bp_tree_insert_unique_array(_bp_tree_t* pt_bp_tree, const void* cpv_array, size_t t_count)
+{
+    size_t i = 0;
+
+    assert(pt_bp_tree != NULL);
+    assert(_bp_tree_is_inited(pt_bp_tree));
+    assert(cpv_array != NULL);
+
+    /*
+     * Copy the elements from src array to dest b+ tree.
+     * The array of c builtin and user define or cstl builtin are different,
+     * the elements of c builtin array are element itself, but the elements of 
+     * c string, user define or cstl are pointer of element.
+     */
+    if (strncmp(_GET_BP_TREE_TYPE_BASENAME(pt_bp_tree), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+        /*
+         * We need built a string_t for c string element.
+         */
+        string_t* pstr_elem = create_string();
+        assert(pstr_elem != NULL);
+        string_init(pstr_elem);
+        for (i = 0; i < t_count; ++i) {
+            string_assign_cstr(pstr_elem, *((const char**)cpv_array + i));
+            _bp_tree_insert_unique(pt_bp_tree, pstr_elem);
+        }
+        string_destroy(pstr_elem);
+    } else if (_GET_BP_TREE_TYPE_STYLE(pt_bp_tree) == _TYPE_C_BUILTIN) {
+        for (i = 0; i < t_count; ++i) {
+            _bp_tree_insert_unique(pt_bp_tree, (unsigned char*)cpv_array + i * _GET_BP_TREE_TYPE_SIZE(pt_bp_tree));
+        }
+    } else {
+        for (i = 0; i < t_count; ++i) {
+            _bp_tree_insert_unique(pt_bp_tree, *((void**)cpv_array + i));
+        }
+    }
+}
+
+/*
+ * Erase an element in a b+ tree from specificed position.
+ */
+void _bp_tree_erase_pos(_bp_tree_t* pt_bp_tree, _bp_tree_iterator_t it_pos)
+{
+    assert(pt_bp_tree != NULL);
+    assert(_bp_tree_is_inited(pt_bp_tree));
+    assert(_bp_tree_iterator_belong_to_bp_tree(pt_bp_tree, it_pos));
+    assert(!_bp_tree_iterator_equal(it_pos, _bp_tree_end(pt_bp_tree)));
+
+    _bp_tree_erase_value(pt_bp_tree, (_bpnode_t*)_BP_TREE_ITERATOR_COREPOS(it_pos), _BP_TREE_ITERATOR_INDEX(it_pos));
+}
+
+/*
+ * Erase a range of element in a b+ tree.
+ */
+void _bp_tree_erase_range(_bp_tree_t* pt_bp_tree, _bp_tree_iterator_t it_begin, _bp_tree_iterator_t it_end)
+{
+    _bp_tree_iterator_t it_iter;
+    size_t              t_count = 0;
+
+    assert(pt_bp_tree != NULL);
+    assert(_bp_tree_is_inited(pt_bp_tree));
+    assert(_bp_tree_iterator_belong_to_bp_tree(pt_bp_tree, it_begin));
+    assert(_bp_tree_iterator_belong_to_bp_tree(pt_bp_tree, it_end));
+    assert(_bp_tree_iterator_equal(it_begin, it_end) || _bp_tree_iterator_before(it_begin, it_end));
+
+    /* it_end is invalid after erasing, so erase the elements by count */
+    t_count = _bp_tree_iterator_distance(it_begin, it_end);
+    for (it_iter = it_begin; t_count > 0; --t_count) {
+        it_iter = _bp_tree_erase_value(
+            pt_bp_tree, (_bpnode_t*)_BP_TREE_ITERATOR_COREPOS(it_iter), _BP_TREE_ITERATOR_INDEX(it_iter));
+    }
+}
+
+/**
+ * Erase an element from a b+ tree that match a specified element.
+ */
+size_t _bp_tree_erase(_bp_tree_t* pt_bp_tree, const void* cpv_value)
+{
+    size_t  t_count = _bp_tree_count(pt_bp_tree, cpv_value);
+    range_t r_range = _bp_tree_equal_range(pt_bp_tree, cpv_value);
+
+    if (!_bp_tree_iterator_equal(r_range.it_begin, _bp_tree_end(pt_bp_tree))) {
+        _bp_tree_erase_range(pt_bp_tree, r_range.it_begin, r_range.it_end);
+    }
+
+    return t_count;
+}
+
+/**
+ * Get the memory that b+ tree allocates.
+ */
+size_t _bp_tree_memory_usage(const _bp_tree_t* cpt_bp_tree)
+{
+    assert(cpt_bp_tree != NULL);
+    assert(_bp_tree_is_inited(cpt_bp_tree));
+
+    return _alloc_memory_usage(&cpt_bp_tree->_t_allocator);
+}
+
+/** local function implementation section **/
+
+/** eof **/
+
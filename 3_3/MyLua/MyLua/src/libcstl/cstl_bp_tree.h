@@ -0,0 +1,503 @@
+/*
+ *  The interface of b+ tree.
+ *  Copyright (C)  2008 - 2013  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+#ifndef _CSTL_BP_TREE_H_
+#define _CSTL_BP_TREE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** include section **/
+
+/** constant declaration and macro section **/
+
+/** data type declaration and struct, union, enum section **/
+
+/** exported global variable declaration section **/
+
+/** exported function prototype section **/
+/**
+ * Create b+ tree container.
+ * @param s_typename        element type name.
+ * @return if create b+ tree successfully return b+ tree pointer, otherwise return NULL.
+ * @remarks s_typename == NULL, then the behavior is undefined. s_typename should be C builtin type name, libcstl builtin
+ *          typename or registed user defined type name, otherwise the function will return NULL.
+ */
+extern _bp_tree_t* _create_bp_tree(const char* s_typename);
+
+/**
+ * Initialize b+ tree container.
+ * @param pt_bp_tree        b+ tree container.
+ * @param t_compare         compare function.
+ * @return void.
+ * @remarks if pt_bp_tree == NULL, then the behavior is undefined, pt_bp_tree must be created by _create_bp_tree(),
+ *          otherwise the behavior is undefined. if t_compare == NULL, then the default compare function is used.
+ */
+extern void _bp_tree_init(_bp_tree_t* pt_bp_tree, bfun_t t_compare);
+
+/**
+ * Initialize b+ tree container with b+ tree.
+ * @param pt_dest           destination b+ tree.
+ * @param cpt_src           source b+ tree.
+ * @return void.
+ * @remarks if pt_dest == NULL or cpt_src == NULL, then the behavior is undefined, pt_dest must be created by
+ *          _create_bp_tree(), cpt_src must be initialized, otherwise the behavior is undefined. the element type of
+ *          pt_dest and cpt_src must be same, otherwise the behavior is undefine.
+ */
+extern void _bp_tree_init_copy(_bp_tree_t* pt_dest, const _bp_tree_t* cpt_src);
+
+/**
+ * Initialize b+ tree container with specific range.
+ * @param pt_dest           destination b+ tree.
+ * @param it_begin          begin of range.
+ * @param it_end            end of range.
+ * @return void.
+ * @remarks if pt_dest == NULL, then the behavior is undefined, pt_dest must be created by _create_bp_tree(), otherwise
+ *          the behavior is undefined. the type of [it_begin, it_end) and pt_dest must be same, otherwise the behavior is
+ *          undefined.
+ */
+extern void _bp_tree_init_copy_equal_range(_bp_tree_t* pt_dest, iterator_t it_begin, iterator_t it_end);
+
+/**
+ * Initialize b+ tree container with specific array.
+ * @param pt_dest           destination b+ tree.
+ * @param cpv_array         array.
+ * @param t_count           element count of array.
+ * @return void.
+ * @remarks if pt_dest == NULL, then the behavior is undefined, pt_dest must be created by _create_bp_tree(), otherwise
+ *          the behavior is undefined. the type of array and pt_dest must be same, otherwise the behavior is undefined.
+ */
+extern void _bp_tree_init_copy_equal_array(_bp_tree_t* pt_dest, const void* cpv_array, size_t t_count);
+
+/**
+ * Initialize b+ tree container with specific range.
+ * @param pt_dest           destination b+ tree.
+ * @param it_begin          begin of range.
+ * @param it_end            end of range.
+ * @return void.
+ * @remarks if pt_dest == NULL, then the behavior is undefined, pt_dest must be created by _create_bp_tree(), otherwise
+ *          the behavior is undefined. the type of [it_begin, it_end) and pt_dest must be same, otherwise the behavior is
+ *          undefined.
+ */
+extern void _bp_tree_init_copy_unique_range(_bp_tree_t* pt_dest, iterator_t it_begin, iterator_t it_end);
+
+/**
+ * Initialize b+ tree container with specific array.
+ * @param pt_dest           destination b+ tree.
+ * @param cpv_array         array.
+ * @param t_count           element count of array.
+ * @return void.
+ * @remarks if pt_dest == NULL, then the behavior is undefined, pt_dest must be created by _create_bp_tree(), otherwise
+ *          the behavior is undefined. the type of array and pt_dest must be same, otherwise the behavior is undefined.
+ */
+extern void _bp_tree_init_copy_unique_array(_bp_tree_t* pt_dest, const void* cpv_array, size_t t_count);
+
+/**
+ * Initialize b+ tree container with specific range and compare function.
+ * @param pt_dest           destination b+ tree.
+ * @param it_begin          begin of range.
+ * @param it_end            end of range.
+ * @param t_compare         compare function.
+ * @return void.
+ * @remarks if pt_dest == NULL, then the behavior is undefined, pt_dest must be created by _create_bp_tree(), otherwise
+ *          the behavior is undefined. the type of [it_begin, it_end) and pt_dest must be same, otherwise the behavior is
+ *          undefined. if t_compare == NULL, then use default compare function.
+ */
+extern void _bp_tree_init_copy_equal_range_ex(_bp_tree_t* pt_dest, iterator_t it_begin, iterator_t it_end, bfun_t t_compare);
+
+/**
+ * Initialize b+ tree container with specific array and compare function.
+ * @param pt_dest           destination b+ tree.
+ * @param cpv_array         array.
+ * @param t_count           element count of array.
+ * @param t_compare         compare function.
+ * @return void.
+ * @remarks if pt_dest == NULL, then the behavior is undefined, pt_dest must be created by _create_bp_tree(), otherwise
+ *          the behavior is undefined. the type of array and pt_dest must be same, otherwise the behavior is undefined. 
+ *          if t_compare == NULL, then use default compare function.
+ */
+extern void _bp_tree_init_copy_equal_array_ex(_bp_tree_t* pt_dest, const void* cpv_array, size_t t_count, bfun_t t_compare);
+
+/**
+ * Initialize b+ tree container with specific range and compare function.
+ * @param pt_dest           destination b+ tree.
+ * @param it_begin          begin of range.
+ * @param it_end            end of range.
+ * @param t_compare         compare function.
+ * @return void.
+ * @remarks if pt_dest == NULL, then the behavior is undefined, pt_dest must be created by _create_bp_tree(), otherwise
+ *          the behavior is undefined. the type of [it_begin, it_end) and pt_dest must be same, otherwise the behavior is
+ *          undefined. if t_compare == NULL, then use default compare function.
+ */
+extern void _bp_tree_init_copy_unique_range_ex(_bp_tree_t* pt_dest, iterator_t it_begin, iterator_t it_end, bfun_t t_compare);
+
+/**
+ * Initialize b+ tree container with specific array and compare function.
+ * @param pt_dest           destination b+ tree.
+ * @param cpv_array         array.
+ * @param t_count           element count of array.
+ * @param t_compare         compare function.
+ * @return void.
+ * @remarks if pt_dest == NULL, then the behavior is undefined, pt_dest must be created by _create_bp_tree(), otherwise
+ *          the behavior is undefined. the type of array and pt_dest must be same, otherwise the behavior is undefined. 
+ *          if t_compare == NULL, then use default compare function.
+ */
+extern void _bp_tree_init_copy_unique_array_ex(_bp_tree_t* pt_dest, const void* cpv_array, size_t t_count, bfun_t t_compare);
+
+/**
+ * Destroy b+ tree.
+ * @param pt_bp_tree        b+ tree container.
+ * @return void.
+ * @remarks if pt_bp_tree == NULL, then the behavior is undefined, the b+ tree must be initialized or created by
+ *          _create_bp_tree(), otherwise the behavior is undefined.
+ */
+extern void _bp_tree_destroy(_bp_tree_t* pt_bp_tree);
+
+/**
+ * Assign b+ tree container.
+ * @param pt_dest           destination b+ tree container.
+ * @param cpt_src           source b+ tree container.
+ * @return void.
+ * @remarks if pt_dest == NULL or cpt_src == NULL, the the behavior is undefined. two b+ tree must be initialized, otherwise
+ *          the behavior is undefined. if _bp_tree_equal(pt_dest, cpt_src), the function dest nothing.
+ */
+extern void _bp_tree_assign(_bp_tree_t* pt_dest, const _bp_tree_t* cpt_src);
+
+/**
+ * Get the number of elements int the b+ tree.
+ * @param cpt_bp_tree       b+ tree container.
+ * @return the number of elements in the b+ tree.
+ * @remarks if cpt_bp_tree == NULL, then the behavior is undefined, the cpt_bp_tree must be initialized, otherwise the
+ *          behavior is undefined.
+ */
+extern size_t _bp_tree_size(const _bp_tree_t* cpt_bp_tree);
+
+/**
+ * Test if a b+ tree is empty.
+ * @param cpt_bp_tree       b+ tree container.
+ * @return true if the b+ tree is empty, otherwise return false.
+ * @remarks if cpt_bp_tree == NULL, then the behavior is undefined, the cpt_bp_tree must be initialized, otherwise the
+ *          behavior is undefined.
+ */
+extern bool_t _bp_tree_empty(const _bp_tree_t* cpt_bp_tree);
+
+/**
+ * Get the maximum number of elements int the b+ tree.
+ * @param cpt_bp_tree       b+ tree container.
+ * @return the maximum number of elements in the b+ tree.
+ * @remarks if cpt_bp_tree == NULL, then the behavior is undefined, the cpt_bp_tree must be initialized, otherwise the
+ *          behavior is undefined.
+ */
+extern size_t _bp_tree_max_size(const _bp_tree_t* cpt_bp_tree);
+
+/**
+ * Return an iterator that addresses the first element in the b+ tree.
+ * @param cpt_bp_tree       b+ tree container.
+ * @return an iterator that addresses the first element in the b+ tree.
+ * @remarks if cpt_bp_tree == NULL, the behavior is undefined. cpt_bp_tree must be initialized, otherwise the behavior
+ *          is undefined. return _bp_tree_end(), if the b+ tree is empty.
+ */
+extern _bp_tree_iterator_t _bp_tree_begin(const _bp_tree_t* cpt_bp_tree);
+
+/**
+ * Return an iterator that addresses the location succeeding the last element in the b+ tree.
+ * @param cpt_bp_tree       b+ tree container.
+ * @return an iterator that addresses location succeeding the last element in the b+ tree.
+ * @remarks if cpt_bp_tree == NULL, the behavior is undefined. cpt_bp_tree must be initialized, otherwise the behavior
+ *          is undefined.
+ */
+extern _bp_tree_iterator_t _bp_tree_end(const _bp_tree_t* cpt_bp_tree);
+/* private */
+extern _bp_tree_reverse_iterator_t _bp_tree_rbegin(const _bp_tree_t* cpt_bp_tree);
+extern _bp_tree_reverse_iterator_t _bp_tree_rend(const _bp_tree_t* cpt_bp_tree);
+
+/**
+ * Return the compare function of key.
+ * @param cpt_bp_tree       b+ tree container.
+ * @return compare function.
+ * @remarks if cpt_bp_tree == NULL, the behavior is undefined. cpt_bp_tree must be initialized, otherwise the behavior
+ *          is undefined.
+ */
+extern bfun_t _bp_tree_key_comp(const _bp_tree_t* cpt_bp_tree);
+
+/**
+ * Find specific element.
+ * @param cpt_bp_tree       b+ tree container.
+ * @param cpv_value         specific element.
+ * @return iterator addresses the sprcific element in the b+ tree, otherwise return _bp_tree_end().
+ * @remarks if cpt_bp_tree == NULL or cpv_value == NULL then the behavior is undefined. cpt_bp_tree must be initialized,
+ *          otherwise the behavior is undefined. the type of specific element and cpt_bp_tree must be same, otherwise the
+ *          behavior is undefined.
+ */
+extern _bp_tree_iterator_t _bp_tree_find(const _bp_tree_t* cpt_bp_tree, const void* cpv_value);
+
+/**
+ * Erases all the elements of a b+ tree.
+ * @param pt_bp_tree        b+ tree container.
+ * @return void.
+ * @remarks if pt_bp_tree == NULL, the behavior is undefined. pt_bp_tree must be initialized, otherwise the behavior
+ *          is undefined.
+ */
+extern void _bp_tree_clear(_bp_tree_t* pt_bp_tree);
+
+/**
+ * Return the number of specific elements in a b+ tree
+ * @param cpt_bp_tree       b+ tree container.
+ * @param cpv_value         specific element.
+ * @return the number of specific elements.
+ * @remarks if cpt_bp_tree == NULL or cpv_value == NULL then the behavior is undefined. cpt_bp_tree must be initialized,
+ *          otherwise the behavior is undefined. the type of specific element and cpt_bp_tree must be same, otherwise the
+ *          behavior is undefined.
+ */
+extern size_t _bp_tree_count(const _bp_tree_t* cpt_bp_tree, const void* cpv_value);
+
+/**
+ * Return an iterator to the first element that is equal to or greater than a specific element.
+ * @param cpt_bp_tree       b+ tree container.
+ * @param cpv_value         specific element.
+ * @return an iterator to the first element that is equal to or greater than a specific element.
+ * @remarks if cpt_bp_tree == NULL or cpv_value == NULL then the behavior is undefined. cpt_bp_tree must be initialized,
+ *          otherwise the behavior is undefined. the type of specific element and cpt_bp_tree must be same, otherwise the
+ *          behavior is undefined.
+ */
+extern _bp_tree_iterator_t _bp_tree_lower_bound(const _bp_tree_t* cpt_bp_tree, const void* cpv_value);
+
+/**
+ * Return an iterator to the first element that is greater than a specific element.
+ * @param cpt_bp_tree       b+ tree container.
+ * @param cpv_value         specific element.
+ * @return an iterator to the first element that is greater than a specific element.
+ * @remarks if cpt_bp_tree == NULL or cpv_value == NULL then the behavior is undefined. cpt_bp_tree must be initialized,
+ *          otherwise the behavior is undefined. the type of specific element and cpt_bp_tree must be same, otherwise the
+ *          behavior is undefined.
+ */
+extern _bp_tree_iterator_t _bp_tree_upper_bound(const _bp_tree_t* cpt_bp_tree, const void* cpv_value);
+
+/**
+ * Return an iterator range that is equal to a specific element.
+ * @param cpt_bp_tree       b+ tree container.
+ * @param cpv_value         specific element.
+ * @return an iterator range that is equal to a specific element.
+ * @remarks if cpt_bp_tree == NULL or cpv_value == NULL then the behavior is undefined. cpt_bp_tree must be initialized,
+ *          otherwise the behavior is undefined. the type of specific element and cpt_bp_tree must be same, otherwise the
+ *          behavior is undefined.
+ */
+extern range_t _bp_tree_equal_range(const _bp_tree_t* cpt_bp_tree, const void* cpv_value);
+
+/**
+ * Tests if the two b+ tree are equal.
+ * @param cpt_first         first b+ tree container.
+ * @param cpt_second        second b+ tree container.
+ * @return if first b+ tree equal to second b+ tree, then return true, else return false.
+ * @remarks if cpt_first == NULL or cpt_second == NULL, then the behavior is undefined. the two b+ tree must be
+ *          initialized, otherwise the behavior is undefined. if the two b+ tree are not same type, then return false.
+ *          if cpt_first == cpt_second, then return true.
+ */
+extern bool_t _bp_tree_equal(const _bp_tree_t* cpt_first, const _bp_tree_t* cpt_second);
+
+/**
+ * Tests if the two b+ tree are not equal.
+ * @param cpt_first         first b+ tree container.
+ * @param cpt_second        second b+ tree container.
+ * @return if first b+ tree not equal to second b+ tree, then return true, else return false.
+ * @remarks if cpt_first == NULL or cpt_second == NULL, then the behavior is undefined. the two b+ tree must be
+ *          initialized, otherwise the behavior is undefined. if the two b+ tree are not same type, then return false.
+ *          if cpt_first == cpt_second, then return false.
+ */
+extern bool_t _bp_tree_not_equal(const _bp_tree_t* cpt_first, const _bp_tree_t* cpt_second);
+
+/**
+ * Tests if the first b+ tree is less than the second b+ tree.
+ * @param cpt_first         first b+ tree container.
+ * @param cpt_second        second b+ tree container.
+ * @return if first b+ tree is less than the second b+ tree, then return true, else return false.
+ * @remarks if cpt_first == NULL or cpt_second == NULL, then the behavior is undefined. the two b+ tree must be
+ *          initialized, otherwise the behavior is undefined. if the two b+ tree are not same type, the behavior is
+ *          undefined. if cpt_first == cpt_second, then return false.
+ */
+extern bool_t _bp_tree_less(const _bp_tree_t* cpt_first, const _bp_tree_t* cpt_second);
+
+/**
+ * Tests if the first b+ tree is less than or equal to the second b+ tree.
+ * @param cpt_first         first b+ tree container.
+ * @param cpt_second        second b+ tree container.
+ * @return if first b+ tree is less than or equal to the second b+ tree, then return true, else return false.
+ * @remarks if cpt_first == NULL or cpt_second == NULL, then the behavior is undefined. the two b+ tree must be
+ *          initialized, otherwise the behavior is undefined. if the two b+ tree are not same type, the behavior is
+ *          undefined. if cpt_first == cpt_second, then return true.
+ */
+extern bool_t _bp_tree_less_equal(const _bp_tree_t* cpt_first, const _bp_tree_t* cpt_second);
+
+/**
+ * Tests if the first b+ tree is greater than the second b+ tree.
+ * @param cpt_first         first b+ tree container.
+ * @param cpt_second        second b+ tree container.
+ * @return if first b+ tree is greater than the second b+ tree, then return true, else return false.
+ * @remarks if cpt_first == NULL or cpt_second == NULL, then the behavior is undefined. the two b+ tree must be
+ *          initialized, otherwise the behavior is undefined. if the two b+ tree are not same type, the behavior is
+ *          undefined. if cpt_first == cpt_second, then return false.
+ */
+extern bool_t _bp_tree_greater(const _bp_tree_t* cpt_first, const _bp_tree_t* cpt_second);
+
+/**
+ * Tests if the first b+ tree is greater than or equal to the second b+ tree.
+ * @param cpt_first         first b+ tree container.
+ * @param cpt_second        second b+ tree container.
+ * @return if first b+ tree is greater than or equal to the second b+ tree, then return true, else return false.
+ * @remarks if cpt_first == NULL or cpt_second == NULL, then the behavior is undefined. the two b+ tree must be
+ *          initialized, otherwise the behavior is undefined. if the two b+ tree are not same type, the behavior is
+ *          undefined. if cpt_first == cpt_second, then return true.
+ */
+extern bool_t _bp_tree_greater_equal(const _bp_tree_t* cpt_first, const _bp_tree_t* cpt_second);
+
+/**
+ * Swap the datas of first bp_tree and second bp_tree.
+ * @param pt_first          first b+ tree container.
+ * @param pt_second         second b+ tree container.
+ * @return void.
+ * @remarks if pt_first == NULL or pt_second == NULL, then the behavior is undefined. the two b+ tree must be
+ *          initialized, otherwise the behavior is undefined. if the two b+ tree are not same type, the behavior is
+ *          undefined. if _bp_tree_equal(cpt_first, cpt_second), then the function do nothing.
+ */
+extern void _bp_tree_swap(_bp_tree_t* pt_first, _bp_tree_t* pt_second);
+
+/**
+ * Inserts an unique element into a b+ tree.
+ * @param pt_bp_tree        b+ tree container.
+ * @param cpv_value         specific element.
+ * @return an iterator addresses the inserted element, or b+ tree end if insert failed.
+ * @remarks if pt_bp_tree == NULL or cpv_value == NULL then the behavior is undefined. cpt_bp_tree must be initialized,
+ *          otherwise the behavior is undefined. the type of specific element and cpt_bp_tree must be same, otherwise the
+ *          behavior is undefined. the elements are stored in leaf nodes directly, so inserting may move them to other
+ *          positions, all iterators and pointers of pt_bp_tree are invalid after inserting except the returned iterator.
+ */
+extern _bp_tree_iterator_t _bp_tree_insert_unique(_bp_tree_t* pt_bp_tree, const void* cpv_value);
+
+/**
+ * Inserts an element into a b+ tree.
+ * @param pt_bp_tree        b+ tree container.
+ * @param cpv_value         specific element.
+ * @return an iterator addresses the inserted element, or b+ tree end if insert failed.
+ * @remarks if pt_bp_tree == NULL or cpv_value == NULL then the behavior is undefined. cpt_bp_tree must be initialized,
+ *          otherwise the behavior is undefined. the type of specific element and cpt_bp_tree must be same, otherwise the
+ *          behavior is undefined. the elements are stored in leaf nodes directly, so inserting may move them to other
+ *          positions, all iterators and pointers of pt_bp_tree are invalid after inserting except the returned iterator.
+ */
+extern _bp_tree_iterator_t _bp_tree_insert_equal(_bp_tree_t* pt_bp_tree, const void* cpv_value);
+
+/**
+ * Inserts an range of unique element into a b+ tree.
+ * @param pt_bp_tree        b+ tree container.
+ * @param it_begin          begin of specific range.
+ * @param it_end            end of specific range.
+ * @return void.
+ * @remarks if pt_bp_tree == NULL then the behavior is undefined. pt_bp_tree must be initialized, otherwise the behavior
+ *          is undefined. the type of [it_begin, it_end) and cpt_bp_tree must be same, otherwise the behavior is undefined.
+ *          [it_begin, it_end) must be valid range, otherwise the behavior is undefine.
+ */
+extern void _bp_tree_insert_unique_range(_bp_tree_t* pt_bp_tree, iterator_t it_begin, iterator_t it_end);
+
+/**
+ * Inserts an array of unique element into a b+ tree.
+ * @param pt_bp_tree        b+ tree container.
+ * @param cpv_array         array.
+ * @param t_count           element count of array.
+ * @return void.
+ * @remarks if pt_bp_tree == NULL then the behavior is undefined. pt_bp_tree must be initialized, otherwise the behavior
+ *          is undefined. the type of array and cpt_bp_tree must be same, otherwise the behavior is undefined.
+ *          array must be valid array, otherwise the behavior is undefine.
+ */
+extern void _bp_tree_insert_unique_array(_bp_tree_t* pt_bp_tree, const void* cpv_array, size_t t_count);
+
+/**
+ * Inserts an range into a b+ tree.
+ * @param pt_bp_tree        b+ tree container.
+ * @param it_begin          begin of specific range.
+ * @param it_end            end of specific range.
+ * @return void.
+ * @remarks if pt_bp_tree == NULL then the behavior is undefined. pt_bp_tree must be initialized, otherwise the behavior
+ *          is undefined. the type of [it_begin, it_end) and cpt_bp_tree must be same, otherwise the behavior is undefined.
+ *          [it_begin, it_end) must be valid range, otherwise the behavior is undefine.
+ */
+extern void _bp_tree_insert_equal_range(_bp_tree_t* pt_bp_tree, iterator_t it_begin, iterator_t it_end);
+
+/**
+ * Inserts an array into a b+ tree.
+ * @param pt_bp_tree        b+ tree container.
+ * @param cpv_array         array.
+ * @param t_count           element count of array.
+ * @return void.
+ * @remarks if pt_bp_tree == NULL then the behavior is undefined. pt_bp_tree must be initialized, otherwise the behavior
+ *          is undefined. the type of array and cpt_bp_tree must be same, otherwise the behavior is undefined.
+ *          array must be valid array, otherwise the behavior is undefine.
+ */
+extern void _bp_tree_insert_equal_array(_bp_tree_t* pt_bp_tree, const void* cpv_array, size_t t_count);
+
+/*
+ * Erase an element in a b+ tree from specificed position.
+ * @param pt_bp_tree        b+ tree container.
+ * @param it_pos            specificed position.
+ * @return void.
+ * @remarks if pt_bp_tree == NULL then the behavior is undefined. pt_bp_tree must be initialized, otherwise the behavior
+ *          is undefined. it_pos must be valid iterator, otherwise the behavior is undefined. all iterators and pointers of
+ *          pt_bp_tree are invalid after erasing.
+ */
+extern void _bp_tree_erase_pos(_bp_tree_t* pt_bp_tree, _bp_tree_iterator_t it_pos);
+
+/*
+ * Erase a range of element in a b+ tree.
+ * @param pt_bp_tree        b+ tree container.
+ * @param it_begin          begin of specific range.
+ * @param it_end            end of specific range.
+ * @return void.
+ * @remarks if pt_bp_tree == NULL then the behavior is undefined. pt_bp_tree must be initialized, otherwise the behavior
+ *          is undefined. [it_begin, it_end) must be valid range for pt_bp_tree, otherwise the behavior is undefine.
+ */
+extern void _bp_tree_erase_range(_bp_tree_t* pt_bp_tree, _bp_tree_iterator_t it_begin, _bp_tree_iterator_t it_end);
+
+/**
+ * Erase an element from a b+ tree that match a specified element.
+ * @param pt_bp_tree        b+ tree container.
+ * @param cpv_value         specific element.
+ * @return the number of erased elements.
+ * @remarks if pt_bp_tree == NULL or cpv_value == NULL then the behavior is undefined. cpt_bp_tree must be initialized,
+ *          otherwise the behavior is undefined. 
+ */
+extern size_t _bp_tree_erase(_bp_tree_t* pt_bp_tree, const void* cpv_value);
+
+/**
+ * Get the memory that b+ tree allocates.
+ * @param cpt_bp_tree       b+ tree container.
+ * @return the bytes of nodes.
+ * @remarks if cpt_bp_tree == NULL then the behavior is undefined. cpt_bp_tree must be initialized, otherwise
+ *          the behavior is undefined. the _bp_tree_t itself is not counted.
+ */
+extern size_t _bp_tree_memory_usage(const _bp_tree_t* cpt_bp_tree);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CSTL_BP_TREE_H_ */
+/** eof **/
+
@@ -0,0 +1,832 @@
+/*
+ *  The implementation of b+ tree auxiliary functions.
+ *  Copyright (C)  2008 - 2012  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+/** include section **/
+#include "cstl_def.h"
+#include "cstl_alloc.h"
+#include "cstl_types.h"
+#include "citerator.h"
+#include "cstring.h"
+
+#include "cstl_bp_tree_iterator.h"
+#include "cstl_bp_tree_private.h"
+#include "cstl_bp_tree.h"
+
+#include "cstl_bp_tree_aux.h"
+
+/** local constant declaration and local macro section **/
+
+/** local function prototype section **/
+
+/** exported global variable definition section **/
+
+/** local global variable definition section **/
+
+/** exported function implementation section **/
+#ifndef NDEBUG
+/**
+ * Test b+ tree is created by _create_bp_tree.
+ */
+bool_t _bp_tree_is_created(const _bp_tree_t* cpt_bp_tree)
+{
+    assert(cpt_bp_tree != NULL);
+
+    if (cpt_bp_tree->_t_typeinfo._t_style != _TYPE_C_BUILTIN &&
+        cpt_bp_tree->_t_typeinfo._t_style != _TYPE_CSTL_BUILTIN &&
+        cpt_bp_tree->_t_typeinfo._t_style != _TYPE_USER_DEFINE) {
+        return false;
+    }
+    if (cpt_bp_tree->_t_typeinfo._pt_type == NULL) {
+        return false;
+    }
+
+    if (cpt_bp_tree->_pt_root != NULL || cpt_bp_tree->_pt_first != NULL || cpt_bp_tree->_pt_last != NULL ||
+        cpt_bp_tree->_t_nodecount != 0 || cpt_bp_tree->_t_leafcount < _BP_TREE_MIN_COUNT ||
+        cpt_bp_tree->_t_innercount < _BP_TREE_MIN_COUNT || cpt_bp_tree->_t_compare != NULL) {
+        return false;
+    }
+
+    return _alloc_is_inited(&cpt_bp_tree->_t_allocator);
+}
+
+/**
+ * Test b+ tree is initialized by b+ tree initialization functions.
+ */
+bool_t _bp_tree_is_inited(const _bp_tree_t* cpt_bp_tree)
+{
+    assert(cpt_bp_tree != NULL);
+
+    if (cpt_bp_tree->_t_typeinfo._t_style != _TYPE_C_BUILTIN &&
+        cpt_bp_tree->_t_typeinfo._t_style != _TYPE_CSTL_BUILTIN &&
+        cpt_bp_tree->_t_typeinfo._t_style != _TYPE_USER_DEFINE) {
+        return false;
+    }
+    if (cpt_bp_tree->_t_typeinfo._pt_type == NULL) {
+        return false;
+    }
+
+    if (cpt_bp_tree->_t_leafcount < _BP_TREE_MIN_COUNT || cpt_bp_tree->_t_innercount < _BP_TREE_MIN_COUNT ||
+        cpt_bp_tree->_t_compare == NULL) {
+        return false;
+    }
+    if ((cpt_bp_tree->_pt_root == NULL) != (cpt_bp_tree->_pt_first == NULL) ||
+        (cpt_bp_tree->_pt_root == NULL) != (cpt_bp_tree->_pt_last == NULL)) {
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Test iterator referenced data is within the b+ tree.
+ */
+bool_t _bp_tree_iterator_belong_to_bp_tree(const _bp_tree_t* cpt_bp_tree, _bp_tree_iterator_t it_iter)
+{
+    assert(cpt_bp_tree != NULL);
+    assert(_bp_tree_is_inited(cpt_bp_tree));
+    assert(_BP_TREE_ITERATOR_TREE(it_iter) == cpt_bp_tree);
+
+    /* if iterator is end */
+    if (_BP_TREE_ITERATOR_COREPOS(it_iter) == NULL) {
+        return _BP_TREE_ITERATOR_INDEX(it_iter) == 0 ? true : false;
+    } else {
+        /* travel leaf list for search the leaf */
+        return _bp_tree_bpnode_belong_to_bp_tree(cpt_bp_tree, (_bpnode_t*)_BP_TREE_ITERATOR_COREPOS(it_iter)) &&
+               _BP_TREE_ITERATOR_INDEX(it_iter) < ((_bpnode_t*)_BP_TREE_ITERATOR_COREPOS(it_iter))->_un_count;
+    }
+}
+
+/**
+ * Test the type that saved in the b+ tree container and referenced by it_iter are same.
+ */
+bool_t _bp_tree_same_bp_tree_iterator_type(const _bp_tree_t* cpt_bp_tree, _bp_tree_iterator_t it_iter)
+{
+    assert(cpt_bp_tree != NULL);
+    assert(_BP_TREE_ITERATOR_TREE(it_iter) != NULL);
+
+    return _bp_tree_same_type(cpt_bp_tree, _BP_TREE_ITERATOR_TREE(it_iter));
+}
+
+/**
+ * Test the type that saved in the b+ tree container and referenced by it_iter are same.
+ */
+bool_t _bp_tree_same_iterator_type(const _bp_tree_t* cpt_bp_tree, iterator_t it_iter)
+{
+    assert(cpt_bp_tree != NULL);
+    assert(_bp_tree_is_inited(cpt_bp_tree) || _bp_tree_is_created(cpt_bp_tree));
+    assert(_iterator_is_valid(it_iter));
+
+    return _type_is_same_ex(&cpt_bp_tree->_t_typeinfo, _iterator_get_typeinfo(it_iter));
+}
+
+/**
+ * Test the type and compare function that saved in the b+ tree container and referenced by it_iter are same.
+ */
+bool_t _bp_tree_same_bp_tree_iterator_type_ex(const _bp_tree_t* cpt_bp_tree, _bp_tree_iterator_t it_iter)
+{
+    assert(cpt_bp_tree != NULL);
+    assert(_BP_TREE_ITERATOR_TREE(it_iter) != NULL);
+
+    return _bp_tree_same_type_ex(cpt_bp_tree, _BP_TREE_ITERATOR_TREE(it_iter));
+}
+
+/**
+ * Test leaf node is linked in the b+ tree.
+ */
+bool_t _bp_tree_bpnode_belong_to_bp_tree(const _bp_tree_t* cpt_bp_tree, const _bpnode_t* cpt_leaf)
+{
+    _bpnode_t* pt_leaf = NULL;
+
+    assert(cpt_bp_tree != NULL);
+
+    for (pt_leaf = cpt_bp_tree->_pt_first; pt_leaf != NULL; pt_leaf = pt_leaf->_pt_next) {
+        if (pt_leaf == cpt_leaf) {
+            return true;
+        }
+    }
+
+    return false;
+}
+#endif /* NDEBUG */
+
+/**
+ * Test the type that saved in the b+ tree container is same.
+ */
+bool_t _bp_tree_same_type(const _bp_tree_t* cpt_first, const _bp_tree_t* cpt_second)
+{
+    assert(cpt_first != NULL);
+    assert(cpt_second != NULL);
+    assert(_bp_tree_is_inited(cpt_first) || _bp_tree_is_created(cpt_first));
+    assert(_bp_tree_is_inited(cpt_second) || _bp_tree_is_created(cpt_second));
+
+    if (cpt_first == cpt_second) {
+        return true;
+    }
+
+    return (cpt_first->_t_typeinfo._t_style == cpt_second->_t_typeinfo._t_style) &&
+           (cpt_first->_t_typeinfo._pt_type == cpt_second->_t_typeinfo._pt_type) &&
+           _type_is_same(_GET_BP_TREE_TYPE_NAME(cpt_first), _GET_BP_TREE_TYPE_NAME(cpt_second));
+}
+
+/**
+ * Test the type and compare function that saved in the b+ tree container is same.
+ */
+bool_t _bp_tree_same_type_ex(const _bp_tree_t* cpt_first, const _bp_tree_t* cpt_second)
+{
+    assert(cpt_first != NULL);
+    assert(cpt_second != NULL);
+    assert(_bp_tree_is_inited(cpt_first) || _bp_tree_is_created(cpt_first));
+    assert(_bp_tree_is_inited(cpt_second) || _bp_tree_is_created(cpt_second));
+
+    if (cpt_first == cpt_second) {
+        return true;
+    }
+
+    return (cpt_first->_t_compare == cpt_second->_t_compare) && _bp_tree_same_type(cpt_first, cpt_second);
+}
+
+/**
+ * Get the iterator that addresses the element in leaf node.
+ */
+_bp_tree_iterator_t _bp_tree_get_iterator(const _bp_tree_t* cpt_bp_tree, const _bpnode_t* cpt_leaf, size_t t_index)
+{
+    _bp_tree_iterator_t it_iter = _create_bp_tree_iterator();
+
+    assert(cpt_bp_tree != NULL);
+
+    if (cpt_leaf != NULL && t_index >= cpt_leaf->_un_count) {
+        assert(t_index == cpt_leaf->_un_count);
+        cpt_leaf = cpt_leaf->_pt_next;
+        t_index = 0;
+    }
+
+    _BP_TREE_ITERATOR_TREE_POINTER(it_iter) = (void*)cpt_bp_tree;
+    _BP_TREE_ITERATOR_COREPOS(it_iter) = (_byte_t*)cpt_leaf;
+    _BP_TREE_ITERATOR_INDEX(it_iter) = cpt_leaf != NULL ? t_index : 0;
+
+    return it_iter;
+}
+
+/**
+ * Search the bound of specific value in a sorted elements or keys.
+ */
+size_t _bp_tree_search_bound(
+    const _bp_tree_t* cpt_bp_tree, const _byte_t* cpby_data, size_t t_count, const void* cpv_value, bool_t b_upper)
+{
+    size_t t_first = 0;
+    size_t t_half = 0;
+    bool_t b_result = false;
+
+    assert(cpt_bp_tree != NULL);
+    assert(cpv_value != NULL);
+
+    while (t_count > 0) {
+        const _byte_t* cpby_mid = NULL;
+
+        t_half = t_count / 2;
+        cpby_mid = cpby_data + (t_first + t_half) * _GET_BP_TREE_TYPE_SIZE(cpt_bp_tree);
+        if (b_upper) {
+            /* skip the elements that are not greater than value */
+            b_result = !_bp_tree_elem_less_auxiliary(cpt_bp_tree, cpv_value, cpby_mid);
+        } else {
+            /* skip the elements that are less than value */
+            b_result = _bp_tree_elem_less_auxiliary(cpt_bp_tree, cpby_mid, cpv_value);
+        }
+
+        if (b_result) {
+            t_first += t_half + 1;
+            t_count -= t_half + 1;
+        } else {
+            t_count = t_half;
+        }
+    }
+
+    return t_first;
+}
+
+/**
+ * Travel from root to leaf for the bound of specific value.
+ */
+_bpnode_t* _bp_tree_find_leaf(const _bp_tree_t* cpt_bp_tree, const void* cpv_value, bool_t b_upper, size_t* pt_index)
+{
+    _bpnode_t* pt_node = NULL;
+
+    assert(cpt_bp_tree != NULL);
+    assert(cpv_value != NULL);
+    assert(pt_index != NULL);
+    assert(cpt_bp_tree->_pt_root != NULL);
+
+    /* key i is in the middle of child i and child i+1, so the bound of keys is the child index */
+    pt_node = cpt_bp_tree->_pt_root;
+    while (!pt_node->_un_leaf) {
+        pt_node = _BP_TREE_CHILDREN(pt_node)[_bp_tree_search_bound(
+            cpt_bp_tree, _BP_TREE_KEY(cpt_bp_tree, pt_node, 0), pt_node->_un_count, cpv_value, b_upper)];
+    }
+
+    *pt_index = _bp_tree_search_bound(cpt_bp_tree, pt_node->_pby_data, pt_node->_un_count, cpv_value, b_upper);
+    return pt_node;
+}
+
+/**
+ * Allocate a new leaf or inner node.
+ */
+_bpnode_t* _bp_tree_create_bpnode(_bp_tree_t* pt_bp_tree, bool_t b_leaf)
+{
+    _bpnode_t* pt_node = NULL;
+
+    assert(pt_bp_tree != NULL);
+
+    pt_node = (_bpnode_t*)_alloc_allocate(&pt_bp_tree->_t_allocator,
+        b_leaf ? _BP_TREE_LEAF_SIZE(pt_bp_tree) : _BP_TREE_INNER_SIZE(pt_bp_tree), 1);
+    assert(pt_node != NULL);
+
+    pt_node->_pt_parent = NULL;
+    pt_node->_pt_prev = NULL;
+    pt_node->_pt_next = NULL;
+    pt_node->_un_count = 0;
+    pt_node->_un_leaf = b_leaf ? 1 : 0;
+
+    return pt_node;
+}
+
+/**
+ * Destroy the subtree with postorder traverse.
+ */
+_bpnode_t* _bp_tree_destroy_subtree(_bp_tree_t* pt_bp_tree, _bpnode_t* pt_root)
+{
+    size_t i = 0;
+
+    assert(pt_bp_tree != NULL);
+    assert(_bp_tree_is_inited(pt_bp_tree) || _bp_tree_is_created(pt_bp_tree));
+
+    if (pt_root != NULL) {
+        if (pt_root->_un_leaf) {
+            for (i = 0; i < pt_root->_un_count; ++i) {
+                _bp_tree_destroy_elem_auxiliary(pt_bp_tree, _BP_TREE_ELEM(pt_bp_tree, pt_root, i));
+            }
+            _alloc_deallocate(&pt_bp_tree->_t_allocator, pt_root, _BP_TREE_LEAF_SIZE(pt_bp_tree), 1);
+        } else {
+            for (i = 0; i < pt_root->_un_count; ++i) {
+                _bp_tree_destroy_elem_auxiliary(pt_bp_tree, _BP_TREE_KEY(pt_bp_tree, pt_root, i));
+            }
+            for (i = 0; i <= pt_root->_un_count; ++i) {
+                _bp_tree_destroy_subtree(pt_bp_tree, _BP_TREE_CHILDREN(pt_root)[i]);
+            }
+            _alloc_deallocate(&pt_bp_tree->_t_allocator, pt_root, _BP_TREE_INNER_SIZE(pt_bp_tree), 1);
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Insert the value into leaf node at specific position.
+ */
+_bp_tree_iterator_t _bp_tree_insert_value(_bp_tree_t* pt_bp_tree, _bpnode_t* pt_leaf, size_t t_index, const void* cpv_value)
+{
+    _bpnode_t* pt_right = NULL;
+    bool_t     b_result = false;
+
+    assert(pt_bp_tree != NULL);
+    assert(pt_leaf != NULL);
+    assert(cpv_value != NULL);
+    assert(pt_leaf->_un_leaf);
+    assert(t_index <= pt_leaf->_un_count && pt_leaf->_un_count <= pt_bp_tree->_t_leafcount);
+
+    /* make room for new element, the leaf may use the overflow slot */
+    _bp_tree_move_elem_auxiliary(pt_bp_tree, _BP_TREE_ELEM(pt_bp_tree, pt_leaf, t_index + 1),
+        _BP_TREE_ELEM(pt_bp_tree, pt_leaf, t_index), pt_leaf->_un_count - t_index);
+    _bp_tree_init_elem_auxiliary(pt_bp_tree, _BP_TREE_ELEM(pt_bp_tree, pt_leaf, t_index));
+    b_result = _GET_BP_TREE_TYPE_SIZE(pt_bp_tree);
+    _GET_BP_TREE_TYPE_COPY_FUNCTION(pt_bp_tree)(_BP_TREE_ELEM(pt_bp_tree, pt_leaf, t_index), cpv_value, &b_result);
+    assert(b_result);
+    pt_leaf->_un_count++;
+    pt_bp_tree->_t_nodecount++;
+
+    if (pt_leaf->_un_count > pt_bp_tree->_t_leafcount) {
+        pt_right = _bp_tree_split_leaf(pt_bp_tree, pt_leaf);
+        if (t_index >= pt_leaf->_un_count) {
+            t_index -= pt_leaf->_un_count;
+            pt_leaf = pt_right;
+        }
+    }
+
+    return _bp_tree_get_iterator(pt_bp_tree, pt_leaf, t_index);
+}
+
+/**
+ * Erase the element of leaf node at specific position.
+ */
+_bp_tree_iterator_t _bp_tree_erase_value(_bp_tree_t* pt_bp_tree, _bpnode_t* pt_leaf, size_t t_index)
+{
+    _bpnode_t* pt_parent = NULL;
+    _bpnode_t* pt_sibling = NULL;
+    size_t     t_child = 0;
+    bool_t     b_result = false;
+
+    assert(pt_bp_tree != NULL);
+    assert(pt_leaf != NULL);
+    assert(pt_leaf->_un_leaf);
+    assert(t_index < pt_leaf->_un_count);
+
+    _bp_tree_destroy_elem_auxiliary(pt_bp_tree, _BP_TREE_ELEM(pt_bp_tree, pt_leaf, t_index));
+    _bp_tree_move_elem_auxiliary(pt_bp_tree, _BP_TREE_ELEM(pt_bp_tree, pt_leaf, t_index),
+        _BP_TREE_ELEM(pt_bp_tree, pt_leaf, t_index + 1), pt_leaf->_un_count - t_index - 1);
+    pt_leaf->_un_count--;
+    pt_bp_tree->_t_nodecount--;
+
+    if (pt_leaf == pt_bp_tree->_pt_root) {
+        if (pt_leaf->_un_count == 0) {
+            _alloc_deallocate(&pt_bp_tree->_t_allocator, pt_leaf, _BP_TREE_LEAF_SIZE(pt_bp_tree), 1);
+            pt_bp_tree->_pt_root = NULL;
+            pt_bp_tree->_pt_first = NULL;
+            pt_bp_tree->_pt_last = NULL;
+            pt_leaf = NULL;
+            t_index = 0;
+        }
+        return _bp_tree_get_iterator(pt_bp_tree, pt_leaf, t_index);
+    }
+    if (pt_leaf->_un_count >= _BP_TREE_LEAF_MIN(pt_bp_tree)) {
+        return _bp_tree_get_iterator(pt_bp_tree, pt_leaf, t_index);
+    }
+
+    /* the leaf is underflow, borrow from or merge with sibling */
+    pt_parent = pt_leaf->_pt_parent;
+    t_child = _bp_tree_get_child_index(pt_leaf);
+    if (t_child > 0 && _BP_TREE_CHILDREN(pt_parent)[t_child - 1]->_un_count > _BP_TREE_LEAF_MIN(pt_bp_tree)) {
+        /* move the last element of left sibling to the front */
+        pt_sibling = _BP_TREE_CHILDREN(pt_parent)[t_child - 1];
+        _bp_tree_move_elem_auxiliary(pt_bp_tree, _BP_TREE_ELEM(pt_bp_tree, pt_leaf, 1),
+            _BP_TREE_ELEM(pt_bp_tree, pt_leaf, 0), pt_leaf->_un_count);
+        _bp_tree_move_elem_auxiliary(pt_bp_tree, _BP_TREE_ELEM(pt_bp_tree, pt_leaf, 0),
+            _BP_TREE_ELEM(pt_bp_tree, pt_sibling, pt_sibling->_un_count - 1), 1);
+        pt_sibling->_un_count--;
+        pt_leaf->_un_count++;
+        t_index++;
+
+        b_result = _GET_BP_TREE_TYPE_SIZE(pt_bp_tree);
+        _GET_BP_TREE_TYPE_COPY_FUNCTION(pt_bp_tree)(
+            _BP_TREE_KEY(pt_bp_tree, pt_parent, t_child - 1), _BP_TREE_ELEM(pt_bp_tree, pt_leaf, 0), &b_result);
+        assert(b_result);
+    } else if (t_child < pt_parent->_un_count &&
+               _BP_TREE_CHILDREN(pt_parent)[t_child + 1]->_un_count > _BP_TREE_LEAF_MIN(pt_bp_tree)) {
+        /* move the first element of right sibling to the back */
+        pt_sibling = _BP_TREE_CHILDREN(pt_parent)[t_child + 1];
+        _bp_tree_move_elem_auxiliary(pt_bp_tree, _BP_TREE_ELEM(pt_bp_tree, pt_leaf, pt_leaf->_un_count),
+            _BP_TREE_ELEM(pt_bp_tree, pt_sibling, 0), 1);
+        _bp_tree_move_elem_auxiliary(pt_bp_tree, _BP_TREE_ELEM(pt_bp_tree, pt_sibling, 0),
+            _BP_TREE_ELEM(pt_bp_tree, pt_sibling, 1), pt_sibling->_un_count - 1);
+        pt_sibling->_un_count--;
+        pt_leaf->_un_count++;
+
+        b_result = _GET_BP_TREE_TYPE_SIZE(pt_bp_tree);
+        _GET_BP_TREE_TYPE_COPY_FUNCTION(pt_bp_tree)(
+            _BP_TREE_KEY(pt_bp_tree, pt_parent, t_child), _BP_TREE_ELEM(pt_bp_tree, pt_sibling, 0), &b_result);
+        assert(b_result);
+    } else {
+        /* merge the right one of two siblings into the left one */
+        if (t_child > 0) {
+            pt_sibling = pt_leaf;
+            pt_leaf = _BP_TREE_CHILDREN(pt_parent)[t_child - 1];
+            t_index += pt_leaf->_un_count;
+            t_child--;
+        } else {
+            pt_sibling = _BP_TREE_CHILDREN(pt_parent)[t_child + 1];
+        }
+
+        _bp_tree_move_elem_auxiliary(pt_bp_tree, _BP_TREE_ELEM(pt_bp_tree, pt_leaf, pt_leaf->_un_count),
+            _BP_TREE_ELEM(pt_bp_tree, pt_sibling, 0), pt_sibling->_un_count);
+        pt_leaf->_un_count += pt_sibling->_un_count;
+        assert(pt_leaf->_un_count <= pt_bp_tree->_t_leafcount);
+
+        pt_leaf->_pt_next = pt_sibling->_pt_next;
+        if (pt_sibling->_pt_next != NULL) {
+            pt_sibling->_pt_next->_pt_prev = pt_leaf;
+        } else {
+            pt_bp_tree->_pt_last = pt_leaf;
+        }
+        _alloc_deallocate(&pt_bp_tree->_t_allocator, pt_sibling, _BP_TREE_LEAF_SIZE(pt_bp_tree), 1);
+
+        _bp_tree_destroy_elem_auxiliary(pt_bp_tree, _BP_TREE_KEY(pt_bp_tree, pt_parent, t_child));
+        _bp_tree_remove_child(pt_bp_tree, pt_parent, t_child);
+        _bp_tree_rebalance_inner(pt_bp_tree, pt_parent);
+    }
+
+    return _bp_tree_get_iterator(pt_bp_tree, pt_leaf, t_index);
+}
+
+/**
+ * Split the overflow leaf node.
+ */
+_bpnode_t* _bp_tree_split_leaf(_bp_tree_t* pt_bp_tree, _bpnode_t* pt_leaf)
+{
+    _bpnode_t* pt_right = NULL;
+    size_t     t_left = 0;
+
+    assert(pt_bp_tree != NULL);
+    assert(pt_leaf != NULL);
+    assert(pt_leaf->_un_leaf);
+
+    t_left = pt_leaf->_un_count / 2;
+    pt_right = _bp_tree_create_bpnode(pt_bp_tree, true);
+    _bp_tree_move_elem_auxiliary(pt_bp_tree, _BP_TREE_ELEM(pt_bp_tree, pt_right, 0),
+        _BP_TREE_ELEM(pt_bp_tree, pt_leaf, t_left), pt_leaf->_un_count - t_left);
+    pt_right->_un_count = (unsigned int)(pt_leaf->_un_count - t_left);
+    pt_leaf->_un_count = (unsigned int)t_left;
+
+    /* link the new leaf */
+    pt_right->_pt_prev = pt_leaf;
+    pt_right->_pt_next = pt_leaf->_pt_next;
+    if (pt_leaf->_pt_next != NULL) {
+        pt_leaf->_pt_next->_pt_prev = pt_right;
+    } else {
+        pt_bp_tree->_pt_last = pt_right;
+    }
+    pt_leaf->_pt_next = pt_right;
+
+    /* the first element of right leaf is the separate key */
+    _bp_tree_insert_child(pt_bp_tree, pt_leaf, _BP_TREE_ELEM(pt_bp_tree, pt_right, 0), true, pt_right);
+
+    return pt_right;
+}
+
+/**
+ * Split the overflow inner node.
+ */
+void _bp_tree_split_inner(_bp_tree_t* pt_bp_tree, _bpnode_t* pt_inner)
+{
+    _bpnode_t* pt_right = NULL;
+    size_t     t_mid = 0;
+    size_t     i = 0;
+
+    assert(pt_bp_tree != NULL);
+    assert(pt_inner != NULL);
+    assert(!pt_inner->_un_leaf);
+
+    /* key mid goes up, the keys and children after it go to the new node */
+    t_mid = pt_inner->_un_count / 2;
+    pt_right = _bp_tree_create_bpnode(pt_bp_tree, false);
+    _bp_tree_move_elem_auxiliary(pt_bp_tree, _BP_TREE_KEY(pt_bp_tree, pt_right, 0),
+        _BP_TREE_KEY(pt_bp_tree, pt_inner, t_mid + 1), pt_inner->_un_count - t_mid - 1);
+    pt_right->_un_count = (unsigned int)(pt_inner->_un_count - t_mid - 1);
+    for (i = 0; i <= pt_right->_un_count; ++i) {
+        _BP_TREE_CHILDREN(pt_right)[i] = _BP_TREE_CHILDREN(pt_inner)[t_mid + 1 + i];
+        _BP_TREE_CHILDREN(pt_right)[i]->_pt_parent = pt_right;
+    }
+    pt_inner->_un_count = (unsigned int)t_mid;
+
+    _bp_tree_insert_child(pt_bp_tree, pt_inner, _BP_TREE_KEY(pt_bp_tree, pt_inner, t_mid), false, pt_right);
+}
+
+/**
+ * Insert the key and the new right node into the parent of left node.
+ */
+void _bp_tree_insert_child(
+    _bp_tree_t* pt_bp_tree, _bpnode_t* pt_left, _byte_t* pby_key, bool_t b_copy, _bpnode_t* pt_right)
+{
+    _bpnode_t* pt_parent = NULL;
+    size_t     t_child = 0;
+    size_t     i = 0;
+
+    assert(pt_bp_tree != NULL);
+    assert(pt_left != NULL);
+    assert(pby_key != NULL);
+    assert(pt_right != NULL);
+
+    pt_parent = pt_left->_pt_parent;
+    if (pt_parent == NULL) {
+        /* the tree grows from root */
+        assert(pt_left == pt_bp_tree->_pt_root);
+        pt_parent = _bp_tree_create_bpnode(pt_bp_tree, false);
+        _BP_TREE_CHILDREN(pt_parent)[0] = pt_left;
+        pt_left->_pt_parent = pt_parent;
+        pt_bp_tree->_pt_root = pt_parent;
+        t_child = 0;
+    } else {
+        t_child = _bp_tree_get_child_index(pt_left);
+        _bp_tree_move_elem_auxiliary(pt_bp_tree, _BP_TREE_KEY(pt_bp_tree, pt_parent, t_child + 1),
+            _BP_TREE_KEY(pt_bp_tree, pt_parent, t_child), pt_parent->_un_count - t_child);
+        for (i = pt_parent->_un_count + 1; i > t_child + 1; --i) {
+            _BP_TREE_CHILDREN(pt_parent)[i] = _BP_TREE_CHILDREN(pt_parent)[i - 1];
+        }
+    }
+
+    if (b_copy) {
+        bool_t b_result = _GET_BP_TREE_TYPE_SIZE(pt_bp_tree);
+        _bp_tree_init_elem_auxiliary(pt_bp_tree, _BP_TREE_KEY(pt_bp_tree, pt_parent, t_child));
+        _GET_BP_TREE_TYPE_COPY_FUNCTION(pt_bp_tree)(_BP_TREE_KEY(pt_bp_tree, pt_parent, t_child), pby_key, &b_result);
+        assert(b_result);
+    } else {
+        _bp_tree_move_elem_auxiliary(pt_bp_tree, _BP_TREE_KEY(pt_bp_tree, pt_parent, t_child), pby_key, 1);
+    }
+    _BP_TREE_CHILDREN(pt_parent)[t_child + 1] = pt_right;
+    pt_right->_pt_parent = pt_parent;
+    pt_parent->_un_count++;
+
+    if (pt_parent->_un_count > pt_bp_tree->_t_innercount) {
+        _bp_tree_split_inner(pt_bp_tree, pt_parent);
+    }
+}
+
+/**
+ * Remove the key and the right child of key from inner node.
+ */
+void _bp_tree_remove_child(_bp_tree_t* pt_bp_tree, _bpnode_t* pt_inner, size_t t_index)
+{
+    size_t i = 0;
+
+    assert(pt_bp_tree != NULL);
+    assert(pt_inner != NULL);
+    assert(!pt_inner->_un_leaf);
+    assert(t_index < pt_inner->_un_count);
+
+    _bp_tree_move_elem_auxiliary(pt_bp_tree, _BP_TREE_KEY(pt_bp_tree, pt_inner, t_index),
+        _BP_TREE_KEY(pt_bp_tree, pt_inner, t_index + 1), pt_inner->_un_count - t_index - 1);
+    for (i = t_index + 1; i < pt_inner->_un_count; ++i) {
+        _BP_TREE_CHILDREN(pt_inner)[i] = _BP_TREE_CHILDREN(pt_inner)[i + 1];
+    }
+    pt_inner->_un_count--;
+}
+
+/**
+ * Rebalance the inner node after removing a child.
+ */
+void _bp_tree_rebalance_inner(_bp_tree_t* pt_bp_tree, _bpnode_t* pt_inner)
+{
+    _bpnode_t* pt_parent = NULL;
+    _bpnode_t* pt_sibling = NULL;
+    size_t     t_child = 0;
+    size_t     i = 0;
+
+    assert(pt_bp_tree != NULL);
+    assert(pt_inner != NULL);
+    assert(!pt_inner->_un_leaf);
+
+    if (pt_inner == pt_bp_tree->_pt_root) {
+        /* the tree shrinks from root */
+        if (pt_inner->_un_count == 0) {
+            pt_bp_tree->_pt_root = _BP_TREE_CHILDREN(pt_inner)[0];
+            pt_bp_tree->_pt_root->_pt_parent = NULL;
+            _alloc_deallocate(&pt_bp_tree->_t_allocator, pt_inner, _BP_TREE_INNER_SIZE(pt_bp_tree), 1);
+        }
+        return;
+    }
+    if (pt_inner->_un_count >= _BP_TREE_INNER_MIN(pt_bp_tree)) {
+        return;
+    }
+
+    pt_parent = pt_inner->_pt_parent;
+    t_child = _bp_tree_get_child_index(pt_inner);
+    if (t_child > 0 && _BP_TREE_CHILDREN(pt_parent)[t_child - 1]->_un_count > _BP_TREE_INNER_MIN(pt_bp_tree)) {
+        /* rotate the last key of left sibling through the parent */
+        pt_sibling = _BP_TREE_CHILDREN(pt_parent)[t_child - 1];
+        _bp_tree_move_elem_auxiliary(pt_bp_tree, _BP_TREE_KEY(pt_bp_tree, pt_inner, 1),
+            _BP_TREE_KEY(pt_bp_tree, pt_inner, 0), pt_inner->_un_count);
+        for (i = pt_inner->_un_count + 1; i > 0; --i) {
+            _BP_TREE_CHILDREN(pt_inner)[i] = _BP_TREE_CHILDREN(pt_inner)[i - 1];
+        }
+        _bp_tree_move_elem_auxiliary(pt_bp_tree, _BP_TREE_KEY(pt_bp_tree, pt_inner, 0),
+            _BP_TREE_KEY(pt_bp_tree, pt_parent, t_child - 1), 1);
+        _BP_TREE_CHILDREN(pt_inner)[0] = _BP_TREE_CHILDREN(pt_sibling)[pt_sibling->_un_count];
+        _BP_TREE_CHILDREN(pt_inner)[0]->_pt_parent = pt_inner;
+        _bp_tree_move_elem_auxiliary(pt_bp_tree, _BP_TREE_KEY(pt_bp_tree, pt_parent, t_child - 1),
+            _BP_TREE_KEY(pt_bp_tree, pt_sibling, pt_sibling->_un_count - 1), 1);
+        pt_sibling->_un_count--;
+        pt_inner->_un_count++;
+    } else if (t_child < pt_parent->_un_count &&
+               _BP_TREE_CHILDREN(pt_parent)[t_child + 1]->_un_count > _BP_TREE_INNER_MIN(pt_bp_tree)) {
+        /* rotate the first key of right sibling through the parent */
+        pt_sibling = _BP_TREE_CHILDREN(pt_parent)[t_child + 1];
+        _bp_tree_move_elem_auxiliary(pt_bp_tree, _BP_TREE_KEY(pt_bp_tree, pt_inner, pt_inner->_un_count),
+            _BP_TREE_KEY(pt_bp_tree, pt_parent, t_child), 1);
+        _BP_TREE_CHILDREN(pt_inner)[pt_inner->_un_count + 1] = _BP_TREE_CHILDREN(pt_sibling)[0];
+        _BP_TREE_CHILDREN(pt_inner)[pt_inner->_un_count + 1]->_pt_parent = pt_inner;
+        _bp_tree_move_elem_auxiliary(pt_bp_tree, _BP_TREE_KEY(pt_bp_tree, pt_parent, t_child),
+            _BP_TREE_KEY(pt_bp_tree, pt_sibling, 0), 1);
+        _bp_tree_move_elem_auxiliary(pt_bp_tree, _BP_TREE_KEY(pt_bp_tree, pt_sibling, 0),
+            _BP_TREE_KEY(pt_bp_tree, pt_sibling, 1), pt_sibling->_un_count - 1);
+        for (i = 0; i < pt_sibling->_un_count; ++i) {
+            _BP_TREE_CHILDREN(pt_sibling)[i] = _BP_TREE_CHILDREN(pt_sibling)[i + 1];
+        }
+        pt_sibling->_un_count--;
+        pt_inner->_un_count++;
+    } else {
+        /* merge the right one of two siblings and the key between them into the left one */
+        if (t_child > 0) {
+            pt_sibling = pt_inner;
+            pt_inner = _BP_TREE_CHILDREN(pt_parent)[t_child - 1];
+            t_child--;
+        } else {
+            pt_sibling = _BP_TREE_CHILDREN(pt_parent)[t_child + 1];
+        }
+
+        _bp_tree_move_elem_auxiliary(pt_bp_tree, _BP_TREE_KEY(pt_bp_tree, pt_inner, pt_inner->_un_count),
+            _BP_TREE_KEY(pt_bp_tree, pt_parent, t_child), 1);
+        _bp_tree_move_elem_auxiliary(pt_bp_tree, _BP_TREE_KEY(pt_bp_tree, pt_inner, pt_inner->_un_count + 1),
+            _BP_TREE_KEY(pt_bp_tree, pt_sibling, 0), pt_sibling->_un_count);
+        for (i = 0; i <= pt_sibling->_un_count; ++i) {
+            _BP_TREE_CHILDREN(pt_inner)[pt_inner->_un_count + 1 + i] = _BP_TREE_CHILDREN(pt_sibling)[i];
+            _BP_TREE_CHILDREN(pt_sibling)[i]->_pt_parent = pt_inner;
+        }
+        pt_inner->_un_count += pt_sibling->_un_count + 1;
+        assert(pt_inner->_un_count <= pt_bp_tree->_t_innercount);
+        _alloc_deallocate(&pt_bp_tree->_t_allocator, pt_sibling, _BP_TREE_INNER_SIZE(pt_bp_tree), 1);
+
+        _bp_tree_remove_child(pt_bp_tree, pt_parent, t_child);
+        _bp_tree_rebalance_inner(pt_bp_tree, pt_parent);
+    }
+}
+
+/**
+ * Get the index of child in parent node.
+ */
+size_t _bp_tree_get_child_index(const _bpnode_t* cpt_node)
+{
+    size_t i = 0;
+
+    assert(cpt_node != NULL);
+    assert(cpt_node->_pt_parent != NULL);
+
+    for (i = 0; i <= cpt_node->_pt_parent->_un_count; ++i) {
+        if (_BP_TREE_CHILDREN(cpt_node->_pt_parent)[i] == cpt_node) {
+            break;
+        }
+    }
+    assert(i <= cpt_node->_pt_parent->_un_count);
+
+    return i;
+}
+
+/**
+ * Initialize element auxiliary function
+ */
+void _bp_tree_init_elem_auxiliary(_bp_tree_t* pt_bp_tree, void* pv_elem)
+{
+    assert(pt_bp_tree != NULL);
+    assert(pv_elem != NULL);
+    assert(_bp_tree_is_inited(pt_bp_tree) || _bp_tree_is_created(pt_bp_tree));
+
+    /* initialize new elements */
+    if (_GET_BP_TREE_TYPE_STYLE(pt_bp_tree) == _TYPE_CSTL_BUILTIN) {
+        /* get element type name */
+        char s_elemtypename[_TYPE_NAME_SIZE + 1];
+        _type_get_elem_typename(_GET_BP_TREE_TYPE_NAME(pt_bp_tree), s_elemtypename);
+
+        _GET_BP_TREE_TYPE_INIT_FUNCTION(pt_bp_tree)(pv_elem, s_elemtypename);
+    } else {
+        bool_t b_result = _GET_BP_TREE_TYPE_SIZE(pt_bp_tree);
+        _GET_BP_TREE_TYPE_INIT_FUNCTION(pt_bp_tree)(pv_elem, &b_result);
+        assert(b_result);
+    }
+}
+
+/**
+ * Destroy element auxiliary function
+ */
+void _bp_tree_destroy_elem_auxiliary(_bp_tree_t* pt_bp_tree, void* pv_elem)
+{
+    bool_t b_result = false;
+
+    assert(pt_bp_tree != NULL);
+    assert(pv_elem != NULL);
+
+    b_result = _GET_BP_TREE_TYPE_SIZE(pt_bp_tree);
+    _GET_BP_TREE_TYPE_DESTROY_FUNCTION(pt_bp_tree)(pv_elem, &b_result);
+    assert(b_result);
+}
+
+/**
+ * Move elements or keys to uninitialized memory.
+ */
+void _bp_tree_move_elem_auxiliary(_bp_tree_t* pt_bp_tree, _byte_t* pby_dest, _byte_t* pby_src, size_t t_count)
+{
+    size_t t_typesize = 0;
+    size_t i = 0;
+    bool_t b_result = false;
+
+    assert(pt_bp_tree != NULL);
+
+    if (t_count == 0 || pby_dest == pby_src) {
+        return;
+    }
+
+    t_typesize = _GET_BP_TREE_TYPE_SIZE(pt_bp_tree);
+    if (pt_bp_tree->_t_isbitwise) {
+        memmove(pby_dest, pby_src, t_count * t_typesize);
+    } else if (pby_dest < pby_src) {
+        for (i = 0; i < t_count; ++i) {
+            _bp_tree_init_elem_auxiliary(pt_bp_tree, pby_dest + i * t_typesize);
+            b_result = t_typesize;
+            _GET_BP_TREE_TYPE_COPY_FUNCTION(pt_bp_tree)(pby_dest + i * t_typesize, pby_src + i * t_typesize, &b_result);
+            assert(b_result);
+            _bp_tree_destroy_elem_auxiliary(pt_bp_tree, pby_src + i * t_typesize);
+        }
+    } else {
+        for (i = t_count; i > 0; --i) {
+            _bp_tree_init_elem_auxiliary(pt_bp_tree, pby_dest + (i - 1) * t_typesize);
+            b_result = t_typesize;
+            _GET_BP_TREE_TYPE_COPY_FUNCTION(pt_bp_tree)(
+                pby_dest + (i - 1) * t_typesize, pby_src + (i - 1) * t_typesize, &b_result);
+            assert(b_result);
+            _bp_tree_destroy_elem_auxiliary(pt_bp_tree, pby_src + (i - 1) * t_typesize);
+        }
+    }
+}
+
+/**
+ * Element less function auxiliary
+ */
+bool_t _bp_tree_elem_less_auxiliary(const _bp_tree_t* cpt_bp_tree, const void* cpv_first, const void* cpv_second)
+{
+    assert(cpt_bp_tree != NULL);
+    assert(cpv_first != NULL);
+    assert(cpv_second != NULL);
+    assert(_bp_tree_is_inited(cpt_bp_tree));
+
+    if (cpt_bp_tree->_t_fastcompare != NULL) {
+        return cpt_bp_tree->_t_fastcompare(cpv_first, cpv_second);
+    } else {
+        bool_t b_result = _GET_BP_TREE_TYPE_SIZE(cpt_bp_tree);
+        if (strncmp(_GET_BP_TREE_TYPE_BASENAME(cpt_bp_tree), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0 &&
+            cpt_bp_tree->_t_compare != _GET_BP_TREE_TYPE_LESS_FUNCTION(cpt_bp_tree)) {
+            cpt_bp_tree->_t_compare(string_c_str((string_t*)cpv_first), string_c_str((string_t*)cpv_second), &b_result);
+        } else {
+            cpt_bp_tree->_t_compare(cpv_first, cpv_second, &b_result);
+        }
+        return b_result;
+    }
+}
+
+/**
+ * Element compare function auxiliary
+ */
+void _bp_tree_elem_compare_auxiliary(
+    const _bp_tree_t* cpt_bp_tree, const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(pv_output != NULL);
+    *(bool_t*)pv_output = _bp_tree_elem_less_auxiliary(cpt_bp_tree, cpv_first, cpv_second);
+}
+
+/** local function implementation section **/
+
+/** eof **/
+
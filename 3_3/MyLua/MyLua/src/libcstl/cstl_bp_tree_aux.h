@@ -0,0 +1,354 @@
+/*
+ *  The interface of b+ tree auxiliary function.
+ *  Copyright (C)  2008 - 2012  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+#ifndef _CSTL_BP_TREE_AUX_H_
+#define _CSTL_BP_TREE_AUX_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** include section **/
+
+/** constant declaration and macro section **/
+/* macros for type informations */
+#define _GET_BP_TREE_TYPE_SIZE(pt_bp_tree)              ((pt_bp_tree)->_t_typeinfo._pt_type->_t_typesize)
+#define _GET_BP_TREE_TYPE_NAME(pt_bp_tree)              ((pt_bp_tree)->_t_typeinfo._s_typename)
+#define _GET_BP_TREE_TYPE_BASENAME(pt_bp_tree)          ((pt_bp_tree)->_t_typeinfo._pt_type->_s_typename)
+#define _GET_BP_TREE_TYPE_INIT_FUNCTION(pt_bp_tree)     ((pt_bp_tree)->_t_typeinfo._pt_type->_t_typeinit)
+#define _GET_BP_TREE_TYPE_COPY_FUNCTION(pt_bp_tree)     ((pt_bp_tree)->_t_typeinfo._pt_type->_t_typecopy)
+#define _GET_BP_TREE_TYPE_LESS_FUNCTION(pt_bp_tree)     ((pt_bp_tree)->_t_typeinfo._pt_type->_t_typeless)
+#define _GET_BP_TREE_TYPE_LESS_FAST_FUNCTION(pt_bp_tree) ((pt_bp_tree)->_t_typeinfo._pt_type->_t_typelessfast)
+#define _GET_BP_TREE_TYPE_DESTROY_FUNCTION(pt_bp_tree)  ((pt_bp_tree)->_t_typeinfo._pt_type->_t_typedestroy)
+#define _GET_BP_TREE_TYPE_STYLE(pt_bp_tree)             ((pt_bp_tree)->_t_typeinfo._t_style)
+
+/* macros for node layout */
+#define _BP_TREE_LEAF_MIN(pt_bp_tree)                   ((pt_bp_tree)->_t_leafcount / 2)
+#define _BP_TREE_INNER_MIN(pt_bp_tree)                  ((pt_bp_tree)->_t_innercount / 2)
+#define _BP_TREE_ELEM(pt_bp_tree, pt_leaf, t_index)\
+    ((pt_leaf)->_pby_data + (t_index) * _GET_BP_TREE_TYPE_SIZE(pt_bp_tree))
+#define _BP_TREE_CHILDREN(pt_inner)                     ((_bpnode_t**)(pt_inner)->_pby_data)
+#define _BP_TREE_KEY(pt_bp_tree, pt_inner, t_index)\
+    ((pt_inner)->_pby_data + ((pt_bp_tree)->_t_innercount + 2) * sizeof(_bpnode_t*) +\
+     (t_index) * _GET_BP_TREE_TYPE_SIZE(pt_bp_tree))
+#define _BP_TREE_ITERATOR_ELEM(it_iter)\
+    _BP_TREE_ELEM(_BP_TREE_ITERATOR_TREE(it_iter), (_bpnode_t*)_BP_TREE_ITERATOR_COREPOS(it_iter),\
+                  _BP_TREE_ITERATOR_INDEX(it_iter))
+
+/** data type declaration and struct, union, enum section **/
+
+/** exported global variable declaration section **/
+
+/** exported function prototype section **/
+#ifndef NDEBUG
+/**
+ * Test b+ tree is created by _create_bp_tree.
+ * @param cpt_bp_tree           b+ tree container.
+ * @return if b+ tree is created by _create_bp_tree, then return true, else return false.
+ * @remarks if cpt_bp_tree == NULL, then the behavior is undefined.
+ */
+extern bool_t _bp_tree_is_created(const _bp_tree_t* cpt_bp_tree);
+
+/**
+ * Test b+ tree is initialized by b+ tree initialization functions.
+ * @param cpt_bp_tree           b+ tree container.
+ * @return if b+ tree is initialized by b+ tree initialization functions, then return true, else return false.
+ * @remarks if cpt_bp_tree == NULL, then the behavior is undefined.
+ */
+extern bool_t _bp_tree_is_inited(const _bp_tree_t* cpt_bp_tree);
+
+/**
+ * Test iterator referenced data is within the b+ tree.
+ * @param cpt_bp_tree           point to b+ tree.
+ * @param it_iter               b+ tree iterator.
+ * @return if iterator referenced is within the b+ tree, then return true, otherwise return false.
+ * @remarks if cpt_bp_tree == NULL, then the behavior is undefined, cpt_bp_tree must be initialized, otherwise the
+ *          behavior is undefined. the it_iter must be valie b+ tree iterator, otherwist the behavior is undefined. 
+ */
+extern bool_t _bp_tree_iterator_belong_to_bp_tree(const _bp_tree_t* cpt_bp_tree, _bp_tree_iterator_t it_iter);
+
+/**
+ * Test the type that saved in the b+ tree container and referenced by it_iter are same.
+ * @param cpt_bp_tree           b+ tree container.
+ * @param it_iter               b+ tree iterator.
+ * @return if the type is same, return true, else return false.
+ * @remarks if cpt_bp_tree == NULL or it_iter is not b+ tree iterator, then the behavior is undefined.
+ */
+extern bool_t _bp_tree_same_bp_tree_iterator_type(const _bp_tree_t* cpt_bp_tree, _bp_tree_iterator_t it_iter);
+
+/**
+ * Test the type that saved in the b+ tree container and referenced by it_iter are same.
+ * @param cpt_bp_tree           b+ tree container.
+ * @param it_iter               iterator.
+ * @return if the type is same, return true, else return false.
+ * @remarks if cpt_bp_tree == NULL, then the behavior is undefined.
+ */
+extern bool_t _bp_tree_same_iterator_type(const _bp_tree_t* cpt_bp_tree, iterator_t it_iter);
+
+/**
+ * Test the type and compare function that saved in the b+ tree container and referenced by it_iter are same.
+ * @param cpt_bp_tree           b+ tree container.
+ * @param it_iter               b+ tree iterator.
+ * @return if the type is same, return true, else return false.
+ * @remarks if cpt_bp_tree == NULL or it_iter is not b+ tree iterator, then the behavior is undefined.
+ */
+extern bool_t _bp_tree_same_bp_tree_iterator_type_ex(const _bp_tree_t* cpt_bp_tree, _bp_tree_iterator_t it_iter);
+
+/**
+ * Test leaf node is linked in the b+ tree.
+ * @param cpt_bp_tree           b+ tree container.
+ * @param cpt_leaf              leaf node.
+ * @return if leaf node is linked in the b+ tree, then return true, otherwise return false.
+ * @remarks if cpt_bp_tree == NULL, then the behavior is undefined. if cpt_leaf == NULL, then return false.
+ */
+extern bool_t _bp_tree_bpnode_belong_to_bp_tree(const _bp_tree_t* cpt_bp_tree, const _bpnode_t* cpt_leaf);
+#endif /* NDEBUG */
+
+/**
+ * Test the type that saved in the b+ tree container is same.
+ * @param cpt_first             first b+ tree.
+ * @param cpt_second            second b+ tree.
+ * @return if the type is same, return true, else return false.
+ * @remarks if cpt_first == NULL or cpt_second == NULL, the behavior is undefined. the two b+ tree must be initialized
+ *          or created by _create_bp_tree(), otherwise the behavior is undefined. if cpt_first == cpt_second then
+ *          return true.
+ */
+extern bool_t _bp_tree_same_type(const _bp_tree_t* cpt_first, const _bp_tree_t* cpt_second);
+
+/**
+ * Test the type and compare function that saved in the b+ tree container is same.
+ * @param cpt_first             first b+ tree.
+ * @param cpt_second            second b+ tree.
+ * @return if the type is same, return true, else return false.
+ * @remarks if cpt_first == NULL or cpt_second == NULL, the behavior is undefined. the two b+ tree must be initialized
+ *          or created by _create_bp_tree(), otherwise the behavior is undefined. if cpt_first == cpt_second then
+ *          return true.
+ */
+extern bool_t _bp_tree_same_type_ex(const _bp_tree_t* cpt_first, const _bp_tree_t* cpt_second);
+
+/**
+ * Get the iterator that addresses the element in leaf node.
+ * @param cpt_bp_tree           b+ tree.
+ * @param cpt_leaf              leaf node.
+ * @param t_index               index of element in leaf node.
+ * @return b+ tree iterator.
+ * @remarks if cpt_bp_tree == NULL, the behavior is undefined. if t_index is the count of leaf node, then the iterator
+ *          addresses the first element of next leaf, if cpt_leaf == NULL or there is no next leaf, then return
+ *          _bp_tree_end().
+ */
+extern _bp_tree_iterator_t _bp_tree_get_iterator(const _bp_tree_t* cpt_bp_tree, const _bpnode_t* cpt_leaf, size_t t_index);
+
+/**
+ * Search the bound of specific value in a sorted elements or keys.
+ * @param cpt_bp_tree           b+ tree.
+ * @param cpby_data             first element or key.
+ * @param t_count               count of elements or keys.
+ * @param cpv_value             specific value.
+ * @param b_upper               search the upper bound or lower bound.
+ * @return the index of first element that is greater than (b_upper is true) or not less than (b_upper is false)
+ *         the specific value, or t_count if there is no such element.
+ * @remarks if cpt_bp_tree == NULL or cpv_value == NULL, then the behavior is undefined.
+ */
+extern size_t _bp_tree_search_bound(
+    const _bp_tree_t* cpt_bp_tree, const _byte_t* cpby_data, size_t t_count, const void* cpv_value, bool_t b_upper);
+
+/**
+ * Travel from root to leaf for the bound of specific value.
+ * @param cpt_bp_tree           b+ tree.
+ * @param cpv_value             specific value.
+ * @param b_upper               search the upper bound or lower bound.
+ * @param pt_index              the index of bound in the leaf.
+ * @return the leaf node that the bound is in, the index may be the count of the leaf.
+ * @remarks if cpt_bp_tree == NULL or cpv_value == NULL or pt_index == NULL, then the behavior is undefined. the b+ tree
+ *          must be initialized and not empty, otherwise the behavior is undefined.
+ */
+extern _bpnode_t* _bp_tree_find_leaf(const _bp_tree_t* cpt_bp_tree, const void* cpv_value, bool_t b_upper, size_t* pt_index);
+
+/**
+ * Allocate a new leaf or inner node.
+ * @param pt_bp_tree            b+ tree.
+ * @param b_leaf                leaf node or inner node.
+ * @return new node without any elements.
+ * @remarks if pt_bp_tree == NULL, then the behavior is undefined.
+ */
+extern _bpnode_t* _bp_tree_create_bpnode(_bp_tree_t* pt_bp_tree, bool_t b_leaf);
+
+/**
+ * Destroy the subtree with postorder traverse.
+ * @param pt_bp_tree            b+ tree.
+ * @param pt_root               root of sub b+ tree.
+ * @return NULL.
+ * @remarks if pt_bp_tree == NULL, the behavior is undefined. b+ tree must be initialized or created by _create_bp_tree(),
+ *          otherwise the behavior is undefined.
+ */
+extern _bpnode_t* _bp_tree_destroy_subtree(_bp_tree_t* pt_bp_tree, _bpnode_t* pt_root);
+
+/**
+ * Insert the value into leaf node at specific position.
+ * @param pt_bp_tree            b+ tree.
+ * @param pt_leaf               leaf node.
+ * @param t_index               position in leaf node.
+ * @param cpv_value             insert value.
+ * @return iterator addresses the new element.
+ * @remarks if pt_bp_tree == NULL or pt_leaf == NULL or cpv_value == NULL, then the behavior is undefined. the position
+ *          must keep the order of b+ tree, otherwise the behavior is undefined.
+ */
+extern _bp_tree_iterator_t _bp_tree_insert_value(_bp_tree_t* pt_bp_tree, _bpnode_t* pt_leaf, size_t t_index, const void* cpv_value);
+
+/**
+ * Erase the element of leaf node at specific position.
+ * @param pt_bp_tree            b+ tree.
+ * @param pt_leaf               leaf node.
+ * @param t_index               position in leaf node.
+ * @return iterator addresses the element that follows the erased element.
+ * @remarks if pt_bp_tree == NULL or pt_leaf == NULL, then the behavior is undefined. t_index must be less than the
+ *          count of leaf node, otherwise the behavior is undefined.
+ */
+extern _bp_tree_iterator_t _bp_tree_erase_value(_bp_tree_t* pt_bp_tree, _bpnode_t* pt_leaf, size_t t_index);
+
+/**
+ * Split the overflow leaf node.
+ * @param pt_bp_tree            b+ tree.
+ * @param pt_leaf               leaf node.
+ * @return the new leaf node that saves the upper half of elements.
+ * @remarks if pt_bp_tree == NULL or pt_leaf == NULL, then the behavior is undefined.
+ */
+extern _bpnode_t* _bp_tree_split_leaf(_bp_tree_t* pt_bp_tree, _bpnode_t* pt_leaf);
+
+/**
+ * Split the overflow inner node.
+ * @param pt_bp_tree            b+ tree.
+ * @param pt_inner              inner node.
+ * @return void.
+ * @remarks if pt_bp_tree == NULL or pt_inner == NULL, then the behavior is undefined.
+ */
+extern void _bp_tree_split_inner(_bp_tree_t* pt_bp_tree, _bpnode_t* pt_inner);
+
+/**
+ * Insert the key and the new right node into the parent of left node.
+ * @param pt_bp_tree            b+ tree.
+ * @param pt_left               left node.
+ * @param pby_key               the key that separates left node and right node.
+ * @param b_copy                copy the key or move the key.
+ * @param pt_right              right node.
+ * @return void.
+ * @remarks if pt_bp_tree == NULL or pt_left == NULL or pby_key == NULL or pt_right == NULL, then the behavior is
+ *          undefined. if pt_left is root, then the new root is created. if the key is moved, the key memory is not
+ *          initialized after inserting.
+ */
+extern void _bp_tree_insert_child(
+    _bp_tree_t* pt_bp_tree, _bpnode_t* pt_left, _byte_t* pby_key, bool_t b_copy, _bpnode_t* pt_right);
+
+/**
+ * Remove the key and the right child of key from inner node.
+ * @param pt_bp_tree            b+ tree.
+ * @param pt_inner              inner node.
+ * @param t_index               index of key.
+ * @return void.
+ * @remarks if pt_bp_tree == NULL or pt_inner == NULL, then the behavior is undefined. the key must be destroyed or
+ *          moved before removing, otherwise the behavior is undefined.
+ */
+extern void _bp_tree_remove_child(_bp_tree_t* pt_bp_tree, _bpnode_t* pt_inner, size_t t_index);
+
+/**
+ * Rebalance the inner node after removing a child.
+ * @param pt_bp_tree            b+ tree.
+ * @param pt_inner              inner node.
+ * @return void.
+ * @remarks if pt_bp_tree == NULL or pt_inner == NULL, then the behavior is undefined.
+ */
+extern void _bp_tree_rebalance_inner(_bp_tree_t* pt_bp_tree, _bpnode_t* pt_inner);
+
+/**
+ * Get the index of child in parent node.
+ * @param cpt_node              child node.
+ * @return index of child.
+ * @remarks if cpt_node == NULL or cpt_node is root, then the behavior is undefined.
+ */
+extern size_t _bp_tree_get_child_index(const _bpnode_t* cpt_node);
+
+/**
+ * Initialize element auxiliary function
+ * @param pt_bp_tree            b+ tree.
+ * @param pv_elem               element.
+ * @return void.
+ * @remarks if pt_bp_tree == NULL or pv_elem == NULL, then the behavior is undefine. pt_bp_tree must be initialized or
+ *          created by _create_bp_tree(), otherwise the behavior is undefined.
+ */
+extern void _bp_tree_init_elem_auxiliary(_bp_tree_t* pt_bp_tree, void* pv_elem);
+
+/**
+ * Destroy element auxiliary function
+ * @param pt_bp_tree            b+ tree.
+ * @param pv_elem               element.
+ * @return void.
+ * @remarks if pt_bp_tree == NULL or pv_elem == NULL, then the behavior is undefine.
+ */
+extern void _bp_tree_destroy_elem_auxiliary(_bp_tree_t* pt_bp_tree, void* pv_elem);
+
+/**
+ * Move elements or keys to uninitialized memory.
+ * @param pt_bp_tree            b+ tree.
+ * @param pby_dest              destination memory.
+ * @param pby_src               source elements.
+ * @param t_count               count of elements.
+ * @return void.
+ * @remarks if pt_bp_tree == NULL, then the behavior is undefine. the destination and source may overlap, the source
+ *          memory is not initialized after moving. elements of c builtin type except char*, pair and vector are
+ *          moved by memmove, others are copied and destroyed one by one.
+ */
+extern void _bp_tree_move_elem_auxiliary(_bp_tree_t* pt_bp_tree, _byte_t* pby_dest, _byte_t* pby_src, size_t t_count);
+
+/**
+ * Element less function auxiliary
+ * @param cpt_bp_tree           b+ tree.
+ * @param cpv_first             first element.
+ * @param cpv_second            second element.
+ * @return true if first element is less than second element, otherwise false.
+ * @remarks if cpt_bp_tree == NULL or cpv_first == NULL or cpv_second == NULL, the behavior is undefined. the result is
+ *          returned by the cached less function of element type directly when the compare function is the default
+ *          one, otherwise the compare function is called. cpt_bp_tree must be initialized, otherwise the behavior is
+ *          undefined.
+ */
+extern bool_t _bp_tree_elem_less_auxiliary(const _bp_tree_t* cpt_bp_tree, const void* cpv_first, const void* cpv_second);
+
+/**
+ * Element compare function auxiliary, the shim of _bp_tree_elem_less_auxiliary().
+ * @param cpt_bp_tree           b+ tree.
+ * @param cpv_first             first element.
+ * @param cpv_second            second element.
+ * @param pv_output             output.
+ * @return void.
+ * @remarks if cpt_bp_tree == NULL or cpv_first == NULL or cpv_second == NULL or pv_output == NULL, the behavior is
+ *          undefined. cpt_bp_tree must be initialized or created by _create_bp_tree(), otherwise the behavior is
+ *          undefined.
+ */
+extern void _bp_tree_elem_compare_auxiliary(
+    const _bp_tree_t* cpt_bp_tree, const void* cpv_first, const void* cpv_second, void* pv_output);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CSTL_BP_TREE_AUX_H_ */
+/** eof **/
+
@@ -0,0 +1,228 @@
+/*
+ *  The implementation of b+ tree iterator interface.
+ *  Copyright (C)  2008 - 2014  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+/** include section **/
+#include "cstl_def.h"
+#include "cstl_alloc.h"
+#include "cstl_types.h"
+#include "citerator.h"
+#include "cstring.h"
+
+#include "cstl_bp_tree_iterator.h"
+#include "cstl_bp_tree_private.h"
+#include "cstl_bp_tree.h"
+
+#include "cstl_bp_tree_aux.h"
+
+/** local constant declaration and local macro section **/
+
+/** local data type declaration and local struct, union, enum section **/
+
+/** local function prototype section **/
+
+/** exported global variable definition section **/
+
+/** local global variable definition section **/
+
+/** exported function implementation section **/
+/**
+ * Create b+ tree iterator.
+ */
+_bp_tree_iterator_t _create_bp_tree_iterator(void)
+{
+    _bp_tree_iterator_t it_iter;
+
+    _BP_TREE_ITERATOR_COREPOS(it_iter) = NULL;
+    _BP_TREE_ITERATOR_INDEX(it_iter) = 0;
+    _BP_TREE_ITERATOR_TREE_POINTER(it_iter) = NULL;
+
+    _ITERATOR_CONTAINER(it_iter) = NULL;
+
+    return it_iter;
+}
+
+/**
+ * Test the two b+ tree iterator are equal.
+ */
+bool_t _bp_tree_iterator_equal(_bp_tree_iterator_t it_first, _bp_tree_iterator_t it_second)
+{
+    assert(_bp_tree_iterator_belong_to_bp_tree(_BP_TREE_ITERATOR_TREE(it_first), it_first));
+    assert(_bp_tree_iterator_belong_to_bp_tree(_BP_TREE_ITERATOR_TREE(it_second), it_second));
+    assert(_BP_TREE_ITERATOR_TREE(it_first) == _BP_TREE_ITERATOR_TREE(it_second));
+
+    return _BP_TREE_ITERATOR_COREPOS(it_first) == _BP_TREE_ITERATOR_COREPOS(it_second) &&
+           _BP_TREE_ITERATOR_INDEX(it_first) == _BP_TREE_ITERATOR_INDEX(it_second) ? true : false;
+}
+
+/**
+ * Get data value referenced by iterator.
+ */
+void _bp_tree_iterator_get_value(_bp_tree_iterator_t it_iter, void* pv_value)
+{
+    assert(pv_value != NULL);
+    assert(_bp_tree_iterator_belong_to_bp_tree(_BP_TREE_ITERATOR_TREE(it_iter), it_iter));
+    assert(!_bp_tree_iterator_equal(it_iter, _bp_tree_end(_BP_TREE_ITERATOR_TREE(it_iter))));
+
+    /* char* */
+    if (strncmp(_GET_BP_TREE_TYPE_BASENAME(_BP_TREE_ITERATOR_TREE(it_iter)), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+        *(char**)pv_value = (char*)string_c_str((string_t*)_BP_TREE_ITERATOR_ELEM(it_iter));
+    } else {
+        bool_t b_result = _GET_BP_TREE_TYPE_SIZE(_BP_TREE_ITERATOR_TREE(it_iter));
+        _GET_BP_TREE_TYPE_COPY_FUNCTION(_BP_TREE_ITERATOR_TREE(it_iter))(pv_value, _BP_TREE_ITERATOR_ELEM(it_iter), &b_result);
+        assert(b_result);
+    }
+}
+
+/**
+ * Get data value pointer referenced by iterator.
+ */
+const void* _bp_tree_iterator_get_pointer(_bp_tree_iterator_t it_iter)
+{
+    assert(_bp_tree_iterator_belong_to_bp_tree(_BP_TREE_ITERATOR_TREE(it_iter), it_iter));
+    assert(!_bp_tree_iterator_equal(it_iter, _bp_tree_end(_BP_TREE_ITERATOR_TREE(it_iter))));
+
+    /* char* */
+    if (strncmp(_GET_BP_TREE_TYPE_BASENAME(_BP_TREE_ITERATOR_TREE(it_iter)), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+        return (char*)string_c_str((string_t*)_BP_TREE_ITERATOR_ELEM(it_iter));
+    } else {
+        return _BP_TREE_ITERATOR_ELEM(it_iter);
+    }
+}
+
+/**
+ * Get data value pointer referenced by iterator, but ignore char*.
+ */
+const void* _bp_tree_iterator_get_pointer_ignore_cstr(_bp_tree_iterator_t it_iter)
+{
+    assert(_bp_tree_iterator_belong_to_bp_tree(_BP_TREE_ITERATOR_TREE(it_iter), it_iter));
+    assert(!_bp_tree_iterator_equal(it_iter, _bp_tree_end(_BP_TREE_ITERATOR_TREE(it_iter))));
+
+    return _BP_TREE_ITERATOR_ELEM(it_iter);
+}
+
+/**
+ * Return iterator reference next element.
+ */
+_bp_tree_iterator_t _bp_tree_iterator_next(_bp_tree_iterator_t it_iter)
+{
+    _bp_tree_iterator_t it_next;
+
+    assert(_bp_tree_iterator_belong_to_bp_tree(_BP_TREE_ITERATOR_TREE(it_iter), it_iter));
+    assert(!_bp_tree_iterator_equal(it_iter, _bp_tree_end(_BP_TREE_ITERATOR_TREE(it_iter))));
+
+    /* keep the container information of it_iter, only move the position */
+    it_next = _bp_tree_get_iterator(_BP_TREE_ITERATOR_TREE(it_iter),
+        (_bpnode_t*)_BP_TREE_ITERATOR_COREPOS(it_iter), _BP_TREE_ITERATOR_INDEX(it_iter) + 1);
+    _BP_TREE_ITERATOR_COREPOS(it_iter) = _BP_TREE_ITERATOR_COREPOS(it_next);
+    _BP_TREE_ITERATOR_INDEX(it_iter) = _BP_TREE_ITERATOR_INDEX(it_next);
+
+    return it_iter;
+}
+
+/**
+ * Return iterator reference previous element.
+ */
+_bp_tree_iterator_t _bp_tree_iterator_prev(_bp_tree_iterator_t it_iter)
+{
+    _bpnode_t* pt_leaf = (_bpnode_t*)_BP_TREE_ITERATOR_COREPOS(it_iter);
+
+    assert(_bp_tree_iterator_belong_to_bp_tree(_BP_TREE_ITERATOR_TREE(it_iter), it_iter));
+    assert(!_bp_tree_iterator_equal(it_iter, _bp_tree_begin(_BP_TREE_ITERATOR_TREE(it_iter))));
+
+    if (pt_leaf != NULL && _BP_TREE_ITERATOR_INDEX(it_iter) > 0) {
+        _BP_TREE_ITERATOR_INDEX(it_iter)--;
+    } else {
+        /* previous of end is the last element of last leaf */
+        pt_leaf = pt_leaf != NULL ? pt_leaf->_pt_prev : _BP_TREE_ITERATOR_TREE(it_iter)->_pt_last;
+        assert(pt_leaf != NULL && pt_leaf->_un_count > 0);
+        _BP_TREE_ITERATOR_COREPOS(it_iter) = (_byte_t*)pt_leaf;
+        _BP_TREE_ITERATOR_INDEX(it_iter) = pt_leaf->_un_count - 1;
+    }
+
+    return it_iter;
+}
+
+/**
+ * Calculate distance between two iterators.
+ */
+int _bp_tree_iterator_distance(_bp_tree_iterator_t it_first, _bp_tree_iterator_t it_second)
+{
+    _bpnode_t* pt_leaf = NULL;
+    int        n_distance = 0;
+
+    assert(_bp_tree_iterator_belong_to_bp_tree(_BP_TREE_ITERATOR_TREE(it_first), it_first));
+    assert(_bp_tree_iterator_belong_to_bp_tree(_BP_TREE_ITERATOR_TREE(it_second), it_second));
+    assert(_BP_TREE_ITERATOR_TREE(it_first) == _BP_TREE_ITERATOR_TREE(it_second));
+
+    if (_bp_tree_iterator_before(it_first, it_second)) {
+        /* count the elements leaf by leaf */
+        n_distance = -(int)_BP_TREE_ITERATOR_INDEX(it_first);
+        for (pt_leaf = (_bpnode_t*)_BP_TREE_ITERATOR_COREPOS(it_first);
+             pt_leaf != (_bpnode_t*)_BP_TREE_ITERATOR_COREPOS(it_second);
+             pt_leaf = pt_leaf->_pt_next) {
+            n_distance += (int)pt_leaf->_un_count;
+        }
+
+        return n_distance + (int)_BP_TREE_ITERATOR_INDEX(it_second);
+    } else if (_bp_tree_iterator_before(it_second, it_first)) {
+        return -_bp_tree_iterator_distance(it_second, it_first);
+    } else {
+        return 0;
+    }
+}
+
+/**
+ * Test the first iterator is before the second.
+ */
+bool_t _bp_tree_iterator_before(_bp_tree_iterator_t it_first, _bp_tree_iterator_t it_second)
+{
+    _bpnode_t* pt_leaf = NULL;
+
+    assert(_bp_tree_iterator_belong_to_bp_tree(_BP_TREE_ITERATOR_TREE(it_first), it_first));
+    assert(_bp_tree_iterator_belong_to_bp_tree(_BP_TREE_ITERATOR_TREE(it_second), it_second));
+    assert(_BP_TREE_ITERATOR_TREE(it_first) == _BP_TREE_ITERATOR_TREE(it_second));
+
+    /* end is after all iterators */
+    if (_BP_TREE_ITERATOR_COREPOS(it_first) == NULL) {
+        return false;
+    } else if (_BP_TREE_ITERATOR_COREPOS(it_second) == NULL) {
+        return true;
+    } else if (_BP_TREE_ITERATOR_COREPOS(it_first) == _BP_TREE_ITERATOR_COREPOS(it_second)) {
+        return _BP_TREE_ITERATOR_INDEX(it_first) < _BP_TREE_ITERATOR_INDEX(it_second) ? true : false;
+    }
+
+    /* else travel the following leaves for search second iterator */
+    for (pt_leaf = ((_bpnode_t*)_BP_TREE_ITERATOR_COREPOS(it_first))->_pt_next;
+         pt_leaf != NULL;
+         pt_leaf = pt_leaf->_pt_next) {
+        if (pt_leaf == (_bpnode_t*)_BP_TREE_ITERATOR_COREPOS(it_second)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/** local function implementation section **/
+
+/** eof **/
+
@@ -0,0 +1,125 @@
+/*
+ *  Interface of b+ tree iterator.
+ *  Copyright (C)  2008 - 2012  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+#ifndef _CSTL_BP_TREE_ITERATOR_H_
+#define _CSTL_BP_TREE_ITERATOR_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** include section **/
+
+/** constant declaration and macro section **/
+
+/** data type declaration and struct, union, enum section **/
+typedef iterator_t _bp_tree_iterator_t;
+typedef iterator_t _bp_tree_reverse_iterator_t;
+
+/** exported global variable declaration section **/
+
+/** exported function prototype section **/
+/**
+ * Create b+ tree iterator.
+ * @return b+ tree iterator.
+ * @remarks the returned iterator is invalid iterator.
+ */
+extern _bp_tree_iterator_t _create_bp_tree_iterator(void);
+
+/**
+ * Get data value referenced by iterator.
+ * @param it_iter    b+ tree iterator.
+ * @param pv_value   data value buffer.
+ * @return void.
+ * @remarks it_iter must be valid b+ tree iterator, otherwise the behavior is undefined. if pv_value == NULL, then the
+ *          behavior is undefined.
+ */
+extern void _bp_tree_iterator_get_value(_bp_tree_iterator_t it_iter, void* pv_value);
+
+/**
+ * Get data value pointer referenced by iterator.
+ * @param it_iter    b+ tree iterator.
+ * @return void.
+ * @remarks it_iter must be valid b+ tree iterator, otherwise the behavior is undefined.
+ */
+extern const void* _bp_tree_iterator_get_pointer(_bp_tree_iterator_t it_iter); 
+
+/**
+ * Get data value pointer referenced by iterator, but ignore char*.
+ * @param it_iter    b+ tree iterator.
+ * @return void.
+ * @remarks it_iter must be valid b+ tree iterator, otherwise the behavior is undefined.
+ */
+extern const void* _bp_tree_iterator_get_pointer_ignore_cstr(_bp_tree_iterator_t it_iter); 
+
+/**
+ * Return iterator reference next element.
+ * @param  it_iter    current iterator.
+ * @return next iterator.
+ * @remarks it_iter and next iterator must be valid iterator, otherwise the behavior is undefined.
+ */
+extern _bp_tree_iterator_t _bp_tree_iterator_next(_bp_tree_iterator_t it_iter);
+
+/**
+ * Return iterator reference previous element.
+ * @param  it_iter    current iterator.
+ * @return previous iterator.
+ * @remarks it_iter and previous iterator must be valid iterator, otherwise the behavior is undefined.
+ */
+extern _bp_tree_iterator_t _bp_tree_iterator_prev(_bp_tree_iterator_t it_iter);
+
+/**
+ * Test the two b+ tree iterator are equal.
+ * @param it_first    b+ tree iterator.
+ * @param it_second   b+ tree iterator.
+ * @return true, if the two iterator are equal, else return false.
+ * @remarks the two iterator must be valid b+ tree iterator, otherwise the behavior is undefined.
+ */
+extern bool_t _bp_tree_iterator_equal(_bp_tree_iterator_t it_first, _bp_tree_iterator_t it_second);
+
+/**
+ * Calculate distance between two iterators.
+ * @param it_first    b+ tree iterator.
+ * @param it_second   b+ tree iterator.
+ * @return distance.
+ * @remarks the two iterator must be valid b+ tree iterator, and must be belong to same b+ tree, otherwise the behavior
+ *          is undefined. the result distance may be less than 0, equal to 0 or greater than 0.
+ */
+extern int _bp_tree_iterator_distance(_bp_tree_iterator_t it_first, _bp_tree_iterator_t it_second);
+
+/**
+ * Test the first iterator is before the second.
+ * @param it_first    b+ tree iterator.
+ * @param it_second   b+ tree iterator.
+ * @return true, if the first iterator is before the second, else return false.
+ * @remarks the two iterator must be valid b+ tree iterator, and must be belong to same b+ tree, otherwise the behavior
+ *          is undefined.
+ */
+extern bool_t _bp_tree_iterator_before(_bp_tree_iterator_t it_first, _bp_tree_iterator_t it_second);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CSTL_BP_TREE_ITERATOR_H_ */
+/** eof **/
+
@@ -0,0 +1,125 @@
+/*
+ *  The implementation of b+ tree private functions.
+ *  Copyright (C)  2008 - 2012  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+/** include section **/
+#include "cstl_def.h"
+#include "cstl_alloc.h"
+#include "cstl_types.h"
+#include "citerator.h"
+#include "cstring.h"
+
+#include "cstl_bp_tree_iterator.h"
+#include "cstl_bp_tree_private.h"
+#include "cstl_bp_tree.h"
+
+#include "cstl_bp_tree_aux.h"
+
+/** local constant declaration and local macro section **/
+
+/** local data type declaration and local struct, union, enum section **/
+
+/** local function prototype section **/
+
+/** exported global variable definition section **/
+
+/** local global variable definition section **/
+
+/** exported function implementation section **/
+/**
+ * Create b+ tree container auxiliary function.
+ */
+bool_t _create_bp_tree_auxiliary(_bp_tree_t* pt_bp_tree, const char* s_typename)
+{
+    size_t t_typesize = 0;
+
+    assert(pt_bp_tree != NULL);
+    assert(s_typename != NULL);
+
+    /* get type information */
+    _type_get_type(&pt_bp_tree->_t_typeinfo, s_typename);
+    if (pt_bp_tree->_t_typeinfo._t_style == _TYPE_INVALID) {
+        return false;
+    }
+
+    pt_bp_tree->_pt_root = NULL;
+    pt_bp_tree->_pt_first = NULL;
+    pt_bp_tree->_pt_last = NULL;
+    pt_bp_tree->_t_nodecount = 0;
+
+    /* fill the nodes with elements as many as the node bytes can hold */
+    t_typesize = _GET_BP_TREE_TYPE_SIZE(pt_bp_tree);
+    pt_bp_tree->_t_leafcount = _BP_TREE_NODE_BYTES / t_typesize;
+    if (pt_bp_tree->_t_leafcount < _BP_TREE_MIN_COUNT) {
+        pt_bp_tree->_t_leafcount = _BP_TREE_MIN_COUNT;
+    }
+    pt_bp_tree->_t_innercount = _BP_TREE_NODE_BYTES / (t_typesize + sizeof(_bpnode_t*));
+    if (pt_bp_tree->_t_innercount < _BP_TREE_MIN_COUNT) {
+        pt_bp_tree->_t_innercount = _BP_TREE_MIN_COUNT;
+    }
+
+    /*
+     * c builtin type, pair and vector never point to themselves, so they can be moved by memmove,
+     * other types are moved by copy function. char* is stored as string_t which keeps short string
+     * in itself, so it is not moved by memmove.
+     */
+    if ((_GET_BP_TREE_TYPE_STYLE(pt_bp_tree) == _TYPE_C_BUILTIN &&
+         strncmp(_GET_BP_TREE_TYPE_BASENAME(pt_bp_tree), _C_STRING_TYPE, _TYPE_NAME_SIZE) != 0) ||
+        strncmp(_GET_BP_TREE_TYPE_BASENAME(pt_bp_tree), _PAIR_TYPE, _TYPE_NAME_SIZE) == 0 ||
+        strncmp(_GET_BP_TREE_TYPE_BASENAME(pt_bp_tree), _VECTOR_TYPE, _TYPE_NAME_SIZE) == 0) {
+        pt_bp_tree->_t_isbitwise = true;
+    } else {
+        pt_bp_tree->_t_isbitwise = false;
+    }
+
+    pt_bp_tree->_t_compare = NULL;
+    pt_bp_tree->_t_fastcompare = NULL;
+
+    _alloc_init(&pt_bp_tree->_t_allocator);
+    return true;
+}
+
+/**
+ * Destroy b+ tree container auxiliary function.
+ */
+void _bp_tree_destroy_auxiliary(_bp_tree_t* pt_bp_tree)
+{
+    assert(pt_bp_tree != NULL);
+    assert(_bp_tree_is_inited(pt_bp_tree) || _bp_tree_is_created(pt_bp_tree));
+
+    /* destroy all elements */
+    pt_bp_tree->_pt_root = _bp_tree_destroy_subtree(pt_bp_tree, pt_bp_tree->_pt_root);
+    assert(pt_bp_tree->_pt_root == NULL);
+    pt_bp_tree->_pt_first = NULL;
+    pt_bp_tree->_pt_last = NULL;
+
+    /* destroy allocator */
+    _alloc_destroy(&pt_bp_tree->_t_allocator);
+
+    pt_bp_tree->_t_nodecount = 0;
+    pt_bp_tree->_t_compare = NULL;
+    pt_bp_tree->_t_fastcompare = NULL;
+}
+
+/** local function implementation section **/
+
+/** eof **/
+
@@ -0,0 +1,134 @@
+/*
+ *  The private interface of b+ tree.
+ *  Copyright (C)  2008 - 2013  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+#ifndef _CSTL_BP_TREE_PRIVATE_H_
+#define _CSTL_BP_TREE_PRIVATE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** include section **/
+
+/** constant declaration and macro section **/
+/*
+ * The bytes of elements or keys in one node, the node count is computed from the element size so that
+ * a node spans a few cache lines, but never less than _BP_TREE_MIN_COUNT.
+ */
+#define _BP_TREE_NODE_BYTES         256
+#define _BP_TREE_MIN_COUNT          4
+
+/* each node keeps one more slot for the overflow before splitting */
+#define _BP_TREE_LEAF_SIZE(pt_bp_tree)\
+    (sizeof(_bpnode_t) - sizeof(_byte_t) +\
+     ((pt_bp_tree)->_t_leafcount + 1) * (pt_bp_tree)->_t_typeinfo._pt_type->_t_typesize)
+#define _BP_TREE_INNER_SIZE(pt_bp_tree)\
+    (sizeof(_bpnode_t) - sizeof(_byte_t) + ((pt_bp_tree)->_t_innercount + 2) * sizeof(_bpnode_t*) +\
+     ((pt_bp_tree)->_t_innercount + 1) * (pt_bp_tree)->_t_typeinfo._pt_type->_t_typesize)
+
+/** data type declaration and struct, union, enum section **/
+/*
+ * leaf node:                       inner node:
+ * +-----------+                    +-----------+
+ * | parent    |                    | parent    |
+ * +-----------+                    +-----------+
+ * | prev      |                    | NULL      |
+ * +-----------+                    +-----------+
+ * | next      |                    | NULL      |
+ * +-----------+                    +-----------+
+ * | count     |                    | count     |
+ * +-----------+                    +-----------+
+ * | leaf = 1  |                    | leaf = 0  |
+ * +-----------+                    +-----------+
+ * | element 0 |                    | child 0   |
+ * | ...       |                    | ...       |
+ * | element   |                    | child n   |
+ * |   n-1     |                    |           |
+ * +-----------+                    +-----------+
+ *                                  | key 0     |
+ *                                  | ...       |
+ *                                  | key n-1   |
+ *                                  +-----------+
+ * the count of leaf is the number of elements, the count of inner node is the number of keys, and key i
+ * separates child i and child i+1: elements of child i <= key i <= elements of child i+1.
+ */
+typedef struct _tagbpnode
+{
+    struct _tagbpnode* _pt_parent;
+    struct _tagbpnode* _pt_prev;
+    struct _tagbpnode* _pt_next;
+    unsigned int       _un_count;
+    unsigned int       _un_leaf;
+    _byte_t            _pby_data[1];
+}_bpnode_t;
+
+typedef struct _tagbptree
+{
+    /* element type information */
+    _typeinfo_t       _t_typeinfo;
+
+    /* memory allocate */
+    _alloc_t          _t_allocator;
+
+    /* b+ tree node */
+    _bpnode_t*        _pt_root;
+    _bpnode_t*        _pt_first;      /* the leftmost leaf */
+    _bpnode_t*        _pt_last;       /* the rightmost leaf */
+    size_t            _t_nodecount;   /* the number of elements */
+    size_t            _t_leafcount;   /* the max number of elements in leaf */
+    size_t            _t_innercount;  /* the max number of keys in inner node */
+    bool_t            _t_isbitwise;   /* elements can be moved by memmove */
+
+    /* compare function for the inserting order */
+    bfun_t            _t_compare;
+    lfun_t            _t_fastcompare; /* the type less function without output or NULL */
+}_bp_tree_t;
+
+/** exported global variable declaration section **/
+
+/** exported function prototype section **/
+/**
+ * Create b+ tree container auxiliary function.
+ * @param pt_bp_tree        uncreated container.
+ * @param s_typename        element type name.
+ * @return if create b+ tree successfully return true, otherwise return false.
+ * @remarks if pt_bp_tree == NULL or s_typename == NULL, then the behavior is undefined. s_typename should be C builtin
+ *          type name, libcstl builtin typename or registed user defined type name, otherwise the function will return false.
+ */
+extern bool_t _create_bp_tree_auxiliary(_bp_tree_t* pt_bp_tree, const char* s_typename);
+
+/**
+ * Destroy b+ tree container auxiliary function.
+ * @param pt_bp_tree        b+ tree container.
+ * @return void.
+ * @remarks if pt_bp_tree == NULL, then the behavior is undefined. b+ tree must be initialized or created by
+ *          _create_bp_tree(), otherwise the behavior is undefine.
+ */
+extern void _bp_tree_destroy_auxiliary(_bp_tree_t* pt_bp_tree);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CSTL_BP_TREE_PRIVATE_H_ */
+/** eof **/
+
@@ -41,6 +41,28 @@
 /** local global variable definition section **/
 
 /** exported function implementation section **/
+/**
+ * Set the element count of each chunk before initialization.
+ */
+void deque_set_block_size(deque_t* pdeq_deque, size_t t_blocksize)
+{
+    assert(pdeq_deque != NULL);
+    assert(_deque_is_created(pdeq_deque));
+    assert(t_blocksize >= 2);
+
+    pdeq_deque->_t_blocksize = t_blocksize;
+}
+
+/**
+ * Get the element count of each chunk.
+ */
+size_t deque_block_size(const deque_t* cpdeq_deque)
+{
+    assert(cpdeq_deque != NULL);
+
+    return cpdeq_deque->_t_blocksize;
+}
+
 /**
  * Initialize an empty deque container
  */
@@ -73,8 +95,8 @@ void deque_init_n(deque_t* pdeq_deque, size_t t_count)
     /* if element count > 0 */
     if (t_count > 0) {
         /* get the element container count */
-        t_validmapcount = (t_count + _DEQUE_ELEM_COUNT - 1) / _DEQUE_ELEM_COUNT;
-        t_endelemcount = t_count % _DEQUE_ELEM_COUNT;
+        t_validmapcount = (t_count + _GET_DEQUE_BLOCK_SIZE(pdeq_deque) - 1) / _GET_DEQUE_BLOCK_SIZE(pdeq_deque);
+        t_endelemcount = t_count % _GET_DEQUE_BLOCK_SIZE(pdeq_deque);
         /* the last container has element */
         if (t_endelemcount != 0) {
             t_validmapcount += 1;
@@ -102,7 +124,8 @@ void deque_init_n(deque_t* pdeq_deque, size_t t_count)
     t_startpos = (t_mapcount - t_validmapcount) / 2;
 
     for (i = t_startpos; i < t_startpos + t_validmapcount; ++i) {
-        pdeq_deque->_ppby_map[i] = _alloc_allocate(&pdeq_deque->_t_allocator, _GET_DEQUE_TYPE_SIZE(pdeq_deque), _DEQUE_ELEM_COUNT);
+        pdeq_deque->_ppby_map[i] = _alloc_allocate(&pdeq_deque->_t_allocator, _GET_DEQUE_TYPE_SIZE(pdeq_deque),
+            _GET_DEQUE_BLOCK_SIZE(pdeq_deque));
         assert(pdeq_deque->_ppby_map[i] != NULL);
     }
 
@@ -111,14 +134,16 @@ void deque_init_n(deque_t* pdeq_deque, size_t t_count)
     _DEQUE_ITERATOR_MAP_POINTER(pdeq_deque->_t_start) = pdeq_deque->_ppby_map + t_startpos;
     _DEQUE_ITERATOR_FIRST_POS(pdeq_deque->_t_start) = *_DEQUE_ITERATOR_MAP_POINTER(pdeq_deque->_t_start);
     _DEQUE_ITERATOR_AFTERLAST_POS(pdeq_deque->_t_start) = 
-        _DEQUE_ITERATOR_FIRST_POS(pdeq_deque->_t_start) + _DEQUE_ELEM_COUNT * _GET_DEQUE_TYPE_SIZE(pdeq_deque);
+        _DEQUE_ITERATOR_FIRST_POS(pdeq_deque->_t_start) +
+            _GET_DEQUE_BLOCK_SIZE(pdeq_deque) * _GET_DEQUE_TYPE_SIZE(pdeq_deque);
     _DEQUE_ITERATOR_COREPOS(pdeq_deque->_t_start) = _DEQUE_ITERATOR_AFTERLAST_POS(pdeq_deque->_t_start);
     /* initialize the finish iterator */
     _ITERATOR_CONTAINER(pdeq_deque->_t_finish) = pdeq_deque;
     _DEQUE_ITERATOR_MAP_POINTER(pdeq_deque->_t_finish) = pdeq_deque->_ppby_map + t_startpos + t_validmapcount - 1;
     _DEQUE_ITERATOR_FIRST_POS(pdeq_deque->_t_finish) = *_DEQUE_ITERATOR_MAP_POINTER(pdeq_deque->_t_finish);
     _DEQUE_ITERATOR_AFTERLAST_POS(pdeq_deque->_t_finish) = 
-        _DEQUE_ITERATOR_FIRST_POS(pdeq_deque->_t_finish) + _DEQUE_ELEM_COUNT * _GET_DEQUE_TYPE_SIZE(pdeq_deque);
+        _DEQUE_ITERATOR_FIRST_POS(pdeq_deque->_t_finish) +
+            _GET_DEQUE_BLOCK_SIZE(pdeq_deque) * _GET_DEQUE_TYPE_SIZE(pdeq_deque);
     _DEQUE_ITERATOR_COREPOS(pdeq_deque->_t_finish) = 
         _DEQUE_ITERATOR_FIRST_POS(pdeq_deque->_t_finish) + t_endelemcount * _GET_DEQUE_TYPE_SIZE(pdeq_deque);
 
@@ -289,6 +314,58 @@ size_t deque_max_size(const deque_t* cpdeq_deque)
     return (size_t)(-1) / _GET_DEQUE_TYPE_SIZE(cpdeq_deque);
 }
 
+/**
+ * Release the unused map space and cached memory of deque.
+ */
+void deque_shrink_to_fit(deque_t* pdeq_deque)
+{
+    size_t        t_validmapsize = 0;
+    size_t        t_newmapsize = 0;
+    size_t        t_newstartpos = 0;
+    _mappointer_t ppby_newmap = NULL;
+
+    assert(pdeq_deque != NULL);
+    assert(_deque_is_inited(pdeq_deque));
+
+    /* the map keeps the used chunks and at least _DEQUE_MAP_COUNT pointers */
+    t_validmapsize = _DEQUE_ITERATOR_MAP_POINTER(pdeq_deque->_t_finish) -
+                     _DEQUE_ITERATOR_MAP_POINTER(pdeq_deque->_t_start) + 1;
+    if (t_validmapsize > _DEQUE_MAP_COUNT) {
+        t_newmapsize = (t_validmapsize + _DEQUE_MAP_GROW_STEP - 1) / _DEQUE_MAP_GROW_STEP * _DEQUE_MAP_GROW_STEP;
+    } else {
+        t_newmapsize = _DEQUE_MAP_COUNT;
+    }
+
+    if (t_newmapsize < pdeq_deque->_t_mapsize) {
+        ppby_newmap = _alloc_allocate(&pdeq_deque->_t_allocator, sizeof(_byte_t*), t_newmapsize);
+        assert(ppby_newmap != NULL);
+        memset(ppby_newmap, 0x00, sizeof(_byte_t*) * t_newmapsize);
+
+        t_newstartpos = (t_newmapsize - t_validmapsize) / 2;
+        memcpy(ppby_newmap + t_newstartpos,
+            _DEQUE_ITERATOR_MAP_POINTER(pdeq_deque->_t_start), sizeof(_byte_t*) * t_validmapsize);
+        _alloc_deallocate(&pdeq_deque->_t_allocator, pdeq_deque->_ppby_map, sizeof(_byte_t*), pdeq_deque->_t_mapsize);
+
+        pdeq_deque->_ppby_map = ppby_newmap;
+        pdeq_deque->_t_mapsize = t_newmapsize;
+        _DEQUE_ITERATOR_MAP_POINTER(pdeq_deque->_t_start) = ppby_newmap + t_newstartpos;
+        _DEQUE_ITERATOR_MAP_POINTER(pdeq_deque->_t_finish) = ppby_newmap + t_newstartpos + t_validmapsize - 1;
+    }
+
+    _alloc_shrink(&pdeq_deque->_t_allocator);
+}
+
+/**
+ * Get the memory that deque holds.
+ */
+size_t deque_memory_usage(const deque_t* cpdeq_deque)
+{
+    assert(cpdeq_deque != NULL);
+    assert(_deque_is_inited(cpdeq_deque));
+
+    return sizeof(deque_t) + _alloc_memory_usage(&cpdeq_deque->_t_allocator);
+}
+
 /**
  * Access first deque data.
  */
@@ -623,16 +700,88 @@ bool_t deque_greater_equal(const deque_t* cpdeq_first, const deque_t* cpdeq_seco
  */
 void* deque_at(const deque_t* cpdeq_deque, size_t t_pos)
 {
-    deque_iterator_t it_iter;
+    size_t t_count = 0;
+    void*  pv_elem = NULL;
+
+    assert(cpdeq_deque != NULL);
+    assert(_deque_is_inited(cpdeq_deque));
+
+    /* deque_segment() checks the subscript */
+    pv_elem = deque_segment(cpdeq_deque, t_pos, &t_count);
+    /* char* */
+    if (_GET_DEQUE_TYPE_STYLE(cpdeq_deque) == _TYPE_C_BUILTIN &&
+        strncmp(_GET_DEQUE_TYPE_BASENAME(cpdeq_deque), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+        return (void*)string_c_str((string_t*)pv_elem);
+    } else {
+        return pv_elem;
+    }
+}
+
+/**
+ * Access the contiguous segment of deque that starts at subscript.
+ */
+void* deque_segment(const deque_t* cpdeq_deque, size_t t_pos, size_t* pt_count)
+{
+    size_t t_offset = 0;
+    size_t t_last = 0;
+
+    assert(cpdeq_deque != NULL);
+    assert(pt_count != NULL);
+    assert(_deque_is_inited(cpdeq_deque));
+
+    /* the offsets from the first position of the first block */
+    t_offset = (size_t)(_DEQUE_ITERATOR_COREPOS(cpdeq_deque->_t_start) - _DEQUE_ITERATOR_FIRST_POS(cpdeq_deque->_t_start)) /
+        _GET_DEQUE_TYPE_SIZE(cpdeq_deque);
+    t_last = (size_t)(_DEQUE_ITERATOR_MAP_POINTER(cpdeq_deque->_t_finish) - _DEQUE_ITERATOR_MAP_POINTER(cpdeq_deque->_t_start)) *
+        _GET_DEQUE_BLOCK_SIZE(cpdeq_deque) + (size_t)(_DEQUE_ITERATOR_COREPOS(cpdeq_deque->_t_finish) -
+        _DEQUE_ITERATOR_FIRST_POS(cpdeq_deque->_t_finish)) / _GET_DEQUE_TYPE_SIZE(cpdeq_deque);
+    assert(t_pos < t_last - t_offset);
+    t_offset += t_pos;
+
+    *pt_count = _GET_DEQUE_BLOCK_SIZE(cpdeq_deque) - t_offset % _GET_DEQUE_BLOCK_SIZE(cpdeq_deque);
+    if (*pt_count > t_last - t_offset) {
+        *pt_count = t_last - t_offset;
+    }
+
+    return _DEQUE_ITERATOR_MAP_POINTER(cpdeq_deque->_t_start)[t_offset / _GET_DEQUE_BLOCK_SIZE(cpdeq_deque)] +
+        t_offset % _GET_DEQUE_BLOCK_SIZE(cpdeq_deque) * _GET_DEQUE_TYPE_SIZE(cpdeq_deque);
+}
+
+/**
+ * Access the contiguous segment of deque that starts at iterator and move the iterator to the next segment.
+ */
+void* deque_segment_next(const deque_t* cpdeq_deque, deque_iterator_t* pit_pos, size_t* pt_count)
+{
+    _byte_t* pby_segment = NULL;
 
     assert(cpdeq_deque != NULL);
+    assert(pit_pos != NULL);
+    assert(pt_count != NULL);
     assert(_deque_is_inited(cpdeq_deque));
-    assert(t_pos < deque_size(cpdeq_deque));
+    assert(_deque_iterator_belong_to_deque(cpdeq_deque, *pit_pos));
+
+    /* the first chunk of deque may be exhausted, so skip the empty segment */
+    while (_DEQUE_ITERATOR_MAP_POINTER(*pit_pos) != _DEQUE_ITERATOR_MAP_POINTER(cpdeq_deque->_t_finish)) {
+        pby_segment = _DEQUE_ITERATOR_COREPOS(*pit_pos);
+        *pt_count = (size_t)(_DEQUE_ITERATOR_AFTERLAST_POS(*pit_pos) - pby_segment) / _GET_DEQUE_TYPE_SIZE(cpdeq_deque);
+
+        _DEQUE_ITERATOR_MAP_POINTER(*pit_pos) += 1;
+        _DEQUE_ITERATOR_FIRST_POS(*pit_pos) = *_DEQUE_ITERATOR_MAP_POINTER(*pit_pos);
+        _DEQUE_ITERATOR_AFTERLAST_POS(*pit_pos) = _DEQUE_ITERATOR_FIRST_POS(*pit_pos) +
+            _GET_DEQUE_BLOCK_SIZE(cpdeq_deque) * _GET_DEQUE_TYPE_SIZE(cpdeq_deque);
+        _DEQUE_ITERATOR_COREPOS(*pit_pos) = _DEQUE_ITERATOR_FIRST_POS(*pit_pos);
+        if (*pt_count > 0) {
+            return pby_segment;
+        }
+    }
 
-    it_iter = iterator_next_n(deque_begin(cpdeq_deque), t_pos);
-    assert(_deque_iterator_belong_to_deque(cpdeq_deque, it_iter));
+    /* the last segment ends at the end of deque */
+    pby_segment = _DEQUE_ITERATOR_COREPOS(*pit_pos);
+    *pt_count = (size_t)(_DEQUE_ITERATOR_COREPOS(cpdeq_deque->_t_finish) - pby_segment) /
+        _GET_DEQUE_TYPE_SIZE(cpdeq_deque);
+    *pit_pos = cpdeq_deque->_t_finish;
 
-    return (void*)iterator_get_pointer(it_iter);
+    return *pt_count > 0 ? pby_segment : NULL;
 }
 
 /**
@@ -669,11 +818,22 @@ void deque_swap(deque_t* pdeq_first, deque_t* pdeq_second)
  */
 void deque_pop_back(deque_t* pdeq_deque)
 {
+    bool_t b_result = false;
+
     assert(pdeq_deque != NULL);
     assert(_deque_is_inited(pdeq_deque));
     assert(!deque_empty(pdeq_deque));
 
-    _deque_shrink_at_end(pdeq_deque, 1);
+    /* the last element is in the last chunk, so no chunk is released */
+    if ((size_t)(_DEQUE_ITERATOR_COREPOS(pdeq_deque->_t_finish) - _DEQUE_ITERATOR_FIRST_POS(pdeq_deque->_t_finish)) >=
+        _GET_DEQUE_TYPE_SIZE(pdeq_deque)) {
+        _DEQUE_ITERATOR_COREPOS(pdeq_deque->_t_finish) -= _GET_DEQUE_TYPE_SIZE(pdeq_deque);
+        b_result = _GET_DEQUE_TYPE_SIZE(pdeq_deque);
+        _GET_DEQUE_TYPE_DESTROY_FUNCTION(pdeq_deque)(_DEQUE_ITERATOR_COREPOS(pdeq_deque->_t_finish), &b_result);
+        assert(b_result);
+    } else {
+        _deque_shrink_at_end(pdeq_deque, 1);
+    }
 }
 
 /**
@@ -681,11 +841,22 @@ void deque_pop_back(deque_t* pdeq_deque)
  */
 void deque_pop_front(deque_t* pdeq_deque)
 {
+    bool_t b_result = false;
+
     assert(pdeq_deque != NULL);
     assert(_deque_is_inited(pdeq_deque));
     assert(!deque_empty(pdeq_deque));
 
-    _deque_shrink_at_begin(pdeq_deque, 1);
+    /* the first element is not the last one of the first chunk, so no chunk is released */
+    if ((size_t)(_DEQUE_ITERATOR_AFTERLAST_POS(pdeq_deque->_t_start) - _DEQUE_ITERATOR_COREPOS(pdeq_deque->_t_start)) >
+        _GET_DEQUE_TYPE_SIZE(pdeq_deque)) {
+        b_result = _GET_DEQUE_TYPE_SIZE(pdeq_deque);
+        _GET_DEQUE_TYPE_DESTROY_FUNCTION(pdeq_deque)(_DEQUE_ITERATOR_COREPOS(pdeq_deque->_t_start), &b_result);
+        assert(b_result);
+        _DEQUE_ITERATOR_COREPOS(pdeq_deque->_t_start) += _GET_DEQUE_TYPE_SIZE(pdeq_deque);
+    } else {
+        _deque_shrink_at_begin(pdeq_deque, 1);
+    }
 }
 
 
@@ -125,6 +125,26 @@ extern "C" {
 /** exported global variable declaration section **/
 
 /** exported function prototype section **/
+/**
+ * Set the element count of each chunk.
+ * @param pdeq_deque   deque container.
+ * @param t_blocksize  the element count of each chunk.
+ * @return void.
+ * @remarks if pdeq_deque == NULL or t_blocksize < 2, then the behavior is undefined. pdeq_deque must be created by
+ *          create_deque() and not initialized, otherwise the behavior is undefine. the default block size holds
+ *          _DEQUE_BLOCK_BYTES bytes and at least 16 elements, large block suits the deque with huge number of elements.
+ */
+extern void deque_set_block_size(deque_t* pdeq_deque, size_t t_blocksize);
+
+/**
+ * Get the element count of each chunk.
+ * @param cpdeq_deque  deque container.
+ * @return the element count of each chunk.
+ * @remarks if cpdeq_deque == NULL, then the behavior is undefined. cpdeq_deque must be created by create_deque(),
+ *          otherwise the behavior is undefine.
+ */
+extern size_t deque_block_size(const deque_t* cpdeq_deque);
+
 /**
  * Initialize an empty deque container
  * @param pdeq_deque   deque container.
@@ -215,6 +235,26 @@ extern size_t deque_size(const deque_t* cpdeq_deque);
  */
 extern size_t deque_max_size(const deque_t* cpdeq_deque);
 
+/**
+ * Release the unused map space and cached memory of deque.
+ * @param pdeq_deque   deque container.
+ * @return void.
+ * @remarks if pdeq_deque == NULL, then the behavior is undefined. the pdeq_deque must be initialized, otherwise the
+ *          behavior is undefine. the chunks of erased elements are released when they are erased, so this function
+ *          shrinks the chunk map and releases the empty slabs. a slab that holds a chunk of any container is kept, so
+ *          the memory goes back to system only when whole slabs are free. all iterators of deque are invalid.
+ */
+extern void deque_shrink_to_fit(deque_t* pdeq_deque);
+
+/**
+ * Get the memory that deque holds.
+ * @param cpdeq_deque  deque container.
+ * @return the bytes of deque_t, chunk map and chunks.
+ * @remarks if cpdeq_deque == NULL, then the behavior is undefined. the cpdeq_deque must be initialized, otherwise the
+ *          behavior is undefine. the memory owned by elements, such as the characters of string_t, is not counted.
+ */
+extern size_t deque_memory_usage(const deque_t* cpdeq_deque);
+
 /**
  * Return a iterator to the first element in the deque container.
  * @param cpdeq_deque    deque container.
@@ -347,6 +387,33 @@ extern bool_t deque_greater_equal(const deque_t* cpdeq_first, const deque_t* cpd
  */
 extern void* deque_at(const deque_t* cpdeq_deque, size_t t_pos);
 
+/**
+ * Access the contiguous segment of deque that starts at subscript.
+ * @param cpdeq_deque  deque container.
+ * @param t_pos        subscript.
+ * @param pt_count     output element count of the segment.
+ * @return raw pointer to the element at t_pos, the *pt_count elements from it are stored contiguously.
+ * @remarks if cpdeq_deque == NULL or pt_count == NULL, then the behavior is undefined. the deque must be initialized,
+ *          otherwise the behavior is undefined. if t_pos >= deque_size(cpdeq_deque), then the behavior is undefined.
+ *          the segment ends at the end of the deque block or the end of deque. the element of char* deque is string_t,
+ *          not char*.
+ */
+extern void* deque_segment(const deque_t* cpdeq_deque, size_t t_pos, size_t* pt_count);
+
+/**
+ * Access the contiguous segment of deque that starts at iterator and move the iterator to the next segment.
+ * @param cpdeq_deque  deque container.
+ * @param pit_pos      the position of segment, it is moved to the position after the segment.
+ * @param pt_count     output element count of the segment.
+ * @return raw pointer to the element at *pit_pos, the *pt_count elements from it are stored contiguously. return NULL
+ *         and *pt_count is 0 when *pit_pos is deque_end().
+ * @remarks if cpdeq_deque == NULL, pit_pos == NULL or pt_count == NULL, then the behavior is undefined. the deque must be
+ *          initialized and *pit_pos must belong to the deque, otherwise the behavior is undefined. the deque is visited
+ *          chunk by chunk when the iterator starts at deque_begin() and the function is called until it returns NULL.
+ *          the element of char* deque is string_t, not char*.
+ */
+extern void* deque_segment_next(const deque_t* cpdeq_deque, deque_iterator_t* pit_pos, size_t* pt_count);
+
 /**
  * Access first deque data.
  * @param cpdeq_deque    deque container.
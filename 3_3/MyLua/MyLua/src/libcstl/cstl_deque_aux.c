@@ -65,7 +65,8 @@ bool_t _deque_iterator_belong_to_deque(const deque_t* cpdeq_deque, deque_iterato
         if (_DEQUE_ITERATOR_MAP_POINTER(it_cur) == _DEQUE_ITERATOR_MAP_POINTER(it_iter)) {
             _DEQUE_ITERATOR_FIRST_POS(it_cur) = *_DEQUE_ITERATOR_MAP_POINTER(it_cur);
             _DEQUE_ITERATOR_AFTERLAST_POS(it_cur) = 
-                _DEQUE_ITERATOR_FIRST_POS(it_cur) + _GET_DEQUE_TYPE_SIZE(cpdeq_deque) * _DEQUE_ELEM_COUNT;
+                _DEQUE_ITERATOR_FIRST_POS(it_cur) +
+                    _GET_DEQUE_TYPE_SIZE(cpdeq_deque) * _GET_DEQUE_BLOCK_SIZE(cpdeq_deque);
             break;
         }
     }
@@ -165,7 +166,7 @@ bool_t _deque_is_created(const deque_t* cpdeq_deque)
         return false;
     }
 
-    if (cpdeq_deque->_ppby_map != NULL || cpdeq_deque->_t_mapsize != 0) {
+    if (cpdeq_deque->_ppby_map != NULL || cpdeq_deque->_t_mapsize != 0 || cpdeq_deque->_t_blocksize == 0) {
         return false;
     }
 
@@ -210,7 +211,8 @@ bool_t _deque_is_inited(const deque_t* cpdeq_deque)
 
     if (cpdeq_deque->_ppby_map == NULL ||
         cpdeq_deque->_t_mapsize < _DEQUE_MAP_COUNT ||
-        cpdeq_deque->_t_mapsize % _DEQUE_MAP_GROW_STEP != 0) {
+        cpdeq_deque->_t_mapsize % _DEQUE_MAP_GROW_STEP != 0 ||
+        cpdeq_deque->_t_blocksize == 0) {
         return false;
     }
 
@@ -310,8 +312,8 @@ deque_iterator_t _deque_expand_at_end(deque_t* pdeq_deque, size_t t_expandsize,
 
         /* caculate the expand container number */
         t_nomemsize = t_expandsize - t_remainsize;
-        t_chunksize = (t_nomemsize + _DEQUE_ELEM_COUNT - 1) / _DEQUE_ELEM_COUNT;
-        t_suffixsize = t_nomemsize % _DEQUE_ELEM_COUNT;
+        t_chunksize = (t_nomemsize + _GET_DEQUE_BLOCK_SIZE(pdeq_deque) - 1) / _GET_DEQUE_BLOCK_SIZE(pdeq_deque);
+        t_suffixsize = t_nomemsize % _GET_DEQUE_BLOCK_SIZE(pdeq_deque);
         if (t_suffixsize == 0) {
             t_chunksize++;
         }
@@ -331,6 +333,11 @@ deque_iterator_t _deque_expand_at_end(deque_t* pdeq_deque, size_t t_expandsize,
             _mappointer_t ppby_oldmap = pdeq_deque->_ppby_map;  /* save the old map */
             size_t t_oldmapsize = pdeq_deque->_t_mapsize;
 
+            /* double the map at least, so that the copying of map is amortized for each chunk */
+            if (t_growsize < t_oldmapsize) {
+                t_growsize = t_oldmapsize;
+            }
+
             /* new map */
             pdeq_deque->_t_mapsize += t_growsize;
             pdeq_deque->_ppby_map = _alloc_allocate(&pdeq_deque->_t_allocator, sizeof(_byte_t*), pdeq_deque->_t_mapsize);
@@ -376,7 +383,8 @@ deque_iterator_t _deque_expand_at_end(deque_t* pdeq_deque, size_t t_expandsize,
 
         /* allocate the container */
         for (i = 0, ppby_newchunk = _DEQUE_ITERATOR_MAP_POINTER(it_oldend) + 1; i < t_chunksize; ++i, ++ppby_newchunk) {
-            *ppby_newchunk = _alloc_allocate(&pdeq_deque->_t_allocator, _GET_DEQUE_TYPE_SIZE(pdeq_deque), _DEQUE_ELEM_COUNT);
+            *ppby_newchunk = _alloc_allocate(&pdeq_deque->_t_allocator, _GET_DEQUE_TYPE_SIZE(pdeq_deque),
+                _GET_DEQUE_BLOCK_SIZE(pdeq_deque));
             assert(*ppby_newchunk != NULL);
         }
 
@@ -384,7 +392,8 @@ deque_iterator_t _deque_expand_at_end(deque_t* pdeq_deque, size_t t_expandsize,
         _DEQUE_ITERATOR_MAP_POINTER(pdeq_deque->_t_finish) = _DEQUE_ITERATOR_MAP_POINTER(it_oldend) + t_chunksize;
         _DEQUE_ITERATOR_FIRST_POS(pdeq_deque->_t_finish) = *_DEQUE_ITERATOR_MAP_POINTER(pdeq_deque->_t_finish);
         _DEQUE_ITERATOR_AFTERLAST_POS(pdeq_deque->_t_finish) = 
-            _DEQUE_ITERATOR_FIRST_POS(pdeq_deque->_t_finish) + _DEQUE_ELEM_COUNT * _GET_DEQUE_TYPE_SIZE(pdeq_deque);
+            _DEQUE_ITERATOR_FIRST_POS(pdeq_deque->_t_finish) +
+                _GET_DEQUE_BLOCK_SIZE(pdeq_deque) * _GET_DEQUE_TYPE_SIZE(pdeq_deque);
         _DEQUE_ITERATOR_COREPOS(pdeq_deque->_t_finish) = 
             _DEQUE_ITERATOR_FIRST_POS(pdeq_deque->_t_finish) + t_suffixsize * _GET_DEQUE_TYPE_SIZE(pdeq_deque);
     }
@@ -429,8 +438,8 @@ deque_iterator_t _deque_expand_at_begin(deque_t* pdeq_deque, size_t t_expandsize
 
         /* caculate the expand chunk number */
         t_nomemsize = t_expandsize - t_remainsize;
-        t_chunksize = (t_nomemsize + _DEQUE_ELEM_COUNT - 1) / _DEQUE_ELEM_COUNT;
-        t_prefixsize = t_nomemsize % _DEQUE_ELEM_COUNT;
+        t_chunksize = (t_nomemsize + _GET_DEQUE_BLOCK_SIZE(pdeq_deque) - 1) / _GET_DEQUE_BLOCK_SIZE(pdeq_deque);
+        t_prefixsize = t_nomemsize % _GET_DEQUE_BLOCK_SIZE(pdeq_deque);
         if (t_prefixsize == 0) {
             t_chunksize++;
         }
@@ -451,6 +460,11 @@ deque_iterator_t _deque_expand_at_begin(deque_t* pdeq_deque, size_t t_expandsize
             _mappointer_t ppby_oldmap = pdeq_deque->_ppby_map;  /* old map */
             size_t t_oldmapsize = pdeq_deque->_t_mapsize;
 
+            /* double the map at least, so that the copying of map is amortized for each chunk */
+            if (t_growsize < t_oldmapsize) {
+                t_growsize = t_oldmapsize;
+            }
+
             /* new map */
             pdeq_deque->_t_mapsize += t_growsize;
             pdeq_deque->_ppby_map = _alloc_allocate(&pdeq_deque->_t_allocator, sizeof(_byte_t*), pdeq_deque->_t_mapsize);
@@ -497,7 +511,8 @@ deque_iterator_t _deque_expand_at_begin(deque_t* pdeq_deque, size_t t_expandsize
 
         /* allocate the chunk */
         for (i = 0, ppby_newchunk = _DEQUE_ITERATOR_MAP_POINTER(it_oldbegin) - 1; i < t_chunksize; ++i, --ppby_newchunk) {
-            *ppby_newchunk = _alloc_allocate(&pdeq_deque->_t_allocator, _GET_DEQUE_TYPE_SIZE(pdeq_deque), _DEQUE_ELEM_COUNT);
+            *ppby_newchunk = _alloc_allocate(&pdeq_deque->_t_allocator, _GET_DEQUE_TYPE_SIZE(pdeq_deque),
+                _GET_DEQUE_BLOCK_SIZE(pdeq_deque));
             assert(*ppby_newchunk != NULL);
         }
 
@@ -505,7 +520,8 @@ deque_iterator_t _deque_expand_at_begin(deque_t* pdeq_deque, size_t t_expandsize
         _DEQUE_ITERATOR_MAP_POINTER(pdeq_deque->_t_start) = _DEQUE_ITERATOR_MAP_POINTER(it_oldbegin) - t_chunksize;
         _DEQUE_ITERATOR_FIRST_POS(pdeq_deque->_t_start) = *_DEQUE_ITERATOR_MAP_POINTER(pdeq_deque->_t_start);
         _DEQUE_ITERATOR_AFTERLAST_POS(pdeq_deque->_t_start) = 
-            _DEQUE_ITERATOR_FIRST_POS(pdeq_deque->_t_start) + _DEQUE_ELEM_COUNT * _GET_DEQUE_TYPE_SIZE(pdeq_deque);
+            _DEQUE_ITERATOR_FIRST_POS(pdeq_deque->_t_start) +
+                _GET_DEQUE_BLOCK_SIZE(pdeq_deque) * _GET_DEQUE_TYPE_SIZE(pdeq_deque);
         _DEQUE_ITERATOR_COREPOS(pdeq_deque->_t_start) = 
             _DEQUE_ITERATOR_AFTERLAST_POS(pdeq_deque->_t_start) - t_prefixsize * _GET_DEQUE_TYPE_SIZE(pdeq_deque);
     }
@@ -516,7 +532,7 @@ deque_iterator_t _deque_expand_at_begin(deque_t* pdeq_deque, size_t t_expandsize
         _DEQUE_ITERATOR_MAP_POINTER(it_oldbegin) += 1;
         _DEQUE_ITERATOR_FIRST_POS(it_oldbegin) = *_DEQUE_ITERATOR_MAP_POINTER(it_oldbegin);
         _DEQUE_ITERATOR_AFTERLAST_POS(it_oldbegin) = _DEQUE_ITERATOR_FIRST_POS(it_oldbegin) + 
-            _DEQUE_ELEM_COUNT * _GET_DEQUE_TYPE_SIZE(pdeq_deque);
+            _GET_DEQUE_BLOCK_SIZE(pdeq_deque) * _GET_DEQUE_TYPE_SIZE(pdeq_deque);
         _DEQUE_ITERATOR_COREPOS(it_oldbegin) = _DEQUE_ITERATOR_FIRST_POS(it_oldbegin);
     }
     /* the *pit_pos is original front */
@@ -525,7 +541,7 @@ deque_iterator_t _deque_expand_at_begin(deque_t* pdeq_deque, size_t t_expandsize
         _DEQUE_ITERATOR_MAP_POINTER(*pit_pos) += 1;
         _DEQUE_ITERATOR_FIRST_POS(*pit_pos) = *_DEQUE_ITERATOR_MAP_POINTER(*pit_pos);
         _DEQUE_ITERATOR_AFTERLAST_POS(*pit_pos) = _DEQUE_ITERATOR_FIRST_POS(*pit_pos) +
-            _DEQUE_ELEM_COUNT * _GET_DEQUE_TYPE_SIZE(pdeq_deque);
+            _GET_DEQUE_BLOCK_SIZE(pdeq_deque) * _GET_DEQUE_TYPE_SIZE(pdeq_deque);
         _DEQUE_ITERATOR_COREPOS(*pit_pos) = _DEQUE_ITERATOR_FIRST_POS(*pit_pos);
     }
 
@@ -563,7 +579,8 @@ void _deque_shrink_at_end(deque_t* pdeq_deque, size_t t_shrinksize)
     pdeq_deque->_t_finish = it_newend;
 
     for (ppby_map = _DEQUE_ITERATOR_MAP_POINTER(pdeq_deque->_t_finish) + 1; ppby_map <= _DEQUE_ITERATOR_MAP_POINTER(it_oldend); ++ppby_map) {
-        _alloc_deallocate(&pdeq_deque->_t_allocator, *ppby_map, _GET_DEQUE_TYPE_SIZE(pdeq_deque), _DEQUE_ELEM_COUNT);
+        _alloc_deallocate(&pdeq_deque->_t_allocator, *ppby_map, _GET_DEQUE_TYPE_SIZE(pdeq_deque),
+            _GET_DEQUE_BLOCK_SIZE(pdeq_deque));
         *ppby_map = NULL;
     }
 }
@@ -596,7 +613,8 @@ void _deque_shrink_at_begin(deque_t* pdeq_deque, size_t t_shrinksize)
     pdeq_deque->_t_start = it_newbegin;
 
     for (ppby_map = _DEQUE_ITERATOR_MAP_POINTER(pdeq_deque->_t_start) - 1; ppby_map >= _DEQUE_ITERATOR_MAP_POINTER(it_oldbegin); --ppby_map) {
-        _alloc_deallocate(&pdeq_deque->_t_allocator, *ppby_map, _GET_DEQUE_TYPE_SIZE(pdeq_deque), _DEQUE_ELEM_COUNT);
+        _alloc_deallocate(&pdeq_deque->_t_allocator, *ppby_map, _GET_DEQUE_TYPE_SIZE(pdeq_deque),
+            _GET_DEQUE_BLOCK_SIZE(pdeq_deque));
         *ppby_map = NULL;
     }
 }
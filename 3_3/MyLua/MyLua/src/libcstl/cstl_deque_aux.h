@@ -32,7 +32,13 @@ extern "C" {
 /** constant declaration and macro section **/
 #define _DEQUE_MAP_COUNT                16
 #define _DEQUE_MAP_GROW_STEP            8
-#define _DEQUE_ELEM_COUNT               16
+#define _DEQUE_ELEM_COUNT               16    /* the mininum element count of default chunk */
+#ifndef _DEQUE_BLOCK_BYTES
+#define _DEQUE_BLOCK_BYTES              512   /* the bytes of default chunk */
+#endif
+#define _DEQUE_DEFAULT_BLOCK_SIZE(typesize)\
+    ((typesize) * _DEQUE_ELEM_COUNT < _DEQUE_BLOCK_BYTES ? _DEQUE_BLOCK_BYTES / (typesize) : _DEQUE_ELEM_COUNT)
+#define _GET_DEQUE_BLOCK_SIZE(pdeq_deque)            ((pdeq_deque)->_t_blocksize)
 
 /* macros for type informations */
 #define _GET_DEQUE_TYPE_SIZE(pdeq_deque)             ((pdeq_deque)->_t_typeinfo._pt_type->_t_typesize)
@@ -226,7 +226,8 @@ deque_iterator_t _deque_iterator_next(deque_iterator_t it_iter)
             _DEQUE_ITERATOR_MAP_POINTER(it_iter) += 1;
             _DEQUE_ITERATOR_FIRST_POS(it_iter) = *_DEQUE_ITERATOR_MAP_POINTER(it_iter);
             _DEQUE_ITERATOR_AFTERLAST_POS(it_iter) = _DEQUE_ITERATOR_FIRST_POS(it_iter) + 
-                _GET_DEQUE_TYPE_SIZE(_DEQUE_ITERATOR_CONTAINER(it_iter)) * _DEQUE_ELEM_COUNT;
+                _GET_DEQUE_TYPE_SIZE(_DEQUE_ITERATOR_CONTAINER(it_iter)) *
+                _GET_DEQUE_BLOCK_SIZE(_DEQUE_ITERATOR_CONTAINER(it_iter));
             _DEQUE_ITERATOR_COREPOS(it_iter) = _DEQUE_ITERATOR_FIRST_POS(it_iter) + t_beyondsize;
         }
     }
@@ -251,7 +252,8 @@ deque_iterator_t _deque_iterator_prev(deque_iterator_t it_iter)
             _DEQUE_ITERATOR_MAP_POINTER(it_iter) -= 1;
             _DEQUE_ITERATOR_FIRST_POS(it_iter) = *_DEQUE_ITERATOR_MAP_POINTER(it_iter);
             _DEQUE_ITERATOR_AFTERLAST_POS(it_iter) = _DEQUE_ITERATOR_FIRST_POS(it_iter) +
-                _GET_DEQUE_TYPE_SIZE(_DEQUE_ITERATOR_CONTAINER(it_iter)) * _DEQUE_ELEM_COUNT;
+                _GET_DEQUE_TYPE_SIZE(_DEQUE_ITERATOR_CONTAINER(it_iter)) *
+                _GET_DEQUE_BLOCK_SIZE(_DEQUE_ITERATOR_CONTAINER(it_iter));
             _DEQUE_ITERATOR_COREPOS(it_iter) = _DEQUE_ITERATOR_AFTERLAST_POS(it_iter) -
                 _GET_DEQUE_TYPE_SIZE(_DEQUE_ITERATOR_CONTAINER(it_iter));
         }
@@ -269,6 +271,7 @@ deque_iterator_t _deque_iterator_next_n(deque_iterator_t it_iter, int n_step)
 {
     int      n_offset = 0;
     int      n_span = 0;
+    int      n_blocksize = 0;
     deque_t* pdeq_deque = NULL;
 
     assert(_deque_iterator_belong_to_deque(_DEQUE_ITERATOR_CONTAINER(it_iter), it_iter));
@@ -306,19 +309,20 @@ deque_iterator_t _deque_iterator_next_n(deque_iterator_t it_iter, int n_step)
      *                    |<--  n_span  -->|
      */
     pdeq_deque = _DEQUE_ITERATOR_CONTAINER(it_iter);
+    n_blocksize = (int)_GET_DEQUE_BLOCK_SIZE(pdeq_deque);
     n_offset = n_step + (_DEQUE_ITERATOR_COREPOS(it_iter) - _DEQUE_ITERATOR_FIRST_POS(it_iter)) / _GET_DEQUE_TYPE_SIZE(pdeq_deque);
-    if (n_offset >= 0 && n_offset <= _DEQUE_ELEM_COUNT) {
+    if (n_offset >= 0 && n_offset <= n_blocksize) {
         _DEQUE_ITERATOR_COREPOS(it_iter) += n_step * _GET_DEQUE_TYPE_SIZE(pdeq_deque);
     } else {
         n_span =  n_offset > 0 ?
-            (n_offset + _DEQUE_ELEM_COUNT - 1) / _DEQUE_ELEM_COUNT - 1 :
-            -((-n_offset + _DEQUE_ELEM_COUNT - 1) / _DEQUE_ELEM_COUNT);
+            (n_offset + n_blocksize - 1) / n_blocksize - 1 :
+            -((-n_offset + n_blocksize - 1) / n_blocksize);
         _DEQUE_ITERATOR_MAP_POINTER(it_iter) += n_span;
         _DEQUE_ITERATOR_FIRST_POS(it_iter) = *_DEQUE_ITERATOR_MAP_POINTER(it_iter);
         _DEQUE_ITERATOR_AFTERLAST_POS(it_iter) = _DEQUE_ITERATOR_FIRST_POS(it_iter) +
-            _GET_DEQUE_TYPE_SIZE(_DEQUE_ITERATOR_CONTAINER(it_iter)) * _DEQUE_ELEM_COUNT;
+            _GET_DEQUE_TYPE_SIZE(pdeq_deque) * n_blocksize;
         _DEQUE_ITERATOR_COREPOS(it_iter) = _DEQUE_ITERATOR_FIRST_POS(it_iter) +
-            (n_offset - n_span * _DEQUE_ELEM_COUNT) * _GET_DEQUE_TYPE_SIZE(pdeq_deque);
+            (n_offset - n_span * n_blocksize) * _GET_DEQUE_TYPE_SIZE(pdeq_deque);
     }
 
     /* corepos == afterlast and current chunk is't last chunk */
@@ -327,7 +331,7 @@ deque_iterator_t _deque_iterator_next_n(deque_iterator_t it_iter, int n_step)
         _DEQUE_ITERATOR_MAP_POINTER(it_iter) += 1;
         _DEQUE_ITERATOR_FIRST_POS(it_iter) = *_DEQUE_ITERATOR_MAP_POINTER(it_iter);
         _DEQUE_ITERATOR_AFTERLAST_POS(it_iter) = _DEQUE_ITERATOR_FIRST_POS(it_iter) +
-            _GET_DEQUE_TYPE_SIZE(_DEQUE_ITERATOR_CONTAINER(it_iter)) * _DEQUE_ELEM_COUNT;
+            _GET_DEQUE_TYPE_SIZE(pdeq_deque) * n_blocksize;
         _DEQUE_ITERATOR_COREPOS(it_iter) = _DEQUE_ITERATOR_FIRST_POS(it_iter);
     }
 
@@ -371,7 +375,8 @@ int _deque_iterator_minus(deque_iterator_t it_first, deque_iterator_t it_second)
     if (_deque_iterator_equal(it_first, it_second)) {
         return 0;
     } else if (_deque_iterator_before(it_first, it_second)) {
-        n_span = (_DEQUE_ITERATOR_MAP_POINTER(it_second) - _DEQUE_ITERATOR_MAP_POINTER(it_first) - 1) * _DEQUE_ELEM_COUNT;
+        n_span = (_DEQUE_ITERATOR_MAP_POINTER(it_second) - _DEQUE_ITERATOR_MAP_POINTER(it_first) - 1) *
+            (int)_GET_DEQUE_BLOCK_SIZE(_DEQUE_ITERATOR_CONTAINER(it_first));
         n_prefix = (_DEQUE_ITERATOR_AFTERLAST_POS(it_first) - _DEQUE_ITERATOR_COREPOS(it_first)) /
             _GET_DEQUE_TYPE_SIZE(_DEQUE_ITERATOR_CONTAINER(it_first));
         n_suffix = (_DEQUE_ITERATOR_COREPOS(it_second) - _DEQUE_ITERATOR_FIRST_POS(it_second)) / 
@@ -379,7 +384,8 @@ int _deque_iterator_minus(deque_iterator_t it_first, deque_iterator_t it_second)
                
         return -(n_prefix + n_span + n_suffix);
     } else {
-        n_span = (_DEQUE_ITERATOR_MAP_POINTER(it_first) - _DEQUE_ITERATOR_MAP_POINTER(it_second) - 1) * _DEQUE_ELEM_COUNT;
+        n_span = (_DEQUE_ITERATOR_MAP_POINTER(it_first) - _DEQUE_ITERATOR_MAP_POINTER(it_second) - 1) *
+            (int)_GET_DEQUE_BLOCK_SIZE(_DEQUE_ITERATOR_CONTAINER(it_first));
         n_prefix = (_DEQUE_ITERATOR_AFTERLAST_POS(it_second) - _DEQUE_ITERATOR_COREPOS(it_second)) /
             _GET_DEQUE_TYPE_SIZE(_DEQUE_ITERATOR_CONTAINER(it_second));
         n_suffix = (_DEQUE_ITERATOR_COREPOS(it_first) - _DEQUE_ITERATOR_FIRST_POS(it_first)) / 
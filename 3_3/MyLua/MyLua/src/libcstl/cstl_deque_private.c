@@ -78,6 +78,7 @@ bool_t _create_deque_auxiliary(deque_t* pdeq_deque, const char* s_typename)
 
     pdeq_deque->_ppby_map = NULL;
     pdeq_deque->_t_mapsize = 0;
+    pdeq_deque->_t_blocksize = _DEQUE_DEFAULT_BLOCK_SIZE(_GET_DEQUE_TYPE_SIZE(pdeq_deque));
     pdeq_deque->_t_start = _create_deque_iterator();
     pdeq_deque->_t_finish = _create_deque_iterator();
 
@@ -148,8 +149,8 @@ void _deque_init_elem_varg(deque_t* pdeq_deque, size_t t_count, va_list val_elem
     /* initialize the map and element container */
     if (t_count > 0) {
         /* get the element container count */
-        t_validmapcount = (t_count + _DEQUE_ELEM_COUNT - 1) / _DEQUE_ELEM_COUNT;
-        t_endelemcount = t_count % _DEQUE_ELEM_COUNT;
+        t_validmapcount = (t_count + _GET_DEQUE_BLOCK_SIZE(pdeq_deque) - 1) / _GET_DEQUE_BLOCK_SIZE(pdeq_deque);
+        t_endelemcount = t_count % _GET_DEQUE_BLOCK_SIZE(pdeq_deque);
         /* the last container has element */
         if (t_endelemcount != 0) {
             t_validmapcount += 1;
@@ -180,7 +181,7 @@ void _deque_init_elem_varg(deque_t* pdeq_deque, size_t t_count, va_list val_elem
 
     for (i = t_startpos; i < t_startpos + t_validmapcount; ++i) {
         pdeq_deque->_ppby_map[i] = _alloc_allocate(
-            &pdeq_deque->_t_allocator, _GET_DEQUE_TYPE_SIZE(pdeq_deque), _DEQUE_ELEM_COUNT);
+            &pdeq_deque->_t_allocator, _GET_DEQUE_TYPE_SIZE(pdeq_deque), _GET_DEQUE_BLOCK_SIZE(pdeq_deque));
         assert(pdeq_deque->_ppby_map[i] != NULL);
     }
 
@@ -189,14 +190,14 @@ void _deque_init_elem_varg(deque_t* pdeq_deque, size_t t_count, va_list val_elem
     _DEQUE_ITERATOR_MAP_POINTER(pdeq_deque->_t_start) = pdeq_deque->_ppby_map + t_startpos;
     _DEQUE_ITERATOR_FIRST_POS(pdeq_deque->_t_start) = *_DEQUE_ITERATOR_MAP_POINTER(pdeq_deque->_t_start);
     _DEQUE_ITERATOR_AFTERLAST_POS(pdeq_deque->_t_start) = _DEQUE_ITERATOR_FIRST_POS(pdeq_deque->_t_start) +
-        _DEQUE_ELEM_COUNT * _GET_DEQUE_TYPE_SIZE(pdeq_deque);
+        _GET_DEQUE_BLOCK_SIZE(pdeq_deque) * _GET_DEQUE_TYPE_SIZE(pdeq_deque);
     _DEQUE_ITERATOR_COREPOS(pdeq_deque->_t_start) = _DEQUE_ITERATOR_AFTERLAST_POS(pdeq_deque->_t_start);
     /* initialize the finish iterator */
     _ITERATOR_CONTAINER(pdeq_deque->_t_finish) = pdeq_deque;
     _DEQUE_ITERATOR_MAP_POINTER(pdeq_deque->_t_finish) = pdeq_deque->_ppby_map + t_startpos + t_validmapcount - 1;
     _DEQUE_ITERATOR_FIRST_POS(pdeq_deque->_t_finish) = *_DEQUE_ITERATOR_MAP_POINTER(pdeq_deque->_t_finish);
     _DEQUE_ITERATOR_AFTERLAST_POS(pdeq_deque->_t_finish) = _DEQUE_ITERATOR_FIRST_POS(pdeq_deque->_t_finish) +
-        _DEQUE_ELEM_COUNT * _GET_DEQUE_TYPE_SIZE(pdeq_deque);
+        _GET_DEQUE_BLOCK_SIZE(pdeq_deque) * _GET_DEQUE_TYPE_SIZE(pdeq_deque);
     _DEQUE_ITERATOR_COREPOS(pdeq_deque->_t_finish) = _DEQUE_ITERATOR_FIRST_POS(pdeq_deque->_t_finish) + 
         t_endelemcount * _GET_DEQUE_TYPE_SIZE(pdeq_deque);
 
@@ -249,7 +250,8 @@ void _deque_destroy_auxiliary(deque_t* pdeq_deque)
         for (ppby_mappos = _DEQUE_ITERATOR_MAP_POINTER(pdeq_deque->_t_start);
              ppby_mappos <= _DEQUE_ITERATOR_MAP_POINTER(pdeq_deque->_t_finish);
              ++ppby_mappos) {
-            _alloc_deallocate(&pdeq_deque->_t_allocator, *ppby_mappos, _GET_DEQUE_TYPE_SIZE(pdeq_deque), _DEQUE_ELEM_COUNT);
+            _alloc_deallocate(&pdeq_deque->_t_allocator, *ppby_mappos, _GET_DEQUE_TYPE_SIZE(pdeq_deque),
+                _GET_DEQUE_BLOCK_SIZE(pdeq_deque));
         }
 
         /* destroy the map */
@@ -346,12 +348,22 @@ void _deque_push_back(deque_t* pdeq_deque, ...)
 void _deque_push_back_varg(deque_t* pdeq_deque, va_list val_elemlist)
 {
     deque_iterator_t it_oldend = _create_deque_iterator();
+    _byte_t*         pby_pos = NULL;
 
     assert(pdeq_deque != NULL);
     assert(_deque_is_inited(pdeq_deque));
 
-    it_oldend = _deque_expand_at_end(pdeq_deque, 1, NULL);
-    _type_get_varg_value(&pdeq_deque->_t_typeinfo, val_elemlist, _deque_iterator_get_pointer_auxiliary(it_oldend));
+    /* the last chunk holds the new element and the end position, so the element is placed directly */
+    if ((size_t)(_DEQUE_ITERATOR_AFTERLAST_POS(pdeq_deque->_t_finish) - _DEQUE_ITERATOR_COREPOS(pdeq_deque->_t_finish)) >
+        _GET_DEQUE_TYPE_SIZE(pdeq_deque)) {
+        pby_pos = _DEQUE_ITERATOR_COREPOS(pdeq_deque->_t_finish);
+        _DEQUE_ITERATOR_COREPOS(pdeq_deque->_t_finish) += _GET_DEQUE_TYPE_SIZE(pdeq_deque);
+        _deque_init_elem_auxiliary(pdeq_deque, pby_pos);
+        _type_get_varg_value(&pdeq_deque->_t_typeinfo, val_elemlist, pby_pos);
+    } else {
+        it_oldend = _deque_expand_at_end(pdeq_deque, 1, NULL);
+        _type_get_varg_value(&pdeq_deque->_t_typeinfo, val_elemlist, _deque_iterator_get_pointer_auxiliary(it_oldend));
+    }
 }
 
 /**
@@ -377,7 +389,14 @@ void _deque_push_front_varg(deque_t* pdeq_deque, va_list val_elemlist)
     assert(pdeq_deque != NULL);
     assert(_deque_is_inited(pdeq_deque));
 
-    _deque_expand_at_begin(pdeq_deque, 1, NULL);
+    /* the first chunk has space before the first element, so the element is placed directly */
+    if ((size_t)(_DEQUE_ITERATOR_COREPOS(pdeq_deque->_t_start) - _DEQUE_ITERATOR_FIRST_POS(pdeq_deque->_t_start)) >
+        _GET_DEQUE_TYPE_SIZE(pdeq_deque)) {
+        _DEQUE_ITERATOR_COREPOS(pdeq_deque->_t_start) -= _GET_DEQUE_TYPE_SIZE(pdeq_deque);
+        _deque_init_elem_auxiliary(pdeq_deque, _DEQUE_ITERATOR_COREPOS(pdeq_deque->_t_start));
+    } else {
+        _deque_expand_at_begin(pdeq_deque, 1, NULL);
+    }
     _type_get_varg_value(&pdeq_deque->_t_typeinfo, val_elemlist,
         _deque_iterator_get_pointer_auxiliary(deque_begin(pdeq_deque)));
 }
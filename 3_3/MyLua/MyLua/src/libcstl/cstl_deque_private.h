@@ -45,6 +45,8 @@ typedef struct _tagdeque
     /* the element manager map and size */
     _mappointer_t    _ppby_map;
     size_t           _t_mapsize;
+    /* the element count of each chunk */
+    size_t           _t_blocksize;
     /* the first element */
     deque_iterator_t _t_start;
     /* the element after the last element */
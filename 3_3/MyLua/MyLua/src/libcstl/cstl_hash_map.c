@@ -29,6 +29,7 @@
 #include "chash_map.h"
 
 #include "cstl_hash_map_aux.h"
+#include "cstl_alloc_aux.h"
 
 /** local constant declaration and local macro section **/
 
@@ -76,7 +77,7 @@ void hash_map_init_ex(hash_map_t* phmap_map, size_t t_bucketcount, ufun_t ufun_h
 void hash_map_destroy(hash_map_t* phmap_map)
 {
     _hash_map_destroy_auxiliary(phmap_map);
-    free(phmap_map);
+    _alloc_free_context(&phmap_map->_t_hashtable._t_allocator._t_context, phmap_map, sizeof(hash_map_t));
 }
 
 /**
@@ -278,6 +279,39 @@ void hash_map_resize(hash_map_t* phmap_map, size_t t_resize)
     _hashtable_resize(&phmap_map->_t_hashtable, t_resize);
 }
 
+/**
+ * Reserve buckets for specific count of elements.
+ */
+void hash_map_reserve(hash_map_t* phmap_map, size_t t_count)
+{
+    assert(phmap_map != NULL);
+    assert(_pair_is_inited(&phmap_map->_pair_temp));
+
+    _hashtable_reserve(&phmap_map->_t_hashtable, t_count);
+}
+
+/**
+ * Reduce the buckets to fit the element count and release the cached memory.
+ */
+void hash_map_shrink_to_fit(hash_map_t* phmap_map)
+{
+    assert(phmap_map != NULL);
+    assert(_pair_is_inited(&phmap_map->_pair_temp));
+
+    _hashtable_shrink_to_fit(&phmap_map->_t_hashtable);
+}
+
+/**
+ * Get the memory that hash_map allocates.
+ */
+size_t hash_map_memory_usage(const hash_map_t* cphmap_map)
+{
+    assert(cphmap_map != NULL);
+    assert(_pair_is_inited(&cphmap_map->_pair_temp));
+
+    return sizeof(hash_map_t) + _hashtable_memory_usage(&cphmap_map->_t_hashtable);
+}
+
 /**
  * Return an iterator that addresses the first element in the hash_map.
  */
@@ -444,6 +478,8 @@ void hash_map_insert_range(hash_map_t* phmap_map, iterator_t it_begin, iterator_
     assert(_pair_is_inited(&phmap_map->_pair_temp));
     assert(iterator_equal(it_begin, it_end) || _iterator_before(it_begin, it_end));
 
+    _hashtable_reserve(
+        &phmap_map->_t_hashtable, _hashtable_size(&phmap_map->_t_hashtable) + iterator_distance(it_begin, it_end));
     for (it_iter = it_begin; !iterator_equal(it_iter, it_end); it_iter = iterator_next(it_iter)) {
         assert(_hash_map_same_pair_type(&phmap_map->_pair_temp, (pair_t*)iterator_get_pointer(it_iter)));
         hash_map_insert(phmap_map, (pair_t*)iterator_get_pointer(it_iter));
@@ -461,6 +497,7 @@ void hash_map_insert_array(hash_map_t* phmap_map, const void* cpv_array, size_t
     assert(_pair_is_inited(&phmap_map->_pair_temp));
     assert(cpv_array != NULL);
 
+    _hashtable_reserve(&phmap_map->_t_hashtable, _hashtable_size(&phmap_map->_t_hashtable) + t_count);
     for (i = 0; i < t_count; ++i) {
         assert(_hash_map_same_pair_type(&phmap_map->_pair_temp, ((pair_t**)cpv_array)[i]));
         hash_map_insert(phmap_map, ((pair_t**)cpv_array)[i]);
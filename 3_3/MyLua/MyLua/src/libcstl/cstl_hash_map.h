@@ -39,6 +39,19 @@ extern "C" {
  */
 #define create_hash_map(...) _create_hash_map(#__VA_ARGS__)
 
+/**
+ * Create hash_map container that gets memory from allocator context.
+ * @param cpt_context  allocator context.
+ * @param ...          element type name.
+ * @return if create hash_map successfully return hash_map pointer, otherwise return NULL.
+ * @remarks if cpt_context == NULL, then the behavior is undefined. the container, its bucket vector and its nodes are
+ *          allocated through the context, memory owned by the elements (the key and value buffers of pair_t) and
+ *          the temporary values of the varg functions come from system. the context is copied and should stay usable
+ *          until the container is destroyed. when the context refuses the memory, the insertion returns the end
+ *          iterator and the container is not changed.
+ */
+#define create_hash_map_with_allocator(cpt_context, ...) _create_hash_map_with_allocator((cpt_context), #__VA_ARGS__)
+
 /**
  * Find specific element.
  * @param cphmap_map    hash_map container.
@@ -73,7 +86,8 @@ extern "C" {
  * Access an element with specific index.
  * @param phmap_map          hash_map container.
  * @param key_elem          key element.
- * @return the pointer that point to the second element.
+ * @return the pointer that point to the second element, NULL if key_elem is not in the hash_map and the allocator
+ *         context refuses the new element.
  * @remarks if phmap_map == NULL then the behavior is undefined. cphmap_map must be initialized, otherwise the behavior is
  *          undefined. 
  */
@@ -272,6 +286,35 @@ extern bfun_t hash_map_value_comp(const hash_map_t* cphmap_map);
  */
 extern void hash_map_resize(hash_map_t* phmap_map, size_t t_resize);
 
+/**
+ * Reserve buckets for specific count of elements.
+ * @param phmap_map      hash_map container.
+ * @param t_count       element count.
+ * @return void.
+ * @remarks if phmap_map == NULL, the behavior is undefined, phmap_map must be initialized,otherwise the behavior
+ *          is undefined. the hash_map holds t_count elements without rehash after reserve.
+ */
+extern void hash_map_reserve(hash_map_t* phmap_map, size_t t_count);
+
+/**
+ * Reduce the buckets to fit the element count and release the empty slabs.
+ * @param phmap_map      hash_map container.
+ * @return void.
+ * @remarks if phmap_map == NULL, the behavior is undefined, phmap_map must be initialized,otherwise the behavior
+ *          is undefined. all iterators of hash_map are invalid after shrink. hash_map_memory_usage() does not grow,
+ *          but a slab is returned to system only when all its memory blocks are free.
+ */
+extern void hash_map_shrink_to_fit(hash_map_t* phmap_map);
+
+/**
+ * Get the memory that hash_map allocates.
+ * @param cphmap_map      hash_map container.
+ * @return the bytes of hash_map_t, buckets and nodes.
+ * @remarks if cphmap_map == NULL, the behavior is undefined, cphmap_map must be initialized,otherwise the behavior
+ *          is undefined. the memory owned by elements such as string_t is not counted.
+ */
+extern size_t hash_map_memory_usage(const hash_map_t* cphmap_map);
+
 /**
  * Return an iterator that addresses the first element in the hash_map.
  * @param cphmap_map      hash_map container.
@@ -29,6 +29,7 @@
 #include "chash_map.h"
 
 #include "cstl_hash_map_aux.h"
+#include "cstl_alloc_aux.h"
 
 /** local constant declaration and local macro section **/
 
@@ -60,6 +61,28 @@ hash_map_t* _create_hash_map(const char* s_typename)
     return phmap_map;
 }
 
+/**
+ * Create hash_map container with allocator context.
+ */
+hash_map_t* _create_hash_map_with_allocator(const alloc_context_t* cpt_context, const char* s_typename)
+{
+    hash_map_t* phmap_map = NULL;
+
+    assert(cpt_context != NULL);
+
+    if ((phmap_map = (hash_map_t*)_alloc_malloc_context(cpt_context, sizeof(hash_map_t))) == NULL) {
+        return NULL;
+    }
+
+    if (!_create_hash_map_auxiliary(phmap_map, s_typename)) {
+        _alloc_free_context(cpt_context, phmap_map, sizeof(hash_map_t));
+        return NULL;
+    }
+    _hashtable_set_context(&phmap_map->_t_hashtable, cpt_context);
+
+    return phmap_map;
+}
+
 /**
  * Create hash_map container auxiliary function.
  */
@@ -267,6 +290,11 @@ void* _hash_map_at_varg(hash_map_t* phmap_map, va_list val_elemlist)
 
     va_end(val_elemlist_copy);
 
+    /* the key is not in hash_map and the allocator context refuses the new element */
+    if (iterator_equal(it_iter, hash_map_end(phmap_map))) {
+        return NULL;
+    }
+
     /* char* */
     if (strncmp(_GET_HASH_MAP_SECOND_TYPE_BASENAME(phmap_map), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
         return (char*)string_c_str((string_t*)((pair_t*)iterator_get_pointer(it_iter))->_pv_second);
@@ -52,6 +52,15 @@ typedef struct _taghashmap
  */
 extern hash_map_t* _create_hash_map(const char* s_typename);
 
+/**
+ * Create hash_map container with allocator context.
+ * @param cpt_context  allocator context.
+ * @param s_typename   element type name.
+ * @return if create hash_map successfully return hash_map pointer, otherwise return NULL.
+ * @remarks if cpt_context == NULL or s_typename == NULL, then the behavior is undefined.
+ */
+extern hash_map_t* _create_hash_map_with_allocator(const alloc_context_t* cpt_context, const char* s_typename);
+
 /**
  * Create hash_map container auxiliary function.
  * @param phmap_map          uncreated container.
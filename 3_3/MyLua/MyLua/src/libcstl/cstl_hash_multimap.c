@@ -29,6 +29,7 @@
 #include "chash_map.h"
 
 #include "cstl_hash_multimap_aux.h"
+#include "cstl_alloc_aux.h"
 
 /** local constant declaration and local macro section **/
 
@@ -75,7 +76,7 @@ void hash_multimap_init_ex(hash_multimap_t* phmmap_map, size_t t_bucketcount, uf
 void hash_multimap_destroy(hash_multimap_t* phmmap_map)
 {
     _hash_multimap_destroy_auxiliary(phmmap_map);
-    free(phmmap_map);
+    _alloc_free_context(&phmmap_map->_t_hashtable._t_allocator._t_context, phmmap_map, sizeof(hash_multimap_t));
 }
 
 /**
@@ -277,6 +278,39 @@ void hash_multimap_resize(hash_multimap_t* phmmap_map, size_t t_resize)
     _hashtable_resize(&phmmap_map->_t_hashtable, t_resize);
 }
 
+/**
+ * Reserve buckets for specific count of elements.
+ */
+void hash_multimap_reserve(hash_multimap_t* phmmap_map, size_t t_count)
+{
+    assert(phmmap_map != NULL);
+    assert(_pair_is_inited(&phmmap_map->_pair_temp));
+
+    _hashtable_reserve(&phmmap_map->_t_hashtable, t_count);
+}
+
+/**
+ * Reduce the buckets to fit the element count and release the cached memory.
+ */
+void hash_multimap_shrink_to_fit(hash_multimap_t* phmmap_map)
+{
+    assert(phmmap_map != NULL);
+    assert(_pair_is_inited(&phmmap_map->_pair_temp));
+
+    _hashtable_shrink_to_fit(&phmmap_map->_t_hashtable);
+}
+
+/**
+ * Get the memory that hash_multimap allocates.
+ */
+size_t hash_multimap_memory_usage(const hash_multimap_t* cphmmap_map)
+{
+    assert(cphmmap_map != NULL);
+    assert(_pair_is_inited(&cphmmap_map->_pair_temp));
+
+    return sizeof(hash_multimap_t) + _hashtable_memory_usage(&cphmmap_map->_t_hashtable);
+}
+
 /**
  * Return an iterator that addresses the first element in the hash_multimap.
  */
@@ -443,6 +477,8 @@ void hash_multimap_insert_range(hash_multimap_t* phmmap_map, iterator_t it_begin
     assert(_pair_is_inited(&phmmap_map->_pair_temp));
     assert(iterator_equal(it_begin, it_end) || _iterator_before(it_begin, it_end));
 
+    _hashtable_reserve(
+        &phmmap_map->_t_hashtable, _hashtable_size(&phmmap_map->_t_hashtable) + iterator_distance(it_begin, it_end));
     for (it_iter = it_begin; !iterator_equal(it_iter, it_end); it_iter = iterator_next(it_iter)) {
         assert(_hash_multimap_same_pair_type(&phmmap_map->_pair_temp, (pair_t*)iterator_get_pointer(it_iter)));
         hash_multimap_insert(phmmap_map, (pair_t*)iterator_get_pointer(it_iter));
@@ -460,6 +496,7 @@ void hash_multimap_insert_array(hash_multimap_t* phmmap_map, const void* cpv_arr
     assert(_pair_is_inited(&phmmap_map->_pair_temp));
     assert(cpv_array != NULL);
 
+    _hashtable_reserve(&phmmap_map->_t_hashtable, _hashtable_size(&phmmap_map->_t_hashtable) + t_count);
     for (i = 0; i < t_count; ++i) {
         assert(_hash_multimap_same_pair_type(&phmmap_map->_pair_temp, ((pair_t**)cpv_array)[i]));
         hash_multimap_insert(phmmap_map, ((pair_t**)cpv_array)[i]);
@@ -39,6 +39,19 @@ extern "C" {
  */
 #define create_hash_multimap(...) _create_hash_multimap(#__VA_ARGS__)
 
+/**
+ * Create hash_multimap container that gets memory from allocator context.
+ * @param cpt_context  allocator context.
+ * @param ...          element type name.
+ * @return if create hash_multimap successfully return hash_multimap pointer, otherwise return NULL.
+ * @remarks if cpt_context == NULL, then the behavior is undefined. the container, its bucket vector and its nodes are
+ *          allocated through the context, memory owned by the elements (the key and value buffers of pair_t) and
+ *          the temporary values of the varg functions come from system. the context is copied and should stay usable
+ *          until the container is destroyed. when the context refuses the memory, the insertion returns the end
+ *          iterator and the container is not changed.
+ */
+#define create_hash_multimap_with_allocator(cpt_context, ...) _create_hash_multimap_with_allocator((cpt_context), #__VA_ARGS__)
+
 /**
  * Find specific element.
  * @param cphmmap_map    hash_multimap container.
@@ -262,6 +275,36 @@ extern bfun_t hash_multimap_value_comp(const hash_multimap_t* cphmmap_map);
  */
 extern void hash_multimap_resize(hash_multimap_t* phmmap_map, size_t t_resize);
 
+/**
+ * Reserve buckets for specific count of elements.
+ * @param phmmap_map      hash_multimap container.
+ * @param t_count       element count.
+ * @return void.
+ * @remarks if phmmap_map == NULL, the behavior is undefined, phmmap_map must be initialized,otherwise the behavior
+ *          is undefined. the hash_multimap holds t_count elements without rehash after reserve.
+ */
+extern void hash_multimap_reserve(hash_multimap_t* phmmap_map, size_t t_count);
+
+/**
+ * Reduce the buckets to fit the element count and release the empty slabs.
+ * @param phmmap_map      hash_multimap container.
+ * @return void.
+ * @remarks if phmmap_map == NULL, the behavior is undefined, phmmap_map must be initialized,otherwise the behavior
+ *          is undefined. all iterators of hash_multimap are invalid after shrink.
+ *          hash_multimap_memory_usage() does not grow, but a slab is returned to system only when all its
+ *          memory blocks are free.
+ */
+extern void hash_multimap_shrink_to_fit(hash_multimap_t* phmmap_map);
+
+/**
+ * Get the memory that hash_multimap allocates.
+ * @param cphmmap_map      hash_multimap container.
+ * @return the bytes of hash_multimap_t, buckets and nodes.
+ * @remarks if cphmmap_map == NULL, the behavior is undefined, cphmmap_map must be initialized,otherwise the behavior
+ *          is undefined. the memory owned by elements such as string_t is not counted.
+ */
+extern size_t hash_multimap_memory_usage(const hash_multimap_t* cphmmap_map);
+
 /**
  * Return an iterator that addresses the first element in the hash_multimap.
  * @param cphmmap_map      hash_multimap container.
@@ -29,6 +29,7 @@
 #include "chash_map.h"
 
 #include "cstl_hash_multimap_aux.h"
+#include "cstl_alloc_aux.h"
 
 /** local constant declaration and local macro section **/
 
@@ -60,6 +61,28 @@ hash_multimap_t* _create_hash_multimap(const char* s_typename)
     return phmmap_map;
 }
 
+/**
+ * Create hash_multimap container with allocator context.
+ */
+hash_multimap_t* _create_hash_multimap_with_allocator(const alloc_context_t* cpt_context, const char* s_typename)
+{
+    hash_multimap_t* phmmap_map = NULL;
+
+    assert(cpt_context != NULL);
+
+    if ((phmmap_map = (hash_multimap_t*)_alloc_malloc_context(cpt_context, sizeof(hash_multimap_t))) == NULL) {
+        return NULL;
+    }
+
+    if (!_create_hash_multimap_auxiliary(phmmap_map, s_typename)) {
+        _alloc_free_context(cpt_context, phmmap_map, sizeof(hash_multimap_t));
+        return NULL;
+    }
+    _hashtable_set_context(&phmmap_map->_t_hashtable, cpt_context);
+
+    return phmmap_map;
+}
+
 /**
  * Create hash_multimap container auxiliary function.
  */
@@ -52,6 +52,15 @@ typedef struct _taghashmultimap
  */
 extern hash_multimap_t* _create_hash_multimap(const char* s_typename);
 
+/**
+ * Create hash_multimap container with allocator context.
+ * @param cpt_context  allocator context.
+ * @param s_typename   element type name.
+ * @return if create hash_multimap successfully return hash_multimap pointer, otherwise return NULL.
+ * @remarks if cpt_context == NULL or s_typename == NULL, then the behavior is undefined.
+ */
+extern hash_multimap_t* _create_hash_multimap_with_allocator(const alloc_context_t* cpt_context, const char* s_typename);
+
 /**
  * Create hash_multimap container auxiliary function.
  * @param phmmap_map          uncreated container.
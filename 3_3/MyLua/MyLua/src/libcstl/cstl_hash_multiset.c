@@ -28,6 +28,7 @@
 #include "chash_set.h"
 
 #include "cstl_hash_multiset_aux.h"
+#include "cstl_alloc_aux.h"
 
 /** local constant declaration and local macro section **/
 
@@ -67,7 +68,7 @@ void hash_multiset_init_ex(
 void hash_multiset_destroy(hash_multiset_t* phmset_set)
 {
     _hash_multiset_destroy_auxiliary(phmset_set);
-    free(phmset_set);
+    _alloc_free_context(&phmset_set->_t_hashtable._t_allocator._t_context, phmset_set, sizeof(hash_multiset_t));
 }
 
 /**
@@ -223,6 +224,36 @@ void hash_multiset_resize(hash_multiset_t* phmset_set, size_t t_resize)
     _hashtable_resize(&phmset_set->_t_hashtable, t_resize);
 }
 
+/**
+ * Reserve buckets for specific count of elements.
+ */
+void hash_multiset_reserve(hash_multiset_t* phmset_set, size_t t_count)
+{
+    assert(phmset_set != NULL);
+
+    _hashtable_reserve(&phmset_set->_t_hashtable, t_count);
+}
+
+/**
+ * Reduce the buckets to fit the element count and release the cached memory.
+ */
+void hash_multiset_shrink_to_fit(hash_multiset_t* phmset_set)
+{
+    assert(phmset_set != NULL);
+
+    _hashtable_shrink_to_fit(&phmset_set->_t_hashtable);
+}
+
+/**
+ * Get the memory that hash_multiset allocates.
+ */
+size_t hash_multiset_memory_usage(const hash_multiset_t* cphmset_set)
+{
+    assert(cphmset_set != NULL);
+
+    return sizeof(hash_multiset_t) + _hashtable_memory_usage(&cphmset_set->_t_hashtable);
+}
+
 /**
  * Tests if the two hash_multiset are equal.
  */
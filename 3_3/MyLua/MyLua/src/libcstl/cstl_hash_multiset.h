@@ -39,6 +39,19 @@ extern "C" {
  */
 #define create_hash_multiset(...) _create_hash_multiset(#__VA_ARGS__)
 
+/**
+ * Create hash_multiset container that gets memory from allocator context.
+ * @param cpt_context  allocator context.
+ * @param ...          element type name.
+ * @return if create hash_multiset successfully return hash_multiset pointer, otherwise return NULL.
+ * @remarks if cpt_context == NULL, then the behavior is undefined. the container, its bucket vector and its nodes are
+ *          allocated through the context, memory owned by the elements (string or other containers) and the temporary
+ *          values of the varg functions come from system. the context is copied and should stay usable until the
+ *          container is destroyed. when the context refuses the memory, the insertion returns the end iterator and the
+ *          container is not changed.
+ */
+#define create_hash_multiset_with_allocator(cpt_context, ...) _create_hash_multiset_with_allocator((cpt_context), #__VA_ARGS__)
+
 /**
  * Find specific element.
  * @param cphmset_set      hash_multiset container.
@@ -274,6 +287,36 @@ extern bfun_t hash_multiset_value_comp(const hash_multiset_t* cphmset_set);
  */
 extern void hash_multiset_resize(hash_multiset_t* phmset_set, size_t t_resize);
 
+/**
+ * Reserve buckets for specific count of elements.
+ * @param phmset_set      hash_multiset container.
+ * @param t_count       element count.
+ * @return void.
+ * @remarks if phmset_set == NULL, the behavior is undefined, phmset_set must be initialized,otherwise the behavior
+ *          is undefined. the hash_multiset holds t_count elements without rehash after reserve.
+ */
+extern void hash_multiset_reserve(hash_multiset_t* phmset_set, size_t t_count);
+
+/**
+ * Reduce the buckets to fit the element count and release the empty slabs.
+ * @param phmset_set      hash_multiset container.
+ * @return void.
+ * @remarks if phmset_set == NULL, the behavior is undefined, phmset_set must be initialized,otherwise the behavior
+ *          is undefined. all iterators of hash_multiset are invalid after shrink.
+ *          hash_multiset_memory_usage() does not grow, but a slab is returned to system only when all its
+ *          memory blocks are free.
+ */
+extern void hash_multiset_shrink_to_fit(hash_multiset_t* phmset_set);
+
+/**
+ * Get the memory that hash_multiset allocates.
+ * @param cphmset_set      hash_multiset container.
+ * @return the bytes of hash_multiset_t, buckets and nodes.
+ * @remarks if cphmset_set == NULL, the behavior is undefined, cphmset_set must be initialized,otherwise the behavior
+ *          is undefined. the memory owned by elements such as string_t is not counted.
+ */
+extern size_t hash_multiset_memory_usage(const hash_multiset_t* cphmset_set);
+
 /**
  * Tests if the two hash_multiset are equal.
  * @param cphmset_first         first hash_multiset container.
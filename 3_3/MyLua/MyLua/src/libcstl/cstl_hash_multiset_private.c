@@ -48,6 +48,14 @@ hash_multiset_t* _create_hash_multiset(const char* s_typename)
     return (hash_multiset_t*)_create_hashtable(s_typename);
 }
 
+/**
+ * Create hash_multiset container with allocator context.
+ */
+hash_multiset_t* _create_hash_multiset_with_allocator(const alloc_context_t* cpt_context, const char* s_typename)
+{
+    return (hash_multiset_t*)_create_hashtable_with_allocator(cpt_context, s_typename);
+}
+
 /**
  * Create hash_multiset container auxiliary function.
  */
@@ -96,16 +104,15 @@ hash_multiset_iterator_t _hash_multiset_find_varg(const hash_multiset_t* cphmset
 
     assert(cphmset_set != NULL);
 
-    pv_varg = _alloc_allocate(
-        &((hash_multiset_t*)cphmset_set)->_t_hashtable._t_allocator, _GET_HASH_MULTISET_TYPE_SIZE(cphmset_set), 1);
-    assert(pv_varg != NULL);
+    pv_varg = _alloc_allocate_temp(
+        &((hash_multiset_t*)cphmset_set)->_t_hashtable._t_allocator, _GET_HASH_MULTISET_TYPE_SIZE(cphmset_set));
     _hash_multiset_get_varg_value_auxiliary((hash_multiset_t*)cphmset_set, val_elemlist, pv_varg);
 
     it_iter = _hashtable_find(&cphmset_set->_t_hashtable, pv_varg);
 
     _hash_multiset_destroy_varg_value_auxiliary((hash_multiset_t*)cphmset_set, pv_varg);
-    _alloc_deallocate(
-        &((hash_multiset_t*)cphmset_set)->_t_hashtable._t_allocator, pv_varg, _GET_HASH_MULTISET_TYPE_SIZE(cphmset_set), 1);
+    _alloc_deallocate_temp(
+        &((hash_multiset_t*)cphmset_set)->_t_hashtable._t_allocator, pv_varg, _GET_HASH_MULTISET_TYPE_SIZE(cphmset_set));
 
     _ITERATOR_CONTAINER(it_iter) = (hash_multiset_t*)cphmset_set;
     _HASH_MULTISET_ITERATOR_CONTAINER_TYPE(it_iter) = _HASH_MULTISET_CONTAINER;
@@ -141,16 +148,15 @@ size_t _hash_multiset_count_varg(const hash_multiset_t* cphmset_set, va_list val
 
     assert(cphmset_set != NULL);
 
-    pv_varg = _alloc_allocate(
-        &((hash_multiset_t*)cphmset_set)->_t_hashtable._t_allocator, _GET_HASH_MULTISET_TYPE_SIZE(cphmset_set), 1);
-    assert(pv_varg != NULL);
+    pv_varg = _alloc_allocate_temp(
+        &((hash_multiset_t*)cphmset_set)->_t_hashtable._t_allocator, _GET_HASH_MULTISET_TYPE_SIZE(cphmset_set));
     _hash_multiset_get_varg_value_auxiliary((hash_multiset_t*)cphmset_set, val_elemlist, pv_varg);
 
     t_count = _hashtable_count(&cphmset_set->_t_hashtable, pv_varg);
 
     _hash_multiset_destroy_varg_value_auxiliary((hash_multiset_t*)cphmset_set, pv_varg);
-    _alloc_deallocate(
-        &((hash_multiset_t*)cphmset_set)->_t_hashtable._t_allocator, pv_varg, _GET_HASH_MULTISET_TYPE_SIZE(cphmset_set), 1);
+    _alloc_deallocate_temp(
+        &((hash_multiset_t*)cphmset_set)->_t_hashtable._t_allocator, pv_varg, _GET_HASH_MULTISET_TYPE_SIZE(cphmset_set));
 
     return t_count;
 }
@@ -182,16 +188,15 @@ range_t _hash_multiset_equal_range_varg(const hash_multiset_t* cphmset_set, va_l
 
     assert(cphmset_set != NULL);
 
-    pv_varg = _alloc_allocate(
-        &((hash_multiset_t*)cphmset_set)->_t_hashtable._t_allocator, _GET_HASH_MULTISET_TYPE_SIZE(cphmset_set), 1);
-    assert(pv_varg != NULL);
+    pv_varg = _alloc_allocate_temp(
+        &((hash_multiset_t*)cphmset_set)->_t_hashtable._t_allocator, _GET_HASH_MULTISET_TYPE_SIZE(cphmset_set));
     _hash_multiset_get_varg_value_auxiliary((hash_multiset_t*)cphmset_set, val_elemlist, pv_varg);
 
     r_range = _hashtable_equal_range(&cphmset_set->_t_hashtable, pv_varg);
 
     _hash_multiset_destroy_varg_value_auxiliary((hash_multiset_t*)cphmset_set, pv_varg);
-    _alloc_deallocate(
-        &((hash_multiset_t*)cphmset_set)->_t_hashtable._t_allocator, pv_varg, _GET_HASH_MULTISET_TYPE_SIZE(cphmset_set), 1);
+    _alloc_deallocate_temp(
+        &((hash_multiset_t*)cphmset_set)->_t_hashtable._t_allocator, pv_varg, _GET_HASH_MULTISET_TYPE_SIZE(cphmset_set));
 
     _ITERATOR_CONTAINER(r_range.it_begin) = (hash_multiset_t*)cphmset_set;
     _HASH_MULTISET_ITERATOR_CONTAINER_TYPE(r_range.it_begin) = _HASH_MULTISET_CONTAINER;
@@ -231,14 +236,13 @@ hash_multiset_iterator_t _hash_multiset_insert_varg(hash_multiset_t* phmset_set,
 
     assert(phmset_set != NULL);
 
-    pv_varg = _alloc_allocate(&phmset_set->_t_hashtable._t_allocator, _GET_HASH_MULTISET_TYPE_SIZE(phmset_set), 1);
-    assert(pv_varg != NULL);
+    pv_varg = _alloc_allocate_temp(&phmset_set->_t_hashtable._t_allocator, _GET_HASH_MULTISET_TYPE_SIZE(phmset_set));
     _hash_multiset_get_varg_value_auxiliary(phmset_set, val_elemlist, pv_varg);
 
     it_iter = _hashtable_insert_equal(&phmset_set->_t_hashtable, pv_varg);
 
     _hash_multiset_destroy_varg_value_auxiliary(phmset_set, pv_varg);
-    _alloc_deallocate(&phmset_set->_t_hashtable._t_allocator, pv_varg, _GET_HASH_MULTISET_TYPE_SIZE(phmset_set), 1);
+    _alloc_deallocate_temp(&phmset_set->_t_hashtable._t_allocator, pv_varg, _GET_HASH_MULTISET_TYPE_SIZE(phmset_set));
 
     _ITERATOR_CONTAINER(it_iter) = phmset_set;
     _HASH_MULTISET_ITERATOR_CONTAINER_TYPE(it_iter) = _HASH_MULTISET_CONTAINER;
@@ -274,14 +278,13 @@ size_t _hash_multiset_erase_varg(hash_multiset_t* phmset_set, va_list val_elemli
 
     assert(phmset_set != NULL);
 
-    pv_varg = _alloc_allocate(&phmset_set->_t_hashtable._t_allocator, _GET_HASH_MULTISET_TYPE_SIZE(phmset_set), 1);
-    assert(pv_varg != NULL);
+    pv_varg = _alloc_allocate_temp(&phmset_set->_t_hashtable._t_allocator, _GET_HASH_MULTISET_TYPE_SIZE(phmset_set));
     _hash_multiset_get_varg_value_auxiliary(phmset_set, val_elemlist, pv_varg);
 
     t_count = _hashtable_erase(&phmset_set->_t_hashtable, pv_varg);
 
     _hash_multiset_destroy_varg_value_auxiliary(phmset_set, pv_varg);
-    _alloc_deallocate(&phmset_set->_t_hashtable._t_allocator, pv_varg, _GET_HASH_MULTISET_TYPE_SIZE(phmset_set), 1);
+    _alloc_deallocate_temp(&phmset_set->_t_hashtable._t_allocator, pv_varg, _GET_HASH_MULTISET_TYPE_SIZE(phmset_set));
 
     return t_count;
 }
@@ -49,6 +49,15 @@ typedef struct _taghashmultiset
  */
 extern hash_multiset_t* _create_hash_multiset(const char* s_typename);
 
+/**
+ * Create hash_multiset container with allocator context.
+ * @param cpt_context  allocator context.
+ * @param s_typename   element type name.
+ * @return if create hash_multiset successfully return hash_multiset pointer, otherwise return NULL.
+ * @remarks if cpt_context == NULL or s_typename == NULL, then the behavior is undefined.
+ */
+extern hash_multiset_t* _create_hash_multiset_with_allocator(const alloc_context_t* cpt_context, const char* s_typename);
+
 /**
  * Create hash_multiset container auxiliary function.
  * @param pset_set          uncreated container.
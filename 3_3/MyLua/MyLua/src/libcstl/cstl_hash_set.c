@@ -28,6 +28,7 @@
 #include "chash_set.h"
 
 #include "cstl_hash_set_aux.h"
+#include "cstl_alloc_aux.h"
 
 /** local constant declaration and local macro section **/
 
@@ -66,7 +67,7 @@ void hash_set_init_ex(hash_set_t* phset_set, size_t t_bucketcount, ufun_t ufun_h
 void hash_set_destroy(hash_set_t* phset_set)
 {
     _hash_set_destroy_auxiliary(phset_set);
-    free(phset_set);
+    _alloc_free_context(&phset_set->_t_hashtable._t_allocator._t_context, phset_set, sizeof(hash_set_t));
 }
 
 /**
@@ -222,6 +223,36 @@ void hash_set_resize(hash_set_t* phset_set, size_t t_resize)
     _hashtable_resize(&phset_set->_t_hashtable, t_resize);
 }
 
+/**
+ * Reserve buckets for specific count of elements.
+ */
+void hash_set_reserve(hash_set_t* phset_set, size_t t_count)
+{
+    assert(phset_set != NULL);
+
+    _hashtable_reserve(&phset_set->_t_hashtable, t_count);
+}
+
+/**
+ * Reduce the buckets to fit the element count and release the cached memory.
+ */
+void hash_set_shrink_to_fit(hash_set_t* phset_set)
+{
+    assert(phset_set != NULL);
+
+    _hashtable_shrink_to_fit(&phset_set->_t_hashtable);
+}
+
+/**
+ * Get the memory that hash_set allocates.
+ */
+size_t hash_set_memory_usage(const hash_set_t* cphset_set)
+{
+    assert(cphset_set != NULL);
+
+    return sizeof(hash_set_t) + _hashtable_memory_usage(&cphset_set->_t_hashtable);
+}
+
 /**
  * Tests if the two hash_set are equal.
  */
@@ -39,6 +39,19 @@ extern "C" {
  */
 #define create_hash_set(...) _create_hash_set(#__VA_ARGS__)
 
+/**
+ * Create hash_set container that gets memory from allocator context.
+ * @param cpt_context  allocator context.
+ * @param ...          element type name.
+ * @return if create hash_set successfully return hash_set pointer, otherwise return NULL.
+ * @remarks if cpt_context == NULL, then the behavior is undefined. the container, its bucket vector and its nodes are
+ *          allocated through the context, memory owned by the elements (string or other containers) and the temporary
+ *          values of the varg functions come from system. the context is copied and should stay usable until the
+ *          container is destroyed. when the context refuses the memory, the insertion returns the end iterator and the
+ *          container is not changed.
+ */
+#define create_hash_set_with_allocator(cpt_context, ...) _create_hash_set_with_allocator((cpt_context), #__VA_ARGS__)
+
 /**
  * Find specific element.
  * @param cphset_set      hash_set container.
@@ -274,6 +287,35 @@ extern bfun_t hash_set_value_comp(const hash_set_t* cphset_set);
  */
 extern void hash_set_resize(hash_set_t* phset_set, size_t t_resize);
 
+/**
+ * Reserve buckets for specific count of elements.
+ * @param phset_set      hash_set container.
+ * @param t_count       element count.
+ * @return void.
+ * @remarks if phset_set == NULL, the behavior is undefined, phset_set must be initialized,otherwise the behavior
+ *          is undefined. the hash_set holds t_count elements without rehash after reserve.
+ */
+extern void hash_set_reserve(hash_set_t* phset_set, size_t t_count);
+
+/**
+ * Reduce the buckets to fit the element count and release the empty slabs.
+ * @param phset_set      hash_set container.
+ * @return void.
+ * @remarks if phset_set == NULL, the behavior is undefined, phset_set must be initialized,otherwise the behavior
+ *          is undefined. all iterators of hash_set are invalid after shrink. hash_set_memory_usage() does not grow,
+ *          but a slab is returned to system only when all its memory blocks are free.
+ */
+extern void hash_set_shrink_to_fit(hash_set_t* phset_set);
+
+/**
+ * Get the memory that hash_set allocates.
+ * @param cphset_set      hash_set container.
+ * @return the bytes of hash_set_t, buckets and nodes.
+ * @remarks if cphset_set == NULL, the behavior is undefined, cphset_set must be initialized,otherwise the behavior
+ *          is undefined. the memory owned by elements such as string_t is not counted.
+ */
+extern size_t hash_set_memory_usage(const hash_set_t* cphset_set);
+
 /**
  * Tests if the two hash_set are equal.
  * @param cphset_first         first hash_set container.
@@ -48,6 +48,14 @@ hash_set_t* _create_hash_set(const char* s_typename)
     return (hash_set_t*)_create_hashtable(s_typename);
 }
 
+/**
+ * Create hash_set container with allocator context.
+ */
+hash_set_t* _create_hash_set_with_allocator(const alloc_context_t* cpt_context, const char* s_typename)
+{
+    return (hash_set_t*)_create_hashtable_with_allocator(cpt_context, s_typename);
+}
+
 /**
  * Create hash_set container auxiliary function.
  */
@@ -96,14 +104,13 @@ hash_set_iterator_t _hash_set_find_varg(const hash_set_t* cphset_set, va_list va
 
     assert(cphset_set != NULL);
 
-    pv_varg = _alloc_allocate(&((hash_set_t*)cphset_set)->_t_hashtable._t_allocator, _GET_HASH_SET_TYPE_SIZE(cphset_set), 1);
-    assert(pv_varg != NULL);
+    pv_varg = _alloc_allocate_temp(&((hash_set_t*)cphset_set)->_t_hashtable._t_allocator, _GET_HASH_SET_TYPE_SIZE(cphset_set));
     _hash_set_get_varg_value_auxiliary((hash_set_t*)cphset_set, val_elemlist, pv_varg);
 
     it_iter = _hashtable_find(&cphset_set->_t_hashtable, pv_varg);
 
     _hash_set_destroy_varg_value_auxiliary((hash_set_t*)cphset_set, pv_varg);
-    _alloc_deallocate(&((hash_set_t*)cphset_set)->_t_hashtable._t_allocator, pv_varg, _GET_HASH_SET_TYPE_SIZE(cphset_set), 1);
+    _alloc_deallocate_temp(&((hash_set_t*)cphset_set)->_t_hashtable._t_allocator, pv_varg, _GET_HASH_SET_TYPE_SIZE(cphset_set));
 
     _ITERATOR_CONTAINER(it_iter) = (hash_set_t*)cphset_set;
     _HASH_SET_ITERATOR_CONTAINER_TYPE(it_iter) = _HASH_SET_CONTAINER;
@@ -139,14 +146,13 @@ size_t _hash_set_count_varg(const hash_set_t* cphset_set, va_list val_elemlist)
 
     assert(cphset_set != NULL);
 
-    pv_varg = _alloc_allocate(&((hash_set_t*)cphset_set)->_t_hashtable._t_allocator, _GET_HASH_SET_TYPE_SIZE(cphset_set), 1);
-    assert(pv_varg != NULL);
+    pv_varg = _alloc_allocate_temp(&((hash_set_t*)cphset_set)->_t_hashtable._t_allocator, _GET_HASH_SET_TYPE_SIZE(cphset_set));
     _hash_set_get_varg_value_auxiliary((hash_set_t*)cphset_set, val_elemlist, pv_varg);
 
     t_count = _hashtable_count(&cphset_set->_t_hashtable, pv_varg);
 
     _hash_set_destroy_varg_value_auxiliary((hash_set_t*)cphset_set, pv_varg);
-    _alloc_deallocate(&((hash_set_t*)cphset_set)->_t_hashtable._t_allocator, pv_varg, _GET_HASH_SET_TYPE_SIZE(cphset_set), 1);
+    _alloc_deallocate_temp(&((hash_set_t*)cphset_set)->_t_hashtable._t_allocator, pv_varg, _GET_HASH_SET_TYPE_SIZE(cphset_set));
 
     return t_count;
 }
@@ -178,14 +184,13 @@ range_t _hash_set_equal_range_varg(const hash_set_t* cphset_set, va_list val_ele
 
     assert(cphset_set != NULL);
 
-    pv_varg = _alloc_allocate(&((hash_set_t*)cphset_set)->_t_hashtable._t_allocator, _GET_HASH_SET_TYPE_SIZE(cphset_set), 1);
-    assert(pv_varg != NULL);
+    pv_varg = _alloc_allocate_temp(&((hash_set_t*)cphset_set)->_t_hashtable._t_allocator, _GET_HASH_SET_TYPE_SIZE(cphset_set));
     _hash_set_get_varg_value_auxiliary((hash_set_t*)cphset_set, val_elemlist, pv_varg);
 
     r_range = _hashtable_equal_range(&cphset_set->_t_hashtable, pv_varg);
 
     _hash_set_destroy_varg_value_auxiliary((hash_set_t*)cphset_set, pv_varg);
-    _alloc_deallocate(&((hash_set_t*)cphset_set)->_t_hashtable._t_allocator, pv_varg, _GET_HASH_SET_TYPE_SIZE(cphset_set), 1);
+    _alloc_deallocate_temp(&((hash_set_t*)cphset_set)->_t_hashtable._t_allocator, pv_varg, _GET_HASH_SET_TYPE_SIZE(cphset_set));
 
     _ITERATOR_CONTAINER(r_range.it_begin) = (hash_set_t*)cphset_set;
     _HASH_SET_ITERATOR_CONTAINER_TYPE(r_range.it_begin) = _HASH_SET_CONTAINER;
@@ -225,14 +230,13 @@ hash_set_iterator_t _hash_set_insert_varg(hash_set_t* phset_set, va_list val_ele
 
     assert(phset_set != NULL);
 
-    pv_varg = _alloc_allocate(&phset_set->_t_hashtable._t_allocator, _GET_HASH_SET_TYPE_SIZE(phset_set), 1);
-    assert(pv_varg != NULL);
+    pv_varg = _alloc_allocate_temp(&phset_set->_t_hashtable._t_allocator, _GET_HASH_SET_TYPE_SIZE(phset_set));
     _hash_set_get_varg_value_auxiliary(phset_set, val_elemlist, pv_varg);
 
     it_iter = _hashtable_insert_unique(&phset_set->_t_hashtable, pv_varg);
 
     _hash_set_destroy_varg_value_auxiliary(phset_set, pv_varg);
-    _alloc_deallocate(&phset_set->_t_hashtable._t_allocator, pv_varg, _GET_HASH_SET_TYPE_SIZE(phset_set), 1);
+    _alloc_deallocate_temp(&phset_set->_t_hashtable._t_allocator, pv_varg, _GET_HASH_SET_TYPE_SIZE(phset_set));
 
     _ITERATOR_CONTAINER(it_iter) = phset_set;
     _HASH_SET_ITERATOR_CONTAINER_TYPE(it_iter) = _HASH_SET_CONTAINER;
@@ -268,14 +272,13 @@ size_t _hash_set_erase_varg(hash_set_t* phset_set, va_list val_elemlist)
 
     assert(phset_set != NULL);
 
-    pv_varg = _alloc_allocate(&phset_set->_t_hashtable._t_allocator, _GET_HASH_SET_TYPE_SIZE(phset_set), 1);
-    assert(pv_varg != NULL);
+    pv_varg = _alloc_allocate_temp(&phset_set->_t_hashtable._t_allocator, _GET_HASH_SET_TYPE_SIZE(phset_set));
     _hash_set_get_varg_value_auxiliary(phset_set, val_elemlist, pv_varg);
 
     t_count = _hashtable_erase(&phset_set->_t_hashtable, pv_varg);
 
     _hash_set_destroy_varg_value_auxiliary(phset_set, pv_varg);
-    _alloc_deallocate(&phset_set->_t_hashtable._t_allocator, pv_varg, _GET_HASH_SET_TYPE_SIZE(phset_set), 1);
+    _alloc_deallocate_temp(&phset_set->_t_hashtable._t_allocator, pv_varg, _GET_HASH_SET_TYPE_SIZE(phset_set));
 
     return t_count;
 }
@@ -49,6 +49,15 @@ typedef struct _taghashset
  */
 extern hash_set_t* _create_hash_set(const char* s_typename);
 
+/**
+ * Create hash_set container with allocator context.
+ * @param cpt_context  allocator context.
+ * @param s_typename   element type name.
+ * @return if create hash_set successfully return hash_set pointer, otherwise return NULL.
+ * @remarks if cpt_context == NULL or s_typename == NULL, then the behavior is undefined.
+ */
+extern hash_set_t* _create_hash_set_with_allocator(const alloc_context_t* cpt_context, const char* s_typename);
+
 /**
  * Create hash_set container auxiliary function.
  * @param pset_set          uncreated container.
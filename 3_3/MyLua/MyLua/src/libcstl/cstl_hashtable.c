@@ -33,12 +33,22 @@
 #include "cstl_hashtable.h"
 
 #include "cstl_hashtable_aux.h"
+#include "cstl_alloc_aux.h"
 
 /** local constant declaration and local macro section **/
 
 /** local data type declaration and local struct, union, enum section **/
 
 /** local function prototype section **/
+/**
+ * Move all nodes to the new buckets.
+ * @param pt_hashtable      hashtable container.
+ * @param t_bucketcount     new bucket count.
+ * @return void.
+ * @remarks the equal elements are still adjacent after rehash. the buckets are not changed if the allocator context
+ *          refuses the new buckets.
+ */
+static void _hashtable_rehash(_hashtable_t* pt_hashtable, size_t t_bucketcount);
 
 /** exported global variable definition section **/
 
@@ -64,6 +74,28 @@ _hashtable_t* _create_hashtable(const char* s_typename)
     return pt_hashtable;
 }
 
+/**
+ * Create hashtable container with allocator context.
+ */
+_hashtable_t* _create_hashtable_with_allocator(const alloc_context_t* cpt_context, const char* s_typename)
+{
+    _hashtable_t* pt_hashtable = NULL;
+
+    assert(cpt_context != NULL);
+
+    if ((pt_hashtable = (_hashtable_t*)_alloc_malloc_context(cpt_context, sizeof(_hashtable_t))) == NULL) {
+        return NULL;
+    }
+
+    if (!_create_hashtable_auxiliary(pt_hashtable, s_typename)) {
+        _alloc_free_context(cpt_context, pt_hashtable, sizeof(_hashtable_t));
+        return NULL;
+    }
+    _hashtable_set_context(pt_hashtable, cpt_context);
+
+    return pt_hashtable;
+}
+
 /**
  * Initialize hashtable container.
  */
@@ -84,6 +116,9 @@ void _hashtable_init(_hashtable_t* pt_hashtable, size_t t_bucketcount, ufun_t uf
     /* initialize the hash, compare and destroy element function */
     pt_hashtable->_ufun_hash = ufun_hash != NULL ? ufun_hash : _hashtable_default_hash;
     pt_hashtable->_bfun_compare = bfun_compare != NULL ? bfun_compare : _GET_HASHTABLE_TYPE_LESS_FUNCTION(pt_hashtable);
+    /* the default compare function can be replaced by the less function without output */
+    pt_hashtable->_lfun_compare = pt_hashtable->_bfun_compare == _GET_HASHTABLE_TYPE_LESS_FUNCTION(pt_hashtable) ?
+        _GET_HASHTABLE_TYPE_LESS_FAST_FUNCTION(pt_hashtable) : NULL;
 }
 
 /**
@@ -107,10 +142,11 @@ void _hashtable_init_copy(_hashtable_t* pt_dest, const _hashtable_t* cpt_src)
     it_end = _hashtable_end(cpt_src);
 
     /* insert node from src to dest */
+    _hashtable_reserve(pt_dest, _hashtable_size(cpt_src));
     for (it_iter = it_begin;
          !_hashtable_iterator_equal(it_iter, it_end);
          it_iter = _hashtable_iterator_next(it_iter)) {
-        _hashtable_insert_equal(pt_dest, _hashtable_iterator_get_pointer_ignore_cstr(it_iter));
+        _hashtable_insert_equal_auxiliary(pt_dest, _hashtable_iterator_get_pointer_ignore_cstr(it_iter));
     }
 }
 
@@ -184,7 +220,7 @@ void _hashtable_init_copy_unique_array(
 void _hashtable_destroy(_hashtable_t* pt_hashtable)
 {
     _hashtable_destroy_auxiliary(pt_hashtable);
-    free(pt_hashtable);
+    _alloc_free_context(&pt_hashtable->_t_allocator._t_context, pt_hashtable, sizeof(_hashtable_t));
 }
 
 /**
@@ -192,125 +228,58 @@ void _hashtable_destroy(_hashtable_t* pt_hashtable)
  */
 void _hashtable_resize(_hashtable_t* pt_hashtable, size_t t_resize)
 {
-    size_t        t_tmp = 0;
-    size_t        t_pos = 0;
-    size_t        i = 0;
-    size_t        t_bucketcount = 0;
-    _hashnode_t*  pt_node = NULL;
-    _hashnode_t*  pt_nodelist = NULL;
-    _hashnode_t** ppt_bucket = NULL;
-
     assert(pt_hashtable != NULL);
 
     if (t_resize > _hashtable_bucket_count(pt_hashtable)) {
-        /* select all element in hash node list */
-        for (i = 0; i < vector_size(&pt_hashtable->_vec_bucket); ++i) {
-            ppt_bucket = (_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, i);
-            pt_node = *ppt_bucket;
-            while (pt_node != NULL) {
-                *ppt_bucket = pt_node->_pt_next;
-                pt_node->_pt_next = pt_nodelist;
-                pt_nodelist = pt_node;
-                pt_node = *ppt_bucket;
-            }
-        }
-
-        /* resize vector bucket */
-        vector_resize(&pt_hashtable->_vec_bucket, _hashtable_get_prime(t_resize));
-        t_bucketcount = _hashtable_bucket_count(pt_hashtable);
-
-        /* rehash */
-        while (pt_nodelist != NULL) {
-            pt_node = pt_nodelist;
-            pt_nodelist = pt_node->_pt_next;
-
-            t_tmp = _GET_HASHTABLE_TYPE_SIZE(pt_hashtable);
-            _hashtable_hash_auxiliary(pt_hashtable, pt_node->_pby_data, &t_tmp);
-            t_pos = t_tmp % t_bucketcount;
-            ppt_bucket = (_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, t_pos);
-            pt_node->_pt_next = *ppt_bucket;
-            *ppt_bucket = pt_node;
-        }
+        _hashtable_rehash(pt_hashtable, _hashtable_get_prime(t_resize));
     }
 }
 
 /**
- * Inserts an element into a hashtable.
+ * Reduce the buckets to fit the element count and release the cached memory.
  */
-_hashtable_iterator_t _hashtable_insert_equal(_hashtable_t* pt_hashtable, const void* cpv_value)
+void _hashtable_shrink_to_fit(_hashtable_t* pt_hashtable)
 {
-    size_t                t_bucketcount = 0;
-    _hashnode_t*          pt_node = NULL;
-    _hashnode_t*          pt_cur = NULL;
-    _hashnode_t**         ppt_nodelist = NULL;
-    _hashtable_iterator_t it_iter = _create_hashtable_iterator();
-    bool_t                b_result = false;
-    size_t                t_tmp = 0;
-    size_t                t_pos = 0;
-    bool_t                b_less = false;
-    bool_t                b_greater = false;
+    size_t t_bucketcount = 0;
 
     assert(pt_hashtable != NULL);
-    assert(cpv_value != NULL);
     assert(_hashtable_is_inited(pt_hashtable));
 
-    /* resize */
-    _hashtable_resize(pt_hashtable, _hashtable_size(pt_hashtable) + 1);
+    t_bucketcount = _hashtable_get_prime(_hashtable_size(pt_hashtable));
+    if (t_bucketcount < _hashtable_bucket_count(pt_hashtable)) {
+        _hashtable_rehash(pt_hashtable, t_bucketcount);
+    }
+    /* the size classes are shared, so the empty slabs of nodes are released with the buckets */
+    vector_shrink_to_fit(&pt_hashtable->_vec_bucket);
+}
 
-    /* allocate node */
-    pt_node = _alloc_allocate(
-        &pt_hashtable->_t_allocator, _HASHTABLE_NODE_SIZE(_GET_HASHTABLE_TYPE_SIZE(pt_hashtable)), 1);
-    assert(pt_node != NULL);
-    _hashtable_init_elem_auxiliary(pt_hashtable, pt_node);
-    b_result = _GET_HASHTABLE_TYPE_SIZE(pt_hashtable);
-    _GET_HASHTABLE_TYPE_COPY_FUNCTION(pt_hashtable)(pt_node->_pby_data, cpv_value, &b_result);
-    assert(b_result);
+/**
+ * Get the memory that hashtable allocates.
+ */
+size_t _hashtable_memory_usage(const _hashtable_t* cpt_hashtable)
+{
+    assert(cpt_hashtable != NULL);
+    assert(_hashtable_is_inited(cpt_hashtable));
 
-    /* hash */
-    t_bucketcount = _hashtable_bucket_count(pt_hashtable);
-    t_tmp = _GET_HASHTABLE_TYPE_SIZE(pt_hashtable);
-    _hashtable_hash_auxiliary(pt_hashtable, pt_node->_pby_data, &t_tmp);
-    t_pos = t_tmp % t_bucketcount;
+    return _alloc_memory_usage(&cpt_hashtable->_t_allocator) +
+           _alloc_memory_usage(&cpt_hashtable->_vec_bucket._t_allocator);
+}
 
-    /* insert node into hashtable, note the node has same value together */
-    ppt_nodelist = (_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, t_pos);
-    assert(ppt_nodelist != NULL);
-    pt_cur = *ppt_nodelist;
-    if (pt_cur == NULL) {
-        pt_node->_pt_next = pt_cur;
-        *ppt_nodelist = pt_node;
-    } else {
-        b_less = b_greater = _GET_HASHTABLE_TYPE_SIZE(pt_hashtable);
-        _hashtable_elem_compare_auxiliary(pt_hashtable, pt_cur->_pby_data, pt_node->_pby_data, &b_less);
-        _hashtable_elem_compare_auxiliary(pt_hashtable, pt_node->_pby_data, pt_cur->_pby_data, &b_greater);
-        if (!b_less && !b_greater) {
-            pt_node->_pt_next = pt_cur;
-            *ppt_nodelist = pt_node;
-        } else {
-            while (pt_cur->_pt_next != NULL) {
-                b_less = b_greater = _GET_HASHTABLE_TYPE_SIZE(pt_hashtable);
-                _hashtable_elem_compare_auxiliary(
-                    pt_hashtable, pt_cur->_pt_next->_pby_data, pt_node->_pby_data, &b_less);
-                _hashtable_elem_compare_auxiliary(
-                    pt_hashtable, pt_node->_pby_data, pt_cur->_pt_next->_pby_data, &b_greater);
+/**
+ * Inserts an element into a hashtable.
+ */
+_hashtable_iterator_t _hashtable_insert_equal(_hashtable_t* pt_hashtable, const void* cpv_value)
+{
+    assert(pt_hashtable != NULL);
+    assert(cpv_value != NULL);
+    assert(_hashtable_is_inited(pt_hashtable));
 
-                if (b_less || b_greater) {
-                    pt_cur = pt_cur->_pt_next;
-                } else {
-                    break;
-                }
-            } 
-            pt_node->_pt_next = pt_cur->_pt_next;
-            pt_cur->_pt_next = pt_node;
-        }
+    /* resize */
+    if (_hashtable_size(pt_hashtable) + 1 > _hashtable_bucket_count(pt_hashtable)) {
+        _hashtable_resize(pt_hashtable, _hashtable_size(pt_hashtable) + 1);
     }
-    pt_hashtable->_t_nodecount++;
 
-    _HASHTABLE_ITERATOR_BUCKETPOS(it_iter) = (_byte_t*)ppt_nodelist;
-    _HASHTABLE_ITERATOR_COREPOS(it_iter) = (_byte_t*)pt_node;
-    _HASHTABLE_ITERATOR_HASHTABLE_POINTER(it_iter) = pt_hashtable;
-
-    return it_iter;
+    return _hashtable_insert_equal_auxiliary(pt_hashtable, cpv_value);
 }
 
 /**
@@ -336,6 +305,18 @@ _hashtable_iterator_t _hashtable_insert_unique(_hashtable_t* pt_hashtable, const
     }
 }
 
+/**
+ * Reserve buckets for specific count of elements.
+ */
+void _hashtable_reserve(_hashtable_t* pt_hashtable, size_t t_count)
+{
+    assert(pt_hashtable != NULL);
+    assert(_hashtable_is_inited(pt_hashtable));
+
+    /* the bucket count is not less than the element count */
+    _hashtable_resize(pt_hashtable, t_count);
+}
+
 /**
  * Find specific element.
  */
@@ -355,16 +336,19 @@ _hashtable_iterator_t _hashtable_find(const _hashtable_t* cpt_hashtable, const v
     assert(_hashtable_is_inited(cpt_hashtable));
 
     t_bucketcount = _hashtable_bucket_count(cpt_hashtable);
+    if (t_bucketcount == 0) {
+        /* the allocator context refused the buckets */
+        return _hashtable_end(cpt_hashtable);
+    }
     t_tmp = _GET_HASHTABLE_TYPE_SIZE(cpt_hashtable);
     _hashtable_hash_auxiliary(cpt_hashtable, cpv_value, &t_tmp);
     t_pos = t_tmp % t_bucketcount;
-    ppt_bucket = (_hashnode_t**)vector_at(&cpt_hashtable->_vec_bucket, t_pos);
+    ppt_bucket = (_hashnode_t**)vector_data(&cpt_hashtable->_vec_bucket) + t_pos;
     pt_node = *ppt_bucket;
 
     while (pt_node != NULL) {
-        b_less = b_greater = _GET_HASHTABLE_TYPE_SIZE(cpt_hashtable);
-        _hashtable_elem_compare_auxiliary(cpt_hashtable, pt_node->_pby_data, cpv_value, &b_less);
-        _hashtable_elem_compare_auxiliary(cpt_hashtable, cpv_value, pt_node->_pby_data, &b_greater);
+        b_less = _hashtable_elem_less_auxiliary(cpt_hashtable, pt_node->_pby_data, cpv_value);
+        b_greater = _hashtable_elem_less_auxiliary(cpt_hashtable, cpv_value, pt_node->_pby_data);
         if (b_less || b_greater) {
             pt_node = pt_node->_pt_next;
         } else {
@@ -407,20 +391,24 @@ range_t _hashtable_equal_range(const _hashtable_t* cpt_hashtable, const void* cp
     r_result.it_end = _create_hashtable_iterator();
 
     t_bucketcount = _hashtable_bucket_count(cpt_hashtable);
+    if (t_bucketcount == 0) {
+        /* the allocator context refused the buckets */
+        r_result.it_begin = _hashtable_end(cpt_hashtable);
+        r_result.it_end = _hashtable_end(cpt_hashtable);
+        return r_result;
+    }
     t_tmp = _GET_HASHTABLE_TYPE_SIZE(cpt_hashtable);
     _hashtable_hash_auxiliary(cpt_hashtable, cpv_value, &t_tmp);
     t_pos = t_tmp % t_bucketcount;
-    ppt_bucket = (_hashnode_t**)vector_at(&cpt_hashtable->_vec_bucket, t_pos);
+    ppt_bucket = (_hashnode_t**)vector_data(&cpt_hashtable->_vec_bucket) + t_pos;
 
     for (pt_begin = *ppt_bucket; pt_begin != NULL; pt_begin = pt_begin->_pt_next) {
-        b_less = b_greater = _GET_HASHTABLE_TYPE_SIZE(cpt_hashtable);
-        _hashtable_elem_compare_auxiliary(cpt_hashtable, pt_begin->_pby_data, cpv_value, &b_less);
-        _hashtable_elem_compare_auxiliary(cpt_hashtable, cpv_value, pt_begin->_pby_data, &b_greater);
+        b_less = _hashtable_elem_less_auxiliary(cpt_hashtable, pt_begin->_pby_data, cpv_value);
+        b_greater = _hashtable_elem_less_auxiliary(cpt_hashtable, cpv_value, pt_begin->_pby_data);
         if (!b_less && !b_greater) {
             for (pt_end = pt_begin->_pt_next; pt_end != NULL; pt_end = pt_end->_pt_next) {
-                b_less = b_greater = _GET_HASHTABLE_TYPE_SIZE(cpt_hashtable);
-                _hashtable_elem_compare_auxiliary(cpt_hashtable, pt_end->_pby_data, cpv_value, &b_less);
-                _hashtable_elem_compare_auxiliary(cpt_hashtable, cpv_value, pt_end->_pby_data, &b_greater);
+                b_less = _hashtable_elem_less_auxiliary(cpt_hashtable, pt_end->_pby_data, cpv_value);
+                b_greater = _hashtable_elem_less_auxiliary(cpt_hashtable, cpv_value, pt_end->_pby_data);
                 if (b_less || b_greater) {
                     _HASHTABLE_ITERATOR_BUCKETPOS(r_result.it_begin) = (_byte_t*)ppt_bucket;
                     _HASHTABLE_ITERATOR_COREPOS(r_result.it_begin) = (_byte_t*)pt_begin;
@@ -439,7 +427,7 @@ range_t _hashtable_equal_range(const _hashtable_t* cpt_hashtable, const void* cp
             _HASHTABLE_ITERATOR_HASHTABLE_POINTER(r_result.it_begin) = (_hashtable_t*)cpt_hashtable;
 
             for (i = t_pos + 1; i < t_bucketcount; ++i) {
-                ppt_bucket = (_hashnode_t**)vector_at(&cpt_hashtable->_vec_bucket, i);
+                ppt_bucket = (_hashnode_t**)vector_data(&cpt_hashtable->_vec_bucket) + i;
                 pt_end = *ppt_bucket;
                 if (pt_end != NULL) {
                     _HASHTABLE_ITERATOR_BUCKETPOS(r_result.it_end) = (_byte_t*)ppt_bucket;
@@ -570,6 +558,7 @@ void _hashtable_swap(_hashtable_t* pt_first, _hashtable_t* pt_second)
     assert(_hashtable_is_inited(pt_first));
     assert(_hashtable_is_inited(pt_second));
     assert(_hashtable_same_type_ex(pt_first, pt_second));
+    assert(_alloc_same_context(&pt_first->_t_allocator._t_context, &pt_second->_t_allocator._t_context));
 
     if (_hashtable_equal(pt_first, pt_second)) {
         return;
@@ -601,10 +590,11 @@ void _hashtable_assign(_hashtable_t* pt_dest, const _hashtable_t* cpt_src)
     it_end = _hashtable_end(cpt_src);
 
     /* insert node from src to dest */
+    _hashtable_reserve(pt_dest, _hashtable_size(cpt_src));
     for (it_iter = it_begin;
          !_hashtable_iterator_equal(it_iter, it_end);
          it_iter = _hashtable_iterator_next(it_iter)) {
-        _hashtable_insert_equal(pt_dest, _hashtable_iterator_get_pointer_ignore_cstr(it_iter));
+        _hashtable_insert_equal_auxiliary(pt_dest, _hashtable_iterator_get_pointer_ignore_cstr(it_iter));
     }
 }
 
@@ -742,8 +732,8 @@ void _hashtable_clear(_hashtable_t* pt_hashtable)
     /* iterator all bucket node */
     for (i = 0; i < t_bucketcount; ++i) {
         /* iterator all element list for one bucket node */
-        pt_node = *(_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, i);
-        *(_hashnode_t**)vector_at(&pt_hashtable->_vec_bucket, i) = NULL;
+        pt_node = *((_hashnode_t**)vector_data(&pt_hashtable->_vec_bucket) + i);
+        *((_hashnode_t**)vector_data(&pt_hashtable->_vec_bucket) + i) = NULL;
         while (pt_node != NULL) {
             /* delete each element */
             pt_deletion = pt_node;
@@ -918,8 +908,10 @@ void _hashtable_insert_equal_range(_hashtable_t* pt_hashtable, iterator_t it_beg
     assert(_hashtable_same_iterator_type(pt_hashtable, it_end));
     assert(iterator_equal(it_begin, it_end) || _iterator_before(it_begin, it_end));
 
+    /* the bucket count is set once for all the elements */
+    _hashtable_reserve(pt_hashtable, _hashtable_size(pt_hashtable) + iterator_distance(it_begin, it_end));
     for (it_iter = it_begin; !iterator_equal(it_iter, it_end); it_iter = iterator_next(it_iter)) {
-        _hashtable_insert_equal(pt_hashtable, _iterator_get_pointer_ignore_cstr(it_iter));
+        _hashtable_insert_equal_auxiliary(pt_hashtable, _iterator_get_pointer_ignore_cstr(it_iter));
     }
 }
 
@@ -934,6 +926,9 @@ void _hashtable_insert_equal_array(_hashtable_t* pt_hashtable, const void* cpv_a
     assert(_hashtable_is_inited(pt_hashtable));
     assert(cpv_array != NULL);
 
+    /* the bucket count is set once for all the elements */
+    _hashtable_reserve(pt_hashtable, _hashtable_size(pt_hashtable) + t_count);
+
     /*
      * Copy the elements from src array to dest hashtable
      * The array of c builtin and user define or cstl builtin are different,
@@ -949,16 +944,16 @@ void _hashtable_insert_equal_array(_hashtable_t* pt_hashtable, const void* cpv_a
         string_init(pstr_elem);
         for (i = 0; i < t_count; ++i) {
             string_assign_cstr(pstr_elem, *((const char**)cpv_array + i));
-            _hashtable_insert_equal(pt_hashtable, pstr_elem);
+            _hashtable_insert_equal_auxiliary(pt_hashtable, pstr_elem);
         }
         string_destroy(pstr_elem);
     } else if (_GET_HASHTABLE_TYPE_STYLE(pt_hashtable) == _TYPE_C_BUILTIN) {
         for (i = 0; i < t_count; ++i) {
-            _hashtable_insert_equal(pt_hashtable, (unsigned char*)cpv_array + i * _GET_HASHTABLE_TYPE_SIZE(pt_hashtable));
+            _hashtable_insert_equal_auxiliary(pt_hashtable, (unsigned char*)cpv_array + i * _GET_HASHTABLE_TYPE_SIZE(pt_hashtable));
         }
     } else {
         for (i = 0; i < t_count; ++i) {
-            _hashtable_insert_equal(pt_hashtable, *((void**)cpv_array + i));
+            _hashtable_insert_equal_auxiliary(pt_hashtable, *((void**)cpv_array + i));
         }
     }
 }
@@ -976,8 +971,10 @@ void _hashtable_insert_unique_range(_hashtable_t* pt_hashtable, iterator_t it_be
     assert(_hashtable_same_iterator_type(pt_hashtable, it_end));
     assert(iterator_equal(it_begin, it_end) || _iterator_before(it_begin, it_end));
 
+    /* the bucket count is set once for all the elements */
+    _hashtable_reserve(pt_hashtable, _hashtable_size(pt_hashtable) + iterator_distance(it_begin, it_end));
     for (it_iter = it_begin; !iterator_equal(it_iter, it_end); it_iter = iterator_next(it_iter)) {
-        _hashtable_insert_unique(pt_hashtable, _iterator_get_pointer_ignore_cstr(it_iter));
+        _hashtable_insert_unique_auxiliary(pt_hashtable, _iterator_get_pointer_ignore_cstr(it_iter));
     }
 }
 
@@ -992,6 +989,9 @@ void _hashtable_insert_unique_array(_hashtable_t* pt_hashtable, const void* cpv_
     assert(_hashtable_is_inited(pt_hashtable));
     assert(cpv_array != NULL);
 
+    /* the bucket count is set once for all the elements */
+    _hashtable_reserve(pt_hashtable, _hashtable_size(pt_hashtable) + t_count);
+
     /*
      * Copy the elements from src array to dest hashtable
      * The array of c builtin and user define or cstl builtin are different,
@@ -1007,21 +1007,70 @@ void _hashtable_insert_unique_array(_hashtable_t* pt_hashtable, const void* cpv_
         string_init(pstr_elem);
         for (i = 0; i < t_count; ++i) {
             string_assign_cstr(pstr_elem, *((const char**)cpv_array + i));
-            _hashtable_insert_unique(pt_hashtable, pstr_elem);
+            _hashtable_insert_unique_auxiliary(pt_hashtable, pstr_elem);
         }
         string_destroy(pstr_elem);
     } else if (_GET_HASHTABLE_TYPE_STYLE(pt_hashtable) == _TYPE_C_BUILTIN) {
         for (i = 0; i < t_count; ++i) {
-            _hashtable_insert_unique(pt_hashtable, (unsigned char*)cpv_array + i * _GET_HASHTABLE_TYPE_SIZE(pt_hashtable));
+            _hashtable_insert_unique_auxiliary(pt_hashtable, (unsigned char*)cpv_array + i * _GET_HASHTABLE_TYPE_SIZE(pt_hashtable));
         }
     } else {
         for (i = 0; i < t_count; ++i) {
-            _hashtable_insert_unique(pt_hashtable, *((void**)cpv_array + i));
+            _hashtable_insert_unique_auxiliary(pt_hashtable, *((void**)cpv_array + i));
         }
     }
 }
 
 /** local function implementation section **/
+/**
+ * Move all nodes to the new buckets.
+ */
+static void _hashtable_rehash(_hashtable_t* pt_hashtable, size_t t_bucketcount)
+{
+    size_t        t_tmp = 0;
+    size_t        t_pos = 0;
+    size_t        i = 0;
+    _hashnode_t*  pt_node = NULL;
+    _hashnode_t*  pt_nodelist = NULL;
+    _hashnode_t** ppt_bucket = NULL;
+
+    assert(pt_hashtable != NULL);
+    assert(t_bucketcount > 0);
+
+    /* reserve the buckets before the nodes are moved, so the refused memory leaves the hashtable as it is */
+    vector_reserve(&pt_hashtable->_vec_bucket, t_bucketcount);
+    if (vector_capacity(&pt_hashtable->_vec_bucket) < t_bucketcount) {
+        return;
+    }
+
+    /* select all element in hash node list */
+    for (i = 0; i < _hashtable_bucket_count(pt_hashtable); ++i) {
+        ppt_bucket = (_hashnode_t**)vector_data(&pt_hashtable->_vec_bucket) + i;
+        pt_node = *ppt_bucket;
+        while (pt_node != NULL) {
+            *ppt_bucket = pt_node->_pt_next;
+            pt_node->_pt_next = pt_nodelist;
+            pt_nodelist = pt_node;
+            pt_node = *ppt_bucket;
+        }
+    }
+
+    /* resize vector bucket */
+    vector_resize(&pt_hashtable->_vec_bucket, t_bucketcount);
+
+    /* rehash */
+    while (pt_nodelist != NULL) {
+        pt_node = pt_nodelist;
+        pt_nodelist = pt_node->_pt_next;
+
+        t_tmp = _GET_HASHTABLE_TYPE_SIZE(pt_hashtable);
+        _hashtable_hash_auxiliary(pt_hashtable, pt_node->_pby_data, &t_tmp);
+        t_pos = t_tmp % t_bucketcount;
+        ppt_bucket = (_hashnode_t**)vector_data(&pt_hashtable->_vec_bucket) + t_pos;
+        pt_node->_pt_next = *ppt_bucket;
+        *ppt_bucket = pt_node;
+    }
+}
 
 /** eof **/
 
@@ -47,6 +47,15 @@ extern "C" {
  */
 extern _hashtable_t* _create_hashtable(const char* s_typename);
 
+/**
+ * Create hashtable container with allocator context.
+ * @param cpt_context  allocator context.
+ * @param s_typename   element type name.
+ * @return if create hashtable successfully return hashtable pointer, otherwise return NULL.
+ * @remarks if cpt_context == NULL or s_typename == NULL, then the behavior is undefined.
+ */
+extern _hashtable_t* _create_hashtable_with_allocator(const alloc_context_t* cpt_context, const char* s_typename);
+
 /**
  * Initialize hashtable container.
  * @param pt_hashtable      hashtable container.
@@ -352,6 +361,37 @@ extern bool_t _hashtable_greater_equal(const _hashtable_t* cpt_first, const _has
  */
 extern void _hashtable_resize(_hashtable_t* pt_hashtable, size_t t_resize);
 
+/**
+ * Reserve buckets for specific count of elements.
+ * @param pt_hashtable      hashtable container.
+ * @param t_count           element count.
+ * @return void.
+ * @remarks if pt_hashtable == NULL, the behavior is undefined, pt_hashtable must be initialized,otherwise the behavior
+ *          is undefined. the hashtable holds t_count elements without rehash after reserve.
+ */
+extern void _hashtable_reserve(_hashtable_t* pt_hashtable, size_t t_count);
+
+/**
+ * Reduce the buckets to fit the element count and release the empty slabs.
+ * @param pt_hashtable      hashtable container.
+ * @return void.
+ * @remarks if pt_hashtable == NULL, the behavior is undefined, pt_hashtable must be initialized,otherwise the behavior
+ *          is undefined. the bucket count becomes the least prime that is not less than the element count, all
+ *          iterators of hashtable are invalid. the bucket vector is reallocated in the shared size classes, so
+ *          _hashtable_memory_usage() does not grow, but the memory of nodes goes back to system only when their
+ *          slabs are free.
+ */
+extern void _hashtable_shrink_to_fit(_hashtable_t* pt_hashtable);
+
+/**
+ * Get the memory that hashtable allocates.
+ * @param cpt_hashtable     hashtable container.
+ * @return the bytes of buckets and nodes.
+ * @remarks if cpt_hashtable == NULL, the behavior is undefined, cpt_hashtable must be initialized,otherwise the
+ *          behavior is undefined. the _hashtable_t itself is not counted.
+ */
+extern size_t _hashtable_memory_usage(const _hashtable_t* cpt_hashtable);
+
 /**
  * Inserts an unique element into a hashtable.
  * @param pt_hashtable       hashtable container.
@@ -461,7 +501,8 @@ extern size_t _hashtable_erase(_hashtable_t* pt_hashtable, const void* cpv_value
  * @return void.
  * @remarks if pt_first == NULL or pt_second == NULL, then the behavior is undefined. the two hashtable must be
  *          initialized, otherwise the behavior is undefined. if the two hashtable are not same type, the behavior is
- *          undefined. if _hashtable_equal(cpt_first, cpt_second), then the function do nothing.
+ *          undefined. if _hashtable_equal(cpt_first, cpt_second), then the function do nothing. the two hashtable must
+ *          be created with the same allocator context, otherwise the behavior is undefined.
  */
 extern void _hashtable_swap(_hashtable_t* pt_first, _hashtable_t* pt_second);
 
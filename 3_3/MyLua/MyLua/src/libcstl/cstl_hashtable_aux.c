@@ -100,8 +100,10 @@ bool_t _hashtable_is_inited(const _hashtable_t* cpt_hashtable)
         return false;
     }
 
+    /* the hashtable has no bucket when the allocator context refused them in initialization */
     if (!_vector_is_inited(&cpt_hashtable->_vec_bucket) ||
-        vector_size(&cpt_hashtable->_vec_bucket) < _HASHTABLE_FIRST_PRIME_BUCKET_COUNT) {
+        (vector_size(&cpt_hashtable->_vec_bucket) < _HASHTABLE_FIRST_PRIME_BUCKET_COUNT &&
+         !(vector_empty(&cpt_hashtable->_vec_bucket) && cpt_hashtable->_t_nodecount == 0))) {
         return false;
     }
 
@@ -123,7 +125,7 @@ bool_t _hashtable_iterator_belong_to_hashtable(const _hashtable_t* cpt_hashtable
 
     assert(cpt_hashtable != NULL);
     assert(_hashtable_is_inited(cpt_hashtable));
-    assert(_HASHTABLE_ITERATOR_BUCKETPOS(it_iter) != NULL);
+    assert(_HASHTABLE_ITERATOR_BUCKETPOS(it_iter) != NULL || vector_empty(&cpt_hashtable->_vec_bucket));
     assert(_HASHTABLE_ITERATOR_HASHTABLE(it_iter) == cpt_hashtable);
 
     /* check for the end node */
@@ -338,22 +340,135 @@ void _hashtable_hash_auxiliary(const _hashtable_t* cpt_hashtable, const void* cp
 }
 
 /**
- * Element compare function auxiliary
+ * Element less function auxiliary
  */
-void _hashtable_elem_compare_auxiliary(
-    const _hashtable_t* cpt_hashtable, const void* cpv_first, const void* cpv_second, void* pv_output)
+bool_t _hashtable_elem_less_auxiliary(const _hashtable_t* cpt_hashtable, const void* cpv_first, const void* cpv_second)
 {
     assert(cpt_hashtable != NULL);
     assert(cpv_first != NULL);
     assert(cpv_second != NULL);
-    assert(pv_output != NULL);
     assert(_hashtable_is_inited(cpt_hashtable));
 
-    if (strncmp(_GET_HASHTABLE_TYPE_NAME(cpt_hashtable), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0 &&
-        cpt_hashtable->_bfun_compare != _GET_HASHTABLE_TYPE_LESS_FUNCTION(cpt_hashtable)) {
-        cpt_hashtable->_bfun_compare(string_c_str((string_t*)cpv_first), string_c_str((string_t*)cpv_second), pv_output);
+    if (cpt_hashtable->_lfun_compare != NULL) {
+        return cpt_hashtable->_lfun_compare(cpv_first, cpv_second);
+    } else {
+        bool_t b_result = _GET_HASHTABLE_TYPE_SIZE(cpt_hashtable);
+        if (strncmp(_GET_HASHTABLE_TYPE_NAME(cpt_hashtable), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0 &&
+            cpt_hashtable->_bfun_compare != _GET_HASHTABLE_TYPE_LESS_FUNCTION(cpt_hashtable)) {
+            cpt_hashtable->_bfun_compare(
+                string_c_str((string_t*)cpv_first), string_c_str((string_t*)cpv_second), &b_result);
+        } else {
+            cpt_hashtable->_bfun_compare(cpv_first, cpv_second, &b_result);
+        }
+        return b_result;
+    }
+}
+
+/**
+ * Element compare function auxiliary
+ */
+void _hashtable_elem_compare_auxiliary(
+    const _hashtable_t* cpt_hashtable, const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(pv_output != NULL);
+    *(bool_t*)pv_output = _hashtable_elem_less_auxiliary(cpt_hashtable, cpv_first, cpv_second);
+}
+
+/**
+ * Inserts an element into a hashtable without resize.
+ */
+_hashtable_iterator_t _hashtable_insert_equal_auxiliary(_hashtable_t* pt_hashtable, const void* cpv_value)
+{
+    size_t                t_bucketcount = 0;
+    _hashnode_t*          pt_node = NULL;
+    _hashnode_t*          pt_cur = NULL;
+    _hashnode_t**         ppt_nodelist = NULL;
+    _hashtable_iterator_t it_iter = _create_hashtable_iterator();
+    bool_t                b_result = false;
+    size_t                t_tmp = 0;
+    size_t                t_pos = 0;
+    bool_t                b_less = false;
+    bool_t                b_greater = false;
+
+    assert(pt_hashtable != NULL);
+    assert(cpv_value != NULL);
+    assert(_hashtable_is_inited(pt_hashtable));
+
+    /* the hashtable has no bucket or no node when the allocator context refuses the memory */
+    t_bucketcount = _hashtable_bucket_count(pt_hashtable);
+    if (t_bucketcount == 0) {
+        return _hashtable_end(pt_hashtable);
+    }
+
+    /* allocate node */
+    pt_node = _alloc_allocate(
+        &pt_hashtable->_t_allocator, _HASHTABLE_NODE_SIZE(_GET_HASHTABLE_TYPE_SIZE(pt_hashtable)), 1);
+    if (pt_node == NULL) {
+        return _hashtable_end(pt_hashtable);
+    }
+    _hashtable_init_elem_auxiliary(pt_hashtable, pt_node);
+    b_result = _GET_HASHTABLE_TYPE_SIZE(pt_hashtable);
+    _GET_HASHTABLE_TYPE_COPY_FUNCTION(pt_hashtable)(pt_node->_pby_data, cpv_value, &b_result);
+    assert(b_result);
+
+    /* hash */
+    t_tmp = _GET_HASHTABLE_TYPE_SIZE(pt_hashtable);
+    _hashtable_hash_auxiliary(pt_hashtable, pt_node->_pby_data, &t_tmp);
+    t_pos = t_tmp % t_bucketcount;
+
+    /* insert node into hashtable, note the node has same value together */
+    ppt_nodelist = (_hashnode_t**)vector_data(&pt_hashtable->_vec_bucket) + t_pos;
+    assert(ppt_nodelist != NULL);
+    pt_cur = *ppt_nodelist;
+    if (pt_cur == NULL) {
+        pt_node->_pt_next = pt_cur;
+        *ppt_nodelist = pt_node;
+    } else {
+        b_less = _hashtable_elem_less_auxiliary(pt_hashtable, pt_cur->_pby_data, pt_node->_pby_data);
+        b_greater = _hashtable_elem_less_auxiliary(pt_hashtable, pt_node->_pby_data, pt_cur->_pby_data);
+        if (!b_less && !b_greater) {
+            pt_node->_pt_next = pt_cur;
+            *ppt_nodelist = pt_node;
+        } else {
+            while (pt_cur->_pt_next != NULL) {
+                b_less = _hashtable_elem_less_auxiliary(
+                    pt_hashtable, pt_cur->_pt_next->_pby_data, pt_node->_pby_data);
+                b_greater = _hashtable_elem_less_auxiliary(
+                    pt_hashtable, pt_node->_pby_data, pt_cur->_pt_next->_pby_data);
+
+                if (b_less || b_greater) {
+                    pt_cur = pt_cur->_pt_next;
+                } else {
+                    break;
+                }
+            } 
+            pt_node->_pt_next = pt_cur->_pt_next;
+            pt_cur->_pt_next = pt_node;
+        }
+    }
+    pt_hashtable->_t_nodecount++;
+
+    _HASHTABLE_ITERATOR_BUCKETPOS(it_iter) = (_byte_t*)ppt_nodelist;
+    _HASHTABLE_ITERATOR_COREPOS(it_iter) = (_byte_t*)pt_node;
+    _HASHTABLE_ITERATOR_HASHTABLE_POINTER(it_iter) = pt_hashtable;
+
+    return it_iter;
+}
+
+/**
+ * Inserts an unique element into a hashtable without resize.
+ */
+_hashtable_iterator_t _hashtable_insert_unique_auxiliary(_hashtable_t* pt_hashtable, const void* cpv_value)
+{
+    assert(pt_hashtable != NULL);
+    assert(cpv_value != NULL);
+    assert(_hashtable_is_inited(pt_hashtable));
+
+    if (!_hashtable_empty(pt_hashtable) &&
+        !_hashtable_iterator_equal(_hashtable_find(pt_hashtable, cpv_value), _hashtable_end(pt_hashtable))) {
+        return _hashtable_end(pt_hashtable);
     } else {
-        cpt_hashtable->_bfun_compare(cpv_first, cpv_second, pv_output);
+        return _hashtable_insert_equal_auxiliary(pt_hashtable, cpv_value);
     }
 }
 
@@ -37,6 +37,7 @@ extern "C" {
 #define _GET_HASHTABLE_TYPE_INIT_FUNCTION(pt_hashtable)    ((pt_hashtable)->_t_typeinfo._pt_type->_t_typeinit)
 #define _GET_HASHTABLE_TYPE_COPY_FUNCTION(pt_hashtable)    ((pt_hashtable)->_t_typeinfo._pt_type->_t_typecopy)
 #define _GET_HASHTABLE_TYPE_LESS_FUNCTION(pt_hashtable)    ((pt_hashtable)->_t_typeinfo._pt_type->_t_typeless)
+#define _GET_HASHTABLE_TYPE_LESS_FAST_FUNCTION(pt_hashtable) ((pt_hashtable)->_t_typeinfo._pt_type->_t_typelessfast)
 #define _GET_HASHTABLE_TYPE_DESTROY_FUNCTION(pt_hashtable) ((pt_hashtable)->_t_typeinfo._pt_type->_t_typedestroy)
 #define _GET_HASHTABLE_TYPE_STYLE(pt_hashtable)            ((pt_hashtable)->_t_typeinfo._t_style)
 
@@ -176,7 +177,20 @@ extern void _hashtable_init_elem_auxiliary(_hashtable_t* pt_hashtable, _hashnode
 extern void _hashtable_hash_auxiliary(const _hashtable_t* cpt_hashtable, const void* cpv_input, void* pv_output);
 
 /**
- * Element compare function auxiliary
+ * Element less function auxiliary
+ * @param cpt_hashtable         hashtable.
+ * @param cpv_first             first element.
+ * @param cpv_second            second element.
+ * @return true if first element is less than second element, otherwise false.
+ * @remarks if cpt_hashtable == NULL or cpv_first == NULL or cpv_second == NULL, the behavior is undefined. the result is
+ *          returned by the cached less function of element type directly when the compare function is the default
+ *          one, otherwise the compare function is called. cpt_hashtable must be initialized, otherwise the behavior is
+ *          undefined.
+ */
+extern bool_t _hashtable_elem_less_auxiliary(const _hashtable_t* cpt_hashtable, const void* cpv_first, const void* cpv_second);
+
+/**
+ * Element compare function auxiliary, the shim of _hashtable_elem_less_auxiliary().
  * @param cpt_hashtable         hashtable.
  * @param cpv_first             first element.
  * @param cpv_second            second element.
@@ -189,6 +203,27 @@ extern void _hashtable_hash_auxiliary(const _hashtable_t* cpt_hashtable, const v
 extern void _hashtable_elem_compare_auxiliary(
     const _hashtable_t* cpt_hashtable, const void* cpv_first, const void* cpv_second, void* pv_output);
 
+/**
+ * Inserts an element into a hashtable without resize.
+ * @param pt_hashtable          hashtable.
+ * @param cpv_value             element.
+ * @return iterator to the new element.
+ * @remarks if pt_hashtable == NULL or cpv_value == NULL, the behavior is undefined. pt_hashtable must be initialized,
+ *          otherwise the behavior is undefined. the buckets must be reserved by caller, the bucket lists grow longer
+ *          instead of rehash when the element count exceeds the bucket count.
+ */
+extern _hashtable_iterator_t _hashtable_insert_equal_auxiliary(_hashtable_t* pt_hashtable, const void* cpv_value);
+
+/**
+ * Inserts an unique element into a hashtable without resize.
+ * @param pt_hashtable          hashtable.
+ * @param cpv_value             element.
+ * @return iterator to the new element, or end iterator if the element is already in hashtable.
+ * @remarks if pt_hashtable == NULL or cpv_value == NULL, the behavior is undefined. pt_hashtable must be initialized,
+ *          otherwise the behavior is undefined. the buckets must be reserved by caller.
+ */
+extern _hashtable_iterator_t _hashtable_insert_unique_auxiliary(_hashtable_t* pt_hashtable, const void* cpv_value);
+
 #ifdef __cplusplus
 }
 #endif
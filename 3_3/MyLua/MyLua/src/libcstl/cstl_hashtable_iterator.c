@@ -130,7 +130,8 @@ const void* _hashtable_iterator_get_pointer_ignore_cstr(_hashtable_iterator_t it
  */
 _hashtable_iterator_t _hashtable_iterator_prev(_hashtable_iterator_t it_iter)
 {
-    vector_iterator_t it_bucket;
+    _hashnode_t**     ppt_bucket = NULL;
+    _hashnode_t**     ppt_begin = NULL;
     _hashnode_t*      pt_node = NULL;
     _hashnode_t*      pt_prevnode = NULL;
 
@@ -139,8 +140,8 @@ _hashtable_iterator_t _hashtable_iterator_prev(_hashtable_iterator_t it_iter)
 
     /* hashtable end is specifical condition. corepos == NULL and bucketpos is invalid pos */
     if (_hashtable_iterator_equal(it_iter, _hashtable_end(_HASHTABLE_ITERATOR_HASHTABLE(it_iter)))) {
-        it_bucket = iterator_prev(vector_end(&_HASHTABLE_ITERATOR_HASHTABLE(it_iter)->_vec_bucket));
-        _HASHTABLE_ITERATOR_BUCKETPOS(it_iter) = _VECTOR_ITERATOR_COREPOS(it_bucket);
+        _HASHTABLE_ITERATOR_BUCKETPOS(it_iter) =
+            (_byte_t*)((_hashnode_t**)vector_data_end(&_HASHTABLE_ITERATOR_HASHTABLE(it_iter)->_vec_bucket) - 1);
     }
 
     pt_node = (_hashnode_t*)_HASHTABLE_ITERATOR_COREPOS(it_iter);
@@ -148,19 +149,17 @@ _hashtable_iterator_t _hashtable_iterator_prev(_hashtable_iterator_t it_iter)
 
     /* current node is first node in current bucket */
     if (pt_prevnode == pt_node) {
-        it_bucket = vector_begin(&(_HASHTABLE_ITERATOR_HASHTABLE(it_iter)->_vec_bucket));
-        _VECTOR_ITERATOR_COREPOS(it_bucket) = _HASHTABLE_ITERATOR_BUCKETPOS(it_iter);
-        for (it_bucket = iterator_prev(it_bucket);
-             iterator_greater_equal(it_bucket, vector_begin(&(_HASHTABLE_ITERATOR_HASHTABLE(it_iter)->_vec_bucket)));
-             it_bucket = iterator_prev(it_bucket)) {
-            pt_node = *(_hashnode_t**)_VECTOR_ITERATOR_COREPOS(it_bucket);
+        ppt_begin = (_hashnode_t**)vector_data(&_HASHTABLE_ITERATOR_HASHTABLE(it_iter)->_vec_bucket);
+        ppt_bucket = (_hashnode_t**)_HASHTABLE_ITERATOR_BUCKETPOS(it_iter);
+        while (ppt_bucket != ppt_begin) {
+            pt_node = *--ppt_bucket;
             if (pt_node != NULL) {
                 /* get the last hashnode */
                 while (pt_node->_pt_next != NULL) {
                         pt_node = pt_node->_pt_next;
                 }
                 /* set bucket pos and core pos */
-                _HASHTABLE_ITERATOR_BUCKETPOS(it_iter) = _VECTOR_ITERATOR_COREPOS(it_bucket);
+                _HASHTABLE_ITERATOR_BUCKETPOS(it_iter) = (_byte_t*)ppt_bucket;
                 _HASHTABLE_ITERATOR_COREPOS(it_iter) = (_byte_t*)pt_node;
                 break;
             }
@@ -181,8 +180,8 @@ _hashtable_iterator_t _hashtable_iterator_prev(_hashtable_iterator_t it_iter)
  */
 _hashtable_iterator_t _hashtable_iterator_next(_hashtable_iterator_t it_iter)
 {
-    vector_iterator_t it_bucket;
-    vector_iterator_t it_end;
+    _hashnode_t**     ppt_bucket = NULL;
+    _hashnode_t**     ppt_end = NULL;
     _hashnode_t*      pt_node = NULL;
 
     assert(_hashtable_iterator_belong_to_hashtable(_HASHTABLE_ITERATOR_HASHTABLE(it_iter), it_iter));
@@ -193,23 +192,16 @@ _hashtable_iterator_t _hashtable_iterator_next(_hashtable_iterator_t it_iter)
 
     if (pt_node->_pt_next == NULL) {
         /* iterator from current bucket pos to end */
-        it_bucket = vector_begin(&(_HASHTABLE_ITERATOR_HASHTABLE(it_iter)->_vec_bucket));
-        _VECTOR_ITERATOR_COREPOS(it_bucket) = _HASHTABLE_ITERATOR_BUCKETPOS(it_iter);
-        it_end = vector_end(&(_HASHTABLE_ITERATOR_HASHTABLE(it_iter)->_vec_bucket));
-        for (it_bucket = iterator_next(it_bucket);
-             !iterator_equal(it_bucket, it_end);
-             it_bucket = iterator_next(it_bucket)) {
-            _HASHTABLE_ITERATOR_BUCKETPOS(it_iter) = _VECTOR_ITERATOR_COREPOS(it_bucket);
-            if (*(_hashnode_t**)_HASHTABLE_ITERATOR_BUCKETPOS(it_iter) != NULL) {
-                _HASHTABLE_ITERATOR_COREPOS(it_iter) = (_byte_t*)(*(_hashnode_t**)_HASHTABLE_ITERATOR_BUCKETPOS(it_iter));
+        ppt_bucket = (_hashnode_t**)_HASHTABLE_ITERATOR_BUCKETPOS(it_iter);
+        ppt_end = (_hashnode_t**)vector_data_end(&_HASHTABLE_ITERATOR_HASHTABLE(it_iter)->_vec_bucket);
+        for (++ppt_bucket; ppt_bucket != ppt_end; ++ppt_bucket) {
+            if (*ppt_bucket != NULL) {
                 break;
             }
         }
-        if (iterator_equal(it_bucket, it_end)) {
-            assert((_hashnode_t*)_HASHTABLE_ITERATOR_COREPOS(it_iter) == pt_node);
-            _HASHTABLE_ITERATOR_COREPOS(it_iter) = NULL;
-            _HASHTABLE_ITERATOR_BUCKETPOS(it_iter) = _VECTOR_ITERATOR_COREPOS(it_bucket);
-        }
+        /* the end iterator has corepos == NULL and bucketpos at the end of buckets */
+        _HASHTABLE_ITERATOR_BUCKETPOS(it_iter) = (_byte_t*)ppt_bucket;
+        _HASHTABLE_ITERATOR_COREPOS(it_iter) = ppt_bucket != ppt_end ? (_byte_t*)*ppt_bucket : NULL;
     } else {
         _HASHTABLE_ITERATOR_COREPOS(it_iter) = (_byte_t*)pt_node->_pt_next;
     }
@@ -69,12 +69,25 @@ bool_t _create_hashtable_auxiliary(_hashtable_t* pt_hashtable, const char* s_typ
     pt_hashtable->_t_nodecount = 0;
     pt_hashtable->_ufun_hash = NULL;
     pt_hashtable->_bfun_compare = NULL;
+    pt_hashtable->_lfun_compare = NULL;
 
     /* initialize the allocator */
     _alloc_init(&pt_hashtable->_t_allocator);
     return true;
 }
 
+/**
+ * Set the allocator context of hashtable and its bucket vector.
+ */
+void _hashtable_set_context(_hashtable_t* pt_hashtable, const alloc_context_t* cpt_context)
+{
+    assert(pt_hashtable != NULL);
+    assert(_hashtable_is_created(pt_hashtable));
+
+    _alloc_set_context(&pt_hashtable->_t_allocator, cpt_context);
+    _alloc_set_context(&pt_hashtable->_vec_bucket._t_allocator, cpt_context);
+}
+
 /**
  * Destroy hashtable container auxiliary function.
  */
@@ -95,6 +108,7 @@ void _hashtable_destroy_auxiliary(_hashtable_t* pt_hashtable)
     /* destroy hash, compare and destroy element function */
     pt_hashtable->_ufun_hash = NULL;
     pt_hashtable->_bfun_compare = NULL;
+    pt_hashtable->_lfun_compare = NULL;
     pt_hashtable->_t_nodecount = 0;
 }
 
@@ -55,6 +55,7 @@ typedef struct _taghashtable
     ufun_t            _ufun_hash;
     /* key compare function */
     bfun_t            _bfun_compare;
+    lfun_t            _lfun_compare;  /* the type less function without output or NULL */
 }_hashtable_t;
 
 /* for the result of equal_range and insert_unique function */
@@ -72,6 +73,16 @@ typedef struct _taghashtable
  */
 extern bool_t _create_hashtable_auxiliary(_hashtable_t* pt_hashtable, const char* s_typename);
 
+/**
+ * Set the allocator context of hashtable and its bucket vector.
+ * @param pt_hashtable      created hashtable container.
+ * @param cpt_context       allocator context.
+ * @return void.
+ * @remarks if pt_hashtable == NULL, then the behavior is undefined. pt_hashtable must be created and not initialized,
+ *          otherwise the behavior is undefined.
+ */
+extern void _hashtable_set_context(_hashtable_t* pt_hashtable, const alloc_context_t* cpt_context);
+
 /**
  * Destroy hashtable container auxiliary function.
  * @param pt_hashtable      hashtable container.
@@ -61,6 +61,11 @@ extern "C" {
 #define _RB_TREE_ITERATOR_COREPOS(it_iter)              ((it_iter)._t_pos._t_treepos._pby_corepos)
 #define _RB_TREE_ITERATOR_TREE(it_iter)                 ((_rb_tree_t*)((it_iter)._t_pos._t_treepos._pt_tree))
 #define _RB_TREE_ITERATOR_TREE_POINTER(it_iter)         ((it_iter)._t_pos._t_treepos._pt_tree)
+/* bp_tree iterator handler */
+#define _BP_TREE_ITERATOR_COREPOS(it_iter)              ((it_iter)._t_pos._t_treepos._pby_corepos)
+#define _BP_TREE_ITERATOR_INDEX(it_iter)                ((it_iter)._t_pos._t_treepos._t_index)
+#define _BP_TREE_ITERATOR_TREE(it_iter)                 ((_bp_tree_t*)((it_iter)._t_pos._t_treepos._pt_tree))
+#define _BP_TREE_ITERATOR_TREE_POINTER(it_iter)         ((it_iter)._t_pos._t_treepos._pt_tree)
 /* set iterator handler */
 #define _SET_ITERATOR_CONTAINER(it_iter)                ((set_t*)((it_iter)._pt_container))
 #define _SET_ITERATOR_CONTAINER_TYPE(it_iter)           ((it_iter)._t_containertype)
@@ -154,9 +159,10 @@ typedef struct _tagiterator
             _byte_t** _ppby_mappos;    /* point to the map */
         }_t_dequepos;
         struct
-        {                    /* for avl tree or rb tree */
+        {                    /* for avl tree, rb tree or b+ tree */
             _byte_t*  _pby_corepos;
-            void*     _pt_tree;       /* point to the avl tree or rb tree*/
+            void*     _pt_tree;       /* point to the avl tree, rb tree or b+ tree */
+            size_t    _t_index;       /* element index in the b+ tree leaf */
         }_t_treepos;
         struct               /* for hash table */
         {
@@ -73,7 +73,7 @@ void list_init_n(list_t* plist_list, size_t t_count)
      *         | data |
      *         +------+
      */
-    plist_list->_pt_node = _alloc_allocate(&plist_list->_t_allocator, _LIST_NODE_SIZE(_GET_LIST_TYPE_SIZE(plist_list)), 1);
+    plist_list->_pt_node = _list_allocate_node(plist_list);
     assert(plist_list->_pt_node != NULL);
     plist_list->_pt_node->_pt_next = plist_list->_pt_node;
     plist_list->_pt_node->_pt_prev = plist_list->_pt_node;
@@ -83,7 +83,7 @@ void list_init_n(list_t* plist_list, size_t t_count)
         _listnode_t* pt_node = NULL;
 
         for (i = 0; i < t_count; ++i) {
-            pt_node = _alloc_allocate(&plist_list->_t_allocator, _LIST_NODE_SIZE(_GET_LIST_TYPE_SIZE(plist_list)), 1);
+            pt_node = _list_allocate_node(plist_list);
             assert(pt_node != NULL);
             _list_init_node_auxiliary(plist_list, pt_node);
 
@@ -632,7 +632,7 @@ void list_insert_range(list_t* plist_list, list_iterator_t it_pos, iterator_t it
 
     /* allocate the copy list of range [it_begin, it_end) */
     for (it_iter = it_begin; !iterator_equal(it_iter, it_end); it_iter = iterator_next(it_iter)) {
-        pt_node = _alloc_allocate(&plist_list->_t_allocator, _LIST_NODE_SIZE(_GET_LIST_TYPE_SIZE(plist_list)), 1);
+        pt_node = _list_allocate_node(plist_list);
         assert(pt_node != NULL);
         pt_node->_pt_next = pt_node->_pt_prev = NULL;
         _list_init_node_auxiliary(plist_list, pt_node);
@@ -692,7 +692,7 @@ void list_insert_array(list_t* plist_list, list_iterator_t it_pos, const void* c
         string_init(pstr_elem);
         for (i = 0; i < t_count; ++i) {
             string_assign_cstr(pstr_elem, *((const char**)cpv_array + i));
-            pt_node = _alloc_allocate(&plist_list->_t_allocator, _LIST_NODE_SIZE(_GET_LIST_TYPE_SIZE(plist_list)), 1);
+            pt_node = _list_allocate_node(plist_list);
             assert(pt_node != NULL);
 
             pt_node->_pt_next = pt_node->_pt_prev = NULL;
@@ -715,7 +715,7 @@ void list_insert_array(list_t* plist_list, list_iterator_t it_pos, const void* c
         string_destroy(pstr_elem);
     } else if (_GET_LIST_TYPE_STYLE(plist_list) == _TYPE_C_BUILTIN) {
         for (i = 0; i < t_count; ++i) {
-            pt_node = _alloc_allocate(&plist_list->_t_allocator, _LIST_NODE_SIZE(_GET_LIST_TYPE_SIZE(plist_list)), 1);
+            pt_node = _list_allocate_node(plist_list);
             assert(pt_node != NULL);
 
             pt_node->_pt_next = pt_node->_pt_prev = NULL;
@@ -738,7 +738,7 @@ void list_insert_array(list_t* plist_list, list_iterator_t it_pos, const void* c
         }
     } else {
         for (i = 0; i < t_count; ++i) {
-            pt_node = _alloc_allocate(&plist_list->_t_allocator, _LIST_NODE_SIZE(_GET_LIST_TYPE_SIZE(plist_list)), 1);
+            pt_node = _list_allocate_node(plist_list);
             assert(pt_node != NULL);
 
             pt_node->_pt_next = pt_node->_pt_prev = NULL;
@@ -790,7 +790,7 @@ void list_pop_back(list_t* plist_list)
     b_result = _GET_LIST_TYPE_SIZE(plist_list);
     _GET_LIST_TYPE_DESTROY_FUNCTION(plist_list)(pt_node->_pby_data, &b_result);
     assert(b_result);
-    _alloc_deallocate(&plist_list->_t_allocator, pt_node, _LIST_NODE_SIZE(_GET_LIST_TYPE_SIZE(plist_list)), 1);
+    _list_deallocate_node(plist_list, pt_node);
 }
 
 /**
@@ -813,7 +813,7 @@ void list_pop_front(list_t* plist_list)
     b_result = _GET_LIST_TYPE_SIZE(plist_list);
     _GET_LIST_TYPE_DESTROY_FUNCTION(plist_list)(pt_node->_pby_data, &b_result);
     assert(b_result);
-    _alloc_deallocate(&plist_list->_t_allocator, pt_node, _LIST_NODE_SIZE(_GET_LIST_TYPE_SIZE(plist_list)), 1);
+    _list_deallocate_node(plist_list, pt_node);
 }
 
 /**
@@ -837,7 +837,7 @@ list_iterator_t list_erase(list_t* plist_list, list_iterator_t it_pos)
     assert(b_result);
     pt_node->_pt_prev->_pt_next = pt_node->_pt_next;
     pt_node->_pt_next->_pt_prev = pt_node->_pt_prev;
-    _alloc_deallocate(&plist_list->_t_allocator, pt_node, _LIST_NODE_SIZE(_GET_LIST_TYPE_SIZE(plist_list)), 1);
+    _list_deallocate_node(plist_list, pt_node);
 
     return it_pos;
 }
@@ -903,7 +903,7 @@ void list_resize(list_t* plist_list, size_t t_resize)
         }
     } else {
         for (i = 0; i < t_resize - t_size; ++i) {
-            pt_node = _alloc_allocate(&plist_list->_t_allocator, _LIST_NODE_SIZE(_GET_LIST_TYPE_SIZE(plist_list)), 1);
+            pt_node = _list_allocate_node(plist_list);
             assert(pt_node != NULL);
             _list_init_node_auxiliary(plist_list, pt_node);
 
@@ -1171,6 +1171,74 @@ void list_reverse(list_t* plist_list)
     }
 }
 
+/**
+ * Reallocate all nodes from one new chunk in the order of elements.
+ */
+void list_compact(list_t* plist_list)
+{
+    _alloc_pool_t* pt_pool = NULL;
+    _listnode_t*   pt_sentinel = NULL;
+    _listnode_t*   pt_prev = NULL;
+    _listnode_t*   pt_node = NULL;
+    _listnode_t*   pt_next = NULL;
+    _listnode_t*   pt_new = NULL;
+    bool_t         b_relocatable = false;
+    bool_t         b_result = false;
+
+    assert(plist_list != NULL);
+    assert(_list_is_inited(plist_list));
+
+    /* the sentinel and all nodes are carved from the first chunk of new pool */
+    pt_pool = _alloc_pool_create(
+        &plist_list->_t_allocator._t_context, _LIST_NODE_SIZE(_GET_LIST_TYPE_SIZE(plist_list)), list_size(plist_list) + 1);
+    pt_sentinel = (_listnode_t*)_alloc_pool_allocate(&pt_pool);
+    /* c builtin elements except char* are moved as raw bytes */
+    b_relocatable = _GET_LIST_TYPE_STYLE(plist_list) == _TYPE_C_BUILTIN &&
+                    strncmp(_GET_LIST_TYPE_BASENAME(plist_list), _C_STRING_TYPE, _TYPE_NAME_SIZE) != 0;
+
+    pt_prev = pt_sentinel;
+    for (pt_node = plist_list->_pt_node->_pt_next; pt_node != plist_list->_pt_node; pt_node = pt_next) {
+        pt_next = pt_node->_pt_next;
+        pt_new = (_listnode_t*)_alloc_pool_allocate(&pt_pool);
+        if (b_relocatable) {
+            memcpy(pt_new->_pby_data, pt_node->_pby_data, _GET_LIST_TYPE_SIZE(plist_list));
+        } else {
+            _list_init_elem_auxiliary(plist_list, pt_new->_pby_data);
+            b_result = _GET_LIST_TYPE_SIZE(plist_list);
+            _GET_LIST_TYPE_COPY_FUNCTION(plist_list)(pt_new->_pby_data, pt_node->_pby_data, &b_result);
+            assert(b_result);
+            b_result = _GET_LIST_TYPE_SIZE(plist_list);
+            _GET_LIST_TYPE_DESTROY_FUNCTION(plist_list)(pt_node->_pby_data, &b_result);
+            assert(b_result);
+        }
+        _list_deallocate_node(plist_list, pt_node);
+
+        pt_new->_pt_prev = pt_prev;
+        pt_prev->_pt_next = pt_new;
+        pt_prev = pt_new;
+    }
+    pt_prev->_pt_next = pt_sentinel;
+    pt_sentinel->_pt_prev = pt_prev;
+
+    /* the old pool is released when no other list shares it */
+    _list_deallocate_node(plist_list, plist_list->_pt_node);
+    _alloc_pool_release(&plist_list->_pt_pool);
+    plist_list->_pt_pool = pt_pool;
+    plist_list->_pt_node = pt_sentinel;
+}
+
+/**
+ * Get the memory that list holds.
+ */
+size_t list_memory_usage(const list_t* cplist_list)
+{
+    assert(cplist_list != NULL);
+    assert(_list_is_inited(cplist_list));
+
+    return sizeof(list_t) + _alloc_memory_usage(&cplist_list->_t_allocator) +
+           _alloc_pool_memory_usage(cplist_list->_pt_pool);
+}
+
 /** local function implementation section **/
 
 /** eof **/
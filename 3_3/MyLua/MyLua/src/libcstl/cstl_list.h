@@ -509,7 +509,8 @@ extern void list_unique_if(list_t* plist_list, bfun_t bfun_op);
  * @remarks  if plist_list == NULL or plist_src == NUll then the behavior is undefined. the target list and source list
  *           must be initialized, otherwise the behavior is undefined. target position must be valid position for target list. 
  *           the element type of two list must be the same, otherwise the behavior is undefined. if plist_list == plist_src
- *           then the function does nothing.
+ *           then the function does nothing. the nodes are relinked, not copied, so the two lists share one node
+ *           pool from now on.
  */
 extern void list_splice(list_t* plist_list, list_iterator_t it_pos, list_t* plist_src);
 
@@ -597,6 +598,27 @@ extern void list_merge_if(list_t* plist_dest, list_t* plist_src, bfun_t bfun_op)
  */
 extern void list_reverse(list_t* plist_list);
 
+/**
+ * Reallocate all nodes from one new chunk in the order of elements.
+ * @param plist_list    list container.
+ * @return void.
+ * @remarks if plist_list == NULL, then the behavior is undefined. the list must be initialized, otherwise the behavior is
+ *          undefined. after splice, sort or a lot of insertion and erasure, the adjacent elements are scattered in memory,
+ *          the compact list is traversed in address order and no longer shares node pool with other lists. all iterators
+ *          of list are invalid after compact.
+ */
+extern void list_compact(list_t* plist_list);
+
+/**
+ * Get the memory that list holds.
+ * @param cplist_list   list container.
+ * @return the bytes of list_t and the chunks of node pool.
+ * @remarks if cplist_list == NULL, then the behavior is undefined. the list must be initialized, otherwise the
+ *          behavior is undefined. the whole node pool is counted, so the lists that share the pool report the same
+ *          chunks. the memory owned by elements, such as the characters of string_t, is not counted.
+ */
+extern size_t list_memory_usage(const list_t* cplist_list);
+
 #ifdef __cplusplus
 }
 #endif
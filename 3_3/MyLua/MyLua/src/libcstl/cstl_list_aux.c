@@ -173,6 +173,11 @@ bool_t _list_same_type(const list_t* cplist_first, const list_t* cplist_second)
  */
 void _list_transfer(list_iterator_t it_pos, list_iterator_t it_begin, list_iterator_t it_end)
 {
+    _listnode_t* pt_pos = NULL;
+    _listnode_t* pt_begin = NULL;
+    _listnode_t* pt_end = NULL;
+    _listnode_t* pt_last = NULL;
+
     assert(_list_iterator_belong_to_list(_LIST_ITERATOR_CONTAINER(it_pos), it_pos));
     assert(_list_iterator_belong_to_list(_LIST_ITERATOR_CONTAINER(it_begin), it_begin));
     assert(_list_iterator_belong_to_list(_LIST_ITERATOR_CONTAINER(it_end), it_end));
@@ -195,10 +200,24 @@ void _list_transfer(list_iterator_t it_pos, list_iterator_t it_begin, list_itera
         }
     }
 
-    /* insert the range [it_begin, it_end) to dest list */
-    list_insert_range(_LIST_ITERATOR_CONTAINER(it_pos), it_pos, it_begin, it_end);
-    /* delete the range [it_begin, it_end) front the source list */
-    list_erase_range(_LIST_ITERATOR_CONTAINER(it_begin), it_begin, it_end);
+    /* the nodes of two lists come from one node pool, so the nodes can be relinked */
+    if (_LIST_ITERATOR_CONTAINER(it_pos) != _LIST_ITERATOR_CONTAINER(it_begin)) {
+        _alloc_pool_share(&_LIST_ITERATOR_CONTAINER(it_pos)->_pt_pool, &_LIST_ITERATOR_CONTAINER(it_begin)->_pt_pool);
+    }
+
+    pt_pos = (_listnode_t*)_LIST_ITERATOR_COREPOS(it_pos);
+    pt_begin = (_listnode_t*)_LIST_ITERATOR_COREPOS(it_begin);
+    pt_end = (_listnode_t*)_LIST_ITERATOR_COREPOS(it_end);
+    pt_last = pt_end->_pt_prev;
+
+    /* unlink the range [it_begin, it_end) from the source list */
+    pt_begin->_pt_prev->_pt_next = pt_end;
+    pt_end->_pt_prev = pt_begin->_pt_prev;
+    /* link the range before it_pos */
+    pt_begin->_pt_prev = pt_pos->_pt_prev;
+    pt_last->_pt_next = pt_pos;
+    pt_pos->_pt_prev->_pt_next = pt_begin;
+    pt_pos->_pt_prev = pt_last;
 }
 
 /**
@@ -420,6 +439,33 @@ void _list_init_node_auxiliary(list_t* plist_list, _listnode_t* pt_node)
     _list_init_elem_auxiliary(plist_list, pt_node->_pby_data);
 }
 
+/**
+ * Allocate list node from the node pool of list.
+ */
+_listnode_t* _list_allocate_node(list_t* plist_list)
+{
+    assert(plist_list != NULL);
+
+    if (plist_list->_pt_pool == NULL) {
+        plist_list->_pt_pool = _alloc_pool_create(
+            &plist_list->_t_allocator._t_context, _LIST_NODE_SIZE(_GET_LIST_TYPE_SIZE(plist_list)), 0);
+    }
+
+    return (_listnode_t*)_alloc_pool_allocate(&plist_list->_pt_pool);
+}
+
+/**
+ * Release list node to the node pool of list.
+ */
+void _list_deallocate_node(list_t* plist_list, _listnode_t* pt_node)
+{
+    assert(plist_list != NULL);
+    assert(plist_list->_pt_pool != NULL);
+    assert(pt_node != NULL);
+
+    _alloc_pool_deallocate(&plist_list->_pt_pool, pt_node);
+}
+
 /** local function implementation section **/
 
 /** eof **/
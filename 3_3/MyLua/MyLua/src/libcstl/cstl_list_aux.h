@@ -132,6 +132,26 @@ extern void _list_destroy_varg_value_auxiliary(list_t* pt_list, _listnode_t* pt_
  */
 extern void _list_init_node_auxiliary(list_t* plist_list, _listnode_t* pt_node);
 
+/**
+ * Allocate list node from the node pool of list.
+ * @param plist_list    list container.
+ * @return new node, the element of node is not initialized.
+ * @remarks if plist_list == NULL, then the behavior is undefined. plist_list must be initialized or created by
+ *          create_list(), otherwise the behavior is undefined. the node pool is created when first node is allocated.
+ */
+extern _listnode_t* _list_allocate_node(list_t* plist_list);
+
+/**
+ * Release list node to the node pool of list.
+ * @param plist_list    list container.
+ * @param pt_node       node.
+ * @return void.
+ * @remarks if plist_list == NULL or pt_node == NULL, then the behavior is undefined. the element of node must be
+ *          destroyed before, and pt_node must be allocated by _list_allocate_node() from plist_list or the list that
+ *          shares node pool with plist_list.
+ */
+extern void _list_deallocate_node(list_t* plist_list, _listnode_t* pt_node);
+
 /**
  * Transfer the range [it_begin, it_end) to position it_pos.
  * @param it_pos      insert data position.
@@ -57,6 +57,7 @@ typedef struct _taglist
 
     /* memory allocate */
     _alloc_t     _t_allocator;
+    _alloc_pool_t* _pt_pool;    /* node pool, shared with the lists that nodes are spliced to or from */
 
     /* list core struct pointer */
     _listnode_t* _pt_node;
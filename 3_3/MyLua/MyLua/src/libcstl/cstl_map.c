@@ -54,6 +54,8 @@ void map_init(map_t* pmap_map)
     /* initialize the tree */
 #ifdef CSTL_MAP_AVL_TREE
     _avl_tree_init(&pmap_map->_t_tree, _map_value_compare);
+#elif defined(CSTL_MAP_BP_TREE)
+    _bp_tree_init(&pmap_map->_t_tree, _map_value_compare);
 #else
     _rb_tree_init(&pmap_map->_t_tree, _map_value_compare);
 #endif
@@ -73,6 +75,8 @@ void map_init_ex(map_t* pmap_map, bfun_t bfun_keycompare)
 
 #ifdef CSTL_MAP_AVL_TREE
     _avl_tree_init(&pmap_map->_t_tree, _map_value_compare);
+#elif defined(CSTL_MAP_BP_TREE)
+    _bp_tree_init(&pmap_map->_t_tree, _map_value_compare);
 #else
     _rb_tree_init(&pmap_map->_t_tree, _map_value_compare);
 #endif
@@ -196,6 +200,8 @@ void map_swap(map_t* pmap_first, map_t* pmap_second)
 
 #ifdef CSTL_MAP_AVL_TREE
     _avl_tree_swap(&pmap_first->_t_tree, &pmap_second->_t_tree);
+#elif defined(CSTL_MAP_BP_TREE)
+    _bp_tree_swap(&pmap_first->_t_tree, &pmap_second->_t_tree);
 #else
     _rb_tree_swap(&pmap_first->_t_tree, &pmap_second->_t_tree);
 #endif
@@ -211,6 +217,8 @@ bool_t map_empty(const map_t* cpmap_map)
 
 #ifdef CSTL_MAP_AVL_TREE
     return _avl_tree_empty(&cpmap_map->_t_tree);
+#elif defined(CSTL_MAP_BP_TREE)
+    return _bp_tree_empty(&cpmap_map->_t_tree);
 #else
     return _rb_tree_empty(&cpmap_map->_t_tree);
 #endif
@@ -226,6 +234,8 @@ size_t map_size(const map_t* cpmap_map)
 
 #ifdef CSTL_MAP_AVL_TREE
     return _avl_tree_size(&cpmap_map->_t_tree);
+#elif defined(CSTL_MAP_BP_TREE)
+    return _bp_tree_size(&cpmap_map->_t_tree);
 #else
     return _rb_tree_size(&cpmap_map->_t_tree);
 #endif
@@ -241,11 +251,30 @@ size_t map_max_size(const map_t* cpmap_map)
 
 #ifdef CSTL_MAP_AVL_TREE
     return _avl_tree_max_size(&cpmap_map->_t_tree);
+#elif defined(CSTL_MAP_BP_TREE)
+    return _bp_tree_max_size(&cpmap_map->_t_tree);
 #else
     return _rb_tree_max_size(&cpmap_map->_t_tree);
 #endif
 }
 
+/**
+ * Get the memory that map allocates.
+ */
+size_t map_memory_usage(const map_t* cpmap_map)
+{
+    assert(cpmap_map != NULL);
+    assert(_pair_is_inited(&cpmap_map->_pair_temp));
+
+#ifdef CSTL_MAP_AVL_TREE
+    return sizeof(map_t) + _avl_tree_memory_usage(&cpmap_map->_t_tree);
+#elif defined(CSTL_MAP_BP_TREE)
+    return sizeof(map_t) + _bp_tree_memory_usage(&cpmap_map->_t_tree);
+#else
+    return sizeof(map_t) + _rb_tree_memory_usage(&cpmap_map->_t_tree);
+#endif
+}
+
 /**
  * Return the compare function of key.
  */
@@ -286,6 +315,8 @@ void map_clear(map_t* pmap_map)
 
 #ifdef CSTL_MAP_AVL_TREE
     _avl_tree_clear(&pmap_map->_t_tree);
+#elif defined(CSTL_MAP_BP_TREE)
+    _bp_tree_clear(&pmap_map->_t_tree);
 #else
     _rb_tree_clear(&pmap_map->_t_tree);
 #endif
@@ -306,6 +337,8 @@ bool_t map_equal(const map_t* cpmap_first, const map_t* cpmap_second)
     }
 #ifdef CSTL_MAP_AVL_TREE
     return _avl_tree_equal(&cpmap_first->_t_tree, &cpmap_second->_t_tree);
+#elif defined(CSTL_MAP_BP_TREE)
+    return _bp_tree_equal(&cpmap_first->_t_tree, &cpmap_second->_t_tree);
 #else
     return _rb_tree_equal(&cpmap_first->_t_tree, &cpmap_second->_t_tree);
 #endif
@@ -326,6 +359,8 @@ bool_t map_not_equal(const map_t* cpmap_first, const map_t* cpmap_second)
     }
 #ifdef CSTL_MAP_AVL_TREE
     return _avl_tree_not_equal(&cpmap_first->_t_tree, &cpmap_second->_t_tree);
+#elif defined(CSTL_MAP_BP_TREE)
+    return _bp_tree_not_equal(&cpmap_first->_t_tree, &cpmap_second->_t_tree);
 #else
     return _rb_tree_not_equal(&cpmap_first->_t_tree, &cpmap_second->_t_tree);
 #endif
@@ -344,6 +379,8 @@ bool_t map_less(const map_t* cpmap_first, const map_t* cpmap_second)
 
 #ifdef CSTL_MAP_AVL_TREE
     return _avl_tree_less(&cpmap_first->_t_tree, &cpmap_second->_t_tree);
+#elif defined(CSTL_MAP_BP_TREE)
+    return _bp_tree_less(&cpmap_first->_t_tree, &cpmap_second->_t_tree);
 #else
     return _rb_tree_less(&cpmap_first->_t_tree, &cpmap_second->_t_tree);
 #endif
@@ -362,6 +399,8 @@ bool_t map_less_equal(const map_t* cpmap_first, const map_t* cpmap_second)
 
 #ifdef CSTL_MAP_AVL_TREE
     return _avl_tree_less_equal(&cpmap_first->_t_tree, &cpmap_second->_t_tree);
+#elif defined(CSTL_MAP_BP_TREE)
+    return _bp_tree_less_equal(&cpmap_first->_t_tree, &cpmap_second->_t_tree);
 #else
     return _rb_tree_less_equal(&cpmap_first->_t_tree, &cpmap_second->_t_tree);
 #endif
@@ -380,6 +419,8 @@ bool_t map_greater(const map_t* cpmap_first, const map_t* cpmap_second)
 
 #ifdef CSTL_MAP_AVL_TREE
     return _avl_tree_greater(&cpmap_first->_t_tree, &cpmap_second->_t_tree);
+#elif defined(CSTL_MAP_BP_TREE)
+    return _bp_tree_greater(&cpmap_first->_t_tree, &cpmap_second->_t_tree);
 #else
     return _rb_tree_greater(&cpmap_first->_t_tree, &cpmap_second->_t_tree);
 #endif
@@ -398,6 +439,8 @@ bool_t map_greater_equal(const map_t* cpmap_first, const map_t* cpmap_second)
 
 #ifdef CSTL_MAP_AVL_TREE
     return _avl_tree_greater_equal(&cpmap_first->_t_tree, &cpmap_second->_t_tree);
+#elif defined(CSTL_MAP_BP_TREE)
+    return _bp_tree_greater_equal(&cpmap_first->_t_tree, &cpmap_second->_t_tree);
 #else
     return _rb_tree_greater_equal(&cpmap_first->_t_tree, &cpmap_second->_t_tree);
 #endif
@@ -415,6 +458,8 @@ map_iterator_t map_begin(const map_t* cpmap_map)
 
 #ifdef CSTL_MAP_AVL_TREE
     it_begin = _avl_tree_begin(&cpmap_map->_t_tree);
+#elif defined(CSTL_MAP_BP_TREE)
+    it_begin = _bp_tree_begin(&cpmap_map->_t_tree);
 #else
     it_begin = _rb_tree_begin(&cpmap_map->_t_tree);
 #endif
@@ -438,6 +483,8 @@ map_iterator_t map_end(const map_t* cpmap_map)
 
 #ifdef CSTL_MAP_AVL_TREE
     it_end = _avl_tree_end(&cpmap_map->_t_tree);
+#elif defined(CSTL_MAP_BP_TREE)
+    it_end = _bp_tree_end(&cpmap_map->_t_tree);
 #else
     it_end = _rb_tree_end(&cpmap_map->_t_tree);
 #endif
@@ -458,6 +505,8 @@ map_reverse_iterator_t map_rbegin(const map_t* cpmap_map)
 
 #ifdef CSTL_MAP_AVL_TREE
     it_rbegin = _avl_tree_rbegin(&cpmap_map->_t_tree);
+#elif defined(CSTL_MAP_BP_TREE)
+    it_rbegin = _bp_tree_rbegin(&cpmap_map->_t_tree);
 #else
     it_rbegin = _rb_tree_rbegin(&cpmap_map->_t_tree);
 #endif
@@ -478,6 +527,8 @@ map_reverse_iterator_t map_rend(const map_t* cpmap_map)
 
 #ifdef CSTL_MAP_AVL_TREE
     it_rend = _avl_tree_rend(&cpmap_map->_t_tree);
+#elif defined(CSTL_MAP_BP_TREE)
+    it_rend = _bp_tree_rend(&cpmap_map->_t_tree);
 #else
     it_rend = _rb_tree_rend(&cpmap_map->_t_tree);
 #endif
@@ -510,6 +561,8 @@ map_iterator_t map_insert(map_t* pmap_map, const pair_t* cppair_pair)
     /* insert pair into tree */
 #ifdef CSTL_MAP_AVL_TREE
     it_iter =  _avl_tree_insert_unique(&pmap_map->_t_tree, cppair_pair);
+#elif defined(CSTL_MAP_BP_TREE)
+    it_iter = _bp_tree_insert_unique(&pmap_map->_t_tree, cppair_pair);
 #else
     it_iter = _rb_tree_insert_unique(&pmap_map->_t_tree, cppair_pair);
 #endif
@@ -542,6 +595,8 @@ map_iterator_t map_insert_hint(map_t* pmap_map, map_iterator_t it_hint, const pa
 
 #ifdef CSTL_MAP_AVL_TREE
     it_hint = _avl_tree_insert_unique(&pmap_map->_t_tree, cppair_pair);
+#elif defined(CSTL_MAP_BP_TREE)
+    it_hint = _bp_tree_insert_unique(&pmap_map->_t_tree, cppair_pair);
 #else
     it_hint = _rb_tree_insert_unique(&pmap_map->_t_tree, cppair_pair);
 #endif
@@ -600,6 +655,8 @@ void map_erase_pos(map_t* pmap_map, map_iterator_t it_pos)
 
 #ifdef CSTL_MAP_AVL_TREE
     _avl_tree_erase_pos(&pmap_map->_t_tree, it_pos);
+#elif defined(CSTL_MAP_BP_TREE)
+    _bp_tree_erase_pos(&pmap_map->_t_tree, it_pos);
 #else
     _rb_tree_erase_pos(&pmap_map->_t_tree, it_pos);
 #endif
@@ -620,6 +677,8 @@ void map_erase_range(map_t* pmap_map, map_iterator_t it_begin, map_iterator_t it
 
 #ifdef CSTL_MAP_AVL_TREE
     _avl_tree_erase_range(&pmap_map->_t_tree, it_begin, it_end);
+#elif defined(CSTL_MAP_BP_TREE)
+    _bp_tree_erase_range(&pmap_map->_t_tree, it_begin, it_end);
 #else
     _rb_tree_erase_range(&pmap_map->_t_tree, it_begin, it_end);
 #endif
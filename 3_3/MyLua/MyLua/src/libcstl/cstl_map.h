@@ -252,6 +252,15 @@ extern bool_t map_empty(const map_t* cpmap_map);
  */
 extern size_t map_max_size(const map_t* cpmap_map);
 
+/**
+ * Get the memory that map allocates.
+ * @param cpmap_map      map container.
+ * @return the bytes of map_t and all tree nodes.
+ * @remarks if cpmap_map == NULL, then the behavior is undefined, the cpmap_map must be initialized, otherwise the
+ *          behavior is undefined. the memory owned by elements such as string_t is not counted.
+ */
+extern size_t map_memory_usage(const map_t* cpmap_map);
+
 /**
  * Return an iterator that addresses the first element in the map.
  * @param cpmap_map      map container.
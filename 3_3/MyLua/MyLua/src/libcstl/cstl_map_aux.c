@@ -106,6 +106,9 @@ void _map_value_compare(const void* cpv_first, const void* cpv_second, void* pv_
     *(bool_t*)pv_output = ppair_first->_t_typeinfofirst._pt_type->_t_typesize;
     if (ppair_first->_bfun_mapkeycompare != NULL) {
         ppair_first->_bfun_mapkeycompare(pair_first(ppair_first), pair_first(ppair_second), pv_output);
+    } else if (ppair_first->_t_typeinfofirst._pt_type->_t_typelessfast != NULL) {
+        *(bool_t*)pv_output = ppair_first->_t_typeinfofirst._pt_type->_t_typelessfast(
+            ppair_first->_pv_first, ppair_second->_pv_first);
     } else {
         ppair_first->_t_typeinfofirst._pt_type->_t_typeless(ppair_first->_pv_first, ppair_second->_pv_first, pv_output);
     }
@@ -50,6 +50,8 @@ map_iterator_t create_map_iterator(void)
 
 #ifdef CSTL_MAP_AVL_TREE
     it_iter = _create_avl_tree_iterator();
+#elif defined(CSTL_MAP_BP_TREE)
+    it_iter = _create_bp_tree_iterator();
 #else
     it_iter = _create_rb_tree_iterator();
 #endif
@@ -71,6 +73,8 @@ void _map_iterator_get_value(map_iterator_t it_iter, void* pv_value)
 
 #ifdef CSTL_MAP_AVL_TREE
     _avl_tree_iterator_get_value(it_iter, pv_value);
+#elif defined(CSTL_MAP_BP_TREE)
+    _bp_tree_iterator_get_value(it_iter, pv_value);
 #else
     _rb_tree_iterator_get_value(it_iter, pv_value);
 #endif
@@ -86,6 +90,8 @@ const void* _map_iterator_get_pointer(map_iterator_t it_iter)
 
 #ifdef CSTL_MAP_AVL_TREE
     return _avl_tree_iterator_get_pointer(it_iter);
+#elif defined(CSTL_MAP_BP_TREE)
+    return _bp_tree_iterator_get_pointer(it_iter);
 #else
     return _rb_tree_iterator_get_pointer(it_iter);
 #endif
@@ -101,6 +107,8 @@ const void* _map_iterator_get_pointer_ignore_cstr(map_iterator_t it_iter)
 
 #ifdef CSTL_MAP_AVL_TREE
     return _avl_tree_iterator_get_pointer_ignore_cstr(it_iter);
+#elif defined(CSTL_MAP_BP_TREE)
+    return _bp_tree_iterator_get_pointer_ignore_cstr(it_iter);
 #else
     return _rb_tree_iterator_get_pointer_ignore_cstr(it_iter);
 #endif
@@ -116,6 +124,8 @@ map_iterator_t _map_iterator_next(map_iterator_t it_iter)
 
 #ifdef CSTL_MAP_AVL_TREE
     return _avl_tree_iterator_next(it_iter);
+#elif defined(CSTL_MAP_BP_TREE)
+    return _bp_tree_iterator_next(it_iter);
 #else
     return _rb_tree_iterator_next(it_iter);
 #endif
@@ -131,6 +141,8 @@ map_iterator_t _map_iterator_prev(map_iterator_t it_iter)
 
 #ifdef CSTL_MAP_AVL_TREE
     return _avl_tree_iterator_prev(it_iter);
+#elif defined(CSTL_MAP_BP_TREE)
+    return _bp_tree_iterator_prev(it_iter);
 #else
     return _rb_tree_iterator_prev(it_iter);
 #endif
@@ -148,6 +160,8 @@ bool_t _map_iterator_equal(map_iterator_t it_first, map_iterator_t it_second)
 
 #ifdef CSTL_MAP_AVL_TREE
     return _avl_tree_iterator_equal(it_first, it_second);
+#elif defined(CSTL_MAP_BP_TREE)
+    return _bp_tree_iterator_equal(it_first, it_second);
 #else
     return _rb_tree_iterator_equal(it_first, it_second);
 #endif
@@ -166,6 +180,8 @@ int _map_iterator_distance(map_iterator_t it_first, map_iterator_t it_second)
 
 #ifdef CSTL_MAP_AVL_TREE
     return _avl_tree_iterator_distance(it_first, it_second);
+#elif defined(CSTL_MAP_BP_TREE)
+    return _bp_tree_iterator_distance(it_first, it_second);
 #else
     return _rb_tree_iterator_distance(it_first, it_second);
 #endif
@@ -184,6 +200,8 @@ bool_t _map_iterator_before(map_iterator_t it_first, map_iterator_t it_second)
 
 #ifdef CSTL_MAP_AVL_TREE
     return _avl_tree_iterator_before(it_first, it_second);
+#elif defined(CSTL_MAP_BP_TREE)
+    return _bp_tree_iterator_before(it_first, it_second);
 #else
     return _rb_tree_iterator_before(it_first, it_second);
 #endif
@@ -84,6 +84,8 @@ bool_t _create_map_auxiliary(map_t* pmap_map, const char* s_typename)
 
 #ifdef CSTL_MAP_AVL_TREE
     b_result = _create_avl_tree_auxiliary(&pmap_map->_t_tree, s_typenameex);
+#elif defined(CSTL_MAP_BP_TREE)
+    b_result = _create_bp_tree_auxiliary(&pmap_map->_t_tree, s_typenameex);
 #else
     b_result = _create_rb_tree_auxiliary(&pmap_map->_t_tree, s_typenameex);
 #endif
@@ -104,6 +106,8 @@ void _map_destroy_auxiliary(map_t* pmap_map)
     _pair_destroy_auxiliary(&pmap_map->_pair_temp);
 #ifdef CSTL_MAP_AVL_TREE
     _avl_tree_destroy_auxiliary(&pmap_map->_t_tree);
+#elif defined(CSTL_MAP_BP_TREE)
+    _bp_tree_destroy_auxiliary(&pmap_map->_t_tree);
 #else
     _rb_tree_destroy_auxiliary(&pmap_map->_t_tree);
 #endif
@@ -142,6 +146,8 @@ map_iterator_t _map_find_varg(const map_t* cpmap_map, va_list val_elemlist)
     /* find key in tree */
 #ifdef CSTL_MAP_AVL_TREE
     it_iter = _avl_tree_find(&cpmap_map->_t_tree, &cpmap_map->_pair_temp);
+#elif defined(CSTL_MAP_BP_TREE)
+    it_iter = _bp_tree_find(&cpmap_map->_t_tree, &cpmap_map->_pair_temp);
 #else
     it_iter = _rb_tree_find(&cpmap_map->_t_tree, &cpmap_map->_pair_temp);
 #endif
@@ -179,6 +185,8 @@ size_t _map_count_varg(const map_t* cpmap_map, va_list val_elemlist)
     _type_get_varg_value(&((map_t*)cpmap_map)->_pair_temp._t_typeinfofirst, val_elemlist, cpmap_map->_pair_temp._pv_first);
 #ifdef CSTL_MAP_AVL_TREE
     return _avl_tree_count(&cpmap_map->_t_tree, &cpmap_map->_pair_temp);
+#elif defined(CSTL_MAP_BP_TREE)
+    return _bp_tree_count(&cpmap_map->_t_tree, &cpmap_map->_pair_temp);
 #else
     return _rb_tree_count(&cpmap_map->_t_tree, &cpmap_map->_pair_temp);
 #endif
@@ -212,6 +220,8 @@ map_iterator_t _map_lower_bound_varg(const map_t* cpmap_map, va_list val_elemlis
     _type_get_varg_value(&((map_t*)cpmap_map)->_pair_temp._t_typeinfofirst, val_elemlist, cpmap_map->_pair_temp._pv_first);
 #ifdef CSTL_MAP_AVL_TREE
     it_iter = _avl_tree_lower_bound(&cpmap_map->_t_tree, &cpmap_map->_pair_temp);
+#elif defined(CSTL_MAP_BP_TREE)
+    it_iter = _bp_tree_lower_bound(&cpmap_map->_t_tree, &cpmap_map->_pair_temp);
 #else
     it_iter = _rb_tree_lower_bound(&cpmap_map->_t_tree, &cpmap_map->_pair_temp);
 #endif
@@ -251,6 +261,8 @@ map_iterator_t _map_upper_bound_varg(const map_t* cpmap_map, va_list val_elemlis
     _type_get_varg_value(&((map_t*)cpmap_map)->_pair_temp._t_typeinfofirst, val_elemlist, cpmap_map->_pair_temp._pv_first);
 #ifdef CSTL_MAP_AVL_TREE
     it_iter = _avl_tree_upper_bound(&cpmap_map->_t_tree, &cpmap_map->_pair_temp);
+#elif defined(CSTL_MAP_BP_TREE)
+    it_iter = _bp_tree_upper_bound(&cpmap_map->_t_tree, &cpmap_map->_pair_temp);
 #else
     it_iter = _rb_tree_upper_bound(&cpmap_map->_t_tree, &cpmap_map->_pair_temp);
 #endif
@@ -290,6 +302,8 @@ range_t _map_equal_range_varg(const map_t* cpmap_map, va_list val_elemlist)
     _type_get_varg_value(&((map_t*)cpmap_map)->_pair_temp._t_typeinfofirst, val_elemlist, cpmap_map->_pair_temp._pv_first);
 #ifdef CSTL_MAP_AVL_TREE
     r_range = _avl_tree_equal_range(&cpmap_map->_t_tree, &cpmap_map->_pair_temp);
+#elif defined(CSTL_MAP_BP_TREE)
+    r_range = _bp_tree_equal_range(&cpmap_map->_t_tree, &cpmap_map->_pair_temp);
 #else
     r_range = _rb_tree_equal_range(&cpmap_map->_t_tree, &cpmap_map->_pair_temp);
 #endif
@@ -331,6 +345,8 @@ size_t _map_erase_varg(map_t* pmap_map, va_list val_elemlist)
     _type_get_varg_value(&pmap_map->_pair_temp._t_typeinfofirst, val_elemlist, pmap_map->_pair_temp._pv_first);
 #ifdef CSTL_MAP_AVL_TREE
     return _avl_tree_erase(&pmap_map->_t_tree, &pmap_map->_pair_temp);
+#elif defined(CSTL_MAP_BP_TREE)
+    return _bp_tree_erase(&pmap_map->_t_tree, &pmap_map->_pair_temp);
 #else
     return _rb_tree_erase(&pmap_map->_t_tree, &pmap_map->_pair_temp);
 #endif
@@ -366,6 +382,8 @@ void* _map_at_varg(map_t* pmap_map, va_list val_elemlist)
     _type_get_varg_value(&pmap_map->_pair_temp._t_typeinfofirst, val_elemlist, pmap_map->_pair_temp._pv_first);
 #ifdef CSTL_MAP_AVL_TREE
     it_iter = _avl_tree_insert_unique(&pmap_map->_t_tree, &pmap_map->_pair_temp);
+#elif defined(CSTL_MAP_BP_TREE)
+    it_iter = _bp_tree_insert_unique(&pmap_map->_t_tree, &pmap_map->_pair_temp);
 #else
     it_iter = _rb_tree_insert_unique(&pmap_map->_t_tree, &pmap_map->_pair_temp);
 #endif
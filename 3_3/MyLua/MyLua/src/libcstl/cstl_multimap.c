@@ -54,6 +54,8 @@ void multimap_init(multimap_t* pmmap_map)
     /* initialize the tree */
 #ifdef CSTL_MULTIMAP_AVL_TREE
     _avl_tree_init(&pmmap_map->_t_tree, _multimap_value_compare);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    _bp_tree_init(&pmmap_map->_t_tree, _multimap_value_compare);
 #else
     _rb_tree_init(&pmmap_map->_t_tree, _multimap_value_compare);
 #endif
@@ -73,6 +75,8 @@ void multimap_init_ex(multimap_t* pmmap_map, bfun_t bfun_keycompare)
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     _avl_tree_init(&pmmap_map->_t_tree, _multimap_value_compare);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    _bp_tree_init(&pmmap_map->_t_tree, _multimap_value_compare);
 #else
     _rb_tree_init(&pmmap_map->_t_tree, _multimap_value_compare);
 #endif
@@ -196,6 +200,8 @@ void multimap_swap(multimap_t* pmmap_first, multimap_t* pmmap_second)
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     _avl_tree_swap(&pmmap_first->_t_tree, &pmmap_second->_t_tree);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    _bp_tree_swap(&pmmap_first->_t_tree, &pmmap_second->_t_tree);
 #else
     _rb_tree_swap(&pmmap_first->_t_tree, &pmmap_second->_t_tree);
 #endif
@@ -211,6 +217,8 @@ bool_t multimap_empty(const multimap_t* cpmmap_map)
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     return _avl_tree_empty(&cpmmap_map->_t_tree);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    return _bp_tree_empty(&cpmmap_map->_t_tree);
 #else
     return _rb_tree_empty(&cpmmap_map->_t_tree);
 #endif
@@ -226,6 +234,8 @@ size_t multimap_size(const multimap_t* cpmmap_map)
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     return _avl_tree_size(&cpmmap_map->_t_tree);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    return _bp_tree_size(&cpmmap_map->_t_tree);
 #else
     return _rb_tree_size(&cpmmap_map->_t_tree);
 #endif
@@ -241,11 +251,30 @@ size_t multimap_max_size(const multimap_t* cpmmap_map)
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     return _avl_tree_max_size(&cpmmap_map->_t_tree);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    return _bp_tree_max_size(&cpmmap_map->_t_tree);
 #else
     return _rb_tree_max_size(&cpmmap_map->_t_tree);
 #endif
 }
 
+/**
+ * Get the memory that multimap allocates.
+ */
+size_t multimap_memory_usage(const multimap_t* cpmmap_map)
+{
+    assert(cpmmap_map != NULL);
+    assert(_pair_is_inited(&cpmmap_map->_pair_temp));
+
+#ifdef CSTL_MULTIMAP_AVL_TREE
+    return sizeof(multimap_t) + _avl_tree_memory_usage(&cpmmap_map->_t_tree);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    return sizeof(multimap_t) + _bp_tree_memory_usage(&cpmmap_map->_t_tree);
+#else
+    return sizeof(multimap_t) + _rb_tree_memory_usage(&cpmmap_map->_t_tree);
+#endif
+}
+
 /**
  * Return the compare function of key.
  */
@@ -286,6 +315,8 @@ void multimap_clear(multimap_t* pmmap_map)
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     _avl_tree_clear(&pmmap_map->_t_tree);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    _bp_tree_clear(&pmmap_map->_t_tree);
 #else
     _rb_tree_clear(&pmmap_map->_t_tree);
 #endif
@@ -306,6 +337,8 @@ bool_t multimap_equal(const multimap_t* cpmmap_first, const multimap_t* cpmmap_s
     }
 #ifdef CSTL_MULTIMAP_AVL_TREE
     return _avl_tree_equal(&cpmmap_first->_t_tree, &cpmmap_second->_t_tree);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    return _bp_tree_equal(&cpmmap_first->_t_tree, &cpmmap_second->_t_tree);
 #else
     return _rb_tree_equal(&cpmmap_first->_t_tree, &cpmmap_second->_t_tree);
 #endif
@@ -326,6 +359,8 @@ bool_t multimap_not_equal(const multimap_t* cpmmap_first, const multimap_t* cpmm
     }
 #ifdef CSTL_MULTIMAP_AVL_TREE
     return _avl_tree_not_equal(&cpmmap_first->_t_tree, &cpmmap_second->_t_tree);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    return _bp_tree_not_equal(&cpmmap_first->_t_tree, &cpmmap_second->_t_tree);
 #else
     return _rb_tree_not_equal(&cpmmap_first->_t_tree, &cpmmap_second->_t_tree);
 #endif
@@ -344,6 +379,8 @@ bool_t multimap_less(const multimap_t* cpmmap_first, const multimap_t* cpmmap_se
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     return _avl_tree_less(&cpmmap_first->_t_tree, &cpmmap_second->_t_tree);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    return _bp_tree_less(&cpmmap_first->_t_tree, &cpmmap_second->_t_tree);
 #else
     return _rb_tree_less(&cpmmap_first->_t_tree, &cpmmap_second->_t_tree);
 #endif
@@ -362,6 +399,8 @@ bool_t multimap_less_equal(const multimap_t* cpmmap_first, const multimap_t* cpm
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     return _avl_tree_less_equal(&cpmmap_first->_t_tree, &cpmmap_second->_t_tree);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    return _bp_tree_less_equal(&cpmmap_first->_t_tree, &cpmmap_second->_t_tree);
 #else
     return _rb_tree_less_equal(&cpmmap_first->_t_tree, &cpmmap_second->_t_tree);
 #endif
@@ -380,6 +419,8 @@ bool_t multimap_greater(const multimap_t* cpmmap_first, const multimap_t* cpmmap
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     return _avl_tree_greater(&cpmmap_first->_t_tree, &cpmmap_second->_t_tree);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    return _bp_tree_greater(&cpmmap_first->_t_tree, &cpmmap_second->_t_tree);
 #else
     return _rb_tree_greater(&cpmmap_first->_t_tree, &cpmmap_second->_t_tree);
 #endif
@@ -398,6 +439,8 @@ bool_t multimap_greater_equal(const multimap_t* cpmmap_first, const multimap_t*
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     return _avl_tree_greater_equal(&cpmmap_first->_t_tree, &cpmmap_second->_t_tree);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    return _bp_tree_greater_equal(&cpmmap_first->_t_tree, &cpmmap_second->_t_tree);
 #else
     return _rb_tree_greater_equal(&cpmmap_first->_t_tree, &cpmmap_second->_t_tree);
 #endif
@@ -415,6 +458,8 @@ multimap_iterator_t multimap_begin(const multimap_t* cpmmap_map)
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     it_iter = _avl_tree_begin(&cpmmap_map->_t_tree);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    it_iter = _bp_tree_begin(&cpmmap_map->_t_tree);
 #else
     it_iter = _rb_tree_begin(&cpmmap_map->_t_tree);
 #endif
@@ -438,6 +483,8 @@ multimap_iterator_t multimap_end(const multimap_t* cpmmap_map)
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     it_iter = _avl_tree_end(&cpmmap_map->_t_tree);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    it_iter = _bp_tree_end(&cpmmap_map->_t_tree);
 #else
     it_iter = _rb_tree_end(&cpmmap_map->_t_tree);
 #endif
@@ -458,6 +505,8 @@ multimap_reverse_iterator_t multimap_rbegin(const multimap_t* cpmmap_map)
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     it_iter = _avl_tree_rbegin(&cpmmap_map->_t_tree);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    it_iter = _bp_tree_rbegin(&cpmmap_map->_t_tree);
 #else
     it_iter = _rb_tree_rbegin(&cpmmap_map->_t_tree);
 #endif
@@ -478,6 +527,8 @@ multimap_reverse_iterator_t multimap_rend(const multimap_t* cpmmap_map)
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     it_iter = _avl_tree_rend(&cpmmap_map->_t_tree);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    it_iter = _bp_tree_rend(&cpmmap_map->_t_tree);
 #else
     it_iter = _rb_tree_rend(&cpmmap_map->_t_tree);
 #endif
@@ -508,6 +559,8 @@ multimap_iterator_t multimap_insert(multimap_t* pmmap_map, const pair_t* cppair_
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     it_iter = _avl_tree_insert_equal(&pmmap_map->_t_tree, cppair_pair);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    it_iter = _bp_tree_insert_equal(&pmmap_map->_t_tree, cppair_pair);
 #else
     it_iter = _rb_tree_insert_equal(&pmmap_map->_t_tree, cppair_pair);
 #endif
@@ -539,6 +592,8 @@ multimap_iterator_t multimap_insert_hint(multimap_t* pmmap_map, multimap_iterato
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     it_hint = _avl_tree_insert_equal(&pmmap_map->_t_tree, cppair_pair);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    it_hint = _bp_tree_insert_equal(&pmmap_map->_t_tree, cppair_pair);
 #else
     it_hint = _rb_tree_insert_equal(&pmmap_map->_t_tree, cppair_pair);
 #endif
@@ -597,6 +652,8 @@ void multimap_erase_pos(multimap_t* pmmap_map, multimap_iterator_t it_pos)
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     _avl_tree_erase_pos(&pmmap_map->_t_tree, it_pos);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    _bp_tree_erase_pos(&pmmap_map->_t_tree, it_pos);
 #else
     _rb_tree_erase_pos(&pmmap_map->_t_tree, it_pos);
 #endif
@@ -617,6 +674,8 @@ void multimap_erase_range(multimap_t* pmmap_map, multimap_iterator_t it_begin, m
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     _avl_tree_erase_range(&pmmap_map->_t_tree, it_begin, it_end);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    _bp_tree_erase_range(&pmmap_map->_t_tree, it_begin, it_end);
 #else
     _rb_tree_erase_range(&pmmap_map->_t_tree, it_begin, it_end);
 #endif
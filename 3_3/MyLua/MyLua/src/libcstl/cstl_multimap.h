@@ -242,6 +242,15 @@ extern bool_t multimap_empty(const multimap_t* cpmmap_map);
  */
 extern size_t multimap_max_size(const multimap_t* cpmmap_map);
 
+/**
+ * Get the memory that multimap allocates.
+ * @param cpmmap_map     multimap container.
+ * @return the bytes of multimap_t and all tree nodes.
+ * @remarks if cpmmap_map == NULL, then the behavior is undefined, the cpmmap_map must be initialized, otherwise the
+ *          behavior is undefined. the memory owned by elements such as string_t is not counted.
+ */
+extern size_t multimap_memory_usage(const multimap_t* cpmmap_map);
+
 /**
  * Return the compare function of key.
  * @param cpmap_map      multimap container.
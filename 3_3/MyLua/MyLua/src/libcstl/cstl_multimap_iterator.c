@@ -50,6 +50,8 @@ multimap_iterator_t create_multimap_iterator(void)
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     it_iter = _create_avl_tree_iterator();
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    it_iter = _create_bp_tree_iterator();
 #else
     it_iter = _create_rb_tree_iterator();
 #endif
@@ -71,6 +73,8 @@ void _multimap_iterator_get_value(multimap_iterator_t it_iter, void* pv_value)
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     _avl_tree_iterator_get_value(it_iter, pv_value);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    _bp_tree_iterator_get_value(it_iter, pv_value);
 #else
     _rb_tree_iterator_get_value(it_iter, pv_value);
 #endif
@@ -86,6 +90,8 @@ const void* _multimap_iterator_get_pointer(multimap_iterator_t it_iter)
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     return _avl_tree_iterator_get_pointer(it_iter);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    return _bp_tree_iterator_get_pointer(it_iter);
 #else
     return _rb_tree_iterator_get_pointer(it_iter);
 #endif
@@ -101,6 +107,8 @@ const void* _multimap_iterator_get_pointer_ignore_cstr(multimap_iterator_t it_it
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     return _avl_tree_iterator_get_pointer_ignore_cstr(it_iter);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    return _bp_tree_iterator_get_pointer_ignore_cstr(it_iter);
 #else
     return _rb_tree_iterator_get_pointer_ignore_cstr(it_iter);
 #endif
@@ -116,6 +124,8 @@ multimap_iterator_t _multimap_iterator_next(multimap_iterator_t it_iter)
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     return _avl_tree_iterator_next(it_iter);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    return _bp_tree_iterator_next(it_iter);
 #else
     return _rb_tree_iterator_next(it_iter);
 #endif
@@ -131,6 +141,8 @@ multimap_iterator_t _multimap_iterator_prev(multimap_iterator_t it_iter)
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     return _avl_tree_iterator_prev(it_iter);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    return _bp_tree_iterator_prev(it_iter);
 #else
     return _rb_tree_iterator_prev(it_iter);
 #endif
@@ -148,6 +160,8 @@ bool_t _multimap_iterator_equal(multimap_iterator_t it_first, multimap_iterator_
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     return _avl_tree_iterator_equal(it_first, it_second);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    return _bp_tree_iterator_equal(it_first, it_second);
 #else
     return _rb_tree_iterator_equal(it_first, it_second);
 #endif
@@ -166,6 +180,8 @@ int _multimap_iterator_distance(multimap_iterator_t it_first, multimap_iterator_
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     return _avl_tree_iterator_distance(it_first, it_second);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    return _bp_tree_iterator_distance(it_first, it_second);
 #else
     return _rb_tree_iterator_distance(it_first, it_second);
 #endif
@@ -184,6 +200,8 @@ bool_t _multimap_iterator_before(multimap_iterator_t it_first, multimap_iterator
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     return _avl_tree_iterator_before(it_first, it_second);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    return _bp_tree_iterator_before(it_first, it_second);
 #else
     return _rb_tree_iterator_before(it_first, it_second);
 #endif
@@ -84,6 +84,8 @@ bool_t _create_multimap_auxiliary(multimap_t* pmmap_map, const char* s_typename)
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     b_result = _create_avl_tree_auxiliary(&pmmap_map->_t_tree, s_typenameex);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    b_result = _create_bp_tree_auxiliary(&pmmap_map->_t_tree, s_typenameex);
 #else
     b_result = _create_rb_tree_auxiliary(&pmmap_map->_t_tree, s_typenameex);
 #endif
@@ -104,6 +106,8 @@ void _multimap_destroy_auxiliary(multimap_t* pmmap_map)
     _pair_destroy_auxiliary(&pmmap_map->_pair_temp);
 #ifdef CSTL_MULTIMAP_AVL_TREE
     _avl_tree_destroy_auxiliary(&pmmap_map->_t_tree);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    _bp_tree_destroy_auxiliary(&pmmap_map->_t_tree);
 #else
     _rb_tree_destroy_auxiliary(&pmmap_map->_t_tree);
 #endif
@@ -142,6 +146,8 @@ multimap_iterator_t _multimap_find_varg(const multimap_t* cpmmap_map, va_list va
     /* find key in tree */
 #ifdef CSTL_MULTIMAP_AVL_TREE
     it_iter = _avl_tree_find(&cpmmap_map->_t_tree, &cpmmap_map->_pair_temp);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    it_iter = _bp_tree_find(&cpmmap_map->_t_tree, &cpmmap_map->_pair_temp);
 #else
     it_iter = _rb_tree_find(&cpmmap_map->_t_tree, &cpmmap_map->_pair_temp);
 #endif
@@ -179,6 +185,8 @@ size_t _multimap_count_varg(const multimap_t* cpmmap_map, va_list val_elemlist)
     _type_get_varg_value(&((multimap_t*)cpmmap_map)->_pair_temp._t_typeinfofirst, val_elemlist, cpmmap_map->_pair_temp._pv_first);
 #ifdef CSTL_MULTIMAP_AVL_TREE
     return _avl_tree_count(&cpmmap_map->_t_tree, &cpmmap_map->_pair_temp);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    return _bp_tree_count(&cpmmap_map->_t_tree, &cpmmap_map->_pair_temp);
 #else
     return _rb_tree_count(&cpmmap_map->_t_tree, &cpmmap_map->_pair_temp);
 #endif
@@ -212,6 +220,8 @@ multimap_iterator_t _multimap_lower_bound_varg(const multimap_t* cpmmap_map, va_
     _type_get_varg_value(&((multimap_t*)cpmmap_map)->_pair_temp._t_typeinfofirst, val_elemlist, cpmmap_map->_pair_temp._pv_first);
 #ifdef CSTL_MULTIMAP_AVL_TREE
     it_iter = _avl_tree_lower_bound(&cpmmap_map->_t_tree, &cpmmap_map->_pair_temp);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    it_iter = _bp_tree_lower_bound(&cpmmap_map->_t_tree, &cpmmap_map->_pair_temp);
 #else
     it_iter = _rb_tree_lower_bound(&cpmmap_map->_t_tree, &cpmmap_map->_pair_temp);
 #endif
@@ -251,6 +261,8 @@ multimap_iterator_t _multimap_upper_bound_varg(const multimap_t* cpmmap_map, va_
     _type_get_varg_value(&((multimap_t*)cpmmap_map)->_pair_temp._t_typeinfofirst, val_elemlist, cpmmap_map->_pair_temp._pv_first);
 #ifdef CSTL_MULTIMAP_AVL_TREE
     it_iter = _avl_tree_upper_bound(&cpmmap_map->_t_tree, &cpmmap_map->_pair_temp);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    it_iter = _bp_tree_upper_bound(&cpmmap_map->_t_tree, &cpmmap_map->_pair_temp);
 #else
     it_iter = _rb_tree_upper_bound(&cpmmap_map->_t_tree, &cpmmap_map->_pair_temp);
 #endif
@@ -290,6 +302,8 @@ range_t _multimap_equal_range_varg(const multimap_t* cpmmap_map, va_list val_ele
     _type_get_varg_value(&((multimap_t*)cpmmap_map)->_pair_temp._t_typeinfofirst, val_elemlist, cpmmap_map->_pair_temp._pv_first);
 #ifdef CSTL_MULTIMAP_AVL_TREE
     r_range = _avl_tree_equal_range(&cpmmap_map->_t_tree, &cpmmap_map->_pair_temp);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    r_range = _bp_tree_equal_range(&cpmmap_map->_t_tree, &cpmmap_map->_pair_temp);
 #else
     r_range = _rb_tree_equal_range(&cpmmap_map->_t_tree, &cpmmap_map->_pair_temp);
 #endif
@@ -331,6 +345,8 @@ size_t _multimap_erase_varg(multimap_t* pmmap_map, va_list val_elemlist)
     _type_get_varg_value(&pmmap_map->_pair_temp._t_typeinfofirst, val_elemlist, pmmap_map->_pair_temp._pv_first);
 #ifdef CSTL_MULTIMAP_AVL_TREE
     return _avl_tree_erase(&pmmap_map->_t_tree, &pmmap_map->_pair_temp);
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    return _bp_tree_erase(&pmmap_map->_t_tree, &pmmap_map->_pair_temp);
 #else
     return _rb_tree_erase(&pmmap_map->_t_tree, &pmmap_map->_pair_temp);
 #endif
@@ -32,7 +32,7 @@ extern "C" {
 /** constant declaration and macro section **/
 
 /** data type declaration and struct, union, enum section **/
-/* the multimap use rb tree default */
+/* the multimap use rb tree default, CSTL_MULTIMAP_AVL_TREE or CSTL_MULTIMAP_BP_TREE selects the other backends */
 typedef struct _tagmultimap
 {
     pair_t            _pair_temp;
@@ -41,6 +41,8 @@ typedef struct _tagmultimap
 
 #ifdef CSTL_MULTIMAP_AVL_TREE
     _avl_tree_t       _t_tree;
+#elif defined(CSTL_MULTIMAP_BP_TREE)
+    _bp_tree_t        _t_tree;
 #else
     _rb_tree_t        _t_tree;
 #endif
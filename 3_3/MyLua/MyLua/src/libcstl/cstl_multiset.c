@@ -49,6 +49,8 @@ void multiset_init(multiset_t* pmset_mset)
 
 #ifdef CSTL_MULTISET_AVL_TREE
     _avl_tree_init(&pmset_mset->_t_tree, NULL);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    _bp_tree_init(&pmset_mset->_t_tree, NULL);
 #else
     _rb_tree_init(&pmset_mset->_t_tree, NULL);
 #endif
@@ -63,6 +65,8 @@ void multiset_init_ex(multiset_t* pmset_mset, bfun_t bfun_compare)
 
 #ifdef CSTL_MULTISET_AVL_TREE
     _avl_tree_init(&pmset_mset->_t_tree, bfun_compare);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    _bp_tree_init(&pmset_mset->_t_tree, bfun_compare);
 #else
     _rb_tree_init(&pmset_mset->_t_tree, bfun_compare);
 #endif
@@ -77,6 +81,8 @@ void multiset_destroy(multiset_t* pmset_mset)
 
 #ifdef CSTL_MULTISET_AVL_TREE
     _avl_tree_destroy(&pmset_mset->_t_tree);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    _bp_tree_destroy(&pmset_mset->_t_tree);
 #else
     _rb_tree_destroy(&pmset_mset->_t_tree);
 #endif
@@ -92,6 +98,8 @@ void multiset_init_copy(multiset_t* pmset_dest, const multiset_t* cpmset_src)
 
 #ifdef CSTL_MULTISET_AVL_TREE
     _avl_tree_init_copy(&pmset_dest->_t_tree, &cpmset_src->_t_tree);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    _bp_tree_init_copy(&pmset_dest->_t_tree, &cpmset_src->_t_tree);
 #else
     _rb_tree_init_copy(&pmset_dest->_t_tree, &cpmset_src->_t_tree);
 #endif
@@ -107,6 +115,8 @@ void multiset_init_copy_range(multiset_t* pmset_dest, iterator_t it_begin, itera
 
 #ifdef CSTL_MULTISET_AVL_TREE
     _avl_tree_init_copy_equal_range(&pmset_dest->_t_tree, it_begin, it_end);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    _bp_tree_init_copy_equal_range(&pmset_dest->_t_tree, it_begin, it_end);
 #else
     _rb_tree_init_copy_equal_range(&pmset_dest->_t_tree, it_begin, it_end);
 #endif
@@ -122,6 +132,8 @@ void multiset_init_copy_array(multiset_t* pmset_dest, const void* cpv_array, siz
 
 #ifdef CSTL_MULTISET_AVL_TREE
     _avl_tree_init_copy_equal_array(&pmset_dest->_t_tree, cpv_array, t_count);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    _bp_tree_init_copy_equal_array(&pmset_dest->_t_tree, cpv_array, t_count);
 #else
     _rb_tree_init_copy_equal_array(&pmset_dest->_t_tree, cpv_array, t_count);
 #endif
@@ -138,6 +150,8 @@ void multiset_init_copy_range_ex(
 
 #ifdef CSTL_MULTISET_AVL_TREE
     _avl_tree_init_copy_equal_range_ex(&pmset_dest->_t_tree, it_begin, it_end, bfun_compare);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    _bp_tree_init_copy_equal_range_ex(&pmset_dest->_t_tree, it_begin, it_end, bfun_compare);
 #else
     _rb_tree_init_copy_equal_range_ex(&pmset_dest->_t_tree, it_begin, it_end, bfun_compare);
 #endif
@@ -154,6 +168,8 @@ void multiset_init_copy_array_ex(
 
 #ifdef CSTL_MULTISET_AVL_TREE
     _avl_tree_init_copy_equal_array_ex(&pmset_dest->_t_tree, cpv_array, t_count, bfun_compare);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    _bp_tree_init_copy_equal_array_ex(&pmset_dest->_t_tree, cpv_array, t_count, bfun_compare);
 #else
     _rb_tree_init_copy_equal_array_ex(&pmset_dest->_t_tree, cpv_array, t_count, bfun_compare);
 #endif
@@ -169,6 +185,8 @@ void multiset_assign(multiset_t* pmset_dest, const multiset_t* cpmset_src)
 
 #ifdef CSTL_MULTISET_AVL_TREE
     _avl_tree_assign(&pmset_dest->_t_tree, &cpmset_src->_t_tree);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    _bp_tree_assign(&pmset_dest->_t_tree, &cpmset_src->_t_tree);
 #else
     _rb_tree_assign(&pmset_dest->_t_tree, &cpmset_src->_t_tree);
 #endif
@@ -183,6 +201,8 @@ bool_t multiset_empty(const multiset_t* cpmset_mset)
 
 #ifdef CSTL_MULTISET_AVL_TREE
     return _avl_tree_empty(&cpmset_mset->_t_tree);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    return _bp_tree_empty(&cpmset_mset->_t_tree);
 #else
     return _rb_tree_empty(&cpmset_mset->_t_tree);
 #endif
@@ -197,6 +217,8 @@ size_t multiset_size(const multiset_t* cpmset_mset)
 
 #ifdef CSTL_MULTISET_AVL_TREE
     return _avl_tree_size(&cpmset_mset->_t_tree);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    return _bp_tree_size(&cpmset_mset->_t_tree);
 #else
     return _rb_tree_size(&cpmset_mset->_t_tree);
 #endif
@@ -211,11 +233,29 @@ size_t multiset_max_size(const multiset_t* cpmset_mset)
 
 #ifdef CSTL_MULTISET_AVL_TREE
     return _avl_tree_max_size(&cpmset_mset->_t_tree);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    return _bp_tree_max_size(&cpmset_mset->_t_tree);
 #else
     return _rb_tree_max_size(&cpmset_mset->_t_tree);
 #endif
 }
 
+/**
+ * Get the memory that multiset allocates.
+ */
+size_t multiset_memory_usage(const multiset_t* cpmset_mset)
+{
+    assert(cpmset_mset != NULL);
+
+#ifdef CSTL_MULTISET_AVL_TREE
+    return sizeof(multiset_t) + _avl_tree_memory_usage(&cpmset_mset->_t_tree);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    return sizeof(multiset_t) + _bp_tree_memory_usage(&cpmset_mset->_t_tree);
+#else
+    return sizeof(multiset_t) + _rb_tree_memory_usage(&cpmset_mset->_t_tree);
+#endif
+}
+
 /**
  * Return an iterator that addresses the first element in the multiset.
  */
@@ -227,6 +267,8 @@ multiset_iterator_t multiset_begin(const multiset_t* cpmset_mset)
 
 #ifdef CSTL_MULTISET_AVL_TREE
     it_begin = _avl_tree_begin(&cpmset_mset->_t_tree);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    it_begin = _bp_tree_begin(&cpmset_mset->_t_tree);
 #else
     it_begin = _rb_tree_begin(&cpmset_mset->_t_tree);
 #endif
@@ -249,6 +291,8 @@ multiset_iterator_t multiset_end(const multiset_t* cpmset_mset)
 
 #ifdef CSTL_MULTISET_AVL_TREE
     it_end = _avl_tree_end(&cpmset_mset->_t_tree);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    it_end = _bp_tree_end(&cpmset_mset->_t_tree);
 #else
     it_end = _rb_tree_end(&cpmset_mset->_t_tree);
 #endif
@@ -268,6 +312,8 @@ multiset_iterator_t multiset_rbegin(const multiset_t* cpmset_mset)
 
 #ifdef CSTL_MULTISET_AVL_TREE
     it_rbegin = _avl_tree_rbegin(&cpmset_mset->_t_tree);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    it_rbegin = _bp_tree_rbegin(&cpmset_mset->_t_tree);
 #else
     it_rbegin = _rb_tree_rbegin(&cpmset_mset->_t_tree);
 #endif
@@ -287,6 +333,8 @@ multiset_iterator_t multiset_rend(const multiset_t* cpmset_mset)
 
 #ifdef CSTL_MULTISET_AVL_TREE
     it_rend = _avl_tree_rend(&cpmset_mset->_t_tree);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    it_rend = _bp_tree_rend(&cpmset_mset->_t_tree);
 #else
     it_rend = _rb_tree_rend(&cpmset_mset->_t_tree);
 #endif
@@ -307,6 +355,8 @@ bfun_t multiset_key_comp(const multiset_t* cpmset_mset)
 
 #ifdef CSTL_MULTISET_AVL_TREE
     return _avl_tree_key_comp(&cpmset_mset->_t_tree);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    return _bp_tree_key_comp(&cpmset_mset->_t_tree);
 #else
     return _rb_tree_key_comp(&cpmset_mset->_t_tree);
 #endif
@@ -329,6 +379,8 @@ void multiset_clear(multiset_t* pmset_mset)
 
 #ifdef CSTL_MULTISET_AVL_TREE
     _avl_tree_clear(&pmset_mset->_t_tree);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    _bp_tree_clear(&pmset_mset->_t_tree);
 #else
     _rb_tree_clear(&pmset_mset->_t_tree);
 #endif
@@ -344,6 +396,8 @@ bool_t multiset_equal(const multiset_t* cpmset_first, const multiset_t* cpmset_s
 
 #ifdef CSTL_MULTISET_AVL_TREE
     return _avl_tree_equal(&cpmset_first->_t_tree, &cpmset_second->_t_tree);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    return _bp_tree_equal(&cpmset_first->_t_tree, &cpmset_second->_t_tree);
 #else
     return _rb_tree_equal(&cpmset_first->_t_tree, &cpmset_second->_t_tree);
 #endif
@@ -359,6 +413,8 @@ bool_t multiset_not_equal(const multiset_t* cpmset_first, const multiset_t* cpms
 
 #ifdef CSTL_MULTISET_AVL_TREE
     return _avl_tree_not_equal(&cpmset_first->_t_tree, &cpmset_second->_t_tree);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    return _bp_tree_not_equal(&cpmset_first->_t_tree, &cpmset_second->_t_tree);
 #else
     return _rb_tree_not_equal(&cpmset_first->_t_tree, &cpmset_second->_t_tree);
 #endif
@@ -374,6 +430,8 @@ bool_t multiset_less(const multiset_t* cpmset_first, const multiset_t* cpmset_se
 
 #ifdef CSTL_MULTISET_AVL_TREE
     return _avl_tree_less(&cpmset_first->_t_tree, &cpmset_second->_t_tree);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    return _bp_tree_less(&cpmset_first->_t_tree, &cpmset_second->_t_tree);
 #else
     return _rb_tree_less(&cpmset_first->_t_tree, &cpmset_second->_t_tree);
 #endif
@@ -389,6 +447,8 @@ bool_t multiset_less_equal(const multiset_t* cpmset_first, const multiset_t* cpm
 
 #ifdef CSTL_MULTISET_AVL_TREE
     return _avl_tree_less_equal(&cpmset_first->_t_tree, &cpmset_second->_t_tree);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    return _bp_tree_less_equal(&cpmset_first->_t_tree, &cpmset_second->_t_tree);
 #else
     return _rb_tree_less_equal(&cpmset_first->_t_tree, &cpmset_second->_t_tree);
 #endif
@@ -404,6 +464,8 @@ bool_t multiset_greater(const multiset_t* cpmset_first, const multiset_t* cpmset
 
 #ifdef CSTL_MULTISET_AVL_TREE
     return _avl_tree_greater(&cpmset_first->_t_tree, &cpmset_second->_t_tree);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    return _bp_tree_greater(&cpmset_first->_t_tree, &cpmset_second->_t_tree);
 #else
     return _rb_tree_greater(&cpmset_first->_t_tree, &cpmset_second->_t_tree);
 #endif
@@ -419,6 +481,8 @@ bool_t multiset_greater_equal(const multiset_t* cpmset_first, const multiset_t*
 
 #ifdef CSTL_MULTISET_AVL_TREE
     return _avl_tree_greater_equal(&cpmset_first->_t_tree, &cpmset_second->_t_tree);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    return _bp_tree_greater_equal(&cpmset_first->_t_tree, &cpmset_second->_t_tree);
 #else
     return _rb_tree_greater_equal(&cpmset_first->_t_tree, &cpmset_second->_t_tree);
 #endif
@@ -434,6 +498,8 @@ void multiset_swap(multiset_t* pmset_first, multiset_t* pmset_second)
 
 #ifdef CSTL_MULTISET_AVL_TREE
     _avl_tree_swap(&pmset_first->_t_tree, &pmset_second->_t_tree);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    _bp_tree_swap(&pmset_first->_t_tree, &pmset_second->_t_tree);
 #else
     _rb_tree_swap(&pmset_first->_t_tree, &pmset_second->_t_tree);
 #endif
@@ -449,6 +515,8 @@ void multiset_insert_range(multiset_t* pmset_mset, iterator_t it_begin, iterator
 
 #ifdef CSTL_MULTISET_AVL_TREE
     _avl_tree_insert_equal_range(&pmset_mset->_t_tree, it_begin, it_end);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    _bp_tree_insert_equal_range(&pmset_mset->_t_tree, it_begin, it_end);
 #else
     _rb_tree_insert_equal_range(&pmset_mset->_t_tree, it_begin, it_end);
 #endif
@@ -464,6 +532,8 @@ void multiset_insert_array(multiset_t* pmset_mset, const void* cpv_array, size_t
 
 #ifdef CSTL_MULTISET_AVL_TREE
     _avl_tree_insert_equal_array(&pmset_mset->_t_tree, cpv_array, t_count);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    _bp_tree_insert_equal_array(&pmset_mset->_t_tree, cpv_array, t_count);
 #else
     _rb_tree_insert_equal_array(&pmset_mset->_t_tree, cpv_array, t_count);
 #endif
@@ -481,6 +551,8 @@ void multiset_erase_pos(multiset_t* pmset_mset, multiset_iterator_t it_pos)
 
 #ifdef CSTL_MULTISET_AVL_TREE
     _avl_tree_erase_pos(&pmset_mset->_t_tree, it_pos);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    _bp_tree_erase_pos(&pmset_mset->_t_tree, it_pos);
 #else
     _rb_tree_erase_pos(&pmset_mset->_t_tree, it_pos);
 #endif
@@ -501,6 +573,8 @@ void multiset_erase_range(multiset_t* pmset_mset, multiset_iterator_t it_begin,
 
 #ifdef CSTL_MULTISET_AVL_TREE
     _avl_tree_erase_range(&pmset_mset->_t_tree, it_begin, it_end);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    _bp_tree_erase_range(&pmset_mset->_t_tree, it_begin, it_end);
 #else
     _rb_tree_erase_range(&pmset_mset->_t_tree, it_begin, it_end);
 #endif
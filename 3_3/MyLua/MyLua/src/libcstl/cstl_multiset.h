@@ -251,6 +251,15 @@ extern bool_t multiset_empty(const multiset_t* cpmset_mset);
  */
 extern size_t multiset_max_size(const multiset_t* cpmset_mset);
 
+/**
+ * Get the memory that multiset allocates.
+ * @param cpmset_mset    multiset container.
+ * @return the bytes of multiset_t and all tree nodes.
+ * @remarks if cpmset_mset == NULL, then the behavior is undefined, the cpmset_mset must be initialized, otherwise the
+ *          behavior is undefined. the memory owned by elements such as string_t is not counted.
+ */
+extern size_t multiset_memory_usage(const multiset_t* cpmset_mset);
+
 /**
  * Return an iterator that addresses the first element in the multiset.
  * @param cpmset_mset      multiset container.
@@ -49,6 +49,8 @@ multiset_iterator_t create_multiset_iterator(void)
 
 #ifdef CSTL_MULTISET_AVL_TREE
     it_iter = _create_avl_tree_iterator();
+#elif defined(CSTL_MULTISET_BP_TREE)
+    it_iter = _create_bp_tree_iterator();
 #else
     it_iter = _create_rb_tree_iterator();
 #endif
@@ -70,6 +72,8 @@ void _multiset_iterator_get_value(multiset_iterator_t it_iter, void* pv_value)
 
 #ifdef CSTL_MULTISET_AVL_TREE
     _avl_tree_iterator_get_value(it_iter, pv_value);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    _bp_tree_iterator_get_value(it_iter, pv_value);
 #else
     _rb_tree_iterator_get_value(it_iter, pv_value);
 #endif
@@ -85,6 +89,8 @@ const void* _multiset_iterator_get_pointer(multiset_iterator_t it_iter)
 
 #ifdef CSTL_MULTISET_AVL_TREE
     return _avl_tree_iterator_get_pointer(it_iter);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    return _bp_tree_iterator_get_pointer(it_iter);
 #else
     return _rb_tree_iterator_get_pointer(it_iter);
 #endif
@@ -100,6 +106,8 @@ const void* _multiset_iterator_get_pointer_ignore_cstr(multiset_iterator_t it_it
 
 #ifdef CSTL_MULTISET_AVL_TREE
     return _avl_tree_iterator_get_pointer_ignore_cstr(it_iter);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    return _bp_tree_iterator_get_pointer_ignore_cstr(it_iter);
 #else
     return _rb_tree_iterator_get_pointer_ignore_cstr(it_iter);
 #endif
@@ -115,6 +123,8 @@ multiset_iterator_t _multiset_iterator_next(multiset_iterator_t it_iter)
 
 #ifdef CSTL_MULTISET_AVL_TREE
     return _avl_tree_iterator_next(it_iter);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    return _bp_tree_iterator_next(it_iter);
 #else
     return _rb_tree_iterator_next(it_iter);
 #endif
@@ -130,6 +140,8 @@ multiset_iterator_t _multiset_iterator_prev(multiset_iterator_t it_iter)
 
 #ifdef CSTL_MULTISET_AVL_TREE
     return _avl_tree_iterator_prev(it_iter);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    return _bp_tree_iterator_prev(it_iter);
 #else
     return _rb_tree_iterator_prev(it_iter);
 #endif
@@ -147,6 +159,8 @@ bool_t _multiset_iterator_equal(multiset_iterator_t it_first, multiset_iterator_
 
 #ifdef CSTL_MULTISET_AVL_TREE
     return _avl_tree_iterator_equal(it_first, it_second);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    return _bp_tree_iterator_equal(it_first, it_second);
 #else
     return _rb_tree_iterator_equal(it_first, it_second);
 #endif
@@ -165,6 +179,8 @@ int _multiset_iterator_distance(multiset_iterator_t it_first, multiset_iterator_
 
 #ifdef CSTL_MULTISET_AVL_TREE
     return _avl_tree_iterator_distance(it_first, it_second);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    return _bp_tree_iterator_distance(it_first, it_second);
 #else
     return _rb_tree_iterator_distance(it_first, it_second);
 #endif
@@ -183,6 +199,8 @@ bool_t _multiset_iterator_before(multiset_iterator_t it_first, multiset_iterator
 
 #ifdef CSTL_MULTISET_AVL_TREE
     return _avl_tree_iterator_before(it_first, it_second);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    return _bp_tree_iterator_before(it_first, it_second);
 #else
     return _rb_tree_iterator_before(it_first, it_second);
 #endif
@@ -47,6 +47,8 @@ multiset_t* _create_multiset(const char* s_typename)
 {
 #ifdef CSTL_MULTISET_AVL_TREE
     return (multiset_t*)_create_avl_tree(s_typename);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    return (multiset_t*)_create_bp_tree(s_typename);
 #else
     return (multiset_t*)_create_rb_tree(s_typename);
 #endif
@@ -62,6 +64,8 @@ bool_t _create_multiset_auxiliary(multiset_t* pmset_mset, const char* s_typename
 
 #ifdef CSTL_MULTISET_AVL_TREE
     return _create_avl_tree_auxiliary(&pmset_mset->_t_tree, s_typename);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    return _create_bp_tree_auxiliary(&pmset_mset->_t_tree, s_typename);
 #else
     return _create_rb_tree_auxiliary(&pmset_mset->_t_tree, s_typename);
 #endif
@@ -76,6 +80,8 @@ void _multiset_destroy_auxiliary(multiset_t* pmset_mset)
 
 #ifdef CSTL_MULTISET_AVL_TREE
     _avl_tree_destroy_auxiliary(&pmset_mset->_t_tree);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    _bp_tree_destroy_auxiliary(&pmset_mset->_t_tree);
 #else
     _rb_tree_destroy_auxiliary(&pmset_mset->_t_tree);
 #endif
@@ -112,6 +118,8 @@ multiset_iterator_t _multiset_find_varg(const multiset_t* cpmset_mset, va_list v
 
 #ifdef CSTL_MULTISET_AVL_TREE
     it_iter = _avl_tree_find(&cpmset_mset->_t_tree, pv_varg);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    it_iter = _bp_tree_find(&cpmset_mset->_t_tree, pv_varg);
 #else
     it_iter = _rb_tree_find(&cpmset_mset->_t_tree, pv_varg);
 #endif
@@ -157,6 +165,8 @@ size_t _multiset_count_varg(const multiset_t* cpmset_mset, va_list val_elemlist)
 
 #ifdef CSTL_MULTISET_AVL_TREE
     t_count = _avl_tree_count(&cpmset_mset->_t_tree, pv_varg);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    t_count = _bp_tree_count(&cpmset_mset->_t_tree, pv_varg);
 #else
     t_count = _rb_tree_count(&cpmset_mset->_t_tree, pv_varg);
 #endif
@@ -198,6 +208,8 @@ multiset_iterator_t _multiset_lower_bound_varg(const multiset_t* cpmset_mset, va
 
 #ifdef CSTL_MULTISET_AVL_TREE
     it_iter = _avl_tree_lower_bound(&cpmset_mset->_t_tree, pv_varg);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    it_iter = _bp_tree_lower_bound(&cpmset_mset->_t_tree, pv_varg);
 #else
     it_iter = _rb_tree_lower_bound(&cpmset_mset->_t_tree, pv_varg);
 #endif
@@ -243,6 +255,8 @@ multiset_iterator_t _multiset_upper_bound_varg(const multiset_t* cpmset_mset, va
 
 #ifdef CSTL_MULTISET_AVL_TREE
     it_iter = _avl_tree_upper_bound(&cpmset_mset->_t_tree, pv_varg);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    it_iter = _bp_tree_upper_bound(&cpmset_mset->_t_tree, pv_varg);
 #else
     it_iter = _rb_tree_upper_bound(&cpmset_mset->_t_tree, pv_varg);
 #endif
@@ -288,6 +302,8 @@ range_t _multiset_equal_range_varg(const multiset_t* cpmset_mset, va_list val_el
 
 #ifdef CSTL_MULTISET_AVL_TREE
     r_range = _avl_tree_equal_range(&cpmset_mset->_t_tree, pv_varg);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    r_range = _bp_tree_equal_range(&cpmset_mset->_t_tree, pv_varg);
 #else
     r_range = _rb_tree_equal_range(&cpmset_mset->_t_tree, pv_varg);
 #endif
@@ -337,6 +353,8 @@ multiset_iterator_t _multiset_insert_varg(multiset_t* pmset_mset, va_list val_el
 
 #ifdef CSTL_MULTISET_AVL_TREE
     it_iter = _avl_tree_insert_equal(&pmset_mset->_t_tree, pv_varg);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    it_iter = _bp_tree_insert_equal(&pmset_mset->_t_tree, pv_varg);
 #else
     it_iter = _rb_tree_insert_equal(&pmset_mset->_t_tree, pv_varg);
 #endif
@@ -381,6 +399,8 @@ multiset_iterator_t _multiset_insert_hint_varg(multiset_t* pmset_mset, multiset_
 
 #ifdef CSTL_MULTISET_AVL_TREE
     it_hint = _avl_tree_insert_equal(&pmset_mset->_t_tree, pv_varg);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    it_hint = _bp_tree_insert_equal(&pmset_mset->_t_tree, pv_varg);
 #else
     it_hint = _rb_tree_insert_equal(&pmset_mset->_t_tree, pv_varg);
 #endif
@@ -426,6 +446,8 @@ size_t _multiset_erase_varg(multiset_t* pmset_mset, va_list val_elemlist)
 
 #ifdef CSTL_MULTISET_AVL_TREE
     t_count = _avl_tree_erase(&pmset_mset->_t_tree, pv_varg);
+#elif defined(CSTL_MULTISET_BP_TREE)
+    t_count = _bp_tree_erase(&pmset_mset->_t_tree, pv_varg);
 #else
     t_count = _rb_tree_erase(&pmset_mset->_t_tree, pv_varg);
 #endif
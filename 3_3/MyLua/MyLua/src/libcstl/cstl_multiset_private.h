@@ -32,11 +32,13 @@ extern "C" {
 /** constant declaration and macro section **/
 
 /** data type declaration and struct, union, enum section **/
-/* the multiset use rb tree default */
+/* the multiset use rb tree default, CSTL_MULTISET_AVL_TREE or CSTL_MULTISET_BP_TREE selects the other backends */
 typedef struct _tagmultiset
 {
 #ifdef CSTL_MULTISET_AVL_TREE
     _avl_tree_t _t_tree;
+#elif defined(CSTL_MULTISET_BP_TREE)
+    _bp_tree_t  _t_tree;
 #else
     _rb_tree_t  _t_tree;
 #endif
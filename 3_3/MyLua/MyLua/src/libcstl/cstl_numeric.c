@@ -28,6 +28,8 @@
 #include "cfunctional.h"
 #include "cnumeric.h"
 
+#include "cstl_numeric_aux.h"
+
 /** local constant declaration and local macro section **/
 
 /** local data type declaration and local struct, union, enum section **/
@@ -102,6 +104,10 @@ output_iterator_t algo_adjacent_difference_if(input_iterator_t it_first, input_i
     if (bfun_op == NULL) {
         bfun_op = _fun_get_binary(it_first, _MINUS_FUN);
     }
+    /* contiguous ranges of builtin numeric type are computed by the type specific kernel */
+    if (_algo_adjacent_difference_builtin(it_first, it_last, it_result, bfun_op, &it_result)) {
+        return it_result;
+    }
 
     pv_value = _iterator_allocate_init_elem(it_first);
     pv_tmp = _iterator_allocate_init_elem(it_first);
@@ -158,6 +164,10 @@ output_iterator_t algo_partial_sum_if(input_iterator_t it_first, input_iterator_
     if (bfun_op == NULL) {
         bfun_op = _fun_get_binary(it_first, _PLUS_FUN);
     }
+    /* contiguous ranges of builtin numeric type are computed by the type specific kernel */
+    if (_algo_partial_sum_builtin(it_first, it_last, it_result, bfun_op, &it_result)) {
+        return it_result;
+    }
 
     pv_value = _iterator_allocate_init_elem(it_first);
 
@@ -35,6 +35,15 @@ extern "C" {
  *        functions for that types.
  */
 
+/*
+ * NOTE : The builtin operations on contiguous range(vector_t or basic_string_t) of c built-in integer, float and double
+ *        types are computed by type specific kernels. the integer results are the same as the generic way. float and
+ *        double are summed one by one from the first element by default, the same order as the generic way, so that
+ *        accumulate and inner_product give the same result as before. define CSTL_NUMERIC_LANE_SUMMATION to sum them
+ *        into 8 interleaved partial sums that are combined pairwise at last, this order can be vectorized and the result
+ *        only depends on the input, but it may differ from the sequential sum in the last bits.
+ */
+
 /** include section **/
 
 /** constant declaration and macro section **/
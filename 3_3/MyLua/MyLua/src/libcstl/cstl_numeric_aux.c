@@ -0,0 +1,344 @@
+/*
+ *  The implementation of numeric algorithm auxiliary functions.
+ *  Copyright (C)  2008 - 2014  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+/** include section **/
+#include "cstl_def.h"
+#include "cstl_alloc.h"
+#include "cstl_types.h"
+#include "citerator.h"
+#include "cfunctional.h"
+#include "cnumeric.h"
+
+#include "cstl_numeric_aux.h"
+
+/** local constant declaration and local macro section **/
+#define _ALGO_NUMERIC_LANES     8   /* the count of interleaved partial sums, must be power of 2 */
+
+#ifdef CSTL_NUMERIC_LANE_SUMMATION
+#define _ALGO_FLOAT_LANE_SUMMATION  true
+#else
+#define _ALGO_FLOAT_LANE_SUMMATION  false
+#endif
+
+/*
+ * The kernels of one element type. integer types are computed by unsigned type of the same size so that the overflow
+ * wraps like the builtin functions, calc_t is the type of multiplication that avoids the promotion to signed int.
+ * when b_lane is true the elements are added into interleaved partial sums, which
+ * are combined by the fixed pairwise order at last, otherwise the elements are added one by one from the first.
+ */
+#define _ALGO_NUMERIC_KERNEL(suffix, type_t, calc_t, b_lane)\
+    static void _algo_sum_##suffix(const _byte_t* cpby_first, size_t t_len, void* pv_output)\
+    {\
+        const type_t* cpt_first = (const type_t*)cpby_first;\
+        type_t        at_lane[_ALGO_NUMERIC_LANES] = {0};\
+        type_t        t_sum = *(type_t*)pv_output;\
+        size_t        i = 0;\
+        size_t        j = 0;\
+        if (!(b_lane)) {\
+            for (i = 0; i < t_len; ++i) {\
+                t_sum += cpt_first[i];\
+            }\
+            *(type_t*)pv_output = t_sum;\
+            return;\
+        }\
+        for (i = 0; i + _ALGO_NUMERIC_LANES <= t_len; i += _ALGO_NUMERIC_LANES) {\
+            for (j = 0; j < _ALGO_NUMERIC_LANES; ++j) {\
+                at_lane[j] += cpt_first[i + j];\
+            }\
+        }\
+        for (j = 0; i < t_len; ++i, ++j) {\
+            at_lane[j] += cpt_first[i];\
+        }\
+        for (j = _ALGO_NUMERIC_LANES / 2; j > 0; j /= 2) {\
+            for (i = 0; i < j; ++i) {\
+                at_lane[i] += at_lane[i + j];\
+            }\
+        }\
+        *(type_t*)pv_output = t_sum + at_lane[0];\
+    }\
+    static void _algo_inner_product_##suffix(const _byte_t* cpby_first1, const _byte_t* cpby_first2, size_t t_len, void* pv_output)\
+    {\
+        const type_t* cpt_first1 = (const type_t*)cpby_first1;\
+        const type_t* cpt_first2 = (const type_t*)cpby_first2;\
+        type_t        at_lane[_ALGO_NUMERIC_LANES] = {0};\
+        type_t        t_sum = *(type_t*)pv_output;\
+        type_t        t_product = 0;\
+        size_t        i = 0;\
+        size_t        j = 0;\
+        if (!(b_lane)) {\
+            for (i = 0; i < t_len; ++i) {\
+                t_product = (type_t)((calc_t)cpt_first1[i] * (calc_t)cpt_first2[i]);\
+                t_sum += t_product;\
+            }\
+            *(type_t*)pv_output = t_sum;\
+            return;\
+        }\
+        for (i = 0; i + _ALGO_NUMERIC_LANES <= t_len; i += _ALGO_NUMERIC_LANES) {\
+            for (j = 0; j < _ALGO_NUMERIC_LANES; ++j) {\
+                t_product = (type_t)((calc_t)cpt_first1[i + j] * (calc_t)cpt_first2[i + j]);\
+                at_lane[j] += t_product;\
+            }\
+        }\
+        for (j = 0; i < t_len; ++i, ++j) {\
+            t_product = (type_t)((calc_t)cpt_first1[i] * (calc_t)cpt_first2[i]);\
+            at_lane[j] += t_product;\
+        }\
+        for (j = _ALGO_NUMERIC_LANES / 2; j > 0; j /= 2) {\
+            for (i = 0; i < j; ++i) {\
+                at_lane[i] += at_lane[i + j];\
+            }\
+        }\
+        *(type_t*)pv_output = t_sum + at_lane[0];\
+    }\
+    static void _algo_partial_sum_##suffix(const _byte_t* cpby_first, size_t t_len, _byte_t* pby_result)\
+    {\
+        const type_t* cpt_first = (const type_t*)cpby_first;\
+        type_t*       pt_result = (type_t*)pby_result;\
+        type_t        t_sum = cpt_first[0];\
+        size_t        i = 0;\
+        pt_result[0] = t_sum;\
+        for (i = 1; i < t_len; ++i) {\
+            t_sum += cpt_first[i];\
+            pt_result[i] = t_sum;\
+        }\
+    }\
+    static void _algo_adjacent_difference_##suffix(const _byte_t* cpby_first, size_t t_len, _byte_t* pby_result)\
+    {\
+        const type_t* cpt_first = (const type_t*)cpby_first;\
+        type_t*       pt_result = (type_t*)pby_result;\
+        type_t        t_prev = cpt_first[0];\
+        type_t        t_curr = 0;\
+        size_t        i = 0;\
+        pt_result[0] = t_prev;\
+        for (i = 1; i < t_len; ++i) {\
+            t_curr = cpt_first[i];\
+            pt_result[i] = t_curr - t_prev;\
+            t_prev = t_curr;\
+        }\
+    }\
+    static const _algo_numeric_kernel_t _sgt_algo_numeric_##suffix = {\
+        _algo_sum_##suffix, _algo_inner_product_##suffix, _algo_partial_sum_##suffix, _algo_adjacent_difference_##suffix\
+    }
+
+/** local data type declaration and local struct, union, enum section **/
+#ifdef _MSC_VER
+typedef unsigned __int64    _algo_uint64_t;
+#else
+typedef unsigned long long  _algo_uint64_t;
+#endif
+
+/* the kernels of one element type */
+typedef struct _tagalgonumerickernel
+{
+    void (*_pfun_sum)(const _byte_t* cpby_first, size_t t_len, void* pv_output);
+    void (*_pfun_inner_product)(const _byte_t* cpby_first1, const _byte_t* cpby_first2, size_t t_len, void* pv_output);
+    void (*_pfun_partial_sum)(const _byte_t* cpby_first, size_t t_len, _byte_t* pby_result);
+    void (*_pfun_adjacent_difference)(const _byte_t* cpby_first, size_t t_len, _byte_t* pby_result);
+}_algo_numeric_kernel_t;
+
+/* builtin numeric type which can be computed by kernels */
+typedef struct _tagalgonumeric
+{
+    bfun_t _bfun_plus;
+    bfun_t _bfun_minus;
+    bfun_t _bfun_multiplies;
+    size_t _t_typesize;
+    bool_t _t_isfloat;
+}_algo_numeric_t;
+
+/** local function prototype section **/
+/**
+ * Get the kernels of contiguous range for the builtin operation.
+ * @param it_iter       Iterator of the range.
+ * @param bfun_op       Builtin plus, minus or multiplies function of the element type.
+ * @return  The kernels or NULL if the range must be computed by the generic way.
+ */
+static const _algo_numeric_kernel_t* _algo_get_numeric_kernel(iterator_t it_iter, bfun_t bfun_op);
+
+/** exported global variable definition section **/
+
+/** local global variable definition section **/
+_ALGO_NUMERIC_KERNEL(u8, unsigned char, unsigned int, true);
+_ALGO_NUMERIC_KERNEL(u16, unsigned short, unsigned int, true);
+_ALGO_NUMERIC_KERNEL(u32, unsigned int, unsigned int, true);
+_ALGO_NUMERIC_KERNEL(u64, _algo_uint64_t, _algo_uint64_t, true);
+_ALGO_NUMERIC_KERNEL(f32, float, float, _ALGO_FLOAT_LANE_SUMMATION);
+_ALGO_NUMERIC_KERNEL(f64, double, double, _ALGO_FLOAT_LANE_SUMMATION);
+
+static const _algo_numeric_t _sgt_algo_numeric[] = {
+    {fun_plus_char, fun_minus_char, fun_multiplies_char, sizeof(char), false},
+    {fun_plus_uchar, fun_minus_uchar, fun_multiplies_uchar, sizeof(unsigned char), false},
+    {fun_plus_short, fun_minus_short, fun_multiplies_short, sizeof(short), false},
+    {fun_plus_ushort, fun_minus_ushort, fun_multiplies_ushort, sizeof(unsigned short), false},
+    {fun_plus_int, fun_minus_int, fun_multiplies_int, sizeof(int), false},
+    {fun_plus_uint, fun_minus_uint, fun_multiplies_uint, sizeof(unsigned int), false},
+    {fun_plus_long, fun_minus_long, fun_multiplies_long, sizeof(long), false},
+    {fun_plus_ulong, fun_minus_ulong, fun_multiplies_ulong, sizeof(unsigned long), false},
+#ifndef _MSC_VER
+    {fun_plus_long_long, fun_minus_long_long, fun_multiplies_long_long, sizeof(long long), false},
+    {fun_plus_ulong_long, fun_minus_ulong_long, fun_multiplies_ulong_long, sizeof(unsigned long long), false},
+#endif
+    {fun_plus_float, fun_minus_float, fun_multiplies_float, sizeof(float), true},
+    {fun_plus_double, fun_minus_double, fun_multiplies_double, sizeof(double), true}
+};
+
+/** exported function implementation section **/
+/**
+ * Computes the sum of contiguous range of C builtin numeric type and adds it to the initial value.
+ */
+bool_t _algo_accumulate_builtin(input_iterator_t it_first, input_iterator_t it_last, bfun_t bfun_op, void* pv_output)
+{
+    const _algo_numeric_kernel_t* cpt_kernel = NULL;
+
+    assert(_iterator_valid_range(it_first, it_last, _INPUT_ITERATOR));
+    assert(pv_output != NULL);
+
+    if ((cpt_kernel = _algo_get_numeric_kernel(it_first, bfun_op)) == NULL ||
+        bfun_op != _fun_get_binary(it_first, _PLUS_FUN)) {
+        return false;
+    }
+
+    cpt_kernel->_pfun_sum(_VECTOR_ITERATOR_COREPOS(it_first), iterator_distance(it_first, it_last), pv_output);
+    return true;
+}
+
+/**
+ * Computes the inner product of two contiguous ranges of C builtin numeric type and adds it to the initial value.
+ */
+bool_t _algo_inner_product_builtin(
+    input_iterator_t it_first1, input_iterator_t it_last1, input_iterator_t it_first2,
+    bfun_t bfun_op1, bfun_t bfun_op2, void* pv_output)
+{
+    const _algo_numeric_kernel_t* cpt_kernel = NULL;
+
+    assert(_iterator_valid_range(it_first1, it_last1, _INPUT_ITERATOR));
+    assert(pv_output != NULL);
+
+    if ((cpt_kernel = _algo_get_numeric_kernel(it_first1, bfun_op1)) == NULL ||
+        _algo_get_numeric_kernel(it_first2, bfun_op2) != cpt_kernel ||
+        bfun_op1 != _fun_get_binary(it_first1, _PLUS_FUN) ||
+        bfun_op2 != _fun_get_binary(it_first1, _MULTIPLIES_FUN)) {
+        return false;
+    }
+
+    cpt_kernel->_pfun_inner_product(
+        _VECTOR_ITERATOR_COREPOS(it_first1), _VECTOR_ITERATOR_COREPOS(it_first2), iterator_distance(it_first1, it_last1), pv_output);
+    return true;
+}
+
+/**
+ * Computes the partial sums of contiguous range of C builtin numeric type.
+ */
+bool_t _algo_partial_sum_builtin(
+    input_iterator_t it_first, input_iterator_t it_last, output_iterator_t it_result, bfun_t bfun_op, output_iterator_t* pit_result)
+{
+    const _algo_numeric_kernel_t* cpt_kernel = NULL;
+    size_t                        t_len = 0;
+
+    assert(_iterator_valid_range(it_first, it_last, _INPUT_ITERATOR));
+    assert(pit_result != NULL);
+
+    if ((cpt_kernel = _algo_get_numeric_kernel(it_first, bfun_op)) == NULL ||
+        _algo_get_numeric_kernel(it_result, bfun_op) != cpt_kernel ||
+        bfun_op != _fun_get_binary(it_first, _PLUS_FUN)) {
+        return false;
+    }
+
+    if ((t_len = iterator_distance(it_first, it_last)) > 0) {
+        cpt_kernel->_pfun_partial_sum(_VECTOR_ITERATOR_COREPOS(it_first), t_len, _VECTOR_ITERATOR_COREPOS(it_result));
+    }
+    *pit_result = iterator_next_n(it_result, (int)t_len);
+    return true;
+}
+
+/**
+ * Computes the adjacent differences of contiguous range of C builtin numeric type.
+ */
+bool_t _algo_adjacent_difference_builtin(
+    input_iterator_t it_first, input_iterator_t it_last, output_iterator_t it_result, bfun_t bfun_op, output_iterator_t* pit_result)
+{
+    const _algo_numeric_kernel_t* cpt_kernel = NULL;
+    size_t                        t_len = 0;
+
+    assert(_iterator_valid_range(it_first, it_last, _INPUT_ITERATOR));
+    assert(pit_result != NULL);
+
+    if ((cpt_kernel = _algo_get_numeric_kernel(it_first, bfun_op)) == NULL ||
+        _algo_get_numeric_kernel(it_result, bfun_op) != cpt_kernel ||
+        bfun_op != _fun_get_binary(it_first, _MINUS_FUN)) {
+        return false;
+    }
+
+    if ((t_len = iterator_distance(it_first, it_last)) > 0) {
+        cpt_kernel->_pfun_adjacent_difference(_VECTOR_ITERATOR_COREPOS(it_first), t_len, _VECTOR_ITERATOR_COREPOS(it_result));
+    }
+    *pit_result = iterator_next_n(it_result, (int)t_len);
+    return true;
+}
+
+/** local function implementation section **/
+/**
+ * Get the kernels of contiguous range for the builtin operation.
+ */
+static const _algo_numeric_kernel_t* _algo_get_numeric_kernel(iterator_t it_iter, bfun_t bfun_op)
+{
+    size_t t_typesize = 0;
+    size_t i = 0;
+
+    if ((_ITERATOR_CONTAINER_TYPE(it_iter) != _VECTOR_CONTAINER &&
+         _ITERATOR_CONTAINER_TYPE(it_iter) != _BASIC_STRING_CONTAINER) ||
+        _iterator_get_typestyle(it_iter) != _TYPE_C_BUILTIN) {
+        return NULL;
+    }
+
+    t_typesize = _iterator_get_typeinfo(it_iter)->_pt_type->_t_typesize;
+    for (i = 0; i < sizeof(_sgt_algo_numeric) / sizeof(_sgt_algo_numeric[0]); ++i) {
+        if (_sgt_algo_numeric[i]._t_typesize != t_typesize ||
+            (_sgt_algo_numeric[i]._bfun_plus != bfun_op &&
+             _sgt_algo_numeric[i]._bfun_minus != bfun_op &&
+             _sgt_algo_numeric[i]._bfun_multiplies != bfun_op)) {
+            continue;
+        }
+
+        if (_sgt_algo_numeric[i]._t_isfloat) {
+            if (t_typesize == sizeof(float)) {
+                return &_sgt_algo_numeric_f32;
+            } else if (t_typesize == sizeof(double)) {
+                return &_sgt_algo_numeric_f64;
+            }
+        } else {
+            switch (t_typesize) {
+                case 1:  return &_sgt_algo_numeric_u8;
+                case 2:  return &_sgt_algo_numeric_u16;
+                case 4:  return &_sgt_algo_numeric_u32;
+                case 8:  return &_sgt_algo_numeric_u64;
+                default: break;
+            }
+        }
+        break;
+    }
+
+    return NULL;
+}
+
+/** eof **/
+
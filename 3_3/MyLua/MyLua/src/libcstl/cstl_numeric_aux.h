@@ -0,0 +1,102 @@
+/*
+ *  The auxiliary function of numeric algorithm.
+ *  Copyright (C)  2008 - 2014  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+#ifndef _CSTL_NUMERIC_AUX_H_
+#define _CSTL_NUMERIC_AUX_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** include section **/
+
+/** constant declaration and macro section **/
+
+/** data type declaration and struct, union, enum section **/
+
+/** exported global variable declaration section **/
+
+/** exported function prototype section **/
+/**
+ * Computes the sum of contiguous range of C builtin numeric type and adds it to the initial value.
+ * @param it_first      An input iterator addressing the first element in the range.
+ * @param it_last       An input iterator addressing the position one past the final element in the range.
+ * @param bfun_op       The binary operation.
+ * @param pv_output     The initial value, the sum is added to it.
+ * @return  true if the range is summed, false if the range must be summed by the generic way.
+ * @remarks The range is summed only when it belongs to vector_t or basic_string_t, the element type is C builtin integer,
+ *          float or double type and bfun_op is the builtin plus function of that type. the summation order of float and
+ *          double is selected by CSTL_NUMERIC_LANE_SUMMATION, see cnumeric.h.
+ */
+extern bool_t _algo_accumulate_builtin(input_iterator_t it_first, input_iterator_t it_last, bfun_t bfun_op, void* pv_output);
+
+/**
+ * Computes the inner product of two contiguous ranges of C builtin numeric type and adds it to the initial value.
+ * @param it_first1     An input iterator addressing the first element in the first range.
+ * @param it_last1      An input iterator addressing the position one past the final element in the first range.
+ * @param it_first2     An input iterator addressing the first element in the second range.
+ * @param bfun_op1      The sum operation.
+ * @param bfun_op2      The product operation.
+ * @param pv_output     The initial value, the inner product is added to it.
+ * @return  true if the ranges are computed, false if the ranges must be computed by the generic way.
+ * @remarks Both ranges must belong to vector_t or basic_string_t, bfun_op1 and bfun_op2 must be the builtin plus and
+ *          multiplies function of the element type, other restriction is the same as _algo_accumulate_builtin().
+ */
+extern bool_t _algo_inner_product_builtin(
+    input_iterator_t it_first1, input_iterator_t it_last1, input_iterator_t it_first2,
+    bfun_t bfun_op1, bfun_t bfun_op2, void* pv_output);
+
+/**
+ * Computes the partial sums of contiguous range of C builtin numeric type.
+ * @param it_first      An input iterator addressing the first element in the range.
+ * @param it_last       An input iterator addressing the position one past the final element in the range.
+ * @param it_result     An output iterator addressing the first element of the destination range.
+ * @param bfun_op       The binary operation.
+ * @param pit_result    Set to the end of the destination range, only when the range is computed.
+ * @return  true if the range is computed, false if the range must be computed by the generic way.
+ * @remarks Both ranges must belong to vector_t or basic_string_t and bfun_op must be the builtin plus function of the
+ *          element type. the destination range may be the source range. the sums are always computed in order.
+ */
+extern bool_t _algo_partial_sum_builtin(
+    input_iterator_t it_first, input_iterator_t it_last, output_iterator_t it_result, bfun_t bfun_op, output_iterator_t* pit_result);
+
+/**
+ * Computes the adjacent differences of contiguous range of C builtin numeric type.
+ * @param it_first      An input iterator addressing the first element in the range.
+ * @param it_last       An input iterator addressing the position one past the final element in the range.
+ * @param it_result     An output iterator addressing the first element of the destination range.
+ * @param bfun_op       The binary operation.
+ * @param pit_result    Set to the end of the destination range, only when the range is computed.
+ * @return  true if the range is computed, false if the range must be computed by the generic way.
+ * @remarks Both ranges must belong to vector_t or basic_string_t and bfun_op must be the builtin minus function of the
+ *          element type. the destination range may be the source range.
+ */
+extern bool_t _algo_adjacent_difference_builtin(
+    input_iterator_t it_first, input_iterator_t it_last, output_iterator_t it_result, bfun_t bfun_op, output_iterator_t* pit_result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CSTL_NUMERIC_AUX_H_ */
+/** eof **/
+
@@ -28,6 +28,8 @@
 #include "cfunctional.h"
 #include "cnumeric.h"
 
+#include "cstl_numeric_aux.h"
+
 /** local constant declaration and local macro section **/
 
 /** local data type declaration and local struct, union, enum section **/
@@ -117,6 +119,11 @@ void _algo_accumulate_if_varg(input_iterator_t it_first, input_iterator_t it_las
     }
 
     _type_get_varg_value(_iterator_get_typeinfo(it_first), val_elemlist, pv_output);
+    /* contiguous range of builtin numeric type is summed by the type specific kernel */
+    if (_algo_accumulate_builtin(it_first, it_last, bfun_op, pv_output)) {
+        return;
+    }
+
     for (it_iter = it_first; !iterator_equal(it_iter, it_last); it_iter = iterator_next(it_iter)) {
         (*bfun_op)(pv_output, iterator_get_pointer(it_iter), pv_output);
     }
@@ -179,6 +186,11 @@ void _algo_inner_product_if_varg(
     if (bfun_op2 == NULL) {
         bfun_op2 = _fun_get_binary(it_first1, _MULTIPLIES_FUN);
     }
+    /* contiguous ranges of builtin numeric type are computed by the type specific kernel */
+    if (_algo_inner_product_builtin(it_first1, it_last1, it_first2, bfun_op1, bfun_op2, pv_output)) {
+        _iterator_deallocate_destroy_elem(it_first1, pv_tmp);
+        return;
+    }
 
     for (it_index1 = it_first1, it_index2 = it_first2;
          !iterator_equal(it_index1, it_last1);
@@ -25,8 +25,12 @@
 #include "cfunctional.h"
 #include "cutility.h"
 #include "calgorithm.h"
+#include "cstring.h"
 #include "cqueue.h"
 
+#include "cstl_vector_aux.h"
+#include "cstl_priority_queue_aux.h"
+
 /** local constant declaration and local macro section **/
 
 /** local data type declaration and local struct, union, enum section **/
@@ -54,7 +58,26 @@ void priority_queue_init_ex(priority_queue_t* ppque_pqueue, bfun_t bfun_op)
     assert(ppque_pqueue != NULL);
 
     vector_init(&ppque_pqueue->_vec_base);
-    ppque_pqueue->_bfun_priority = bfun_op;
+    _priority_queue_init_priority(ppque_pqueue, bfun_op);
+}
+
+/**
+ * Initialize an empty indexed priority queue adaptor.
+ */
+void priority_queue_init_indexed(priority_queue_t* ppque_pqueue, size_t t_keycount)
+{
+    priority_queue_init_indexed_ex(ppque_pqueue, t_keycount, NULL);
+}
+
+/**
+ * Initialize an empty indexed priority queue adaptor with user define priority rule.
+ */
+void priority_queue_init_indexed_ex(priority_queue_t* ppque_pqueue, size_t t_keycount, bfun_t bfun_op)
+{
+    assert(ppque_pqueue != NULL);
+
+    priority_queue_init_ex(ppque_pqueue, bfun_op);
+    _priority_queue_init_index(ppque_pqueue, t_keycount);
 }
 
 /**
@@ -76,6 +99,11 @@ void priority_queue_init_copy(priority_queue_t* ppque_dest, const priority_queue
 
     vector_init_copy(&ppque_dest->_vec_base, &cppque_src->_vec_base);
     ppque_dest->_bfun_priority = cppque_src->_bfun_priority;
+    if (cppque_src->_pt_keypos != NULL) {
+        _priority_queue_init_index(ppque_dest, cppque_src->_t_keycount);
+        memcpy(ppque_dest->_pt_poskey, cppque_src->_pt_poskey, sizeof(size_t) * cppque_src->_t_keycount);
+        memcpy(ppque_dest->_pt_keypos, cppque_src->_pt_keypos, sizeof(size_t) * cppque_src->_t_keycount);
+    }
 }
 
 /**
@@ -94,8 +122,8 @@ void priority_queue_init_copy_range_ex(priority_queue_t* ppque_dest, input_itera
     assert(ppque_dest != NULL);
 
     vector_init_copy_range(&ppque_dest->_vec_base, it_first, it_last);
-    ppque_dest->_bfun_priority = bfun_op;
-    algo_make_heap_if(vector_begin(&ppque_dest->_vec_base), vector_end(&ppque_dest->_vec_base), ppque_dest->_bfun_priority);
+    _priority_queue_init_priority(ppque_dest, bfun_op);
+    _priority_queue_make_heap(ppque_dest, 0);
 }
 
 /**
@@ -115,8 +143,8 @@ void priority_queue_init_copy_array_ex(priority_queue_t* ppque_dest, const void*
     assert(cpv_array != NULL);
 
     vector_init_copy_array(&ppque_dest->_vec_base, cpv_array, t_count);
-    ppque_dest->_bfun_priority = bfun_op;
-    algo_make_heap_if(vector_begin(&ppque_dest->_vec_base), vector_end(&ppque_dest->_vec_base), ppque_dest->_bfun_priority);
+    _priority_queue_init_priority(ppque_dest, bfun_op);
+    _priority_queue_make_heap(ppque_dest, 0);
 }
 
 /**
@@ -127,8 +155,13 @@ void priority_queue_assign(priority_queue_t* ppque_dest, const priority_queue_t*
     assert(ppque_dest != NULL);
     assert(cppque_src != NULL);
     assert(ppque_dest->_bfun_priority == cppque_src->_bfun_priority);
+    assert(ppque_dest->_t_keycount == cppque_src->_t_keycount);
 
     vector_assign(&ppque_dest->_vec_base, &cppque_src->_vec_base);
+    if (cppque_src->_pt_keypos != NULL && ppque_dest != cppque_src) {
+        memcpy(ppque_dest->_pt_poskey, cppque_src->_pt_poskey, sizeof(size_t) * cppque_src->_t_keycount);
+        memcpy(ppque_dest->_pt_keypos, cppque_src->_pt_keypos, sizeof(size_t) * cppque_src->_t_keycount);
+    }
 }
 
 /**
@@ -151,6 +184,18 @@ size_t priority_queue_size(const priority_queue_t* cppque_pqueue)
     return vector_size(&cppque_pqueue->_vec_base);
 }
 
+/**
+ * Get the memory that priority_queue allocates.
+ */
+size_t priority_queue_memory_usage(const priority_queue_t* cppque_pqueue)
+{
+    assert(cppque_pqueue != NULL);
+
+    /* the key maps of indexed priority queue are counted too */
+    return vector_memory_usage(&cppque_pqueue->_vec_base) - sizeof(vector_t) + sizeof(priority_queue_t) +
+           (cppque_pqueue->_pt_keypos != NULL ? sizeof(size_t) * cppque_pqueue->_t_keycount * 2 : 0);
+}
+
 /**
  * Returns a const reference to the largest element at the top of the priority_queue.
  */
@@ -167,9 +212,70 @@ void* priority_queue_top(const priority_queue_t* cppque_pqueue)
 void priority_queue_pop(priority_queue_t* ppque_pqueue)
 {
     assert(ppque_pqueue != NULL);
+    assert(!vector_empty(&ppque_pqueue->_vec_base));
+
+    _priority_queue_erase_pos(ppque_pqueue, 0);
+}
+
+/**
+ * Add elements of array into priority queue.
+ */
+void priority_queue_push_n(priority_queue_t* ppque_pqueue, const void* cpv_array, size_t t_count)
+{
+    size_t t_size = 0;
+
+    assert(ppque_pqueue != NULL);
+    assert(ppque_pqueue->_pt_keypos == NULL);
+    assert(cpv_array != NULL);
+
+    t_size = vector_size(&ppque_pqueue->_vec_base);
+    vector_insert_array(&ppque_pqueue->_vec_base, vector_end(&ppque_pqueue->_vec_base), cpv_array, t_count);
+    _priority_queue_make_heap(ppque_pqueue, t_size);
+}
+
+/**
+ * Returns the key of the element at the top of indexed priority queue.
+ */
+size_t priority_queue_top_indexed(const priority_queue_t* cppque_pqueue)
+{
+    assert(cppque_pqueue != NULL);
+    assert(cppque_pqueue->_pt_poskey != NULL);
+    assert(!vector_empty(&cppque_pqueue->_vec_base));
+
+    return cppque_pqueue->_pt_poskey[0];
+}
+
+/**
+ * Test the key is in use in indexed priority queue.
+ */
+bool_t priority_queue_contain_indexed(const priority_queue_t* cppque_pqueue, size_t t_key)
+{
+    assert(cppque_pqueue != NULL);
+    assert(cppque_pqueue->_pt_keypos != NULL);
+
+    return t_key < cppque_pqueue->_t_keycount && cppque_pqueue->_pt_keypos[t_key] != NPOS ? true : false;
+}
+
+/**
+ * Returns the element of key in indexed priority queue.
+ */
+void* priority_queue_at_indexed(const priority_queue_t* cppque_pqueue, size_t t_key)
+{
+    assert(cppque_pqueue != NULL);
+    assert(priority_queue_contain_indexed(cppque_pqueue, t_key));
+
+    return vector_at(&cppque_pqueue->_vec_base, cppque_pqueue->_pt_keypos[t_key]);
+}
+
+/**
+ * Removes the element of key from indexed priority queue.
+ */
+void priority_queue_erase_indexed(priority_queue_t* ppque_pqueue, size_t t_key)
+{
+    assert(ppque_pqueue != NULL);
+    assert(priority_queue_contain_indexed(ppque_pqueue, t_key));
 
-    algo_pop_heap_if(vector_begin(&ppque_pqueue->_vec_base), vector_end(&ppque_pqueue->_vec_base), ppque_pqueue->_bfun_priority);
-    vector_pop_back(&ppque_pqueue->_vec_base);
+    _priority_queue_erase_pos(ppque_pqueue, ppque_pqueue->_pt_keypos[t_key]);
 }
 
 /** local function implementation section **/
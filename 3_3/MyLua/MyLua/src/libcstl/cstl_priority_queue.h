@@ -49,6 +49,32 @@ extern "C" {
  */
 #define priority_queue_push(ppque_pqueue, elem) _priority_queue_push((ppque_pqueue), (elem))
 
+/**
+ * Add specificed element with key into indexed priority queue.
+ * @param ppque_pqueue    indexed priority queue adaptor.
+ * @param t_key           key of element, must be less than key count of priority queue.
+ * @param elem            specificed element.
+ * @return void.
+ * @remarks ppque_pqueue must be initialized by priority_queue_init_indexed(), otherwise the behavior is undefined. the key
+ *          must not be in use, the type of specificed element and priority queue element type must be same, otherwise
+ *          the behavior is undefined.
+ */
+#define priority_queue_push_indexed(ppque_pqueue, t_key, elem)\
+    _priority_queue_push_indexed((ppque_pqueue), (t_key), (elem))
+
+/**
+ * Replace the element of key in indexed priority queue and restore the heap order, both decrease key and increase key.
+ * @param ppque_pqueue    indexed priority queue adaptor.
+ * @param t_key           key of element.
+ * @param elem            new value of element.
+ * @return void.
+ * @remarks ppque_pqueue must be initialized by priority_queue_init_indexed(), otherwise the behavior is undefined. the key
+ *          must be in use, the type of specificed element and priority queue element type must be same, otherwise
+ *          the behavior is undefined.
+ */
+#define priority_queue_update_indexed(ppque_pqueue, t_key, elem)\
+    _priority_queue_update_indexed((ppque_pqueue), (t_key), (elem))
+
 /** data type declaration and struct, union, enum section **/
 
 /** exported global variable declaration section **/
@@ -73,6 +99,27 @@ extern void priority_queue_init(priority_queue_t* ppque_pqueue);
  */
 extern void priority_queue_init_ex(priority_queue_t* ppque_pqueue, bfun_t bfun_op);
 
+/**
+ * Initialize an empty indexed priority queue adaptor.
+ * @param ppque_pqueue   priority queue adaptor.
+ * @param t_keycount     count of keys, elements are identified by key in [0, t_keycount).
+ * @return void.
+ * @remarks if ppque_pqueue == NULL, then the behavior is undefined. pque_queue must be created by create_priority_queue(), otherwise
+ *          the behavior is undefine. elements of indexed priority queue must be added by priority_queue_push_indexed().
+ */
+extern void priority_queue_init_indexed(priority_queue_t* ppque_pqueue, size_t t_keycount);
+
+/**
+ * Initialize an empty indexed priority queue adaptor with user define priority rule.
+ * @param ppque_pqueue   priority queue adaptor.
+ * @param t_keycount     count of keys, elements are identified by key in [0, t_keycount).
+ * @param bfun_op        priority rule.
+ * @return void.
+ * @remarks if ppque_pqueue == NULL, then the behavior is undefined. pque_queue must be created by create_priority_queue(), otherwise
+ *          the behavior is undefine. elements of indexed priority queue must be added by priority_queue_push_indexed().
+ */
+extern void priority_queue_init_indexed_ex(priority_queue_t* ppque_pqueue, size_t t_keycount, bfun_t bfun_op);
+
 /**
  * Initialize an priority queue adaptor from an exist priority queue.
  * @param ppque_dest    destination priority queue adaptor.
@@ -158,6 +205,14 @@ extern bool_t priority_queue_empty(const priority_queue_t* cppque_pqueue);
  */
 extern size_t priority_queue_size(const priority_queue_t* cppque_pqueue);
 
+/**
+ * Get the memory that priority_queue allocates.
+ * @param cppque_pqueue     priority queue adaptor.
+ * @reture  The bytes of priority_queue_t, the heap vector and the key maps.
+ * @remarks The priority queue adaptor must be valid, otherwise the behavior is undefined.
+ */
+extern size_t priority_queue_memory_usage(const priority_queue_t* cppque_pqueue);
+
 /**
  * Returns a const reference to the largest element at the top of the priority_queue.
  * @param cppque_pqueue     priority queue adaptor.
@@ -174,6 +229,52 @@ extern void* priority_queue_top(const priority_queue_t* cppque_pqueue);
  */
 extern void priority_queue_pop(priority_queue_t* ppque_pqueue);
 
+/**
+ * Add elements of array into priority queue, the heap is rebuilt in linear time when the array is large.
+ * @param ppque_pqueue      priority queue adaptor.
+ * @param cpv_array         An exist array.
+ * @param t_count           Element count.
+ * @return void.
+ * @remarks The priority queue adaptor must be valid and not indexed, array must be valid and have same element type,
+ *          otherwise the behavior is undefined.
+ */
+extern void priority_queue_push_n(priority_queue_t* ppque_pqueue, const void* cpv_array, size_t t_count);
+
+/**
+ * Returns the key of the element at the top of indexed priority queue.
+ * @param cppque_pqueue     indexed priority queue adaptor.
+ * @return key of the top element.
+ * @remarks The priority queue adaptor must be indexed and not empty, otherwise the behavior is undefined.
+ */
+extern size_t priority_queue_top_indexed(const priority_queue_t* cppque_pqueue);
+
+/**
+ * Tests if the key is in use in indexed priority queue.
+ * @param cppque_pqueue     indexed priority queue adaptor.
+ * @param t_key             key of element.
+ * @return true if the key is in use, otherwise false.
+ * @remarks The priority queue adaptor must be indexed, otherwise the behavior is undefined.
+ */
+extern bool_t priority_queue_contain_indexed(const priority_queue_t* cppque_pqueue, size_t t_key);
+
+/**
+ * Returns the element of key in indexed priority queue.
+ * @param cppque_pqueue     indexed priority queue adaptor.
+ * @param t_key             key of element.
+ * @return pointer to element.
+ * @remarks The priority queue adaptor must be indexed and the key must be in use, otherwise the behavior is undefined.
+ */
+extern void* priority_queue_at_indexed(const priority_queue_t* cppque_pqueue, size_t t_key);
+
+/**
+ * Removes the element of key from indexed priority queue.
+ * @param ppque_pqueue      indexed priority queue adaptor.
+ * @param t_key             key of element.
+ * @return void.
+ * @remarks The priority queue adaptor must be indexed and the key must be in use, otherwise the behavior is undefined.
+ */
+extern void priority_queue_erase_indexed(priority_queue_t* ppque_pqueue, size_t t_key);
+
 #ifdef __cplusplus
 }
 #endif
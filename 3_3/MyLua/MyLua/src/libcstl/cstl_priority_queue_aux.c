@@ -0,0 +1,350 @@
+/*
+ *  The implementation of auxiliary priority queue.
+ *  Copyright (C)  2008 - 2013  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+
+/** include section **/
+#include "cstl_def.h"
+#include "cstl_alloc.h"
+#include "cstl_types.h"
+#include "citerator.h"
+#include "cfunctional.h"
+#include "cvector.h"
+#include "cstring.h"
+#include "cqueue.h"
+
+#include "cstl_vector_aux.h"
+#include "cstl_function_private.h"
+#include "cstl_priority_queue_aux.h"
+
+/** local constant declaration and local macro section **/
+
+/** local data type declaration and local struct, union, enum section **/
+
+/** local function prototype section **/
+/**
+ * Test the first element has lower priority than the second.
+ * @param cppque_pqueue     priority queue adaptor.
+ * @param cpby_first        first element.
+ * @param cpby_second       second element.
+ * @return true if the first element has lower priority.
+ */
+static bool_t _priority_queue_elem_less(const priority_queue_t* cppque_pqueue, const _byte_t* cpby_first, const _byte_t* cpby_second);
+
+/**
+ * Move element to destination, the source element is still valid after moving.
+ * @param ppque_pqueue      priority queue adaptor.
+ * @param pby_dest          destination element.
+ * @param cpby_src          source element.
+ * @return void.
+ */
+static void _priority_queue_move_elem(priority_queue_t* ppque_pqueue, _byte_t* pby_dest, const _byte_t* cpby_src);
+
+/** exported global variable definition section **/
+
+/** local global variable definition section **/
+
+/** exported function implementation section **/
+/**
+ * Get the scratch element after the last element of priority queue.
+ */
+_byte_t* _priority_queue_get_scratch(priority_queue_t* ppque_pqueue)
+{
+    vector_t* pvec_base = NULL;
+
+    assert(ppque_pqueue != NULL);
+
+    pvec_base = &ppque_pqueue->_vec_base;
+    if (vector_capacity(pvec_base) == vector_size(pvec_base)) {
+        vector_reserve(pvec_base, _vector_calculate_new_capacity(vector_size(pvec_base), 1));
+    }
+
+    if (!ppque_pqueue->_t_isbitwise) {
+        _vector_init_elem_auxiliary(pvec_base, pvec_base->_pby_finish);
+    }
+
+    return pvec_base->_pby_finish;
+}
+
+/**
+ * Release the scratch element.
+ */
+void _priority_queue_release_scratch(priority_queue_t* ppque_pqueue, _byte_t* pby_scratch)
+{
+    assert(ppque_pqueue != NULL);
+    assert(pby_scratch != NULL);
+
+    if (!ppque_pqueue->_t_isbitwise) {
+        bool_t b_result = _GET_VECTOR_TYPE_SIZE(&ppque_pqueue->_vec_base);
+        _GET_VECTOR_TYPE_DESTROY_FUNCTION(&ppque_pqueue->_vec_base)(pby_scratch, &b_result);
+        assert(b_result);
+    }
+}
+
+/**
+ * Move the element at specific position up to its place in heap.
+ */
+void _priority_queue_sift_up(priority_queue_t* ppque_pqueue, size_t t_pos, _byte_t* pby_scratch)
+{
+    size_t t_parent = 0;
+    size_t t_key = 0;
+
+    assert(ppque_pqueue != NULL);
+    assert(pby_scratch != NULL);
+    assert(t_pos < vector_size(&ppque_pqueue->_vec_base));
+
+    /* hold the element in scratch and move parents down until its place is found */
+    _priority_queue_move_elem(ppque_pqueue, pby_scratch, _PRIORITY_QUEUE_ELEM(ppque_pqueue, t_pos));
+    t_key = ppque_pqueue->_pt_poskey != NULL ? ppque_pqueue->_pt_poskey[t_pos] : 0;
+    while (t_pos > 0) {
+        t_parent = (t_pos - 1) / _PRIORITY_QUEUE_HEAP_ARITY;
+        if (!_priority_queue_elem_less(ppque_pqueue, _PRIORITY_QUEUE_ELEM(ppque_pqueue, t_parent), pby_scratch)) {
+            break;
+        }
+
+        _priority_queue_move_elem(
+            ppque_pqueue, _PRIORITY_QUEUE_ELEM(ppque_pqueue, t_pos), _PRIORITY_QUEUE_ELEM(ppque_pqueue, t_parent));
+        if (ppque_pqueue->_pt_poskey != NULL) {
+            ppque_pqueue->_pt_poskey[t_pos] = ppque_pqueue->_pt_poskey[t_parent];
+            ppque_pqueue->_pt_keypos[ppque_pqueue->_pt_poskey[t_pos]] = t_pos;
+        }
+        t_pos = t_parent;
+    }
+
+    _priority_queue_move_elem(ppque_pqueue, _PRIORITY_QUEUE_ELEM(ppque_pqueue, t_pos), pby_scratch);
+    if (ppque_pqueue->_pt_poskey != NULL) {
+        ppque_pqueue->_pt_poskey[t_pos] = t_key;
+        ppque_pqueue->_pt_keypos[t_key] = t_pos;
+    }
+}
+
+/**
+ * Move the element at specific position down to its place in heap.
+ */
+void _priority_queue_sift_down(priority_queue_t* ppque_pqueue, size_t t_pos, _byte_t* pby_scratch)
+{
+    size_t t_size = 0;
+    size_t t_child = 0;
+    size_t t_last = 0;
+    size_t t_max = 0;
+    size_t t_key = 0;
+
+    assert(ppque_pqueue != NULL);
+    assert(pby_scratch != NULL);
+    assert(t_pos < vector_size(&ppque_pqueue->_vec_base));
+
+    t_size = vector_size(&ppque_pqueue->_vec_base);
+    _priority_queue_move_elem(ppque_pqueue, pby_scratch, _PRIORITY_QUEUE_ELEM(ppque_pqueue, t_pos));
+    t_key = ppque_pqueue->_pt_poskey != NULL ? ppque_pqueue->_pt_poskey[t_pos] : 0;
+    for (;;) {
+        /* find the child of the highest priority */
+        t_child = t_pos * _PRIORITY_QUEUE_HEAP_ARITY + 1;
+        if (t_child >= t_size) {
+            break;
+        }
+        t_last = t_child + _PRIORITY_QUEUE_HEAP_ARITY < t_size ? t_child + _PRIORITY_QUEUE_HEAP_ARITY : t_size;
+        for (t_max = t_child++; t_child < t_last; ++t_child) {
+            if (_priority_queue_elem_less(
+                    ppque_pqueue, _PRIORITY_QUEUE_ELEM(ppque_pqueue, t_max), _PRIORITY_QUEUE_ELEM(ppque_pqueue, t_child))) {
+                t_max = t_child;
+            }
+        }
+
+        if (!_priority_queue_elem_less(ppque_pqueue, pby_scratch, _PRIORITY_QUEUE_ELEM(ppque_pqueue, t_max))) {
+            break;
+        }
+
+        _priority_queue_move_elem(
+            ppque_pqueue, _PRIORITY_QUEUE_ELEM(ppque_pqueue, t_pos), _PRIORITY_QUEUE_ELEM(ppque_pqueue, t_max));
+        if (ppque_pqueue->_pt_poskey != NULL) {
+            ppque_pqueue->_pt_poskey[t_pos] = ppque_pqueue->_pt_poskey[t_max];
+            ppque_pqueue->_pt_keypos[ppque_pqueue->_pt_poskey[t_pos]] = t_pos;
+        }
+        t_pos = t_max;
+    }
+
+    _priority_queue_move_elem(ppque_pqueue, _PRIORITY_QUEUE_ELEM(ppque_pqueue, t_pos), pby_scratch);
+    if (ppque_pqueue->_pt_poskey != NULL) {
+        ppque_pqueue->_pt_poskey[t_pos] = t_key;
+        ppque_pqueue->_pt_keypos[t_key] = t_pos;
+    }
+}
+
+/**
+ * Converts all elements of priority queue into a heap in O(n).
+ */
+void _priority_queue_make_heap(priority_queue_t* ppque_pqueue, size_t t_first)
+{
+    size_t   t_size = 0;
+    size_t   t_pos = 0;
+    _byte_t* pby_scratch = NULL;
+
+    assert(ppque_pqueue != NULL);
+
+    t_size = vector_size(&ppque_pqueue->_vec_base);
+    if (t_first >= t_size) {
+        return;
+    }
+
+    pby_scratch = _priority_queue_get_scratch(ppque_pqueue);
+    if (t_size - t_first < t_first) {
+        /* few elements are appended to a big heap, sift up each one */
+        for (t_pos = t_first; t_pos < t_size; ++t_pos) {
+            _priority_queue_sift_up(ppque_pqueue, t_pos, pby_scratch);
+        }
+    } else if (t_size >= 2) {
+        /* sift down all parents from the last one */
+        t_pos = (t_size - 2) / _PRIORITY_QUEUE_HEAP_ARITY + 1;
+        while (t_pos-- > 0) {
+            _priority_queue_sift_down(ppque_pqueue, t_pos, pby_scratch);
+        }
+    }
+    _priority_queue_release_scratch(ppque_pqueue, pby_scratch);
+}
+
+/**
+ * Remove the element at specific position.
+ */
+void _priority_queue_erase_pos(priority_queue_t* ppque_pqueue, size_t t_pos)
+{
+    size_t   t_last = 0;
+    _byte_t* pby_scratch = NULL;
+
+    assert(ppque_pqueue != NULL);
+    assert(t_pos < vector_size(&ppque_pqueue->_vec_base));
+
+    t_last = vector_size(&ppque_pqueue->_vec_base) - 1;
+    if (ppque_pqueue->_pt_poskey != NULL) {
+        ppque_pqueue->_pt_keypos[ppque_pqueue->_pt_poskey[t_pos]] = NPOS;
+    }
+
+    /* fill the hole with the last element, then move it up or down */
+    if (t_pos != t_last) {
+        _priority_queue_move_elem(
+            ppque_pqueue, _PRIORITY_QUEUE_ELEM(ppque_pqueue, t_pos), _PRIORITY_QUEUE_ELEM(ppque_pqueue, t_last));
+        if (ppque_pqueue->_pt_poskey != NULL) {
+            ppque_pqueue->_pt_poskey[t_pos] = ppque_pqueue->_pt_poskey[t_last];
+            ppque_pqueue->_pt_keypos[ppque_pqueue->_pt_poskey[t_pos]] = t_pos;
+        }
+    }
+    vector_pop_back(&ppque_pqueue->_vec_base);
+
+    if (t_pos < t_last) {
+        pby_scratch = _priority_queue_get_scratch(ppque_pqueue);
+        if (t_pos > 0 && _priority_queue_elem_less(ppque_pqueue,
+                _PRIORITY_QUEUE_ELEM(ppque_pqueue, (t_pos - 1) / _PRIORITY_QUEUE_HEAP_ARITY),
+                _PRIORITY_QUEUE_ELEM(ppque_pqueue, t_pos))) {
+            _priority_queue_sift_up(ppque_pqueue, t_pos, pby_scratch);
+        } else {
+            _priority_queue_sift_down(ppque_pqueue, t_pos, pby_scratch);
+        }
+        _priority_queue_release_scratch(ppque_pqueue, pby_scratch);
+    }
+}
+
+/**
+ * Resolve the priority rule of priority queue.
+ */
+void _priority_queue_init_priority(priority_queue_t* ppque_pqueue, bfun_t bfun_op)
+{
+    assert(ppque_pqueue != NULL);
+
+    if (bfun_op == NULL) {
+        bfun_op = _fun_get_binary(vector_begin(&ppque_pqueue->_vec_base), _LESS_FUN);
+    }
+    ppque_pqueue->_bfun_priority = bfun_op;
+}
+
+/**
+ * Initialize the key index of indexed priority queue.
+ */
+void _priority_queue_init_index(priority_queue_t* ppque_pqueue, size_t t_keycount)
+{
+    size_t i = 0;
+
+    assert(ppque_pqueue != NULL);
+    assert(ppque_pqueue->_pt_poskey == NULL && ppque_pqueue->_pt_keypos == NULL);
+
+    if (t_keycount == 0) {
+        t_keycount = 1;
+    }
+    ppque_pqueue->_pt_poskey = (size_t*)malloc(sizeof(size_t) * t_keycount);
+    ppque_pqueue->_pt_keypos = (size_t*)malloc(sizeof(size_t) * t_keycount);
+    if (ppque_pqueue->_pt_poskey == NULL || ppque_pqueue->_pt_keypos == NULL) {
+        fprintf(stderr, "CSTL FATAL ERROR: memory allocation error!\n");
+        exit(EXIT_FAILURE);
+    }
+    for (i = 0; i < t_keycount; ++i) {
+        ppque_pqueue->_pt_keypos[i] = NPOS;
+    }
+    ppque_pqueue->_t_keycount = t_keycount;
+}
+
+/**
+ * Destroy the key index of indexed priority queue.
+ */
+void _priority_queue_destroy_index(priority_queue_t* ppque_pqueue)
+{
+    assert(ppque_pqueue != NULL);
+
+    free(ppque_pqueue->_pt_poskey);
+    free(ppque_pqueue->_pt_keypos);
+    ppque_pqueue->_pt_poskey = NULL;
+    ppque_pqueue->_pt_keypos = NULL;
+    ppque_pqueue->_t_keycount = 0;
+}
+
+/** local function implementation section **/
+/**
+ * Test the first element has lower priority than the second.
+ */
+static bool_t _priority_queue_elem_less(const priority_queue_t* cppque_pqueue, const _byte_t* cpby_first, const _byte_t* cpby_second)
+{
+    bool_t b_result = _GET_VECTOR_TYPE_SIZE(&cppque_pqueue->_vec_base);
+
+    /* char* is stored as string_t, but the priority rule accept char* */
+    if (!cppque_pqueue->_t_isbitwise &&
+        strncmp(_GET_VECTOR_TYPE_BASENAME(&cppque_pqueue->_vec_base), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+        cppque_pqueue->_bfun_priority(
+            string_c_str((const string_t*)cpby_first), string_c_str((const string_t*)cpby_second), &b_result);
+    } else {
+        cppque_pqueue->_bfun_priority(cpby_first, cpby_second, &b_result);
+    }
+
+    return b_result;
+}
+
+/**
+ * Move element to destination.
+ */
+static void _priority_queue_move_elem(priority_queue_t* ppque_pqueue, _byte_t* pby_dest, const _byte_t* cpby_src)
+{
+    if (ppque_pqueue->_t_isbitwise) {
+        memcpy(pby_dest, cpby_src, _GET_VECTOR_TYPE_SIZE(&ppque_pqueue->_vec_base));
+    } else {
+        bool_t b_result = _GET_VECTOR_TYPE_SIZE(&ppque_pqueue->_vec_base);
+        _GET_VECTOR_TYPE_COPY_FUNCTION(&ppque_pqueue->_vec_base)(pby_dest, cpby_src, &b_result);
+        assert(b_result);
+    }
+}
+
+/** eof **/
+
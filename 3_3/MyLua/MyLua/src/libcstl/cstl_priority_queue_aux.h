@@ -0,0 +1,140 @@
+/*
+ *  The interface of auxiliary priority queue.
+ *  Copyright (C)  2008 - 2013  Wangbo
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *  Author e-mail: activesys.wb@gmail.com
+ *                 activesys@sina.com.cn
+ */
+
+
+#ifndef _CSTL_PRIORITY_QUEUE_AUX_H_
+#define _CSTL_PRIORITY_QUEUE_AUX_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** include section **/
+
+/** constant declaration and macro section **/
+/* children count of each heap node */
+#ifdef CSTL_PRIORITY_QUEUE_4ARY_HEAP
+#define _PRIORITY_QUEUE_HEAP_ARITY    4
+#else
+#define _PRIORITY_QUEUE_HEAP_ARITY    2
+#endif
+
+#define _PRIORITY_QUEUE_ELEM(ppque_pqueue, t_pos)\
+    ((_byte_t*)vector_data(&(ppque_pqueue)->_vec_base) + (t_pos) * _GET_VECTOR_TYPE_SIZE(&(ppque_pqueue)->_vec_base))
+
+/** data type declaration and struct, union, enum section **/
+
+/** exported global variable declaration section **/
+
+/** exported function prototype section **/
+/**
+ * Get the scratch element after the last element of priority queue.
+ * @param ppque_pqueue      priority queue adaptor.
+ * @return pointer to scratch element.
+ * @remarks if ppque_pqueue == NULL, then the behavior is undefined. the scratch element is stored in the spare capacity of
+ *          the underlying vector, it must be released by _priority_queue_release_scratch() before the vector is modified.
+ */
+extern _byte_t* _priority_queue_get_scratch(priority_queue_t* ppque_pqueue);
+
+/**
+ * Release the scratch element.
+ * @param ppque_pqueue      priority queue adaptor.
+ * @param pby_scratch       scratch element.
+ * @return void.
+ * @remarks if ppque_pqueue == NULL or pby_scratch == NULL, then the behavior is undefined.
+ */
+extern void _priority_queue_release_scratch(priority_queue_t* ppque_pqueue, _byte_t* pby_scratch);
+
+/**
+ * Move the element at specific position up to its place in heap.
+ * @param ppque_pqueue      priority queue adaptor.
+ * @param t_pos             position of element.
+ * @param pby_scratch       scratch element.
+ * @return void.
+ * @remarks if ppque_pqueue == NULL or pby_scratch == NULL, then the behavior is undefined. the elements before t_pos must
+ *          be a heap.
+ */
+extern void _priority_queue_sift_up(priority_queue_t* ppque_pqueue, size_t t_pos, _byte_t* pby_scratch);
+
+/**
+ * Move the element at specific position down to its place in heap.
+ * @param ppque_pqueue      priority queue adaptor.
+ * @param t_pos             position of element.
+ * @param pby_scratch       scratch element.
+ * @return void.
+ * @remarks if ppque_pqueue == NULL or pby_scratch == NULL, then the behavior is undefined. the sub heaps of t_pos must
+ *          be heaps.
+ */
+extern void _priority_queue_sift_down(priority_queue_t* ppque_pqueue, size_t t_pos, _byte_t* pby_scratch);
+
+/**
+ * Converts all elements of priority queue into a heap in O(n).
+ * @param ppque_pqueue      priority queue adaptor.
+ * @param t_first           the first position that may violate the heap, elements before it is a heap.
+ * @return void.
+ * @remarks if ppque_pqueue == NULL, then the behavior is undefined.
+ */
+extern void _priority_queue_make_heap(priority_queue_t* ppque_pqueue, size_t t_first);
+
+/**
+ * Remove the element at specific position.
+ * @param ppque_pqueue      priority queue adaptor.
+ * @param t_pos             position of element.
+ * @return void.
+ * @remarks if ppque_pqueue == NULL, then the behavior is undefined. t_pos must be less than size of priority queue.
+ */
+extern void _priority_queue_erase_pos(priority_queue_t* ppque_pqueue, size_t t_pos);
+
+/**
+ * Resolve the priority rule of priority queue.
+ * @param ppque_pqueue      priority queue adaptor.
+ * @param bfun_op           user defined priority rule.
+ * @return void.
+ * @remarks if ppque_pqueue == NULL, then the behavior is undefined. the default priority rule is less function of
+ *          element type if bfun_op == NULL.
+ */
+extern void _priority_queue_init_priority(priority_queue_t* ppque_pqueue, bfun_t bfun_op);
+
+/**
+ * Initialize the key index of indexed priority queue.
+ * @param ppque_pqueue      priority queue adaptor.
+ * @param t_keycount        count of keys.
+ * @return void.
+ * @remarks if ppque_pqueue == NULL, then the behavior is undefined.
+ */
+extern void _priority_queue_init_index(priority_queue_t* ppque_pqueue, size_t t_keycount);
+
+/**
+ * Destroy the key index of indexed priority queue.
+ * @param ppque_pqueue      priority queue adaptor.
+ * @return void.
+ * @remarks if ppque_pqueue == NULL, then the behavior is undefined.
+ */
+extern void _priority_queue_destroy_index(priority_queue_t* ppque_pqueue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CSTL_PRIORITY_QUEUE_AUX_H_ */
+/** eof **/
+
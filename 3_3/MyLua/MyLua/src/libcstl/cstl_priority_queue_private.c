@@ -25,8 +25,12 @@
 #include "cfunctional.h"
 #include "cutility.h"
 #include "calgorithm.h"
+#include "cstring.h"
 #include "cqueue.h"
 
+#include "cstl_vector_aux.h"
+#include "cstl_priority_queue_aux.h"
+
 /** local constant declaration and local macro section **/
 
 /** local data type declaration and local struct, union, enum section **/
@@ -71,6 +75,17 @@ bool_t _create_priority_queue_auxiliary(priority_queue_t* ppque_pqueue,  const c
         return false;
     }
     ppque_pqueue->_bfun_priority = NULL;
+    ppque_pqueue->_pt_poskey = NULL;
+    ppque_pqueue->_pt_keypos = NULL;
+    ppque_pqueue->_t_keycount = 0;
+
+    /* c builtin elements except char* are moved by memcpy in heap */
+    if (_GET_VECTOR_TYPE_STYLE(&ppque_pqueue->_vec_base) == _TYPE_C_BUILTIN &&
+        strncmp(_GET_VECTOR_TYPE_BASENAME(&ppque_pqueue->_vec_base), _C_STRING_TYPE, _TYPE_NAME_SIZE) != 0) {
+        ppque_pqueue->_t_isbitwise = true;
+    } else {
+        ppque_pqueue->_t_isbitwise = false;
+    }
 
     return true;
 }
@@ -83,6 +98,7 @@ void _priority_queue_destroy_auxiliary(priority_queue_t* ppque_pqueue)
     assert(ppque_pqueue != NULL);
 
     _vector_destroy_auxiliary(&ppque_pqueue->_vec_base);
+    _priority_queue_destroy_index(ppque_pqueue);
     ppque_pqueue->_bfun_priority = NULL;
 }
 
@@ -91,15 +107,72 @@ void _priority_queue_destroy_auxiliary(priority_queue_t* ppque_pqueue)
  */
 void _priority_queue_push(priority_queue_t* ppque_pqueue, ...)
 {
-    va_list val_elemlist;
+    va_list  val_elemlist;
+    _byte_t* pby_scratch = NULL;
 
     assert(ppque_pqueue != NULL);
+    assert(ppque_pqueue->_pt_keypos == NULL);
 
     va_start(val_elemlist, ppque_pqueue);
     _vector_push_back_varg(&ppque_pqueue->_vec_base, val_elemlist);
     va_end(val_elemlist);
 
-    algo_push_heap_if(vector_begin(&ppque_pqueue->_vec_base), vector_end(&ppque_pqueue->_vec_base), ppque_pqueue->_bfun_priority);
+    pby_scratch = _priority_queue_get_scratch(ppque_pqueue);
+    _priority_queue_sift_up(ppque_pqueue, vector_size(&ppque_pqueue->_vec_base) - 1, pby_scratch);
+    _priority_queue_release_scratch(ppque_pqueue, pby_scratch);
+}
+
+/**
+ * Add specificed element with key into indexed priority queue.
+ */
+void _priority_queue_push_indexed(priority_queue_t* ppque_pqueue, size_t t_key, ...)
+{
+    va_list  val_elemlist;
+    size_t   t_pos = 0;
+    _byte_t* pby_scratch = NULL;
+
+    assert(ppque_pqueue != NULL);
+    assert(ppque_pqueue->_pt_keypos != NULL);
+    assert(t_key < ppque_pqueue->_t_keycount);
+    assert(ppque_pqueue->_pt_keypos[t_key] == NPOS);
+
+    va_start(val_elemlist, t_key);
+    _vector_push_back_varg(&ppque_pqueue->_vec_base, val_elemlist);
+    va_end(val_elemlist);
+
+    t_pos = vector_size(&ppque_pqueue->_vec_base) - 1;
+    ppque_pqueue->_pt_poskey[t_pos] = t_key;
+    ppque_pqueue->_pt_keypos[t_key] = t_pos;
+
+    pby_scratch = _priority_queue_get_scratch(ppque_pqueue);
+    _priority_queue_sift_up(ppque_pqueue, t_pos, pby_scratch);
+    _priority_queue_release_scratch(ppque_pqueue, pby_scratch);
+}
+
+/**
+ * Update the element of key in indexed priority queue.
+ */
+void _priority_queue_update_indexed(priority_queue_t* ppque_pqueue, size_t t_key, ...)
+{
+    va_list  val_elemlist;
+    size_t   t_pos = 0;
+    _byte_t* pby_scratch = NULL;
+
+    assert(ppque_pqueue != NULL);
+    assert(ppque_pqueue->_pt_keypos != NULL);
+    assert(t_key < ppque_pqueue->_t_keycount);
+    assert(ppque_pqueue->_pt_keypos[t_key] != NPOS);
+
+    t_pos = ppque_pqueue->_pt_keypos[t_key];
+    va_start(val_elemlist, t_key);
+    _type_get_varg_value(&ppque_pqueue->_vec_base._t_typeinfo, val_elemlist, _PRIORITY_QUEUE_ELEM(ppque_pqueue, t_pos));
+    va_end(val_elemlist);
+
+    /* the new element may have higher or lower priority */
+    pby_scratch = _priority_queue_get_scratch(ppque_pqueue);
+    _priority_queue_sift_up(ppque_pqueue, t_pos, pby_scratch);
+    _priority_queue_sift_down(ppque_pqueue, ppque_pqueue->_pt_keypos[t_key], pby_scratch);
+    _priority_queue_release_scratch(ppque_pqueue, pby_scratch);
 }
 
 /** local function implementation section **/
@@ -31,10 +31,19 @@ extern "C" {
 /** constant declaration and macro section **/
 
 /** data type declaration and struct, union, enum section **/
+/*
+ * priority queue is a binary heap default, CSTL_PRIORITY_QUEUE_4ARY_HEAP selects 4-ary heap.
+ * the indexed priority queue maps key in [0, _t_keycount) to the element, _pt_poskey is the key of
+ * element at each heap position and _pt_keypos is the heap position of each key, NPOS if the key is not in use.
+ */
 typedef struct _tagpriority_queue
 {
     vector_t          _vec_base;
     bfun_t            _bfun_priority;
+    bool_t            _t_isbitwise;   /* elements can be moved by memcpy */
+    size_t*           _pt_poskey;
+    size_t*           _pt_keypos;
+    size_t            _t_keycount;
 }priority_queue_t;
 
 /** exported global variable declaration section **/
@@ -79,6 +88,28 @@ extern void _priority_queue_destroy_auxiliary(priority_queue_t* ppque_pqueue);
  */
 extern void _priority_queue_push(priority_queue_t* ppque_pqueue, ...);
 
+/**
+ * Add specificed element with key into indexed priority queue.
+ * @param ppque_pqueue    priority queue adaptor.
+ * @param t_key           key of element.
+ * @param ...             specificed element.
+ * @return void.
+ * @remarks if ppque_pqueue == NULL or priority queue is not initialized as indexed, then the behavior is undefined. t_key
+ *          must be less than key count and not in use, otherwise the behavior is undefined.
+ */
+extern void _priority_queue_push_indexed(priority_queue_t* ppque_pqueue, size_t t_key, ...);
+
+/**
+ * Update the element of key in indexed priority queue, the element can be increased or decreased.
+ * @param ppque_pqueue    priority queue adaptor.
+ * @param t_key           key of element.
+ * @param ...             new element.
+ * @return void.
+ * @remarks if ppque_pqueue == NULL or priority queue is not initialized as indexed, then the behavior is undefined. t_key
+ *          must be in use, otherwise the behavior is undefined.
+ */
+extern void _priority_queue_update_indexed(priority_queue_t* ppque_pqueue, size_t t_key, ...);
+
 #ifdef __cplusplus
 }
 #endif
@@ -117,6 +117,21 @@ size_t queue_size(const queue_t* cpque_queue)
 #endif
 }
 
+/**
+ * Get the memory that queue allocates.
+ */
+size_t queue_memory_usage(const queue_t* cpque_queue)
+{
+    assert(cpque_queue != NULL);
+
+    /* queue_t holds only the sequence */
+#ifdef CSTL_QUEUE_LIST_SEQUENCE
+    return list_memory_usage(&cpque_queue->_t_sequence);
+#else
+    return deque_memory_usage(&cpque_queue->_t_sequence);
+#endif
+}
+
 /**
  * Access queue front data.
  */
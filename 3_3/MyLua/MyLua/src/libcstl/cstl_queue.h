@@ -111,6 +111,15 @@ extern bool_t queue_empty(const queue_t* cpque_queue);
  */
 extern size_t queue_size(const queue_t* cpque_queue);
 
+/**
+ * Get the memory that queue allocates.
+ * @param cpque_queue  queue adaptor.
+ * @return the bytes of queue_t and the memory that the underlying sequence allocates.
+ * @remarks if cpque_queue == NULL, then the behavior is undefined. the cpque_queue must be initialized, otherwise the
+ *          behavior is undefine.
+ */
+extern size_t queue_memory_usage(const queue_t* cpque_queue);
+
 /**
  * Access queue front data.
  * @param cpque_queue  queue adaptor.
@@ -76,6 +76,9 @@ void _rb_tree_init(_rb_tree_t* pt_rb_tree, bfun_t t_compare)
 
 
     pt_rb_tree->_t_compare = t_compare != NULL ? t_compare : _GET_RB_TREE_TYPE_LESS_FUNCTION(pt_rb_tree);
+    /* the default compare function can be replaced by the less function without output */
+    pt_rb_tree->_t_fastcompare = pt_rb_tree->_t_compare == _GET_RB_TREE_TYPE_LESS_FUNCTION(pt_rb_tree) ?
+        _GET_RB_TREE_TYPE_LESS_FAST_FUNCTION(pt_rb_tree) : NULL;
 }
 
 /**
@@ -605,16 +608,14 @@ _rb_tree_iterator_t _rb_tree_lower_bound(const _rb_tree_t* cpt_rb_tree, const vo
     if (!_rb_tree_empty(cpt_rb_tree)) {
         pt_prev = cpt_rb_tree->_t_rbroot._pt_parent;
 
-        b_less = b_greater = _GET_RB_TREE_TYPE_SIZE(cpt_rb_tree);
-        _rb_tree_elem_compare_auxiliary(cpt_rb_tree, cpv_value, pt_prev->_pby_data, &b_less);
-        _rb_tree_elem_compare_auxiliary(cpt_rb_tree, pt_prev->_pby_data, cpv_value, &b_greater);
+        b_less = _rb_tree_elem_less_auxiliary(cpt_rb_tree, cpv_value, pt_prev->_pby_data);
+        b_greater = _rb_tree_elem_less_auxiliary(cpt_rb_tree, pt_prev->_pby_data, cpv_value);
 
         pt_cur = (b_less || !b_greater) ? pt_prev->_pt_left : pt_prev->_pt_right;
         while (pt_cur != NULL) {
             pt_prev = pt_cur;
-            b_less = b_greater = _GET_RB_TREE_TYPE_SIZE(cpt_rb_tree);
-            _rb_tree_elem_compare_auxiliary(cpt_rb_tree, cpv_value, pt_prev->_pby_data, &b_less);
-            _rb_tree_elem_compare_auxiliary(cpt_rb_tree, pt_prev->_pby_data, cpv_value, &b_greater);
+            b_less = _rb_tree_elem_less_auxiliary(cpt_rb_tree, cpv_value, pt_prev->_pby_data);
+            b_greater = _rb_tree_elem_less_auxiliary(cpt_rb_tree, pt_prev->_pby_data, cpv_value);
 
             pt_cur = (b_less || !b_greater) ? pt_prev->_pt_left : pt_prev->_pt_right;
         }
@@ -655,14 +656,12 @@ _rb_tree_iterator_t _rb_tree_upper_bound(const _rb_tree_t* cpt_rb_tree, const vo
     if (!_rb_tree_empty(cpt_rb_tree)) {
         pt_prev = cpt_rb_tree->_t_rbroot._pt_parent;
 
-        b_result = _GET_RB_TREE_TYPE_SIZE(cpt_rb_tree);
-        _rb_tree_elem_compare_auxiliary(cpt_rb_tree, cpv_value, pt_prev->_pby_data, &b_result);
+        b_result = _rb_tree_elem_less_auxiliary(cpt_rb_tree, cpv_value, pt_prev->_pby_data);
 
         pt_cur = b_result ? pt_prev->_pt_left : pt_prev->_pt_right;
         while (pt_cur != NULL) {
             pt_prev = pt_cur;
-            b_result = _GET_RB_TREE_TYPE_SIZE(cpt_rb_tree);
-            _rb_tree_elem_compare_auxiliary(cpt_rb_tree, cpv_value, pt_prev->_pby_data, &b_result);
+            b_result = _rb_tree_elem_less_auxiliary(cpt_rb_tree, cpv_value, pt_prev->_pby_data);
 
             pt_cur = b_result ? pt_prev->_pt_left : pt_prev->_pt_right;
         }
@@ -1242,6 +1241,17 @@ size_t _rb_tree_erase(_rb_tree_t* pt_rb_tree, const void* cpv_value)
     return t_count;
 }
 
+/**
+ * Get the memory that rb tree allocates.
+ */
+size_t _rb_tree_memory_usage(const _rb_tree_t* cpt_rb_tree)
+{
+    assert(cpt_rb_tree != NULL);
+    assert(_rb_tree_is_inited(cpt_rb_tree));
+
+    return _alloc_memory_usage(&cpt_rb_tree->_t_allocator);
+}
+
 /** local function implementation section **/
 
 /** eof **/
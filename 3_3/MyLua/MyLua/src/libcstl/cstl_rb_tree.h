@@ -499,6 +499,15 @@ extern void _rb_tree_erase_range(_rb_tree_t* pt_rb_tree, _rb_tree_iterator_t it_
  */
 extern size_t _rb_tree_erase(_rb_tree_t* pt_rb_tree, const void* cpv_value);
 
+/**
+ * Get the memory that rb tree allocates.
+ * @param cpt_rb_tree       rb tree container.
+ * @return the bytes of nodes.
+ * @remarks if cpt_rb_tree == NULL then the behavior is undefined. cpt_rb_tree must be initialized, otherwise
+ *          the behavior is undefined. the _rb_tree_t itself is not counted.
+ */
+extern size_t _rb_tree_memory_usage(const _rb_tree_t* cpt_rb_tree);
+
 #ifdef __cplusplus
 }
 #endif
@@ -237,14 +237,12 @@ _rbnode_t* _rb_tree_find_value(const _rb_tree_t* cpt_rb_tree, const _rbnode_t* c
         return NULL;
     }
 
-    b_result = _GET_RB_TREE_TYPE_SIZE(cpt_rb_tree);
-    _rb_tree_elem_compare_auxiliary(cpt_rb_tree, cpv_value, cpt_root->_pby_data, &b_result);
+    b_result = _rb_tree_elem_less_auxiliary(cpt_rb_tree, cpv_value, cpt_root->_pby_data);
     if (b_result) {
         return _rb_tree_find_value(cpt_rb_tree, cpt_root->_pt_left, cpv_value);
     }
 
-    b_result = _GET_RB_TREE_TYPE_SIZE(cpt_rb_tree);
-    _rb_tree_elem_compare_auxiliary(cpt_rb_tree, cpt_root->_pby_data, cpv_value, &b_result);
+    b_result = _rb_tree_elem_less_auxiliary(cpt_rb_tree, cpt_root->_pby_data, cpv_value);
     
     return b_result ? _rb_tree_find_value(cpt_rb_tree, cpt_root->_pt_right, cpv_value) : (_rbnode_t*)cpt_root;
 }
@@ -328,16 +326,14 @@ _rbnode_t* _rb_tree_insert_rbnode(_rb_tree_t* pt_rb_tree, const void* cpv_value)
     } else {
         pt_parent = pt_rb_tree->_t_rbroot._pt_parent;
 
-        b_less = _GET_RB_TREE_TYPE_SIZE(pt_rb_tree);
-        _rb_tree_elem_compare_auxiliary(pt_rb_tree, cpv_value, pt_parent->_pby_data, &b_less);
+        b_less = _rb_tree_elem_less_auxiliary(pt_rb_tree, cpv_value, pt_parent->_pby_data);
 
         pt_cur = b_less ? pt_parent->_pt_left : pt_parent->_pt_right;
         /* from the root to insert position */
         while (pt_cur != NULL) {
             /* next current position */
             pt_parent = pt_cur;
-            b_less = _GET_RB_TREE_TYPE_SIZE(pt_rb_tree);
-            _rb_tree_elem_compare_auxiliary(pt_rb_tree, cpv_value, pt_parent->_pby_data, &b_less);
+            b_less = _rb_tree_elem_less_auxiliary(pt_rb_tree, cpv_value, pt_parent->_pby_data);
 
             pt_cur = b_less ? pt_parent->_pt_left : pt_parent->_pt_right;
         }
@@ -1037,25 +1033,39 @@ void _rb_tree_init_elem_auxiliary(_rb_tree_t* pt_rb_tree, _rbnode_t* pt_node)
 }
 
 /**
- * Element compare function auxiliary
+ * Element less function auxiliary
  */
-void _rb_tree_elem_compare_auxiliary(
-    const _rb_tree_t* cpt_rb_tree, const void* cpv_first, const void* cpv_second, void* pv_output)
+bool_t _rb_tree_elem_less_auxiliary(const _rb_tree_t* cpt_rb_tree, const void* cpv_first, const void* cpv_second)
 {
     assert(cpt_rb_tree != NULL);
     assert(cpv_first != NULL);
     assert(cpv_second != NULL);
-    assert(pv_output != NULL); 
     assert(_rb_tree_is_inited(cpt_rb_tree));
 
-    if (strncmp(_GET_RB_TREE_TYPE_BASENAME(cpt_rb_tree), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0 &&
-        cpt_rb_tree->_t_compare != _GET_RB_TREE_TYPE_LESS_FUNCTION(cpt_rb_tree)) {
-        cpt_rb_tree->_t_compare(string_c_str((string_t*)cpv_first), string_c_str((string_t*)cpv_second), pv_output);
+    if (cpt_rb_tree->_t_fastcompare != NULL) {
+        return cpt_rb_tree->_t_fastcompare(cpv_first, cpv_second);
     } else {
-        cpt_rb_tree->_t_compare(cpv_first, cpv_second, pv_output);
+        bool_t b_result = _GET_RB_TREE_TYPE_SIZE(cpt_rb_tree);
+        if (strncmp(_GET_RB_TREE_TYPE_BASENAME(cpt_rb_tree), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0 &&
+            cpt_rb_tree->_t_compare != _GET_RB_TREE_TYPE_LESS_FUNCTION(cpt_rb_tree)) {
+            cpt_rb_tree->_t_compare(string_c_str((string_t*)cpv_first), string_c_str((string_t*)cpv_second), &b_result);
+        } else {
+            cpt_rb_tree->_t_compare(cpv_first, cpv_second, &b_result);
+        }
+        return b_result;
     }
 }
 
+/**
+ * Element compare function auxiliary
+ */
+void _rb_tree_elem_compare_auxiliary(
+    const _rb_tree_t* cpt_rb_tree, const void* cpv_first, const void* cpv_second, void* pv_output)
+{
+    assert(pv_output != NULL);
+    *(bool_t*)pv_output = _rb_tree_elem_less_auxiliary(cpt_rb_tree, cpv_first, cpv_second);
+}
+
 /** local function implementation section **/
 
 /** eof **/
@@ -65,6 +65,7 @@ bool_t _create_rb_tree_auxiliary(_rb_tree_t* pt_rb_tree, const char* s_typename)
     pt_rb_tree->_t_nodecount = 0;
 
     pt_rb_tree->_t_compare = NULL;
+    pt_rb_tree->_t_fastcompare = NULL;
 
     _alloc_init(&pt_rb_tree->_t_allocator);
     return true;
@@ -89,6 +90,7 @@ void _rb_tree_destroy_auxiliary(_rb_tree_t* pt_rb_tree)
     _alloc_destroy(&pt_rb_tree->_t_allocator);
 
     pt_rb_tree->_t_compare = NULL;
+    pt_rb_tree->_t_fastcompare = NULL;
 }
 
 /** local function implementation section **/
@@ -74,6 +74,7 @@ typedef struct _tagrbtree
 
     /* compare function for the inserting order */
     bfun_t            _t_compare;
+    lfun_t            _t_fastcompare; /* the type less function without output or NULL */
 }_rb_tree_t;
 
 /** exported global variable declaration section **/
@@ -49,6 +49,8 @@ void set_init(set_t* pset_set)
 
 #ifdef CSTL_SET_AVL_TREE
     _avl_tree_init(&pset_set->_t_tree, NULL);
+#elif defined(CSTL_SET_BP_TREE)
+    _bp_tree_init(&pset_set->_t_tree, NULL);
 #else
     _rb_tree_init(&pset_set->_t_tree, NULL);
 #endif
@@ -63,6 +65,8 @@ void set_init_ex(set_t* pset_set, bfun_t bfun_compare)
 
 #ifdef CSTL_SET_AVL_TREE
     _avl_tree_init(&pset_set->_t_tree, bfun_compare);
+#elif defined(CSTL_SET_BP_TREE)
+    _bp_tree_init(&pset_set->_t_tree, bfun_compare);
 #else
     _rb_tree_init(&pset_set->_t_tree, bfun_compare);
 #endif
@@ -77,6 +81,8 @@ void set_destroy(set_t* pset_set)
 
 #ifdef CSTL_SET_AVL_TREE
     _avl_tree_destroy(&pset_set->_t_tree);
+#elif defined(CSTL_SET_BP_TREE)
+    _bp_tree_destroy(&pset_set->_t_tree);
 #else
     _rb_tree_destroy(&pset_set->_t_tree);
 #endif
@@ -92,6 +98,8 @@ void set_init_copy(set_t* pset_dest, const set_t* cpset_src)
 
 #ifdef CSTL_SET_AVL_TREE
     _avl_tree_init_copy(&pset_dest->_t_tree, &cpset_src->_t_tree);
+#elif defined(CSTL_SET_BP_TREE)
+    _bp_tree_init_copy(&pset_dest->_t_tree, &cpset_src->_t_tree);
 #else
     _rb_tree_init_copy(&pset_dest->_t_tree, &cpset_src->_t_tree);
 #endif
@@ -107,6 +115,8 @@ void set_init_copy_range(set_t* pset_dest, iterator_t it_begin, iterator_t it_en
 
 #ifdef CSTL_SET_AVL_TREE
     _avl_tree_init_copy_unique_range(&pset_dest->_t_tree, it_begin, it_end);
+#elif defined(CSTL_SET_BP_TREE)
+    _bp_tree_init_copy_unique_range(&pset_dest->_t_tree, it_begin, it_end);
 #else
     _rb_tree_init_copy_unique_range(&pset_dest->_t_tree, it_begin, it_end);
 #endif
@@ -122,6 +132,8 @@ void set_init_copy_array(set_t* pset_dest, const void* cpv_array, size_t t_count
 
 #ifdef CSTL_SET_AVL_TREE
     _avl_tree_init_copy_unique_array(&pset_dest->_t_tree, cpv_array, t_count);
+#elif defined(CSTL_SET_BP_TREE)
+    _bp_tree_init_copy_unique_array(&pset_dest->_t_tree, cpv_array, t_count);
 #else
     _rb_tree_init_copy_unique_array(&pset_dest->_t_tree, cpv_array, t_count);
 #endif
@@ -138,6 +150,8 @@ void set_init_copy_range_ex(
 
 #ifdef CSTL_SET_AVL_TREE
     _avl_tree_init_copy_unique_range_ex(&pset_dest->_t_tree, it_begin, it_end, bfun_compare);
+#elif defined(CSTL_SET_BP_TREE)
+    _bp_tree_init_copy_unique_range_ex(&pset_dest->_t_tree, it_begin, it_end, bfun_compare);
 #else
     _rb_tree_init_copy_unique_range_ex(&pset_dest->_t_tree, it_begin, it_end, bfun_compare);
 #endif
@@ -154,6 +168,8 @@ void set_init_copy_array_ex(
 
 #ifdef CSTL_SET_AVL_TREE
     _avl_tree_init_copy_unique_array_ex(&pset_dest->_t_tree, cpv_array, t_count, bfun_compare);
+#elif defined(CSTL_SET_BP_TREE)
+    _bp_tree_init_copy_unique_array_ex(&pset_dest->_t_tree, cpv_array, t_count, bfun_compare);
 #else
     _rb_tree_init_copy_unique_array_ex(&pset_dest->_t_tree, cpv_array, t_count, bfun_compare);
 #endif
@@ -169,6 +185,8 @@ void set_assign(set_t* pset_dest, const set_t* cpset_src)
 
 #ifdef CSTL_SET_AVL_TREE
     _avl_tree_assign(&pset_dest->_t_tree, &cpset_src->_t_tree);
+#elif defined(CSTL_SET_BP_TREE)
+    _bp_tree_assign(&pset_dest->_t_tree, &cpset_src->_t_tree);
 #else
     _rb_tree_assign(&pset_dest->_t_tree, &cpset_src->_t_tree);
 #endif
@@ -183,6 +201,8 @@ bool_t set_empty(const set_t* cpset_set)
 
 #ifdef CSTL_SET_AVL_TREE
     return _avl_tree_empty(&cpset_set->_t_tree);
+#elif defined(CSTL_SET_BP_TREE)
+    return _bp_tree_empty(&cpset_set->_t_tree);
 #else
     return _rb_tree_empty(&cpset_set->_t_tree);
 #endif
@@ -197,6 +217,8 @@ size_t set_size(const set_t* cpset_set)
 
 #ifdef CSTL_SET_AVL_TREE
     return _avl_tree_size(&cpset_set->_t_tree);
+#elif defined(CSTL_SET_BP_TREE)
+    return _bp_tree_size(&cpset_set->_t_tree);
 #else
     return _rb_tree_size(&cpset_set->_t_tree);
 #endif
@@ -211,11 +233,29 @@ size_t set_max_size(const set_t* cpset_set)
 
 #ifdef CSTL_SET_AVL_TREE
     return _avl_tree_max_size(&cpset_set->_t_tree);
+#elif defined(CSTL_SET_BP_TREE)
+    return _bp_tree_max_size(&cpset_set->_t_tree);
 #else
     return _rb_tree_max_size(&cpset_set->_t_tree);
 #endif
 }
 
+/**
+ * Get the memory that set allocates.
+ */
+size_t set_memory_usage(const set_t* cpset_set)
+{
+    assert(cpset_set != NULL);
+
+#ifdef CSTL_SET_AVL_TREE
+    return sizeof(set_t) + _avl_tree_memory_usage(&cpset_set->_t_tree);
+#elif defined(CSTL_SET_BP_TREE)
+    return sizeof(set_t) + _bp_tree_memory_usage(&cpset_set->_t_tree);
+#else
+    return sizeof(set_t) + _rb_tree_memory_usage(&cpset_set->_t_tree);
+#endif
+}
+
 /**
  * Return an iterator that addresses the first element in the set.
  */
@@ -227,6 +267,8 @@ set_iterator_t set_begin(const set_t* cpset_set)
 
 #ifdef CSTL_SET_AVL_TREE
     it_begin = _avl_tree_begin(&cpset_set->_t_tree);
+#elif defined(CSTL_SET_BP_TREE)
+    it_begin = _bp_tree_begin(&cpset_set->_t_tree);
 #else
     it_begin = _rb_tree_begin(&cpset_set->_t_tree);
 #endif
@@ -249,6 +291,8 @@ set_iterator_t set_end(const set_t* cpset_set)
 
 #ifdef CSTL_SET_AVL_TREE
     it_end = _avl_tree_end(&cpset_set->_t_tree);
+#elif defined(CSTL_SET_BP_TREE)
+    it_end = _bp_tree_end(&cpset_set->_t_tree);
 #else
     it_end = _rb_tree_end(&cpset_set->_t_tree);
 #endif
@@ -268,6 +312,8 @@ set_iterator_t set_rbegin(const set_t* cpset_set)
 
 #ifdef CSTL_SET_AVL_TREE
     it_rbegin = _avl_tree_rbegin(&cpset_set->_t_tree);
+#elif defined(CSTL_SET_BP_TREE)
+    it_rbegin = _bp_tree_rbegin(&cpset_set->_t_tree);
 #else
     it_rbegin = _rb_tree_rbegin(&cpset_set->_t_tree);
 #endif
@@ -287,6 +333,8 @@ set_iterator_t set_rend(const set_t* cpset_set)
 
 #ifdef CSTL_SET_AVL_TREE
     it_rend = _avl_tree_rend(&cpset_set->_t_tree);
+#elif defined(CSTL_SET_BP_TREE)
+    it_rend = _bp_tree_rend(&cpset_set->_t_tree);
 #else
     it_rend = _rb_tree_rend(&cpset_set->_t_tree);
 #endif
@@ -307,6 +355,8 @@ bfun_t set_key_comp(const set_t* cpset_set)
 
 #ifdef CSTL_SET_AVL_TREE
     return _avl_tree_key_comp(&cpset_set->_t_tree);
+#elif defined(CSTL_SET_BP_TREE)
+    return _bp_tree_key_comp(&cpset_set->_t_tree);
 #else
     return _rb_tree_key_comp(&cpset_set->_t_tree);
 #endif
@@ -329,6 +379,8 @@ void set_clear(set_t* pset_set)
 
 #ifdef CSTL_SET_AVL_TREE
     _avl_tree_clear(&pset_set->_t_tree);
+#elif defined(CSTL_SET_BP_TREE)
+    _bp_tree_clear(&pset_set->_t_tree);
 #else
     _rb_tree_clear(&pset_set->_t_tree);
 #endif
@@ -344,6 +396,8 @@ bool_t set_equal(const set_t* cpset_first, const set_t* cpset_second)
 
 #ifdef CSTL_SET_AVL_TREE
     return _avl_tree_equal(&cpset_first->_t_tree, &cpset_second->_t_tree);
+#elif defined(CSTL_SET_BP_TREE)
+    return _bp_tree_equal(&cpset_first->_t_tree, &cpset_second->_t_tree);
 #else
     return _rb_tree_equal(&cpset_first->_t_tree, &cpset_second->_t_tree);
 #endif
@@ -359,6 +413,8 @@ bool_t set_not_equal(const set_t* cpset_first, const set_t* cpset_second)
 
 #ifdef CSTL_SET_AVL_TREE
     return _avl_tree_not_equal(&cpset_first->_t_tree, &cpset_second->_t_tree);
+#elif defined(CSTL_SET_BP_TREE)
+    return _bp_tree_not_equal(&cpset_first->_t_tree, &cpset_second->_t_tree);
 #else
     return _rb_tree_not_equal(&cpset_first->_t_tree, &cpset_second->_t_tree);
 #endif
@@ -374,6 +430,8 @@ bool_t set_less(const set_t* cpset_first, const set_t* cpset_second)
 
 #ifdef CSTL_SET_AVL_TREE
     return _avl_tree_less(&cpset_first->_t_tree, &cpset_second->_t_tree);
+#elif defined(CSTL_SET_BP_TREE)
+    return _bp_tree_less(&cpset_first->_t_tree, &cpset_second->_t_tree);
 #else
     return _rb_tree_less(&cpset_first->_t_tree, &cpset_second->_t_tree);
 #endif
@@ -389,6 +447,8 @@ bool_t set_less_equal(const set_t* cpset_first, const set_t* cpset_second)
 
 #ifdef CSTL_SET_AVL_TREE
     return _avl_tree_less_equal(&cpset_first->_t_tree, &cpset_second->_t_tree);
+#elif defined(CSTL_SET_BP_TREE)
+    return _bp_tree_less_equal(&cpset_first->_t_tree, &cpset_second->_t_tree);
 #else
     return _rb_tree_less_equal(&cpset_first->_t_tree, &cpset_second->_t_tree);
 #endif
@@ -404,6 +464,8 @@ bool_t set_greater(const set_t* cpset_first, const set_t* cpset_second)
 
 #ifdef CSTL_SET_AVL_TREE
     return _avl_tree_greater(&cpset_first->_t_tree, &cpset_second->_t_tree);
+#elif defined(CSTL_SET_BP_TREE)
+    return _bp_tree_greater(&cpset_first->_t_tree, &cpset_second->_t_tree);
 #else
     return _rb_tree_greater(&cpset_first->_t_tree, &cpset_second->_t_tree);
 #endif
@@ -419,6 +481,8 @@ bool_t set_greater_equal(const set_t* cpset_first, const set_t* cpset_second)
 
 #ifdef CSTL_SET_AVL_TREE
     return _avl_tree_greater_equal(&cpset_first->_t_tree, &cpset_second->_t_tree);
+#elif defined(CSTL_SET_BP_TREE)
+    return _bp_tree_greater_equal(&cpset_first->_t_tree, &cpset_second->_t_tree);
 #else
     return _rb_tree_greater_equal(&cpset_first->_t_tree, &cpset_second->_t_tree);
 #endif
@@ -434,6 +498,8 @@ void set_swap(set_t* pset_first, set_t* pset_second)
 
 #ifdef CSTL_SET_AVL_TREE
     _avl_tree_swap(&pset_first->_t_tree, &pset_second->_t_tree);
+#elif defined(CSTL_SET_BP_TREE)
+    _bp_tree_swap(&pset_first->_t_tree, &pset_second->_t_tree);
 #else
     _rb_tree_swap(&pset_first->_t_tree, &pset_second->_t_tree);
 #endif
@@ -449,6 +515,8 @@ void set_insert_range(set_t* pset_set, iterator_t it_begin, iterator_t it_end)
 
 #ifdef CSTL_SET_AVL_TREE
     _avl_tree_insert_unique_range(&pset_set->_t_tree, it_begin, it_end);
+#elif defined(CSTL_SET_BP_TREE)
+    _bp_tree_insert_unique_range(&pset_set->_t_tree, it_begin, it_end);
 #else
     _rb_tree_insert_unique_range(&pset_set->_t_tree, it_begin, it_end);
 #endif
@@ -464,6 +532,8 @@ void set_insert_array(set_t* pset_set, const void* cpv_array, size_t t_count)
 
 #ifdef CSTL_SET_AVL_TREE
     _avl_tree_insert_unique_array(&pset_set->_t_tree, cpv_array, t_count);
+#elif defined(CSTL_SET_BP_TREE)
+    _bp_tree_insert_unique_array(&pset_set->_t_tree, cpv_array, t_count);
 #else
     _rb_tree_insert_unique_array(&pset_set->_t_tree, cpv_array, t_count);
 #endif
@@ -481,6 +551,8 @@ void set_erase_pos(set_t* pset_set, set_iterator_t it_pos)
 
 #ifdef CSTL_SET_AVL_TREE
     _avl_tree_erase_pos(&pset_set->_t_tree, it_pos);
+#elif defined(CSTL_SET_BP_TREE)
+    _bp_tree_erase_pos(&pset_set->_t_tree, it_pos);
 #else
     _rb_tree_erase_pos(&pset_set->_t_tree, it_pos);
 #endif
@@ -501,6 +573,8 @@ void set_erase_range(set_t* pset_set, set_iterator_t it_begin, set_iterator_t it
 
 #ifdef CSTL_SET_AVL_TREE
     _avl_tree_erase_range(&pset_set->_t_tree, it_begin, it_end);
+#elif defined(CSTL_SET_BP_TREE)
+    _bp_tree_erase_range(&pset_set->_t_tree, it_begin, it_end);
 #else
     _rb_tree_erase_range(&pset_set->_t_tree, it_begin, it_end);
 #endif
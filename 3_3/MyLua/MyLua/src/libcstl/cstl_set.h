@@ -252,6 +252,15 @@ extern bool_t set_empty(const set_t* cpset_set);
  */
 extern size_t set_max_size(const set_t* cpset_set);
 
+/**
+ * Get the memory that set allocates.
+ * @param cpset_set      set container.
+ * @return the bytes of set_t and all tree nodes.
+ * @remarks if cpset_set == NULL, then the behavior is undefined, the cpset_set must be initialized, otherwise the
+ *          behavior is undefined. the memory owned by elements such as string_t is not counted.
+ */
+extern size_t set_memory_usage(const set_t* cpset_set);
+
 /**
  * Return an iterator that addresses the first element in the set.
  * @param cpset_set      set container.
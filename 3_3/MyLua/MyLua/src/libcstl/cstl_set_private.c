@@ -47,6 +47,8 @@ set_t* _create_set(const char* s_typename)
 {
 #ifdef CSTL_SET_AVL_TREE
     return (set_t*)_create_avl_tree(s_typename);
+#elif defined(CSTL_SET_BP_TREE)
+    return (set_t*)_create_bp_tree(s_typename);
 #else
     return (set_t*)_create_rb_tree(s_typename);
 #endif
@@ -62,6 +64,8 @@ bool_t _create_set_auxiliary(set_t* pset_set, const char* s_typename)
 
 #ifdef CSTL_SET_AVL_TREE
     return _create_avl_tree_auxiliary(&pset_set->_t_tree, s_typename);
+#elif defined(CSTL_SET_BP_TREE)
+    return _create_bp_tree_auxiliary(&pset_set->_t_tree, s_typename);
 #else
     return _create_rb_tree_auxiliary(&pset_set->_t_tree, s_typename);
 #endif
@@ -76,6 +80,8 @@ void _set_destroy_auxiliary(set_t* pset_set)
 
 #ifdef CSTL_SET_AVL_TREE
     _avl_tree_destroy_auxiliary(&pset_set->_t_tree);
+#elif defined(CSTL_SET_BP_TREE)
+    _bp_tree_destroy_auxiliary(&pset_set->_t_tree);
 #else
     _rb_tree_destroy_auxiliary(&pset_set->_t_tree);
 #endif
@@ -114,6 +120,8 @@ set_iterator_t _set_find_varg(const set_t* cpset_set, va_list val_elemlist)
 
 #ifdef CSTL_SET_AVL_TREE
     it_iter = _avl_tree_find(&cpset_set->_t_tree, pv_varg);
+#elif defined(CSTL_SET_BP_TREE)
+    it_iter = _bp_tree_find(&cpset_set->_t_tree, pv_varg);
 #else
     it_iter = _rb_tree_find(&cpset_set->_t_tree, pv_varg);
 #endif
@@ -161,6 +169,8 @@ size_t _set_count_varg(const set_t* cpset_set, va_list val_elemlist)
 
 #ifdef CSTL_SET_AVL_TREE
     t_count = _avl_tree_count(&cpset_set->_t_tree, pv_varg);
+#elif defined(CSTL_SET_BP_TREE)
+    t_count = _bp_tree_count(&cpset_set->_t_tree, pv_varg);
 #else
     t_count = _rb_tree_count(&cpset_set->_t_tree, pv_varg);
 #endif
@@ -204,6 +214,8 @@ set_iterator_t _set_lower_bound_varg(const set_t* cpset_set, va_list val_elemlis
 
 #ifdef CSTL_SET_AVL_TREE
     it_iter = _avl_tree_lower_bound(&cpset_set->_t_tree, pv_varg);
+#elif defined(CSTL_SET_BP_TREE)
+    it_iter = _bp_tree_lower_bound(&cpset_set->_t_tree, pv_varg);
 #else
     it_iter = _rb_tree_lower_bound(&cpset_set->_t_tree, pv_varg);
 #endif
@@ -251,6 +263,8 @@ set_iterator_t _set_upper_bound_varg(const set_t* cpset_set, va_list val_elemlis
 
 #ifdef CSTL_SET_AVL_TREE
     it_iter = _avl_tree_upper_bound(&cpset_set->_t_tree, pv_varg);
+#elif defined(CSTL_SET_BP_TREE)
+    it_iter = _bp_tree_upper_bound(&cpset_set->_t_tree, pv_varg);
 #else
     it_iter = _rb_tree_upper_bound(&cpset_set->_t_tree, pv_varg);
 #endif
@@ -298,6 +312,8 @@ range_t _set_equal_range_varg(const set_t* cpset_set, va_list val_elemlist)
 
 #ifdef CSTL_SET_AVL_TREE
     r_range = _avl_tree_equal_range(&cpset_set->_t_tree, pv_varg);
+#elif defined(CSTL_SET_BP_TREE)
+    r_range = _bp_tree_equal_range(&cpset_set->_t_tree, pv_varg);
 #else
     r_range = _rb_tree_equal_range(&cpset_set->_t_tree, pv_varg);
 #endif
@@ -349,6 +365,8 @@ set_iterator_t _set_insert_varg(set_t* pset_set, va_list val_elemlist)
 
 #ifdef CSTL_SET_AVL_TREE
     it_iter = _avl_tree_insert_unique(&pset_set->_t_tree, pv_varg);
+#elif defined(CSTL_SET_BP_TREE)
+    it_iter = _bp_tree_insert_unique(&pset_set->_t_tree, pv_varg);
 #else
     it_iter = _rb_tree_insert_unique(&pset_set->_t_tree, pv_varg);
 #endif
@@ -395,6 +413,8 @@ set_iterator_t _set_insert_hint_varg(set_t* pset_set, set_iterator_t it_hint, va
 
 #ifdef CSTL_SET_AVL_TREE
     it_hint = _avl_tree_insert_unique(&pset_set->_t_tree, pv_varg);
+#elif defined(CSTL_SET_BP_TREE)
+    it_hint = _bp_tree_insert_unique(&pset_set->_t_tree, pv_varg);
 #else
     it_hint = _rb_tree_insert_unique(&pset_set->_t_tree, pv_varg);
 #endif
@@ -442,6 +462,8 @@ size_t _set_erase_varg(set_t* pset_set, va_list val_elemlist)
 
 #ifdef CSTL_SET_AVL_TREE
     t_count = _avl_tree_erase(&pset_set->_t_tree, pv_varg);
+#elif defined(CSTL_SET_BP_TREE)
+    t_count = _bp_tree_erase(&pset_set->_t_tree, pv_varg);
 #else
     t_count = _rb_tree_erase(&pset_set->_t_tree, pv_varg);
 #endif
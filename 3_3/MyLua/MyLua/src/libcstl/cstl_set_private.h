@@ -32,11 +32,13 @@ extern "C" {
 /** constant declaration and macro section **/
 
 /** data type declaration and struct, union, enum section **/
-/* the set use rbtree default */
+/* the set use rbtree default, CSTL_SET_AVL_TREE or CSTL_SET_BP_TREE selects the other backends */
 typedef struct _tagset
 {
 #ifdef CSTL_SET_AVL_TREE
     _avl_tree_t _t_tree;
+#elif defined(CSTL_SET_BP_TREE)
+    _bp_tree_t  _t_tree;
 #else
     _rb_tree_t  _t_tree;
 #endif
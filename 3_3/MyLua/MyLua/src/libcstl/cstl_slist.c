@@ -68,7 +68,7 @@ void slist_init_n(slist_t* pslist_slist, size_t t_count)
         _slistnode_t* pt_node = NULL;
 
         for (i = 0; i < t_count; ++i) {
-            pt_node = _alloc_allocate(&pslist_slist->_t_allocator, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+            pt_node = _slist_allocate_node(pslist_slist);
             assert(pt_node != NULL);
             _slist_init_node_auxiliary(pslist_slist, pt_node);
 
@@ -454,7 +454,7 @@ void slist_pop_front(slist_t* pslist_slist)
     b_result = _GET_SLIST_TYPE_SIZE(pslist_slist);
     _GET_SLIST_TYPE_DESTROY_FUNCTION(pslist_slist)(pt_node->_pby_data, &b_result);
     assert(b_result);
-    _alloc_deallocate(&pslist_slist->_t_allocator, pt_node, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+    _slist_deallocate_node(pslist_slist, pt_node);
 }
 
 /**
@@ -504,7 +504,7 @@ void slist_insert_range(slist_t* pslist_slist, slist_iterator_t it_pos, iterator
         bool_t        b_result = false;
 
         for (it_iter = it_begin; !iterator_equal(it_iter, it_end); it_iter = iterator_next(it_iter)) {
-            pt_node = _alloc_allocate(&pslist_slist->_t_allocator, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+            pt_node = _slist_allocate_node(pslist_slist);
             assert(pt_node != NULL);
             _slist_init_node_auxiliary(pslist_slist, pt_node);
 
@@ -570,7 +570,7 @@ void slist_insert_array(slist_t* pslist_slist, slist_iterator_t it_pos, const vo
             string_init(pstr_elem);
 
             for (i = 0; i < t_count; ++i) {
-                pt_node = _alloc_allocate(&pslist_slist->_t_allocator, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+                pt_node = _slist_allocate_node(pslist_slist);
                 assert(pt_node != NULL);
                 _slist_init_node_auxiliary(pslist_slist, pt_node);
 
@@ -592,7 +592,7 @@ void slist_insert_array(slist_t* pslist_slist, slist_iterator_t it_pos, const vo
             string_destroy(pstr_elem);
         } else if (_GET_SLIST_TYPE_STYLE(pslist_slist) == _TYPE_C_BUILTIN) {
             for (i = 0; i < t_count; ++i) {
-                pt_node = _alloc_allocate(&pslist_slist->_t_allocator, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+                pt_node = _slist_allocate_node(pslist_slist);
                 assert(pt_node != NULL);
                 _slist_init_node_auxiliary(pslist_slist, pt_node);
 
@@ -613,7 +613,7 @@ void slist_insert_array(slist_t* pslist_slist, slist_iterator_t it_pos, const vo
             }
         } else {
             for (i = 0; i < t_count; ++i) {
-                pt_node = _alloc_allocate(&pslist_slist->_t_allocator, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+                pt_node = _slist_allocate_node(pslist_slist);
                 assert(pt_node != NULL);
                 _slist_init_node_auxiliary(pslist_slist, pt_node);
 
@@ -668,7 +668,7 @@ void slist_insert_after_range(
 
     /* allocate new elements and copy the element from range */
     for (it_iter = it_begin; !iterator_equal(it_iter, it_end); it_iter = iterator_next(it_iter)) {
-        pt_node = _alloc_allocate(&pslist_slist->_t_allocator, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+        pt_node = _slist_allocate_node(pslist_slist);
         assert(pt_node != NULL);
         _slist_init_node_auxiliary(pslist_slist, pt_node);
 
@@ -730,7 +730,7 @@ void slist_insert_after_array(
         string_init(pstr_elem);
 
         for (i = 0; i < t_count; ++i) {
-            pt_node = _alloc_allocate(&pslist_slist->_t_allocator, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+            pt_node = _slist_allocate_node(pslist_slist);
             assert(pt_node != NULL);
             _slist_init_node_auxiliary(pslist_slist, pt_node);
 
@@ -752,7 +752,7 @@ void slist_insert_after_array(
         string_destroy(pstr_elem);
     } else if (_GET_SLIST_TYPE_STYLE(pslist_slist) == _TYPE_C_BUILTIN) {
         for (i = 0; i < t_count; ++i) {
-            pt_node = _alloc_allocate(&pslist_slist->_t_allocator, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+            pt_node = _slist_allocate_node(pslist_slist);
             assert(pt_node != NULL);
             _slist_init_node_auxiliary(pslist_slist, pt_node);
 
@@ -773,7 +773,7 @@ void slist_insert_after_array(
         }
     } else {
         for (i = 0; i < t_count; ++i) {
-            pt_node = _alloc_allocate(&pslist_slist->_t_allocator, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+            pt_node = _slist_allocate_node(pslist_slist);
             assert(pt_node != NULL);
             _slist_init_node_auxiliary(pslist_slist, pt_node);
 
@@ -819,7 +819,7 @@ slist_iterator_t slist_erase_after(slist_t* pslist_slist, slist_iterator_t it_po
         b_result = _GET_SLIST_TYPE_SIZE(pslist_slist);
         _GET_SLIST_TYPE_DESTROY_FUNCTION(pslist_slist)(pt_node->_pby_data, &b_result);
         assert(b_result);
-        _alloc_deallocate(&pslist_slist->_t_allocator, pt_node, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+        _slist_deallocate_node(pslist_slist, pt_node);
 
         return iterator_next(it_pos);
     } else {
@@ -903,7 +903,7 @@ slist_iterator_t slist_erase_after_range(slist_t* pslist_slist, slist_iterator_t
             b_result = _GET_SLIST_TYPE_SIZE(pslist_slist);
             _GET_SLIST_TYPE_DESTROY_FUNCTION(pslist_slist)(pt_node->_pby_data, &b_result);
             assert(b_result);
-            _alloc_deallocate(&pslist_slist->_t_allocator, pt_node, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+            _slist_deallocate_node(pslist_slist, pt_node);
 
             pt_node = pt_begin;
         }
@@ -1306,6 +1306,62 @@ void slist_merge_if(slist_t* pslist_dest, slist_t* pslist_src, bfun_t bfun_op)
     }
 }
 
+/**
+ * Reallocate all nodes from one new chunk in the order of elements.
+ */
+void slist_compact(slist_t* pslist_slist)
+{
+    _alloc_pool_t* pt_pool = NULL;
+    _slistnode_t*  pt_prev = NULL;
+    _slistnode_t*  pt_node = NULL;
+    _slistnode_t*  pt_new = NULL;
+    size_t         t_size = 0;
+    bool_t         b_relocatable = false;
+    bool_t         b_result = false;
+
+    assert(pslist_slist != NULL);
+    assert(_slist_is_inited(pslist_slist));
+
+    t_size = slist_size(pslist_slist);
+    if (t_size == 0) {
+        _alloc_pool_release(&pslist_slist->_pt_pool);
+        return;
+    }
+
+    /* all nodes are carved from the first chunk of new pool */
+    pt_pool = _alloc_pool_create(
+        &pslist_slist->_t_allocator._t_context, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), t_size);
+    /* c builtin elements except char* are moved as raw bytes */
+    b_relocatable = _GET_SLIST_TYPE_STYLE(pslist_slist) == _TYPE_C_BUILTIN &&
+                    strncmp(_GET_SLIST_TYPE_BASENAME(pslist_slist), _C_STRING_TYPE, _TYPE_NAME_SIZE) != 0;
+
+    pt_prev = &pslist_slist->_t_head;
+    while (pt_prev->_pt_next != NULL) {
+        pt_node = pt_prev->_pt_next;
+        pt_new = (_slistnode_t*)_alloc_pool_allocate(&pt_pool);
+        if (b_relocatable) {
+            memcpy(pt_new->_pby_data, pt_node->_pby_data, _GET_SLIST_TYPE_SIZE(pslist_slist));
+        } else {
+            _slist_init_node_auxiliary(pslist_slist, pt_new);
+            b_result = _GET_SLIST_TYPE_SIZE(pslist_slist);
+            _GET_SLIST_TYPE_COPY_FUNCTION(pslist_slist)(pt_new->_pby_data, pt_node->_pby_data, &b_result);
+            assert(b_result);
+            b_result = _GET_SLIST_TYPE_SIZE(pslist_slist);
+            _GET_SLIST_TYPE_DESTROY_FUNCTION(pslist_slist)(pt_node->_pby_data, &b_result);
+            assert(b_result);
+        }
+
+        pt_new->_pt_next = pt_node->_pt_next;
+        pt_prev->_pt_next = pt_new;
+        pt_prev = pt_new;
+        _slist_deallocate_node(pslist_slist, pt_node);
+    }
+
+    /* the old pool is released when no other slist shares it */
+    _alloc_pool_release(&pslist_slist->_pt_pool);
+    pslist_slist->_pt_pool = pt_pool;
+}
+
 /**
  * Erases the elements of slist.
  */
@@ -1344,7 +1400,7 @@ void slist_resize(slist_t* pslist_slist, size_t t_resize)
         }
 
         for (i = 0; i < t_resize - t_size; ++i) {
-            pt_node = _alloc_allocate(&pslist_slist->_t_allocator, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+            pt_node = _slist_allocate_node(pslist_slist);
             assert(pt_node != NULL);
             _slist_init_node_auxiliary(pslist_slist, pt_node);
 
@@ -1493,6 +1549,18 @@ bool_t slist_greater_equal(const slist_t* cpslist_first, const slist_t* cpslist_
     return (slist_greater(cpslist_first, cpslist_second) || slist_equal(cpslist_first, cpslist_second)) ? true : false;
 }
 
+/**
+ * Get the memory that slist holds.
+ */
+size_t slist_memory_usage(const slist_t* cpslist_slist)
+{
+    assert(cpslist_slist != NULL);
+    assert(_slist_is_inited(cpslist_slist));
+
+    return sizeof(slist_t) + _alloc_memory_usage(&cpslist_slist->_t_allocator) +
+           _alloc_pool_memory_usage(cpslist_slist->_pt_pool);
+}
+
 /** local function implementation section **/
 
 /** eof **/
@@ -459,7 +459,8 @@ extern slist_iterator_t slist_erase_after_range(slist_t* pslist_slist, slist_ite
  * @remarks  if pslist_slist == NULL or pslist_src == NUll then the behavior is undefined. the target slist and source slist
  *           must be initialized, otherwise the behavior is undefined. target position must be valid position for target slist. 
  *           the element type of two slist must be the same, otherwise the behavior is undefined. if pslist_slist == pslist_src
- *           then the function does nothing.
+ *           then the function does nothing. the nodes are relinked, not copied, so the two slists share one node
+ *           pool from now on.
  */
 extern void slist_splice(slist_t* pslist_slist, slist_iterator_t it_pos, slist_t* pslist_src);
 
@@ -612,6 +613,26 @@ extern void slist_merge(slist_t* pslist_dest, slist_t* pslist_src);
  */
 extern void slist_merge_if(slist_t* pslist_dest, slist_t* pslist_src, bfun_t bfun_op);
 
+/**
+ * Reallocate all nodes from one new chunk in the order of elements.
+ * @param pslist_slist  slist container.
+ * @return void.
+ * @remarks if pslist_slist == NULL, then the behavior is undefined. the slist must be initialized, otherwise the behavior
+ *          is undefined. the compact slist is traversed in address order and no longer shares node pool with other
+ *          slists. all iterators of slist are invalid after compact.
+ */
+extern void slist_compact(slist_t* pslist_slist);
+
+/**
+ * Get the memory that slist holds.
+ * @param cpslist_slist slist container.
+ * @return the bytes of slist_t and the chunks of node pool.
+ * @remarks if cpslist_slist == NULL, then the behavior is undefined. the slist must be initialized, otherwise the
+ *          behavior is undefined. the whole node pool is counted, so the slists that share the pool report the same
+ *          chunks. the memory owned by elements, such as the characters of string_t, is not counted.
+ */
+extern size_t slist_memory_usage(const slist_t* cpslist_slist);
+
 /**
  * Specifies a new size of a slist.
  * @param pslist_slist  slist container.
@@ -36,6 +36,27 @@
 /** local data type declaration and local struct, union, enum section **/
 
 /** local function prototype section **/
+/**
+ * Get the node before specificed node.
+ * @param pslist_slist   slist container.
+ * @param pt_node        node of slist, NULL means end.
+ * @return the previous node, the head of slist if pt_node is the first node.
+ * @remarks if pslist_slist == NULL, then the behavior is undefined. pt_node must belong to pslist_slist.
+ */
+static _slistnode_t* _slist_previous_node(slist_t* pslist_slist, _slistnode_t* pt_node);
+
+/**
+ * Unlink the nodes [pt_begin, pt_end) from source slist and link them after pt_pos.
+ * @param pslist_dest    destination slist.
+ * @param pt_pos         node of destination slist or the head of destination slist.
+ * @param pslist_src     source slist.
+ * @param pt_begin       range start.
+ * @param pt_end         range end, NULL means end.
+ * @return void.
+ * @remarks the range must not be empty and pt_pos must not belong to it. the node pools of two slists are shared.
+ */
+static void _slist_relink_after(
+    slist_t* pslist_dest, _slistnode_t* pt_pos, slist_t* pslist_src, _slistnode_t* pt_begin, _slistnode_t* pt_end);
 
 /** exported global variable definition section **/
 
@@ -189,8 +210,9 @@ void _slist_transfer_after(slist_iterator_t it_pos, slist_iterator_t it_begin, s
         }
     }
 
-    slist_insert_after_range(_SLIST_ITERATOR_CONTAINER(it_pos), it_pos, it_begin, it_end);
-    slist_erase_range(_SLIST_ITERATOR_CONTAINER(it_begin), it_begin, it_end);
+    _slist_relink_after(
+        _SLIST_ITERATOR_CONTAINER(it_pos), (_slistnode_t*)_SLIST_ITERATOR_COREPOS(it_pos), _SLIST_ITERATOR_CONTAINER(it_begin),
+        (_slistnode_t*)_SLIST_ITERATOR_COREPOS(it_begin), (_slistnode_t*)_SLIST_ITERATOR_COREPOS(it_end));
 }
 
 /**
@@ -220,8 +242,12 @@ void _slist_transfer(slist_iterator_t it_pos, slist_iterator_t it_begin, slist_i
         }
     }
 
-    slist_insert_range(_SLIST_ITERATOR_CONTAINER(it_pos), it_pos, it_begin, it_end);
-    slist_erase_range(_SLIST_ITERATOR_CONTAINER(it_begin), it_begin, it_end);
+    /* the previous node of it_pos must be found before the range is unlinked */
+    _slist_relink_after(
+        _SLIST_ITERATOR_CONTAINER(it_pos),
+        _slist_previous_node(_SLIST_ITERATOR_CONTAINER(it_pos), (_slistnode_t*)_SLIST_ITERATOR_COREPOS(it_pos)),
+        _SLIST_ITERATOR_CONTAINER(it_begin),
+        (_slistnode_t*)_SLIST_ITERATOR_COREPOS(it_begin), (_slistnode_t*)_SLIST_ITERATOR_COREPOS(it_end));
 }
 
 /**
@@ -276,7 +302,78 @@ void _slist_init_node_auxiliary(slist_t* pslist_slist, _slistnode_t* pt_node)
     }
 }
 
+/**
+ * Allocate slist node from the node pool of slist.
+ */
+_slistnode_t* _slist_allocate_node(slist_t* pslist_slist)
+{
+    assert(pslist_slist != NULL);
+
+    if (pslist_slist->_pt_pool == NULL) {
+        pslist_slist->_pt_pool = _alloc_pool_create(
+            &pslist_slist->_t_allocator._t_context, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 0);
+    }
+
+    return (_slistnode_t*)_alloc_pool_allocate(&pslist_slist->_pt_pool);
+}
+
+/**
+ * Release slist node to the node pool of slist.
+ */
+void _slist_deallocate_node(slist_t* pslist_slist, _slistnode_t* pt_node)
+{
+    assert(pslist_slist != NULL);
+    assert(pslist_slist->_pt_pool != NULL);
+    assert(pt_node != NULL);
+
+    _alloc_pool_deallocate(&pslist_slist->_pt_pool, pt_node);
+}
+
 /** local function implementation section **/
+/**
+ * Get the node before specificed node.
+ */
+static _slistnode_t* _slist_previous_node(slist_t* pslist_slist, _slistnode_t* pt_node)
+{
+    _slistnode_t* pt_prev = NULL;
+
+    assert(pslist_slist != NULL);
+
+    for (pt_prev = &pslist_slist->_t_head; pt_prev->_pt_next != pt_node; pt_prev = pt_prev->_pt_next) {
+        assert(pt_prev->_pt_next != NULL);
+    }
+
+    return pt_prev;
+}
+
+/**
+ * Unlink the nodes [pt_begin, pt_end) from source slist and link them after pt_pos.
+ */
+static void _slist_relink_after(
+    slist_t* pslist_dest, _slistnode_t* pt_pos, slist_t* pslist_src, _slistnode_t* pt_begin, _slistnode_t* pt_end)
+{
+    _slistnode_t* pt_prev = NULL;
+    _slistnode_t* pt_last = NULL;
+
+    assert(pslist_dest != NULL);
+    assert(pt_pos != NULL);
+    assert(pslist_src != NULL);
+    assert(pt_begin != NULL && pt_begin != pt_end);
+
+    /* the nodes of two slists come from one node pool, so the nodes can be relinked */
+    if (pslist_dest != pslist_src) {
+        _alloc_pool_share(&pslist_dest->_pt_pool, &pslist_src->_pt_pool);
+    }
+
+    pt_prev = _slist_previous_node(pslist_src, pt_begin);
+    for (pt_last = pt_begin; pt_last->_pt_next != pt_end; pt_last = pt_last->_pt_next) {
+        assert(pt_last->_pt_next != NULL);
+    }
+
+    pt_prev->_pt_next = pt_end;
+    pt_last->_pt_next = pt_pos->_pt_next;
+    pt_pos->_pt_next = pt_begin;
+}
 
 /** eof **/
 
@@ -158,6 +158,26 @@ extern void _slist_destroy_varg_value_auxiliary(slist_t* pslist_slist, _slistnod
  */
 extern void _slist_init_node_auxiliary(slist_t* pslist_slist, _slistnode_t* pt_node);
 
+/**
+ * Allocate slist node from the node pool of slist.
+ * @param pslist_slist  slist container.
+ * @return new node, the element of node is not initialized.
+ * @remarks if pslist_slist == NULL, then the behavior is undefined. pslist_slist must be initialized or created by
+ *          create_slist(), otherwise the behavior is undefined. the node pool is created when first node is allocated.
+ */
+extern _slistnode_t* _slist_allocate_node(slist_t* pslist_slist);
+
+/**
+ * Release slist node to the node pool of slist.
+ * @param pslist_slist  slist container.
+ * @param pt_node       node.
+ * @return void.
+ * @remarks if pslist_slist == NULL or pt_node == NULL, then the behavior is undefined. the element of node must be
+ *          destroyed before, and pt_node must be allocated by _slist_allocate_node() from pslist_slist or the slist
+ *          that shares node pool with pslist_slist.
+ */
+extern void _slist_deallocate_node(slist_t* pslist_slist, _slistnode_t* pt_node);
+
 #ifdef __cplusplus
 }
 #endif
@@ -78,6 +78,7 @@ bool_t _create_slist_auxiliary(slist_t* pslist_slist, const char* s_typename)
     }
 
     pslist_slist->_t_head._pt_next = NULL;
+    pslist_slist->_pt_pool = NULL;
 
     _alloc_init(&pslist_slist->_t_allocator);
     return true;
@@ -115,12 +116,12 @@ void _slist_init_elem_varg(slist_t* pslist_slist, size_t t_count, va_list val_el
         _slistnode_t* pt_node = NULL;
 
         /* get varg value only once */
-        pt_varg = _alloc_allocate(&pslist_slist->_t_allocator, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+        pt_varg = _slist_allocate_node(pslist_slist);
         assert(pt_varg != NULL);
         _slist_get_varg_value_auxiliary(pslist_slist, val_elemlist, pt_varg);
 
         for (i = 0; i < t_count; ++i) {
-            pt_node = _alloc_allocate(&pslist_slist->_t_allocator, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+            pt_node = _slist_allocate_node(pslist_slist);
             assert(pt_node != NULL);
             _slist_init_node_auxiliary(pslist_slist, pt_node);
             /* copy value from varg */
@@ -135,7 +136,7 @@ void _slist_init_elem_varg(slist_t* pslist_slist, size_t t_count, va_list val_el
         }
 
         _slist_destroy_varg_value_auxiliary(pslist_slist, pt_varg);
-        _alloc_deallocate(&pslist_slist->_t_allocator, pt_varg, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+        _slist_deallocate_node(pslist_slist, pt_varg);
     }
 }
 
@@ -151,7 +152,7 @@ void _slist_destroy_auxiliary(slist_t* pslist_slist)
     assert(pslist_slist != NULL);
     assert(_slist_is_inited(pslist_slist) || _slist_is_created(pslist_slist));
 
-    /* _alloc_deallocate all nodes in slist */
+    /* deallocate all nodes in slist */
     while (pslist_slist->_t_head._pt_next != NULL) {
         /* take out each node from the slist */
         pt_node = pslist_slist->_t_head._pt_next;
@@ -163,11 +164,12 @@ void _slist_destroy_auxiliary(slist_t* pslist_slist)
         _GET_SLIST_TYPE_DESTROY_FUNCTION(pslist_slist)(pt_node->_pby_data, &b_result);
         assert(b_result);
 
-        _alloc_deallocate(&pslist_slist->_t_allocator, pt_node, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+        _slist_deallocate_node(pslist_slist, pt_node);
         pt_node = NULL;
     }
 
-    /* _alloc_deallocate the allocator */
+    /* release the node pool and the allocator */
+    _alloc_pool_release(&pslist_slist->_pt_pool);
     _alloc_destroy(&pslist_slist->_t_allocator);
 }
 
@@ -204,7 +206,7 @@ void _slist_assign_elem_varg(slist_t* pslist_slist, size_t t_count, va_list val_
     slist_resize(pslist_slist, t_count);
 
     /* get varg value */
-    pt_varg = _alloc_allocate(&pslist_slist->_t_allocator, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+    pt_varg = _slist_allocate_node(pslist_slist);
     assert(pt_varg != NULL);
     _slist_get_varg_value_auxiliary(pslist_slist, val_elemlist, pt_varg);
 
@@ -221,7 +223,7 @@ void _slist_assign_elem_varg(slist_t* pslist_slist, size_t t_count, va_list val_
 
     /* destroy varg value */
     _slist_destroy_varg_value_auxiliary(pslist_slist, pt_varg);
-    _alloc_deallocate(&pslist_slist->_t_allocator, pt_varg, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+    _slist_deallocate_node(pslist_slist, pt_varg);
 }
 
 /**
@@ -250,7 +252,7 @@ void _slist_push_front_varg(slist_t* pslist_slist, va_list val_elemlist)
     assert(_slist_is_inited(pslist_slist));
 
     /* allocate memory for new element and copy the element from elemlist */
-    pt_node = _alloc_allocate(&pslist_slist->_t_allocator, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+    pt_node = _slist_allocate_node(pslist_slist);
     assert(pt_node != NULL);
     _slist_get_varg_value_auxiliary(pslist_slist, val_elemlist, pt_node);
 
@@ -367,13 +369,13 @@ void _slist_insert_after_n_varg(slist_t* pslist_slist, slist_iterator_t it_pos,
     assert(!iterator_equal(it_pos, slist_end(pslist_slist)));
 
     /* get varg value only once */
-    pt_varg = _alloc_allocate(&pslist_slist->_t_allocator, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+    pt_varg = _slist_allocate_node(pslist_slist);
     assert(pt_varg != NULL);
     _slist_get_varg_value_auxiliary(pslist_slist, val_elemlist, pt_varg);
 
     for (i = 0; i < t_count; ++i) {
         /* allocate slist node */
-        pt_node = _alloc_allocate(&pslist_slist->_t_allocator, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+        pt_node = _slist_allocate_node(pslist_slist);
         assert(pt_node != NULL);
         _slist_init_node_auxiliary(pslist_slist, pt_node);
 
@@ -390,7 +392,7 @@ void _slist_insert_after_n_varg(slist_t* pslist_slist, slist_iterator_t it_pos,
 
     /* destroy varg value */
     _slist_destroy_varg_value_auxiliary(pslist_slist, pt_varg);
-    _alloc_deallocate(&pslist_slist->_t_allocator, pt_varg, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+    _slist_deallocate_node(pslist_slist, pt_varg);
 }
 
 /**
@@ -423,7 +425,7 @@ void _slist_remove_varg(slist_t* pslist_slist, va_list val_elemlist)
     assert(pslist_slist != NULL);
     assert(_slist_is_inited(pslist_slist));
 
-    pt_varg = _alloc_allocate(&pslist_slist->_t_allocator, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+    pt_varg = _slist_allocate_node(pslist_slist);
     assert(pt_varg != NULL);
     _slist_get_varg_value_auxiliary(pslist_slist, val_elemlist, pt_varg);
 
@@ -443,7 +445,7 @@ void _slist_remove_varg(slist_t* pslist_slist, va_list val_elemlist)
     }
 
     _slist_destroy_varg_value_auxiliary(pslist_slist, pt_varg);
-    _alloc_deallocate(&pslist_slist->_t_allocator, pt_varg, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+    _slist_deallocate_node(pslist_slist, pt_varg);
 }
 
 /**
@@ -487,12 +489,12 @@ void _slist_resize_elem_varg(slist_t* pslist_slist, size_t t_resize, va_list val
         }
 
         /* get varg value only once */
-        pt_varg = _alloc_allocate(&pslist_slist->_t_allocator, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+        pt_varg = _slist_allocate_node(pslist_slist);
         assert(pt_varg != NULL);
         _slist_get_varg_value_auxiliary(pslist_slist, val_elemlist, pt_varg);
 
         for (i = 0; i < t_resize - t_size; ++i) {
-            pt_node = _alloc_allocate(&pslist_slist->_t_allocator, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+            pt_node = _slist_allocate_node(pslist_slist);
             assert(pt_node != NULL);
             _slist_init_node_auxiliary(pslist_slist, pt_node);
 
@@ -507,7 +509,7 @@ void _slist_resize_elem_varg(slist_t* pslist_slist, size_t t_resize, va_list val
         }
 
         _slist_destroy_varg_value_auxiliary(pslist_slist, pt_varg);
-        _alloc_deallocate(&pslist_slist->_t_allocator, pt_varg, _SLIST_NODE_SIZE(_GET_SLIST_TYPE_SIZE(pslist_slist)), 1);
+        _slist_deallocate_node(pslist_slist, pt_varg);
     }
 }
 
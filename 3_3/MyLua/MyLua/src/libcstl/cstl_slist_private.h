@@ -54,6 +54,7 @@ typedef struct _tagslist
 
     /* memory allocate */
     _alloc_t     _t_allocator;
+    _alloc_pool_t* _pt_pool;    /* node pool, shared with the slists that nodes are spliced to or from */
 
     /* slist core struct */
     _slistnode_t _t_head;
@@ -127,6 +127,23 @@ size_t stack_size(const stack_t* cpsk_stack)
 #endif
 }
 
+/**
+ * Get the memory that stack allocates.
+ */
+size_t stack_memory_usage(const stack_t* cpsk_stack)
+{
+    assert(cpsk_stack != NULL);
+
+    /* stack_t holds only the sequence */
+#if defined (CSTL_STACK_VECTOR_SEQUENCE)
+    return vector_memory_usage(&cpsk_stack->_t_sequence);
+#elif defined (CSTL_STACK_LIST_SEQUENCE)
+    return list_memory_usage(&cpsk_stack->_t_sequence);
+#else
+    return deque_memory_usage(&cpsk_stack->_t_sequence);
+#endif
+}
+
 /**
  * Access stack top data.
  */
@@ -102,6 +102,15 @@ extern void stack_assign(stack_t* psk_dest, const stack_t* cpsk_src);
  */
 extern size_t stack_size(const stack_t* cpsk_stack);
 
+/**
+ * Get the memory that stack allocates.
+ * @param cpsk_stack  stack adaptor.
+ * @return the bytes of stack_t and the memory that the underlying sequence allocates.
+ * @remarks if cpsk_stack == NULL, then the behavior is undefined. the cpsk_stack must be initialized, otherwise the
+ *          behavior is undefine.
+ */
+extern size_t stack_memory_usage(const stack_t* cpsk_stack);
+
 /**
  * Tests if a stack is empty.
  * @param cpsk_stack  stack adaptor.
@@ -126,6 +126,7 @@ bool_t _type_register(
         pt_type->_t_typeinit = t_typeinit != NULL ? t_typeinit : _type_init_default;
         pt_type->_t_typecopy = t_typecopy != NULL ? t_typecopy : _type_copy_default;
         pt_type->_t_typeless = t_typeless != NULL ? t_typeless : _type_less_default;
+        pt_type->_t_typelessfast = NULL;
         pt_type->_t_typedestroy = t_typedestroy != NULL ? t_typedestroy : _type_destroy_default;
 
         pt_node->_pt_type = pt_type;
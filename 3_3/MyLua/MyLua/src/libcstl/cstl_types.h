@@ -141,6 +141,14 @@ typedef void (*binary_function_t)(const void*, const void*, void*);
 typedef unary_function_t  ufun_t;
 typedef binary_function_t bfun_t;
 
+/*
+ * Type definition of less function that returns the result directly.
+ * Note: It is the fast path of the type less function, the caller need not
+ *       prepare the output parameter.
+ */
+typedef bool_t (*less_function_t)(const void*, const void*);
+typedef less_function_t lfun_t;
+
 /* 
  * Type register hash table.
  */
@@ -159,6 +167,7 @@ typedef struct _tagtype
     _typestyle_t         _t_style;                           /* type style */
     bfun_t               _t_typecopy;                        /* type copy function */
     bfun_t               _t_typeless;                        /* type less function */
+    lfun_t               _t_typelessfast;                    /* type less function without output, NULL if none */
     ufun_t               _t_typeinit;                        /* type initialize function */
     ufun_t               _t_typedestroy;                     /* type destroy function */
 }_type_t;
@@ -59,8 +59,14 @@
         pt_type->_t_typeinit = _type_init_##type_suffix;\
         pt_type->_t_typecopy = _type_copy_##type_suffix;\
         pt_type->_t_typeless = _type_less_##type_suffix;\
+        pt_type->_t_typelessfast = NULL;\
         pt_type->_t_typedestroy = _type_destroy_##type_suffix;\
     }while(false)
+/* register the less function without output for the last registered type */
+#define _TYPE_REGISTER_TYPE_LESS_FAST(type_suffix)\
+    do{\
+        pt_type->_t_typelessfast = _type_less_fast_##type_suffix;\
+    }while(false)
 #define _TYPE_REGISTER_TYPE_NODE(type, type_text)\
     do{\
         pt_node = (_typenode_t*)_alloc_allocate(\
@@ -111,14 +117,15 @@
  *                             | _s_typename = "abc_t"        |
  *                             | _t_typecopy = abc_copy       | "registered type abc_t"
  *                             | _t_typeless = abc_less       |
+ *                             | _t_typelessfast = NULL       |
  *                             | _t_typeinit = abc_init       |
  *                             | _t_typedestroy = abc_destroy |
  *                             +------------------------------+
  */
 #ifdef CSTL_MEMORY_MANAGEMENT
-_typeregister_t _gt_typeregister = {false, {NULL}, {{NULL}, NULL, NULL, 0, 0, 0}};
+_typeregister_t _gt_typeregister = {false, {NULL}, {{0}, 0, {NULL, NULL}}};
 #else
-_typeregister_t _gt_typeregister = {false, {NULL}, {0}};
+_typeregister_t _gt_typeregister = {false, {NULL}, {0, {NULL, NULL}}};
 #endif
 
 _typecache_t    _gt_typecache[_TYPE_CACHE_COUNT] = {{'\0'}, {'\0'}, 0};
@@ -198,71 +205,88 @@ void _type_register_c_builtin(void)
 
     /* register char type */
     _TYPE_REGISTER_TYPE(char, _CHAR_TYPE, char, _TYPE_C_BUILTIN);
+    _TYPE_REGISTER_TYPE_LESS_FAST(char);
     _TYPE_REGISTER_TYPE_NODE(char, _CHAR_TYPE);
     _TYPE_REGISTER_TYPE_NODE(signed char, _SIGNED_CHAR_TYPE);
     /* register unsigned char */
     _TYPE_REGISTER_TYPE(unsigned char, _UNSIGNED_CHAR_TYPE, uchar, _TYPE_C_BUILTIN);
+    _TYPE_REGISTER_TYPE_LESS_FAST(uchar);
     _TYPE_REGISTER_TYPE_NODE(unsigned char, _UNSIGNED_CHAR_TYPE);
     /* register short */
     _TYPE_REGISTER_TYPE(short, _SHORT_TYPE, short, _TYPE_C_BUILTIN);
+    _TYPE_REGISTER_TYPE_LESS_FAST(short);
     _TYPE_REGISTER_TYPE_NODE(short, _SHORT_TYPE);
     _TYPE_REGISTER_TYPE_NODE(short int, _SHORT_INT_TYPE);
     _TYPE_REGISTER_TYPE_NODE(signed short, _SIGNED_SHORT_TYPE);
     _TYPE_REGISTER_TYPE_NODE(signed short int, _SIGNED_SHORT_INT_TYPE);
     /* register unsigned short */
     _TYPE_REGISTER_TYPE(unsigned short, _UNSIGNED_SHORT_TYPE, ushort, _TYPE_C_BUILTIN);
+    _TYPE_REGISTER_TYPE_LESS_FAST(ushort);
     _TYPE_REGISTER_TYPE_NODE(unsigned short, _UNSIGNED_SHORT_TYPE);
     _TYPE_REGISTER_TYPE_NODE(unsigned short int, _UNSIGNED_SHORT_INT_TYPE);
     /* register int */
     _TYPE_REGISTER_TYPE(int, _INT_TYPE, int, _TYPE_C_BUILTIN);
+    _TYPE_REGISTER_TYPE_LESS_FAST(int);
     _TYPE_REGISTER_TYPE_NODE(int, _INT_TYPE);
     _TYPE_REGISTER_TYPE_NODE(signed, _SIGNED_TYPE);
     _TYPE_REGISTER_TYPE_NODE(signed int, _SIGNED_INT_TYPE);
     /* register unsigned int */
     _TYPE_REGISTER_TYPE(unsigned int, _UNSIGNED_INT_TYPE, uint, _TYPE_C_BUILTIN);
+    _TYPE_REGISTER_TYPE_LESS_FAST(uint);
     _TYPE_REGISTER_TYPE_NODE(unsigned int, _UNSIGNED_INT_TYPE);
     _TYPE_REGISTER_TYPE_NODE(signed, _UNSIGNED_TYPE);
     /* register long */
     _TYPE_REGISTER_TYPE(long, _LONG_TYPE, long, _TYPE_C_BUILTIN);
+    _TYPE_REGISTER_TYPE_LESS_FAST(long);
     _TYPE_REGISTER_TYPE_NODE(long, _LONG_TYPE);
     _TYPE_REGISTER_TYPE_NODE(long int, _LONG_INT_TYPE);
     _TYPE_REGISTER_TYPE_NODE(signed long, _SIGNED_LONG_TYPE);
     _TYPE_REGISTER_TYPE_NODE(signed long int, _SIGNED_LONG_INT_TYPE);
     /* register unsigned long */
     _TYPE_REGISTER_TYPE(unsigned long, _UNSIGNED_LONG_TYPE, ulong, _TYPE_C_BUILTIN);
+    _TYPE_REGISTER_TYPE_LESS_FAST(ulong);
     _TYPE_REGISTER_TYPE_NODE(unsigned long, _UNSIGNED_LONG_TYPE);
     _TYPE_REGISTER_TYPE_NODE(unsigned long int, _UNSIGNED_LONG_INT_TYPE);
     /* register float */
     _TYPE_REGISTER_TYPE(float, _FLOAT_TYPE, float, _TYPE_C_BUILTIN);
+    _TYPE_REGISTER_TYPE_LESS_FAST(float);
     _TYPE_REGISTER_TYPE_NODE(float, _FLOAT_TYPE);
     /* register double */
     _TYPE_REGISTER_TYPE(double, _DOUBLE_TYPE, double, _TYPE_C_BUILTIN);
+    _TYPE_REGISTER_TYPE_LESS_FAST(double);
     _TYPE_REGISTER_TYPE_NODE(double, _DOUBLE_TYPE);
     /* register long double */
     _TYPE_REGISTER_TYPE(long double, _LONG_DOUBLE_TYPE, long_double, _TYPE_C_BUILTIN);
+    _TYPE_REGISTER_TYPE_LESS_FAST(long_double);
     _TYPE_REGISTER_TYPE_NODE(long double, _LONG_DOUBLE_TYPE);
     /* register bool_t */
     _TYPE_REGISTER_TYPE(bool_t, _CSTL_BOOL_TYPE, cstl_bool, _TYPE_C_BUILTIN);
+    _TYPE_REGISTER_TYPE_LESS_FAST(cstl_bool);
     _TYPE_REGISTER_TYPE_NODE(bool_t, _CSTL_BOOL_TYPE);
     /* register char* */
     _TYPE_REGISTER_TYPE(string_t, _C_STRING_TYPE, cstr, _TYPE_C_BUILTIN);
+    _TYPE_REGISTER_TYPE_LESS_FAST(cstr);
     _TYPE_REGISTER_TYPE_NODE(string_t, _C_STRING_TYPE);
     /* register void* */
     _TYPE_REGISTER_TYPE(void*, _POINTER_TYPE, pointer, _TYPE_C_BUILTIN);
+    _TYPE_REGISTER_TYPE_LESS_FAST(pointer);
     _TYPE_REGISTER_TYPE_NODE(void*, _POINTER_TYPE);
 
 #ifndef _MSC_VER
     /* register _Bool */
     _TYPE_REGISTER_TYPE(_Bool, _BOOL_TYPE, bool, _TYPE_C_BUILTIN);
+    _TYPE_REGISTER_TYPE_LESS_FAST(bool);
     _TYPE_REGISTER_TYPE_NODE(_Bool, _BOOL_TYPE);
     /* register long long */
     _TYPE_REGISTER_TYPE(long long, _LONG_LONG_TYPE, long_long, _TYPE_C_BUILTIN);
+    _TYPE_REGISTER_TYPE_LESS_FAST(long_long);
     _TYPE_REGISTER_TYPE_NODE(long long, _LONG_LONG_TYPE);
     _TYPE_REGISTER_TYPE_NODE(long long int, _LONG_LONG_INT_TYPE);
     _TYPE_REGISTER_TYPE_NODE(signed long long, _SIGNED_LONG_LONG_TYPE);
     _TYPE_REGISTER_TYPE_NODE(signed long long int, _SIGNED_LONG_LONG_INT_TYPE);
     /* register unsigned long long */
     _TYPE_REGISTER_TYPE(unsigned long long, _UNSIGNED_LONG_LONG_TYPE, ulong_long, _TYPE_C_BUILTIN);
+    _TYPE_REGISTER_TYPE_LESS_FAST(ulong_long);
     _TYPE_REGISTER_TYPE_NODE(unsigned long long, _UNSIGNED_LONG_LONG_TYPE);
     _TYPE_REGISTER_TYPE_NODE(unsigned long long int, _UNSIGNED_LONG_LONG_INT_TYPE);
 #endif
@@ -70,10 +70,16 @@ void _type_copy_char(const void* cpv_first, const void* cpv_second, void* pv_out
     *(bool_t*)pv_output = true;
 }
 
+bool_t _type_less_fast_char(const void* cpv_first, const void* cpv_second)
+{
+    assert(cpv_first != NULL && cpv_second != NULL);
+    return *(char*)cpv_first < *(char*)cpv_second ? true : false;
+}
+
 void _type_less_char(const void* cpv_first, const void* cpv_second, void* pv_output)
 {
-    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
-    *(bool_t*)pv_output = *(char*)cpv_first < *(char*)cpv_second ? true : false;
+    assert(pv_output != NULL);
+    *(bool_t*)pv_output = _type_less_fast_char(cpv_first, cpv_second);
 }
 
 void _type_destroy_char(const void* cpv_input, void* pv_output)
@@ -96,10 +102,16 @@ void _type_copy_uchar(const void* cpv_first, const void* cpv_second, void* pv_ou
     *(bool_t*)pv_output = true;
 }
 
+bool_t _type_less_fast_uchar(const void* cpv_first, const void* cpv_second)
+{
+    assert(cpv_first != NULL && cpv_second != NULL);
+    return *(unsigned char*)cpv_first < *(unsigned char*)cpv_second ? true : false;
+}
+
 void _type_less_uchar(const void* cpv_first, const void* cpv_second, void* pv_output)
 {
-    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
-    *(bool_t*)pv_output = *(unsigned char*)cpv_first < *(unsigned char*)cpv_second ? true : false;
+    assert(pv_output != NULL);
+    *(bool_t*)pv_output = _type_less_fast_uchar(cpv_first, cpv_second);
 }
 
 void _type_destroy_uchar(const void* cpv_input, void* pv_output)
@@ -122,10 +134,16 @@ void _type_copy_short(const void* cpv_first, const void* cpv_second, void* pv_ou
     *(bool_t*)pv_output = true;
 }
 
+bool_t _type_less_fast_short(const void* cpv_first, const void* cpv_second)
+{
+    assert(cpv_first != NULL && cpv_second != NULL);
+    return *(short*)cpv_first < *(short*)cpv_second ? true : false;
+}
+
 void _type_less_short(const void* cpv_first, const void* cpv_second, void* pv_output)
 {
-    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
-    *(bool_t*)pv_output = *(short*)cpv_first < *(short*)cpv_second ? true : false;
+    assert(pv_output != NULL);
+    *(bool_t*)pv_output = _type_less_fast_short(cpv_first, cpv_second);
 }
 
 void _type_destroy_short(const void* cpv_input, void* pv_output)
@@ -148,10 +166,16 @@ void _type_copy_ushort(const void* cpv_first, const void* cpv_second, void* pv_o
     *(bool_t*)pv_output = true;
 }
 
+bool_t _type_less_fast_ushort(const void* cpv_first, const void* cpv_second)
+{
+    assert(cpv_first != NULL && cpv_second != NULL);
+    return *(unsigned short*)cpv_first < *(unsigned short*)cpv_second ? true : false;
+}
+
 void _type_less_ushort(const void* cpv_first, const void* cpv_second, void* pv_output)
 {
-    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
-    *(bool_t*)pv_output = *(unsigned short*)cpv_first < *(unsigned short*)cpv_second ? true : false;
+    assert(pv_output != NULL);
+    *(bool_t*)pv_output = _type_less_fast_ushort(cpv_first, cpv_second);
 }
 
 void _type_destroy_ushort(const void* cpv_input, void* pv_output)
@@ -174,10 +198,16 @@ void _type_copy_int(const void* cpv_first, const void* cpv_second, void* pv_outp
     *(bool_t*)pv_output = true;
 }
 
+bool_t _type_less_fast_int(const void* cpv_first, const void* cpv_second)
+{
+    assert(cpv_first != NULL && cpv_second != NULL);
+    return *(int*)cpv_first < *(int*)cpv_second ? true : false;
+}
+
 void _type_less_int(const void* cpv_first, const void* cpv_second, void* pv_output)
 {
-    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
-    *(bool_t*)pv_output = *(int*)cpv_first < *(int*)cpv_second ? true : false;
+    assert(pv_output != NULL);
+    *(bool_t*)pv_output = _type_less_fast_int(cpv_first, cpv_second);
 }
 
 void _type_destroy_int(const void* cpv_input, void* pv_output)
@@ -200,10 +230,16 @@ void _type_copy_uint(const void* cpv_first, const void* cpv_second, void* pv_out
     *(bool_t*)pv_output = true;
 }
 
+bool_t _type_less_fast_uint(const void* cpv_first, const void* cpv_second)
+{
+    assert(cpv_first != NULL && cpv_second != NULL);
+    return *(unsigned int*)cpv_first < *(unsigned int*)cpv_second ? true : false;
+}
+
 void _type_less_uint(const void* cpv_first, const void* cpv_second, void* pv_output)
 {
-    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
-    *(bool_t*)pv_output = *(unsigned int*)cpv_first < *(unsigned int*)cpv_second ? true : false;
+    assert(pv_output != NULL);
+    *(bool_t*)pv_output = _type_less_fast_uint(cpv_first, cpv_second);
 }
 
 void _type_destroy_uint(const void* cpv_input, void* pv_output)
@@ -226,10 +262,16 @@ void _type_copy_long(const void* cpv_first, const void* cpv_second, void* pv_out
     *(bool_t*)pv_output = true;
 }
 
+bool_t _type_less_fast_long(const void* cpv_first, const void* cpv_second)
+{
+    assert(cpv_first != NULL && cpv_second != NULL);
+    return *(long*)cpv_first < *(long*)cpv_second ? true : false;
+}
+
 void _type_less_long(const void* cpv_first, const void* cpv_second, void* pv_output)
 {
-    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
-    *(bool_t*)pv_output = *(long*)cpv_first < *(long*)cpv_second ? true : false;
+    assert(pv_output != NULL);
+    *(bool_t*)pv_output = _type_less_fast_long(cpv_first, cpv_second);
 }
 
 void _type_destroy_long(const void* cpv_input, void* pv_output)
@@ -252,10 +294,16 @@ void _type_copy_ulong(const void* cpv_first, const void* cpv_second, void* pv_ou
     *(bool_t*)pv_output = true;
 }
 
+bool_t _type_less_fast_ulong(const void* cpv_first, const void* cpv_second)
+{
+    assert(cpv_first != NULL && cpv_second != NULL);
+    return *(unsigned long*)cpv_first < *(unsigned long*)cpv_second ? true : false;
+}
+
 void _type_less_ulong(const void* cpv_first, const void* cpv_second, void* pv_output)
 {
-    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
-    *(bool_t*)pv_output = *(unsigned long*)cpv_first < *(unsigned long*)cpv_second ? true : false;
+    assert(pv_output != NULL);
+    *(bool_t*)pv_output = _type_less_fast_ulong(cpv_first, cpv_second);
 }
 
 void _type_destroy_ulong(const void* cpv_input, void* pv_output)
@@ -278,10 +326,16 @@ void _type_copy_float(const void* cpv_first, const void* cpv_second, void* pv_ou
     *(bool_t*)pv_output = true;
 }
 
+bool_t _type_less_fast_float(const void* cpv_first, const void* cpv_second)
+{
+    assert(cpv_first != NULL && cpv_second != NULL);
+    return *(float*)cpv_first - *(float*)cpv_second < -FLT_EPSILON ? true : false;
+}
+
 void _type_less_float(const void* cpv_first, const void* cpv_second, void* pv_output)
 {
-    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
-    *(bool_t*)pv_output = *(float*)cpv_first - *(float*)cpv_second < -FLT_EPSILON ? true : false;
+    assert(pv_output != NULL);
+    *(bool_t*)pv_output = _type_less_fast_float(cpv_first, cpv_second);
 }
 
 void _type_destroy_float(const void* cpv_input, void* pv_output)
@@ -304,10 +358,16 @@ void _type_copy_double(const void* cpv_first, const void* cpv_second, void* pv_o
     *(bool_t*)pv_output = true;
 }
 
+bool_t _type_less_fast_double(const void* cpv_first, const void* cpv_second)
+{
+    assert(cpv_first != NULL && cpv_second != NULL);
+    return *(double*)cpv_first - *(double*)cpv_second < -DBL_EPSILON ? true : false;
+}
+
 void _type_less_double(const void* cpv_first, const void* cpv_second, void* pv_output)
 {
-    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
-    *(bool_t*)pv_output = *(double*)cpv_first - *(double*)cpv_second < -DBL_EPSILON ? true : false;
+    assert(pv_output != NULL);
+    *(bool_t*)pv_output = _type_less_fast_double(cpv_first, cpv_second);
 }
 
 void _type_destroy_double(const void* cpv_input, void* pv_output)
@@ -330,10 +390,16 @@ void _type_copy_long_double(const void* cpv_first, const void* cpv_second, void*
     *(bool_t*)pv_output = true;
 }
 
+bool_t _type_less_fast_long_double(const void* cpv_first, const void* cpv_second)
+{
+    assert(cpv_first != NULL && cpv_second != NULL);
+    return *(long double*)cpv_first - *(long double*)cpv_second < -LDBL_EPSILON ? true : false;
+}
+
 void _type_less_long_double(const void* cpv_first, const void* cpv_second, void* pv_output)
 {
-    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
-    *(bool_t*)pv_output = *(long double*)cpv_first - *(long double*)cpv_second < -LDBL_EPSILON ? true : false;
+    assert(pv_output != NULL);
+    *(bool_t*)pv_output = _type_less_fast_long_double(cpv_first, cpv_second);
 }
 
 void _type_destroy_long_double(const void* cpv_input, void* pv_output)
@@ -356,10 +422,16 @@ void _type_copy_cstl_bool(const void* cpv_first, const void* cpv_second, void* p
     *(bool_t*)pv_output = true;
 }
 
+bool_t _type_less_fast_cstl_bool(const void* cpv_first, const void* cpv_second)
+{
+    assert(cpv_first != NULL && cpv_second != NULL);
+    return *(bool_t*)cpv_first < *(bool_t*)cpv_second ? true : false;
+}
+
 void _type_less_cstl_bool(const void* cpv_first, const void* cpv_second, void* pv_output)
 {
-    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
-    *(bool_t*)pv_output = *(bool_t*)cpv_first < *(bool_t*)cpv_second ? true : false;
+    assert(pv_output != NULL);
+    *(bool_t*)pv_output = _type_less_fast_cstl_bool(cpv_first, cpv_second);
 }
 
 void _type_destroy_cstl_bool(const void* cpv_input, void* pv_output)
@@ -382,10 +454,16 @@ void _type_copy_pointer(const void* cpv_first, const void* cpv_second, void* pv_
     *(bool_t*)pv_output = true;
 }
 
+bool_t _type_less_fast_pointer(const void* cpv_first, const void* cpv_second)
+{
+    assert(cpv_first != NULL && cpv_second != NULL);
+    return *(void**)cpv_first < *(void**)cpv_second ? true : false;
+}
+
 void _type_less_pointer(const void* cpv_first, const void* cpv_second, void* pv_output)
 {
-    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
-    *(bool_t*)pv_output = *(void**)cpv_first < *(void**)cpv_second ? true : false;
+    assert(pv_output != NULL);
+    *(bool_t*)pv_output = _type_less_fast_pointer(cpv_first, cpv_second);
 }
 
 void _type_destroy_pointer(const void* cpv_input, void* pv_output)
@@ -417,10 +495,16 @@ void _type_copy_cstr(const void* cpv_first, const void* cpv_second, void* pv_out
     *(bool_t*)pv_output = true;
 }
 
+bool_t _type_less_fast_cstr(const void* cpv_first, const void* cpv_second)
+{
+    assert(cpv_first != NULL && cpv_second != NULL);
+    return string_less((string_t*)cpv_first, (string_t*)cpv_second);
+}
+
 void _type_less_cstr(const void* cpv_first, const void* cpv_second, void* pv_output)
 {
-    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
-    *(bool_t*)pv_output = string_less((string_t*)cpv_first, (string_t*)cpv_second);
+    assert(pv_output != NULL);
+    *(bool_t*)pv_output = _type_less_fast_cstr(cpv_first, cpv_second);
 }
 
 void _type_destroy_cstr(const void* cpv_input, void* pv_output)
@@ -1079,10 +1163,16 @@ void _type_copy_bool(const void* cpv_first, const void* cpv_second, void* pv_out
     *(bool_t*)pv_output = true;
 }
 
+bool_t _type_less_fast_bool(const void* cpv_first, const void* cpv_second)
+{
+    assert(cpv_first != NULL && cpv_second != NULL);
+    return *(_Bool*)cpv_first < *(_Bool*)cpv_second ? true : false;
+}
+
 void _type_less_bool(const void* cpv_first, const void* cpv_second, void* pv_output)
 {
-    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
-    *(bool_t*)pv_output = *(_Bool*)cpv_first < *(_Bool*)cpv_second ? true : false;
+    assert(pv_output != NULL);
+    *(bool_t*)pv_output = _type_less_fast_bool(cpv_first, cpv_second);
 }
 
 void _type_destroy_bool(const void* cpv_input, void* pv_output)
@@ -1105,10 +1195,16 @@ void _type_copy_long_long(const void* cpv_first, const void* cpv_second, void* p
     *(bool_t*)pv_output = true;
 }
 
+bool_t _type_less_fast_long_long(const void* cpv_first, const void* cpv_second)
+{
+    assert(cpv_first != NULL && cpv_second != NULL);
+    return *(long long*)cpv_first < *(long long*)cpv_second ? true : false;
+}
+
 void _type_less_long_long(const void* cpv_first, const void* cpv_second, void* pv_output)
 {
-    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
-    *(bool_t*)pv_output = *(long long*)cpv_first < *(long long*)cpv_second ? true : false;
+    assert(pv_output != NULL);
+    *(bool_t*)pv_output = _type_less_fast_long_long(cpv_first, cpv_second);
 }
 
 void _type_destroy_long_long(const void* cpv_input, void* pv_output)
@@ -1131,10 +1227,16 @@ void _type_copy_ulong_long(const void* cpv_first, const void* cpv_second, void*
     *(bool_t*)pv_output = true;
 }
 
+bool_t _type_less_fast_ulong_long(const void* cpv_first, const void* cpv_second)
+{
+    assert(cpv_first != NULL && cpv_second != NULL);
+    return *(unsigned long long*)cpv_first < *(unsigned long long*)cpv_second ? true : false;
+}
+
 void _type_less_ulong_long(const void* cpv_first, const void* cpv_second, void* pv_output)
 {
-    assert(cpv_first != NULL && cpv_second != NULL && pv_output != NULL);
-    *(bool_t*)pv_output = *(unsigned long long*)cpv_first < *(unsigned long long*)cpv_second ? true : false;
+    assert(pv_output != NULL);
+    *(bool_t*)pv_output = _type_less_fast_ulong_long(cpv_first, cpv_second);
 }
 
 void _type_destroy_ulong_long(const void* cpv_input, void* pv_output)
@@ -43,78 +43,93 @@ extern "C" {
  * @param cpv_second   second input parameter.
  * @param pv_output    output parameter.
  * @return void.
- * @remarks cpv_input, cpv_first, cpv_second and pv_output must not be NULL.
+ * @remarks cpv_input, cpv_first, cpv_second and pv_output must not be NULL. the _type_less_fast_xxx functions of
+ *          c builtin type return the less result directly, and the _type_less_xxx functions are kept as the shim of them.
  */
 /* c builtin */
 /* char */
 extern void _type_init_char(const void* cpv_input, void* pv_output);
 extern void _type_copy_char(const void* cpv_first, const void* cpv_second, void* pv_output);
 extern void _type_less_char(const void* cpv_first, const void* cpv_second, void* pv_output);
+extern bool_t _type_less_fast_char(const void* cpv_first, const void* cpv_second);
 extern void _type_destroy_char(const void* cpv_input, void* pv_output);
 /* unsigned char */
 extern void _type_init_uchar(const void* cpv_input, void* pv_output);
 extern void _type_copy_uchar(const void* cpv_first, const void* cpv_second, void* pv_output);
 extern void _type_less_uchar(const void* cpv_first, const void* cpv_second, void* pv_output);
+extern bool_t _type_less_fast_uchar(const void* cpv_first, const void* cpv_second);
 extern void _type_destroy_uchar(const void* cpv_input, void* pv_output);
 /* short */
 extern void _type_init_short(const void* cpv_input, void* pv_output);
 extern void _type_copy_short(const void* cpv_first, const void* cpv_second, void* pv_output);
 extern void _type_less_short(const void* cpv_first, const void* cpv_second, void* pv_output);
+extern bool_t _type_less_fast_short(const void* cpv_first, const void* cpv_second);
 extern void _type_destroy_short(const void* cpv_input, void* pv_output);
 /* unsigned short */
 extern void _type_init_ushort(const void* cpv_input, void* pv_output);
 extern void _type_copy_ushort(const void* cpv_first, const void* cpv_second, void* pv_output);
 extern void _type_less_ushort(const void* cpv_first, const void* cpv_second, void* pv_output);
+extern bool_t _type_less_fast_ushort(const void* cpv_first, const void* cpv_second);
 extern void _type_destroy_ushort(const void* cpv_input, void* pv_output);
 /* int */
 extern void _type_init_int(const void* cpv_input, void* pv_output);
 extern void _type_copy_int(const void* cpv_first, const void* cpv_second, void* pv_output);
 extern void _type_less_int(const void* cpv_first, const void* cpv_second, void* pv_output);
+extern bool_t _type_less_fast_int(const void* cpv_first, const void* cpv_second);
 extern void _type_destroy_int(const void* cpv_input, void* pv_output);
 /* unsigned int */
 extern void _type_init_uint(const void* cpv_input, void* pv_output);
 extern void _type_copy_uint(const void* cpv_first, const void* cpv_second, void* pv_output);
 extern void _type_less_uint(const void* cpv_first, const void* cpv_second, void* pv_output);
+extern bool_t _type_less_fast_uint(const void* cpv_first, const void* cpv_second);
 extern void _type_destroy_uint(const void* cpv_input, void* pv_output);
 /* long */
 extern void _type_init_long(const void* cpv_input, void* pv_output);
 extern void _type_copy_long(const void* cpv_first, const void* cpv_second, void* pv_output);
 extern void _type_less_long(const void* cpv_first, const void* cpv_second, void* pv_output);
+extern bool_t _type_less_fast_long(const void* cpv_first, const void* cpv_second);
 extern void _type_destroy_long(const void* cpv_input, void* pv_output);
 /* unsigned long */
 extern void _type_init_ulong(const void* cpv_input, void* pv_output);
 extern void _type_copy_ulong(const void* cpv_first, const void* cpv_second, void* pv_output);
 extern void _type_less_ulong(const void* cpv_first, const void* cpv_second, void* pv_output);
+extern bool_t _type_less_fast_ulong(const void* cpv_first, const void* cpv_second);
 extern void _type_destroy_ulong(const void* cpv_input, void* pv_output);
 /* float */
 extern void _type_init_float(const void* cpv_input, void* pv_output);
 extern void _type_copy_float(const void* cpv_first, const void* cpv_second, void* pv_output);
 extern void _type_less_float(const void* cpv_first, const void* cpv_second, void* pv_output);
+extern bool_t _type_less_fast_float(const void* cpv_first, const void* cpv_second);
 extern void _type_destroy_float(const void* cpv_input, void* pv_output);
 /* double */
 extern void _type_init_double(const void* cpv_input, void* pv_output);
 extern void _type_copy_double(const void* cpv_first, const void* cpv_second, void* pv_output);
 extern void _type_less_double(const void* cpv_first, const void* cpv_second, void* pv_output);
+extern bool_t _type_less_fast_double(const void* cpv_first, const void* cpv_second);
 extern void _type_destroy_double(const void* cpv_input, void* pv_output);
 /* long double */
 extern void _type_init_long_double(const void* cpv_input, void* pv_output);
 extern void _type_copy_long_double(const void* cpv_first, const void* cpv_second, void* pv_output);
 extern void _type_less_long_double(const void* cpv_first, const void* cpv_second, void* pv_output);
+extern bool_t _type_less_fast_long_double(const void* cpv_first, const void* cpv_second);
 extern void _type_destroy_long_double(const void* cpv_input, void* pv_output);
 /* bool_t */
 extern void _type_init_cstl_bool(const void* cpv_input, void* pv_output);
 extern void _type_copy_cstl_bool(const void* cpv_first, const void* cpv_second, void* pv_output);
 extern void _type_less_cstl_bool(const void* cpv_first, const void* cpv_second, void* pv_output);
+extern bool_t _type_less_fast_cstl_bool(const void* cpv_first, const void* cpv_second);
 extern void _type_destroy_cstl_bool(const void* cpv_input, void* pv_output);
 /* char* */
 extern void _type_init_cstr(const void* cpv_input, void* pv_output);
 extern void _type_copy_cstr(const void* cpv_first, const void* cpv_second, void* pv_output);
 extern void _type_less_cstr(const void* cpv_first, const void* cpv_second, void* pv_output);
+extern bool_t _type_less_fast_cstr(const void* cpv_first, const void* cpv_second);
 extern void _type_destroy_cstr(const void* cpv_input, void* pv_output);
 /* void* */
 extern void _type_init_pointer(const void* cpv_input, void* pv_output);
 extern void _type_copy_pointer(const void* cpv_first, const void* cpv_second, void* pv_output);
 extern void _type_less_pointer(const void* cpv_first, const void* cpv_second, void* pv_output);
+extern bool_t _type_less_fast_pointer(const void* cpv_first, const void* cpv_second);
 extern void _type_destroy_pointer(const void* cpv_input, void* pv_output);
 /* cstl container */
 /* vector_t */
@@ -223,16 +238,19 @@ extern void _type_destroy_basic_string(const void* cpv_input, void* pv_output);
 extern void _type_init_bool(const void* cpv_input, void* pv_output);
 extern void _type_copy_bool(const void* cpv_first, const void* cpv_second, void* pv_output);
 extern void _type_less_bool(const void* cpv_first, const void* cpv_second, void* pv_output);
+extern bool_t _type_less_fast_bool(const void* cpv_first, const void* cpv_second);
 extern void _type_destroy_bool(const void* cpv_input, void* pv_output);
 /* long long */
 extern void _type_init_long_long(const void* cpv_input, void* pv_output);
 extern void _type_copy_long_long(const void* cpv_first, const void* cpv_second, void* pv_output);
 extern void _type_less_long_long(const void* cpv_first, const void* cpv_second, void* pv_output);
+extern bool_t _type_less_fast_long_long(const void* cpv_first, const void* cpv_second);
 extern void _type_destroy_long_long(const void* cpv_input, void* pv_output);
 /* unsigned long long */
 extern void _type_init_ulong_long(const void* cpv_input, void* pv_output);
 extern void _type_copy_ulong_long(const void* cpv_first, const void* cpv_second, void* pv_output);
 extern void _type_less_ulong_long(const void* cpv_first, const void* cpv_second, void* pv_output);
+extern bool_t _type_less_fast_ulong_long(const void* cpv_first, const void* cpv_second);
 extern void _type_destroy_ulong_long(const void* cpv_input, void* pv_output);
 #endif
 
@@ -29,12 +29,22 @@
 #include "cvector.h"
 
 #include "cstl_vector_aux.h"
+#include "cstl_alloc_aux.h"
 
 /** local constant declaration and local macro section **/
 
 /** local data type declaration and local struct, union, enum section **/
 
 /** local function prototype section **/
+/**
+ * Move the elements of vector to new memory with specific capacity.
+ * @param pvec_vector    vector container.
+ * @param t_newcapacity  new capacity.
+ * @return false if the allocator context refuses the new memory, otherwise true.
+ * @remarks t_newcapacity must not be less than vector_size(), the old memory is released. if t_newcapacity == 0, then
+ *          the vector has no memory. the vector is not changed when false is returned.
+ */
+static bool_t _vector_reallocate(vector_t* pvec_vector, size_t t_newcapacity);
 
 /** exported global variable definition section **/
 
@@ -64,7 +74,10 @@ void vector_init_n(vector_t* pvec_vector, size_t t_count)
         size_t t_newcapacity = _vector_calculate_new_capacity(0, t_count);
 
         pvec_vector->_pby_start = _alloc_allocate(&pvec_vector->_t_allocator, _GET_VECTOR_TYPE_SIZE(pvec_vector), t_newcapacity);
-        assert(pvec_vector->_pby_start != NULL);
+        if (pvec_vector->_pby_start == NULL) {
+            /* the allocator context refuses the memory, the vector stays empty */
+            return;
+        }
         pvec_vector->_pby_finish = pvec_vector->_pby_start + _GET_VECTOR_TYPE_SIZE(pvec_vector) * t_count;
         pvec_vector->_pby_endofstorage = pvec_vector->_pby_start + _GET_VECTOR_TYPE_SIZE(pvec_vector) * t_newcapacity;
 
@@ -199,7 +212,7 @@ void vector_destroy(vector_t* pvec_vector)
 
     _vector_destroy_auxiliary(pvec_vector);
     /* free memory that malloced in _create_vector() function */
-    free(pvec_vector);
+    _alloc_free_context(&pvec_vector->_t_allocator._t_context, pvec_vector, sizeof(vector_t));
 }
 
 /**
@@ -251,58 +264,37 @@ size_t vector_capacity(const vector_t* cpvec_vector)
  */
 void vector_reserve(vector_t* pvec_vector, size_t t_reservesize)
 {
-    _byte_t* pby_reservemem = NULL; /* new memory for reserve */
-    _byte_t* pby_newstart = NULL;
-    _byte_t* pby_newfinish = NULL;
-    _byte_t* pby_newendofstorage = NULL;
-    _byte_t* pby_newpos = NULL;
-    _byte_t* pby_oldpos = NULL;
-    size_t   t_oldsize = 0;
-    size_t   t_oldcapacity = 0;
-    bool_t   b_result = false;
-
     assert(pvec_vector != NULL);
     assert(_vector_is_inited(pvec_vector));
 
     if (vector_capacity(pvec_vector) < t_reservesize) {
-        /* allocate the new vector with reserve size */
-        pby_reservemem = _alloc_allocate(&pvec_vector->_t_allocator, _GET_VECTOR_TYPE_SIZE(pvec_vector), t_reservesize);
-        assert(pby_reservemem != NULL);
-        /* get the new position */
-        t_oldsize = pvec_vector->_pby_finish - pvec_vector->_pby_start;
-        t_oldcapacity = pvec_vector->_pby_endofstorage - pvec_vector->_pby_start;
-        pby_newstart = pby_reservemem;
-        pby_newfinish = pby_reservemem + t_oldsize;
-        pby_newendofstorage = pby_reservemem + _GET_VECTOR_TYPE_SIZE(pvec_vector) * t_reservesize;
+        _vector_reallocate(pvec_vector, t_reservesize);
+    }
+}
 
-        /* initialize new elements */
-        _vector_init_elem_range_auxiliary(pvec_vector, pby_newstart, pby_newfinish);
-
-        /* copy elements from old memory and destroy those */
-        for (pby_newpos = pby_newstart, pby_oldpos = pvec_vector->_pby_start;
-             pby_newpos < pby_newfinish && pby_oldpos < pvec_vector->_pby_finish;
-             pby_newpos += _GET_VECTOR_TYPE_SIZE(pvec_vector),
-             pby_oldpos += _GET_VECTOR_TYPE_SIZE(pvec_vector)) {
-            /* copy from old vector_t memory */
-            b_result = _GET_VECTOR_TYPE_SIZE(pvec_vector);
-            _GET_VECTOR_TYPE_COPY_FUNCTION(pvec_vector)(pby_newpos, pby_oldpos, &b_result);
-            assert(b_result);
-            /* destroy old vector_t memory */
-            b_result = _GET_VECTOR_TYPE_SIZE(pvec_vector);
-            _GET_VECTOR_TYPE_DESTROY_FUNCTION(pvec_vector)(pby_oldpos, &b_result);
-            assert(b_result);
-        }
-        assert(pby_newpos == pby_newfinish && pby_oldpos == pvec_vector->_pby_finish);
+/**
+ * Release the unused capacity of vector.
+ */
+void vector_shrink_to_fit(vector_t* pvec_vector)
+{
+    assert(pvec_vector != NULL);
+    assert(_vector_is_inited(pvec_vector));
 
-        /* free the old vector element */
-        if (pvec_vector->_pby_start != NULL) {
-            _alloc_deallocate(&pvec_vector->_t_allocator, pvec_vector->_pby_start,
-                _GET_VECTOR_TYPE_SIZE(pvec_vector), t_oldcapacity / _GET_VECTOR_TYPE_SIZE(pvec_vector));
-        }
-        pvec_vector->_pby_start = pby_newstart;
-        pvec_vector->_pby_finish = pby_newfinish;
-        pvec_vector->_pby_endofstorage = pby_newendofstorage;
+    if (vector_capacity(pvec_vector) > vector_size(pvec_vector)) {
+        _vector_reallocate(pvec_vector, vector_size(pvec_vector));
     }
+    _alloc_shrink(&pvec_vector->_t_allocator);
+}
+
+/**
+ * Get the memory that vector holds.
+ */
+size_t vector_memory_usage(const vector_t* cpvec_vector)
+{
+    assert(cpvec_vector != NULL);
+    assert(_vector_is_inited(cpvec_vector));
+
+    return sizeof(vector_t) + _alloc_memory_usage(&cpvec_vector->_t_allocator);
 }
 
 /**
@@ -569,6 +561,7 @@ void vector_swap(vector_t* pvec_first, vector_t* pvec_second)
     assert(_vector_is_inited(pvec_first));
     assert(_vector_is_inited(pvec_second));
     assert(_vector_same_type(pvec_first, pvec_second));
+    assert(_alloc_same_context(&pvec_first->_t_allocator._t_context, &pvec_second->_t_allocator._t_context));
 
     if (vector_equal(pvec_first, pvec_second)) {
         return;
@@ -588,7 +581,13 @@ void* vector_at(const vector_t* cpvec_vector, size_t t_pos)
     assert(_vector_is_inited(cpvec_vector));
     assert(t_pos < vector_size(cpvec_vector));
 
-    return (void*)iterator_get_pointer(iterator_next_n(vector_begin(cpvec_vector), t_pos));
+    /* char* */
+    if (_GET_VECTOR_TYPE_STYLE(cpvec_vector) == _TYPE_C_BUILTIN &&
+        strncmp(_GET_VECTOR_TYPE_BASENAME(cpvec_vector), _C_STRING_TYPE, _TYPE_NAME_SIZE) == 0) {
+        return (void*)string_c_str((string_t*)(cpvec_vector->_pby_start + t_pos * _GET_VECTOR_TYPE_SIZE(cpvec_vector)));
+    } else {
+        return cpvec_vector->_pby_start + t_pos * _GET_VECTOR_TYPE_SIZE(cpvec_vector);
+    }
 }
 
 /**
@@ -707,6 +706,9 @@ void vector_insert_range(vector_t* pvec_vector, vector_iterator_t it_pos, iterat
             size_t t_distance = _VECTOR_ITERATOR_COREPOS(it_pos) - pvec_vector->_pby_start;
             /* reserve the new size */
             vector_reserve(pvec_vector, _vector_calculate_new_capacity(vector_size(pvec_vector), t_count));
+            if (vector_size(pvec_vector) + t_count > vector_capacity(pvec_vector)) {
+                return;
+            }
             _VECTOR_ITERATOR_COREPOS(it_pos) = pvec_vector->_pby_start + t_distance;
         }
 
@@ -765,6 +767,9 @@ void vector_insert_array(vector_t* pvec_vector, vector_iterator_t it_pos, const
             size_t t_distance = _VECTOR_ITERATOR_COREPOS(it_pos) - pvec_vector->_pby_start;
             /* reserve the new size */
             vector_reserve(pvec_vector, _vector_calculate_new_capacity(vector_size(pvec_vector), t_count));
+            if (vector_size(pvec_vector) + t_count > vector_capacity(pvec_vector)) {
+                return;
+            }
             _VECTOR_ITERATOR_COREPOS(it_pos) = pvec_vector->_pby_start + t_distance;
         }
 
@@ -921,6 +926,9 @@ void vector_resize(vector_t* pvec_vector, size_t t_resize)
         t_expsize = t_resize - vector_size(pvec_vector);
         if (t_resize > vector_capacity(pvec_vector)) {
             vector_reserve(pvec_vector, _vector_calculate_new_capacity(vector_size(pvec_vector), t_expsize));
+            if (t_resize > vector_capacity(pvec_vector)) {
+                return;
+            }
         }
 
         /* initialize new elements */
@@ -942,6 +950,78 @@ void vector_clear(vector_t* pvec_vector)
 }
 
 /** local function implementation section **/
+/**
+ * Move the elements of vector to new memory with specific capacity.
+ */
+static bool_t _vector_reallocate(vector_t* pvec_vector, size_t t_newcapacity)
+{
+    _byte_t* pby_reservemem = NULL; /* new memory for reserve */
+    _byte_t* pby_newstart = NULL;
+    _byte_t* pby_newfinish = NULL;
+    _byte_t* pby_newendofstorage = NULL;
+    _byte_t* pby_newpos = NULL;
+    _byte_t* pby_oldpos = NULL;
+    size_t   t_oldsize = 0;
+    size_t   t_oldcapacity = 0;
+    bool_t   b_result = false;
+
+    assert(pvec_vector != NULL);
+    assert(vector_size(pvec_vector) <= t_newcapacity);
+
+    if (t_newcapacity == 0) {
+        /* the vector is empty, so release the memory only */
+        if (pvec_vector->_pby_start != NULL) {
+            _alloc_deallocate(&pvec_vector->_t_allocator, pvec_vector->_pby_start, _GET_VECTOR_TYPE_SIZE(pvec_vector),
+                (pvec_vector->_pby_endofstorage - pvec_vector->_pby_start) / _GET_VECTOR_TYPE_SIZE(pvec_vector));
+        }
+        pvec_vector->_pby_start = NULL;
+        pvec_vector->_pby_finish = NULL;
+        pvec_vector->_pby_endofstorage = NULL;
+        return true;
+    }
+
+    /* allocate the new vector with reserve size */
+    pby_reservemem = _alloc_allocate(&pvec_vector->_t_allocator, _GET_VECTOR_TYPE_SIZE(pvec_vector), t_newcapacity);
+    if (pby_reservemem == NULL) {
+        return false;
+    }
+    /* get the new position */
+    t_oldsize = pvec_vector->_pby_finish - pvec_vector->_pby_start;
+    t_oldcapacity = pvec_vector->_pby_endofstorage - pvec_vector->_pby_start;
+    pby_newstart = pby_reservemem;
+    pby_newfinish = pby_reservemem + t_oldsize;
+    pby_newendofstorage = pby_reservemem + _GET_VECTOR_TYPE_SIZE(pvec_vector) * t_newcapacity;
+
+    /* initialize new elements */
+    _vector_init_elem_range_auxiliary(pvec_vector, pby_newstart, pby_newfinish);
+
+    /* copy elements from old memory and destroy those */
+    for (pby_newpos = pby_newstart, pby_oldpos = pvec_vector->_pby_start;
+         pby_newpos < pby_newfinish && pby_oldpos < pvec_vector->_pby_finish;
+         pby_newpos += _GET_VECTOR_TYPE_SIZE(pvec_vector),
+         pby_oldpos += _GET_VECTOR_TYPE_SIZE(pvec_vector)) {
+        /* copy from old vector_t memory */
+        b_result = _GET_VECTOR_TYPE_SIZE(pvec_vector);
+        _GET_VECTOR_TYPE_COPY_FUNCTION(pvec_vector)(pby_newpos, pby_oldpos, &b_result);
+        assert(b_result);
+        /* destroy old vector_t memory */
+        b_result = _GET_VECTOR_TYPE_SIZE(pvec_vector);
+        _GET_VECTOR_TYPE_DESTROY_FUNCTION(pvec_vector)(pby_oldpos, &b_result);
+        assert(b_result);
+    }
+    assert(pby_newpos == pby_newfinish && pby_oldpos == pvec_vector->_pby_finish);
+
+    /* free the old vector element */
+    if (pvec_vector->_pby_start != NULL) {
+        _alloc_deallocate(&pvec_vector->_t_allocator, pvec_vector->_pby_start,
+            _GET_VECTOR_TYPE_SIZE(pvec_vector), t_oldcapacity / _GET_VECTOR_TYPE_SIZE(pvec_vector));
+    }
+    pvec_vector->_pby_start = pby_newstart;
+    pvec_vector->_pby_finish = pby_newfinish;
+    pvec_vector->_pby_endofstorage = pby_newendofstorage;
+
+    return true;
+}
 
 /** eof **/
 
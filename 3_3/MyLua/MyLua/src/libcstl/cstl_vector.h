@@ -38,6 +38,19 @@ extern "C" {
  */
 #define create_vector(...) _create_vector(#__VA_ARGS__) 
 
+/**
+ * Create vector container that gets memory from allocator context.
+ * @param cpt_context  allocator context.
+ * @param ...          element type name.
+ * @return if create vector successfully return vector pointer, otherwise return NULL.
+ * @remarks if cpt_context == NULL, then the behavior is undefined. the container and its element buffer are allocated
+ *          through the context, memory owned by the elements (string or other containers) and the temporary values
+ *          of the varg functions come from system. the context is copied and should stay usable until the container
+ *          is destroyed. when the context refuses the memory, the function that grows the vector leaves it unchanged,
+ *          the insertion of a number of elements returns vector_end().
+ */
+#define create_vector_with_allocator(cpt_context, ...) _create_vector_with_allocator((cpt_context), #__VA_ARGS__)
+
 /**
  * Initialize vector container with mutiple specificed element.
  * @param pvec_vector    vector container.
@@ -88,7 +101,8 @@ extern "C" {
  * @param pvec_vector   vector container.
  * @param it_pos        specificed position.
  * @param elem          specificed element.
- * @return the position where the new element was inserted into the vector.
+ * @return the position where the new element was inserted into the vector, vector_end() if the allocator context
+ *         refuses the memory.
  * @remarks if pvec_vector == NULL, then the behavior is undefined. the vector must be initialized, otherwise the
  *          behavior is undefined. the specificed position muse be valid iterator for vector container, otherwise
  *          the behavior is undefined. the type of specificed and vector element must be the same, otherwise the
@@ -102,7 +116,8 @@ extern "C" {
  * @param it_pos        specificed position.
  * @param t_count       the number of specificed elements.
  * @param elem          specificed element.
- * @return the position where the new element was inserted into the vector.
+ * @return the position where the new element was inserted into the vector, vector_end() if the allocator context
+ *         refuses the memory.
  * @remarks if pvec_vector == NULL, then the behavior is undefined. the vector must be initialized, otherwise the
  *          behavior is undefined. the specificed position muse be valid iterator for vector container, otherwise
  *          the behavior is undefined. the type of specificed and vector element must be the same, otherwise the
@@ -110,6 +125,25 @@ extern "C" {
  */
 #define vector_insert_n(pvec_vector, it_pos, t_count, elem) _vector_insert_n((pvec_vector), (it_pos), (t_count), (elem))
 
+/**
+ * Return raw pointer to the first element of vector.
+ * @param cpvec_vector   vector container.
+ * @return raw pointer to the first element, the elements are stored contiguously in [vector_data(), vector_data_end()).
+ * @remarks if cpvec_vector == NULL, then the behavior is undefined. the vector must be initialized, otherwise the behavior
+ *          is undefined. the pointer is invalid after the capacity of vector changed. the element of char* vector is
+ *          string_t, not char*.
+ */
+#define vector_data(cpvec_vector) ((void*)(cpvec_vector)->_pby_start)
+
+/**
+ * Return raw pointer that points just beyond the last element of vector.
+ * @param cpvec_vector   vector container.
+ * @return raw pointer after the last element.
+ * @remarks if cpvec_vector == NULL, then the behavior is undefined. the vector must be initialized, otherwise the behavior
+ *          is undefined. the pointer is invalid after the size or capacity of vector changed.
+ */
+#define vector_data_end(cpvec_vector) ((void*)(cpvec_vector)->_pby_finish)
+
 /** data type declaration and struct, union, enum section **/
 
 /** exported global variable declaration section **/
@@ -228,6 +262,25 @@ extern size_t vector_capacity(const vector_t* cpvec_vector);
  */
 extern void vector_reserve(vector_t* pvec_vector, size_t t_reservesize);
 
+/**
+ * Release the unused capacity of vector.
+ * @param pvec_vector   vector container.
+ * @return void.
+ * @remarks if pvec_vector == NULL, then the behavior is undefined. pvec_vector must be initialized, otherwise the
+ *          behavior is undefined. the capacity becomes vector_size() and the empty slabs are released, all iterators of
+ *          vector are invalid.
+ */
+extern void vector_shrink_to_fit(vector_t* pvec_vector);
+
+/**
+ * Get the memory that vector holds.
+ * @param cpvec_vector   vector container.
+ * @return the bytes of vector_t and the memory of its allocator.
+ * @remarks if cpvec_vector == NULL, then the behavior is undefined. cpvec_vector must be initialized, otherwise the
+ *          behavior is undefined. the memory owned by elements, such as the characters of string_t, is not counted.
+ */
+extern size_t vector_memory_usage(const vector_t* cpvec_vector);
+
 /**
  * Test the two vectors are equal.
  * @param cpvec_first   first vector container.
@@ -337,6 +390,7 @@ extern void vector_assign_array(vector_t* pvec_vector, const void* cpv_array, si
  * @remarks if pvec_first == NULL or pvec_second == NULL, then the behavior is undefined. the two vectors must be
  *          initialized, otherwise the behavior is undefined. the element type of two vectors must be the same, otherwise
  *          the behavior is undefined. if vector_equal(pvec_first, pvec_second) == true, then this function does nothing.
+ *          the two vectors must be created with the same allocator context, otherwise the behavior is undefined.
  */
 extern void vector_swap(vector_t* pvec_first, vector_t* pvec_second);
 
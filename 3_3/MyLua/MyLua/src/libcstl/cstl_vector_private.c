@@ -29,6 +29,7 @@
 #include "cvector.h"
 
 #include "cstl_vector_aux.h"
+#include "cstl_alloc_aux.h"
 
 /** local constant declaration and local macro section **/
 
@@ -61,6 +62,28 @@ vector_t* _create_vector(const char* s_typename)
     return pvec_vector;
 }
 
+/**
+ * Create vector container with allocator context.
+ */
+vector_t* _create_vector_with_allocator(const alloc_context_t* cpt_context, const char* s_typename)
+{
+    vector_t*   pvec_vector = NULL;
+
+    assert(cpt_context != NULL);
+
+    if ((pvec_vector = (vector_t*)_alloc_malloc_context(cpt_context, sizeof(vector_t))) == NULL) {
+        return NULL;
+    }
+
+    if (!_create_vector_auxiliary(pvec_vector, s_typename)) {
+        _alloc_free_context(cpt_context, pvec_vector, sizeof(vector_t));
+        return NULL;
+    }
+    _alloc_set_context(&pvec_vector->_t_allocator, cpt_context);
+
+    return pvec_vector;
+}
+
 /**
  * Create vector container auxiliary function.
  */
@@ -113,10 +136,9 @@ void _vector_init_elem_varg(vector_t* pvec_vector, size_t t_count, va_list val_e
 
     /* initialize vector_t */
     vector_init_n(pvec_vector, t_count);
-    if (t_count > 0) {
+    if (t_count > 0 && vector_size(pvec_vector) == t_count) {
         /* get varg value only once */
-        pv_varg = _alloc_allocate(&pvec_vector->_t_allocator, _GET_VECTOR_TYPE_SIZE(pvec_vector), 1);
-        assert(pv_varg != NULL);
+        pv_varg = _alloc_allocate_temp(&pvec_vector->_t_allocator, _GET_VECTOR_TYPE_SIZE(pvec_vector));
         _vector_get_varg_value_auxiliary(pvec_vector, val_elemlist, pv_varg);
 
         /* copy varg value to each element */
@@ -131,7 +153,7 @@ void _vector_init_elem_varg(vector_t* pvec_vector, size_t t_count, va_list val_e
 
         /* destroy varg value and free memory */
         _vector_destroy_varg_value_auxiliary(pvec_vector, pv_varg);
-        _alloc_deallocate(&pvec_vector->_t_allocator, pv_varg, _GET_VECTOR_TYPE_SIZE(pvec_vector), 1);
+        _alloc_deallocate_temp(&pvec_vector->_t_allocator, pv_varg, _GET_VECTOR_TYPE_SIZE(pvec_vector));
     }
 }
 
@@ -198,23 +220,24 @@ void _vector_assign_elem_varg(vector_t* pvec_vector, size_t t_count, va_list val
     assert(_vector_is_inited(pvec_vector));
 
     /* get value from varg */
-    pv_varg = _alloc_allocate(&pvec_vector->_t_allocator, _GET_VECTOR_TYPE_SIZE(pvec_vector), 1);
-    assert(pv_varg != NULL);
+    pv_varg = _alloc_allocate_temp(&pvec_vector->_t_allocator, _GET_VECTOR_TYPE_SIZE(pvec_vector));
     _vector_get_varg_value_auxiliary(pvec_vector, val_elemlist, pv_varg);
 
-    /* copy value from varg for each element */
+    /* copy value from varg for each element, the elements are not changed if the vector can not grow */
     vector_resize(pvec_vector, t_count);
-    it_begin = vector_begin(pvec_vector);
-    it_end = vector_end(pvec_vector);
-    for (it_iter = it_begin; !iterator_equal(it_iter, it_end); it_iter = iterator_next(it_iter)) {
-        b_result = _GET_VECTOR_TYPE_SIZE(pvec_vector);
-        _GET_VECTOR_TYPE_COPY_FUNCTION(pvec_vector)(_VECTOR_ITERATOR_COREPOS(it_iter), pv_varg, &b_result);
-        assert(b_result);
+    if (vector_size(pvec_vector) == t_count) {
+        it_begin = vector_begin(pvec_vector);
+        it_end = vector_end(pvec_vector);
+        for (it_iter = it_begin; !iterator_equal(it_iter, it_end); it_iter = iterator_next(it_iter)) {
+            b_result = _GET_VECTOR_TYPE_SIZE(pvec_vector);
+            _GET_VECTOR_TYPE_COPY_FUNCTION(pvec_vector)(_VECTOR_ITERATOR_COREPOS(it_iter), pv_varg, &b_result);
+            assert(b_result);
+        }
     }
 
     /* destroy varg and free memory */
     _vector_destroy_varg_value_auxiliary(pvec_vector, pv_varg);
-    _alloc_deallocate(&pvec_vector->_t_allocator, pv_varg, _GET_VECTOR_TYPE_SIZE(pvec_vector), 1);
+    _alloc_deallocate_temp(&pvec_vector->_t_allocator, pv_varg, _GET_VECTOR_TYPE_SIZE(pvec_vector));
 }
 
 /**
@@ -245,6 +268,9 @@ void _vector_push_back_varg(vector_t* pvec_vector, va_list val_elemlist)
     /* if the remain capacity is less then the element count */
     if (vector_capacity(pvec_vector) == vector_size(pvec_vector)) {
         vector_reserve(pvec_vector, _vector_calculate_new_capacity(vector_size(pvec_vector), 1));
+        if (vector_capacity(pvec_vector) == vector_size(pvec_vector)) {
+            return;
+        }
     }
 
     /* initialize the last element */
@@ -296,11 +322,13 @@ void _vector_resize_elem_varg(vector_t* pvec_vector, size_t t_resize, va_list va
         t_expsize = t_resize - vector_size(pvec_vector);
         if (t_resize > vector_capacity(pvec_vector)) {
             vector_reserve(pvec_vector, _vector_calculate_new_capacity(vector_size(pvec_vector), t_expsize));
+            if (t_resize > vector_capacity(pvec_vector)) {
+                return;
+            }
         }
 
         /* get varg value only once */
-        pv_varg = _alloc_allocate(&pvec_vector->_t_allocator, _GET_VECTOR_TYPE_SIZE(pvec_vector), 1);
-        assert(pv_varg != NULL);
+        pv_varg = _alloc_allocate_temp(&pvec_vector->_t_allocator, _GET_VECTOR_TYPE_SIZE(pvec_vector));
         _vector_get_varg_value_auxiliary(pvec_vector, val_elemlist, pv_varg);
 
         /* initialize new elements */
@@ -315,7 +343,7 @@ void _vector_resize_elem_varg(vector_t* pvec_vector, size_t t_resize, va_list va
         }
         /* destroy varg */
         _vector_destroy_varg_value_auxiliary(pvec_vector, pv_varg);
-        _alloc_deallocate(&pvec_vector->_t_allocator, pv_varg, _GET_VECTOR_TYPE_SIZE(pvec_vector), 1);
+        _alloc_deallocate_temp(&pvec_vector->_t_allocator, pv_varg, _GET_VECTOR_TYPE_SIZE(pvec_vector));
     }
 }
 
@@ -362,6 +390,9 @@ vector_iterator_t _vector_insert_n_varg(vector_t* pvec_vector, vector_iterator_t
             size_t t_insertpos = iterator_distance(vector_begin(pvec_vector), it_pos);
             /* reserve the new size */
             vector_reserve(pvec_vector, _vector_calculate_new_capacity(vector_size(pvec_vector), t_count));
+            if (vector_size(pvec_vector) + t_count > vector_capacity(pvec_vector)) {
+                return vector_end(pvec_vector);
+            }
             it_pos = iterator_next_n(vector_begin(pvec_vector), t_insertpos);
         }
 
@@ -401,8 +432,7 @@ vector_iterator_t _vector_insert_n_varg(vector_t* pvec_vector, vector_iterator_t
         }
 
         /* get varg value only once */
-        pv_varg = _alloc_allocate(&pvec_vector->_t_allocator, _GET_VECTOR_TYPE_SIZE(pvec_vector), 1);
-        assert(pv_varg != NULL);
+        pv_varg = _alloc_allocate_temp(&pvec_vector->_t_allocator, _GET_VECTOR_TYPE_SIZE(pvec_vector));
         _vector_get_varg_value_auxiliary(pvec_vector, val_elemlist, pv_varg);
         /* copy value for varg */
         for (i = 0; i < t_count; ++i) {
@@ -412,7 +442,7 @@ vector_iterator_t _vector_insert_n_varg(vector_t* pvec_vector, vector_iterator_t
         }
         /* destroy varg and free memory */
         _vector_destroy_varg_value_auxiliary(pvec_vector, pv_varg);
-        _alloc_deallocate(&pvec_vector->_t_allocator, pv_varg, _GET_VECTOR_TYPE_SIZE(pvec_vector), 1);
+        _alloc_deallocate_temp(&pvec_vector->_t_allocator, pv_varg, _GET_VECTOR_TYPE_SIZE(pvec_vector));
     }
 
     return it_pos;
@@ -69,6 +69,15 @@ typedef struct _tagvector
  */
 extern vector_t* _create_vector(const char* s_typename);
 
+/**
+ * Create vector container with allocator context.
+ * @param cpt_context  allocator context.
+ * @param s_typename   element type name.
+ * @return if create vector successfully return vector pointer, otherwise return NULL.
+ * @remarks if cpt_context == NULL or s_typename == NULL, then the behavior is undefined.
+ */
+extern vector_t* _create_vector_with_allocator(const alloc_context_t* cpt_context, const char* s_typename);
+
 /**
  * Create vector container auxiliary function.
  * @param pvec_vector uncreated container.
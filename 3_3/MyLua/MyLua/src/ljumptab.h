@@ -0,0 +1,98 @@
+/*
+** $Id: ljumptab.h $
+** Jump Table for the Lua interpreter
+** See Copyright Notice in lua.h
+*/
+
+
+/*
+** This file is included inside 'luaV_execute' when LUA_USE_JUMPTABLE
+** is on. Each opcode gets its own label and every instruction ends
+** with its own indirect jump to the next one ("direct threading").
+** 'disp' points to the table in use: 'disptab' when no line/count hook
+** is active, 'hooktab' otherwise, whose entries all lead to the code
+** that calls the hook before dispatching through 'disptab'. 'disp' is
+** refreshed by 'updatedisp' at frame entry, after any call that may
+** change hooks (Protect) and at jumps, so a hook set from a signal
+** handler still breaks loops.
+*/
+
+
+#undef vmdispatch
+#define vmdispatch(x)     goto *disp[x];
+
+#undef vmcase
+#define vmcase(l)     L_##l:
+
+#undef vmbreak
+#define vmbreak		vmfetch(); vmdispatch(GET_OPCODE(i));
+
+
+static const void *const disptab[NUM_OPCODES] = {
+
+#if 0
+** you can update the following list with this command:
+**
+**  sed -n '/^OP_/\!d; s/OP_/\&\&L_OP_/ ; s/,.*/,/ ; s/\/.*// ; p'  lopcodes.h
+**
+#endif
+
+&&L_OP_MOVE,
+&&L_OP_LOADK,
+&&L_OP_LOADKX,
+&&L_OP_LOADBOOL,
+&&L_OP_LOADNIL,
+&&L_OP_GETUPVAL,
+&&L_OP_GETTABUP,
+&&L_OP_GETTABLE,
+&&L_OP_SETTABUP,
+&&L_OP_SETUPVAL,
+&&L_OP_SETTABLE,
+&&L_OP_NEWTABLE,
+&&L_OP_SELF,
+&&L_OP_ADD,
+&&L_OP_SUB,
+&&L_OP_MUL,
+&&L_OP_MOD,
+&&L_OP_POW,
+&&L_OP_DIV,
+&&L_OP_IDIV,
+&&L_OP_BAND,
+&&L_OP_BOR,
+&&L_OP_BXOR,
+&&L_OP_SHL,
+&&L_OP_SHR,
+&&L_OP_UNM,
+&&L_OP_BNOT,
+&&L_OP_NOT,
+&&L_OP_LEN,
+&&L_OP_CONCAT,
+&&L_OP_JMP,
+&&L_OP_EQ,
+&&L_OP_LT,
+&&L_OP_LE,
+&&L_OP_TEST,
+&&L_OP_TESTSET,
+&&L_OP_CALL,
+&&L_OP_TAILCALL,
+&&L_OP_RETURN,
+&&L_OP_FORLOOP,
+&&L_OP_FORPREP,
+&&L_OP_TFORCALL,
+&&L_OP_TFORLOOP,
+&&L_OP_SETLIST,
+&&L_OP_CLOSURE,
+&&L_OP_VARARG,
+&&L_OP_EXTRAARG,
+&&L_OP_EXPORT
+
+};
+
+
+/* every opcode goes through the hook first (GNU range initializer) */
+static const void *const hooktab[NUM_OPCODES] = {
+  [0 ... NUM_OPCODES - 1] = &&L_hook
+};
+
+const void *const *disp = disptab;
+
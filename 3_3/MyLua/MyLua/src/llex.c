@@ -137,7 +137,8 @@ TString *luaX_newstring (LexState *ls, const char *str, size_t l) {
     setbvalue(o, 1);  /* t[string] = true */
     luaC_checkGC(L);
   }
-  else {  /* string already present */
+  else if (ts->tt == LUA_TLNGSTR) {  /* long string already present */
+    /* (short strings are internalized; their entry may be a shape slot) */
     ts = tsvalue(keyfromval(o));  /* re-use value previously stored */
   }
   L->top--;  /* remove string from stack */
@@ -230,7 +231,7 @@ static int read_numeral (LexState *ls, SemInfo *seminfo) {
     else break;
   }
   save(ls, '\0');
-  if (luaO_str2num(luaZ_buffer(ls->buff), &obj) == 0)  /* format error? */
+  if (luaO_str2num(ls->L, luaZ_buffer(ls->buff), &obj) == 0)  /* error? */
     lexerror(ls, "malformed number", TK_FLT);
   if (ttisinteger(&obj)) {
     seminfo->i = ivalue(&obj);
@@ -178,6 +178,34 @@ typedef unsigned long Instruction;
 #endif
 
 
+/*
+** Limits for table shapes (see ltable.c): maximum number of keys in a
+** shape (must fit in a byte) and maximum number of shapes in a state.
+** Tables that would pass these limits use a regular hash part.
+*/
+#if !defined(LUAI_MAXSHAPEKEYS)
+#define LUAI_MAXSHAPEKEYS	64
+#endif
+
+#if !defined(LUAI_MAXSHAPES)
+#define LUAI_MAXSHAPES		4096
+#endif
+
+
+/*
+** Limits for incremental rehash (see ltable.c): minimum number of nodes
+** in a hash part for it to be moved incrementally, and minimum number
+** of old nodes moved for each new key.
+*/
+#if !defined(LUAI_REHASHMIN)
+#define LUAI_REHASHMIN		(1 << 15)
+#endif
+
+#if !defined(LUAI_REHASHSTEP)
+#define LUAI_REHASHSTEP		32
+#endif
+
+
 /*
 ** Initial size for the string table (must be power of 2).
 ** The Lua core alone registers ~50 strings (reserved words +
@@ -98,3 +98,21 @@ void *luaM_realloc_ (lua_State *L, void *block, size_t osize, size_t nsize) {
   return newblock;
 }
 
+
+/*
+** allocation routine for libcstl containers of the state ('ud' is the
+** global state). Memory is counted in 'GCdebt', but a failure cannot run
+** an emergency collection or raise an error inside libcstl, so it just
+** returns NULL: the container is left unchanged and its caller runs the
+** collection and raises the error (see 'luaE_monopolize').
+*/
+void *luaM_cstlrealloc (void *ud, void *block, size_t osize, size_t nsize) {
+  global_State *g = cast(global_State *, ud);
+  size_t realosize = (block) ? osize : 0;
+  void *newblock = (*g->frealloc)(g->ud, block, osize, nsize);
+  if (newblock == NULL && nsize > 0)
+    return NULL;
+  g->GCdebt = (g->GCdebt + nsize) - realosize;
+  return newblock;
+}
+
@@ -64,6 +64,8 @@ LUAI_FUNC void *luaM_realloc_ (lua_State *L, void *block, size_t oldsize,
 LUAI_FUNC void *luaM_growaux_ (lua_State *L, void *block, int *size,
                                size_t size_elem, int limit,
                                const char *what);
+LUAI_FUNC void *luaM_cstlrealloc (void *ud, void *block, size_t oldsize,
+                                                          size_t size);
 
 #endif
 
@@ -22,6 +22,7 @@
 #include "lctype.h"
 #include "ldebug.h"
 #include "ldo.h"
+#include "lgc.h"
 #include "lmem.h"
 #include "lobject.h"
 #include "lstate.h"
@@ -33,6 +34,30 @@
 LUAI_DDEF const TValue luaO_nilobject_ = {NILCONSTANT};
 
 
+#if defined(LUA_USE_NANBOX)
+
+LUAI_DDEF const lu_byte luaO_nbtypes[16] = {
+  LUA_TNUMFLT, LUA_TNIL, LUA_TBOOLEAN, LUA_TLIGHTUSERDATA,
+  LUA_TLCF, LUA_TDEADKEY, LUA_TNIL, LUA_TNUMINT,
+  ctb(LUA_TSHRSTR), ctb(LUA_TLNGSTR), ctb(LUA_TTABLE), ctb(LUA_TUSERDATA),
+  ctb(LUA_TLCL), ctb(LUA_TCCL), ctb(LUA_TTHREAD), LUA_TNUMINT
+};
+
+
+/*
+** Store in 'o' an integer too large for the payload of a boxed value.
+** (The box is a plain number for the collector: it is never weak and
+** has no references.)
+*/
+void luaO_boxint (lua_State *L, TValue *o, lua_Integer i) {
+  GCObject *b = luaC_newobj(L, LUA_TNUMINT, sizeof(IntBox));
+  gco2ib(b)->i = i;
+  nbsetgc(o, NBT_INTBOX, b);
+}
+
+#endif
+
+
 /*
 ** converts an integer to a "floating point byte", represented as
 ** (eeeeexxx), where the real value is (1xxx) * 2^(eeeee - 1) if
@@ -128,7 +153,7 @@ void luaO_arith (lua_State *L, int op, const TValue *p1, const TValue *p2,
     case LUA_OPBNOT: {  /* operate only on integers */
       lua_Integer i1; lua_Integer i2;
       if (tointeger(p1, &i1) && tointeger(p2, &i2)) {
-        setivalue(res, intarith(L, op, i1, i2));
+        setivalue(L, res, intarith(L, op, i1, i2));
         return;
       }
       else break;  /* go to the end */
@@ -144,7 +169,7 @@ void luaO_arith (lua_State *L, int op, const TValue *p1, const TValue *p2,
     default: {  /* other operations */
       lua_Number n1; lua_Number n2;
       if (ttisinteger(p1) && ttisinteger(p2)) {
-        setivalue(res, intarith(L, op, ivalue(p1), ivalue(p2)));
+        setivalue(L, res, intarith(L, op, ivalue(p1), ivalue(p2)));
         return;
       }
       else if (tonumber(p1, &n1) && tonumber(p2, &n2)) {
@@ -328,21 +353,42 @@ static const char *l_str2int (const char *s, lua_Integer *result) {
 }
 
 
-size_t luaO_str2num (const char *s, TValue *o) {
-  lua_Integer i; lua_Number n;
+/*
+** Convert string 's' to a number, putting an integer result in '*i'
+** or a float one in '*n' ('*isint' tells which). Returns 0 if the
+** conversion fails, the string size plus one otherwise. (Unlike
+** 'luaO_str2num', it needs no state to hold a large integer when
+** values are NaN-boxed.)
+*/
+size_t luaO_rawstr2num (const char *s, lua_Integer *i, lua_Number *n,
+                        int *isint) {
   const char *e;
-  if ((e = l_str2int(s, &i)) != NULL) {  /* try as an integer */
-    setivalue(o, i);
-  }
-  else if ((e = l_str2d(s, &n)) != NULL) {  /* else try as a float */
-    setfltvalue(o, n);
-  }
+  if ((e = l_str2int(s, i)) != NULL)  /* try as an integer */
+    *isint = 1;
+  else if ((e = l_str2d(s, n)) != NULL)  /* else try as a float */
+    *isint = 0;
   else
     return 0;  /* conversion failed */
   return (e - s) + 1;  /* success; return string size */
 }
 
 
+size_t luaO_str2num (lua_State *L, const char *s, TValue *o) {
+  lua_Integer i; lua_Number n; int isint;
+  size_t sz = luaO_rawstr2num(s, &i, &n, &isint);
+  UNUSED(L);  /* only NaN-boxed integers may need the state */
+  if (sz == 0)
+    return 0;  /* conversion failed */
+  else if (isint) {
+    setivalue(L, o, i);
+  }
+  else {
+    setfltvalue(o, n);
+  }
+  return sz;
+}
+
+
 int luaO_utf8esc (char *buff, unsigned long x) {
   int n = 1;  /* number of bytes put in buffer (backwards) */
   lua_assert(x <= 0x10FFFF);
@@ -419,11 +465,11 @@ const char *luaO_pushvfstring (lua_State *L, const char *fmt, va_list argp) {
         break;
       }
       case 'd': {  /* an 'int' */
-        setivalue(L->top, va_arg(argp, int));
+        setivalue(L, L->top, va_arg(argp, int));
         goto top2str;
       }
       case 'I': {  /* a 'lua_Integer' */
-        setivalue(L->top, cast(lua_Integer, va_arg(argp, l_uacInt)));
+        setivalue(L, L->top, cast(lua_Integer, va_arg(argp, l_uacInt)));
         goto top2str;
       }
       case 'f': {  /* a 'lua_Number' */
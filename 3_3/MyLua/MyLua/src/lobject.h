@@ -94,6 +94,8 @@ struct GCObject {
 ** an actual value plus a tag with its type.
 */
 
+#if !defined(LUA_USE_NANBOX)	/* { */
+
 /*
 ** Union of all Lua values
 */
@@ -109,22 +111,73 @@ typedef union Value {
 
 #define TValuefields	Value value_; int tt_
 
+#else				/* }{ */
 
-typedef struct lua_TValue {
-  TValuefields;
-} TValue;
+#if LUA_FLOAT_TYPE != LUA_FLOAT_DOUBLE || (LUA_MAXINTEGER >> 62) != 1
+#error "LUA_USE_NANBOX needs 64-bit integers and double floats"
+#endif
 
+/*
+** NaN-boxed values: a value is a float unless its bits, read as an
+** unsigned integer, are above 'NB_FLOATMAX' (the usual negative quiet
+** NaN; other NaNs in that range are canonicalized to it when stored,
+** see 'setfltvalue'). Above it, bits 47-50 hold a tag (one of the
+** 'NBT_*' below) and bits 0-46 the payload: a pointer, a boolean or an
+** integer of 47 bits. Integers that do not fit in that are kept in an
+** 'IntBox'. Tags 8-15 are the collectable ones.
+*/
+typedef union Value {
+  lua_Unsigned u;  /* raw bits */
+  lua_Number n;    /* float numbers */
+} Value;
 
 
-/* macro defining a nil value */
-#define NILCONSTANT	{NULL}, LUA_TNIL
+#define TValuefields	Value value_
 
 
-#define val_(o)		((o)->value_)
+#define NBT_NIL		1
+#define NBT_BOOLEAN	2
+#define NBT_LIGHTUD	3
+#define NBT_LCF		4
+#define NBT_DEADKEY	5
+#define NBT_INT		7  /* (NBT_INTBOX - 8, see 'ttisinteger') */
+#define NBT_SHRSTR	8
+#define NBT_LNGSTR	9
+#define NBT_TABLE	10
+#define NBT_UDATA	11
+#define NBT_LCL		12
+#define NBT_CCL		13
+#define NBT_THREAD	14
+#define NBT_INTBOX	15
 
+#define NB_TAGSHIFT	47
+#define NB_PAYLOAD	((cast(lua_Unsigned, 1) << NB_TAGSHIFT) - 1)
+#define NB_HIGH		cast(lua_Unsigned, 0x1FFF0)  /* sign, exponent, quiet */
+
+/* raw bits of a boxed value with tag 't' and no payload */
+#define nbtagbits(t)	((NB_HIGH | (t)) << NB_TAGSHIFT)
+
+#define NB_FLOATMAX	nbtagbits(0)
+
+
+/*
+** Integers that do not fit in the payload of a NaN-boxed value
+*/
+typedef struct IntBox {
+  CommonHeader;
+  lua_Integer i;
+} IntBox;
+
+#endif				/* } */
+
+
+typedef struct lua_TValue {
+  TValuefields;
+} TValue;
+
+
+#define val_(o)		((o)->value_)
 
-/* raw type tag of a TValue */
-#define rttype(o)	((o)->tt_)
 
 /* tag with no variants (bits 0-3) */
 #define novariant(x)	((x) & 0x0F)
@@ -136,6 +189,16 @@ typedef struct lua_TValue {
 #define ttnov(o)	(novariant(rttype(o)))
 
 
+#if !defined(LUA_USE_NANBOX)	/* { */
+
+/* macro defining a nil value */
+#define NILCONSTANT	{NULL}, LUA_TNIL
+
+
+/* raw type tag of a TValue */
+#define rttype(o)	((o)->tt_)
+
+
 /* Macros to test type */
 #define checktag(o,t)		(rttype(o) == (t))
 #define checktype(o,t)		(ttnov(o) == (t))
@@ -178,20 +241,10 @@ typedef struct lua_TValue {
 /* a dead value may get the 'gc' field, but cannot access its contents */
 #define deadvalue(o)	check_exp(ttisdeadkey(o), cast(void *, val_(o).gc))
 
-#define l_isfalse(o)	(ttisnil(o) || (ttisboolean(o) && bvalue(o) == 0))
-
 
 #define iscollectable(o)	(rttype(o) & BIT_ISCOLLECTABLE)
 
 
-/* Macros for internal tests */
-#define righttt(obj)		(ttype(obj) == gcvalue(obj)->tt)
-
-#define checkliveness(L,obj) \
-	lua_longassert(!iscollectable(obj) || \
-		(righttt(obj) && (L == NULL || !isdead(G(L),gcvalue(obj)))))
-
-
 /* Macros to set values */
 #define settt_(o,t)	((o)->tt_=(t))
 
@@ -201,10 +254,10 @@ typedef struct lua_TValue {
 #define chgfltvalue(obj,x) \
   { TValue *io=(obj); lua_assert(ttisfloat(io)); val_(io).n=(x); }
 
-#define setivalue(obj,x) \
+#define setivalue(L,obj,x) \
   { TValue *io=(obj); val_(io).i=(x); settt_(io, LUA_TNUMINT); }
 
-#define chgivalue(obj,x) \
+#define chgivalue(L,obj,x) \
   { TValue *io=(obj); lua_assert(ttisinteger(io)); val_(io).i=(x); }
 
 #define setnilvalue(obj) settt_(obj, LUA_TNIL)
@@ -254,6 +307,175 @@ typedef struct lua_TValue {
 
 #define setdeadvalue(obj)	settt_(obj, LUA_TDEADKEY)
 
+#else				/* }{ */
+
+#define NILCONSTANT	{nbtagbits(NBT_NIL)}
+
+
+/* NaN-box tag of a value that is not a float */
+#define nbtag(o)	cast_int((val_(o).u >> NB_TAGSHIFT) & 0x0F)
+
+/* whether the (non-float) value has tag 't' */
+#define nbis(o,t)	((val_(o).u >> NB_TAGSHIFT) == (NB_HIGH | (t)))
+
+/* whether the tag is one of the pair 't', 't+1' (for even 't') */
+#define nbis2(o,t)	((val_(o).u >> (NB_TAGSHIFT + 1)) == ((NB_HIGH | (t)) >> 1))
+
+#define nbpayload(o)	(val_(o).u & NB_PAYLOAD)
+#define nbptr(o)	cast(void *, cast(size_t, nbpayload(o)))
+#define nbgco(o)	cast(GCObject *, nbptr(o))
+
+#define nbset(o,t,p)	(val_(o).u = nbtagbits(t) | (p))
+#define nbsetgc(o,t,x)	nbset(o, t, cast(lua_Unsigned, cast(size_t, (x))))
+
+/* sign-extend a 47-bit payload */
+#define nbint2i(u) \
+	(l_castU2S((u) << (64 - NB_TAGSHIFT)) >> (64 - NB_TAGSHIFT))
+
+/* whether integer 'i' can go in the payload */
+#define nbfitsint(i)	(nbint2i(l_castS2U(i)) == (i))
+
+/* tag of a collectable object with type 'tt' */
+#define nbgctag(tt) \
+	((tt) == LUA_TTABLE ? NBT_TABLE : \
+	 (tt) == LUA_TSHRSTR ? NBT_SHRSTR : \
+	 (tt) == LUA_TLNGSTR ? NBT_LNGSTR : \
+	 (tt) == LUA_TUSERDATA ? NBT_UDATA : \
+	 (tt) == LUA_TLCL ? NBT_LCL : \
+	 (tt) == LUA_TCCL ? NBT_CCL : \
+	 (tt) == LUA_TTHREAD ? NBT_THREAD : NBT_INTBOX)
+
+
+/* raw type tag of a TValue */
+#define rttype(o)  \
+	(ttisfloat(o) ? LUA_TNUMFLT : cast_int(luaO_nbtypes[nbtag(o)]))
+
+
+/* Macros to test type */
+#define checktag(o,t)		(rttype(o) == (t))
+#define checktype(o,t)		(ttnov(o) == (t))
+#define ttisnumber(o)		(ttisfloat(o) || ttisinteger(o))
+#define ttisfloat(o)		(val_(o).u <= NB_FLOATMAX)
+#define ttisinteger(o)  \
+	(((val_(o).u >> NB_TAGSHIFT) | 8) == (NB_HIGH | NBT_INTBOX))
+#define ttisnil(o)		(val_(o).u == nbtagbits(NBT_NIL))
+#define ttisboolean(o)		nbis(o, NBT_BOOLEAN)
+#define ttislightuserdata(o)	nbis(o, NBT_LIGHTUD)
+#define ttisstring(o)		nbis2(o, NBT_SHRSTR)
+#define ttisshrstring(o)	nbis(o, NBT_SHRSTR)
+#define ttislngstring(o)	nbis(o, NBT_LNGSTR)
+#define ttistable(o)		nbis(o, NBT_TABLE)
+#define ttisfunction(o)		(ttisclosure(o) || ttislcf(o))
+#define ttisclosure(o)		nbis2(o, NBT_LCL)
+#define ttisCclosure(o)		nbis(o, NBT_CCL)
+#define ttisLclosure(o)		nbis(o, NBT_LCL)
+#define ttislcf(o)		nbis(o, NBT_LCF)
+#define ttisfulluserdata(o)	nbis(o, NBT_UDATA)
+#define ttisthread(o)		nbis(o, NBT_THREAD)
+#define ttisdeadkey(o)		nbis(o, NBT_DEADKEY)
+
+
+/* Macros to access values */
+#define ivalue(o)	check_exp(ttisinteger(o), nbis(o, NBT_INT) ? \
+	nbint2i(val_(o).u) : cast(IntBox *, nbptr(o))->i)
+#define fltvalue(o)	check_exp(ttisfloat(o), val_(o).n)
+#define nvalue(o)	check_exp(ttisnumber(o), \
+	(ttisinteger(o) ? cast_num(ivalue(o)) : fltvalue(o)))
+#define gcvalue(o)	check_exp(iscollectable(o), nbgco(o))
+#define pvalue(o)	check_exp(ttislightuserdata(o), nbptr(o))
+#define tsvalue(o)	check_exp(ttisstring(o), gco2ts(nbgco(o)))
+#define uvalue(o)	check_exp(ttisfulluserdata(o), gco2u(nbgco(o)))
+#define clvalue(o)	check_exp(ttisclosure(o), gco2cl(nbgco(o)))
+#define clLvalue(o)	check_exp(ttisLclosure(o), gco2lcl(nbgco(o)))
+#define clCvalue(o)	check_exp(ttisCclosure(o), gco2ccl(nbgco(o)))
+#define fvalue(o)  \
+	check_exp(ttislcf(o), cast(lua_CFunction, cast(size_t, nbpayload(o))))
+#define hvalue(o)	check_exp(ttistable(o), gco2t(nbgco(o)))
+#define bvalue(o)	check_exp(ttisboolean(o), cast_int(nbpayload(o)))
+#define thvalue(o)	check_exp(ttisthread(o), gco2th(nbgco(o)))
+/* a dead value may get the 'gc' field, but cannot access its contents */
+#define deadvalue(o)	check_exp(ttisdeadkey(o), nbptr(o))
+
+
+#define iscollectable(o)  \
+	((val_(o).u >> (NB_TAGSHIFT + 3)) == ((NB_HIGH | 8) >> 3))
+
+
+/* Macros to set values */
+
+/* (NaNs that would look like boxed values are canonicalized) */
+#define setfltvalue(obj,x) \
+  { TValue *io=(obj); val_(io).n=(x); \
+    if (val_(io).u > NB_FLOATMAX) val_(io).u = NB_FLOATMAX; }
+
+#define chgfltvalue(obj,x) \
+  { TValue *io_=(obj); lua_assert(ttisfloat(io_)); setfltvalue(io_, x); }
+
+#define setivalue(L,obj,x) \
+  { TValue *io=(obj); lua_Integer i_=(x); \
+    if (nbfitsint(i_)) nbset(io, NBT_INT, l_castS2U(i_) & NB_PAYLOAD); \
+    else luaO_boxint(L, io, i_); }
+
+#define chgivalue(L,obj,x) \
+  { TValue *io_=(obj); lua_assert(ttisinteger(io_)); setivalue(L, io_, x); }
+
+#define setnilvalue(obj) (val_(obj).u = nbtagbits(NBT_NIL))
+
+#define setfvalue(obj,x) \
+  { TValue *io=(obj); nbsetgc(io, NBT_LCF, (x)); }
+
+/* (light userdata keep only the 47 significant bits of the pointer) */
+#define setpvalue(obj,x) \
+  { TValue *io=(obj); \
+    nbset(io, NBT_LIGHTUD, cast(lua_Unsigned, cast(size_t, (x))) & NB_PAYLOAD); }
+
+#define setbvalue(obj,x) \
+  { TValue *io=(obj); nbset(io, NBT_BOOLEAN, cast(lua_Unsigned, (x) != 0)); }
+
+#define setgcovalue(L,obj,x) \
+  { TValue *io = (obj); GCObject *i_g=(x); \
+    nbsetgc(io, nbgctag(i_g->tt), i_g); }
+
+#define setsvalue(L,obj,x) \
+  { TValue *io = (obj); TString *x_ = (x); \
+    nbsetgc(io, x_->tt == LUA_TSHRSTR ? NBT_SHRSTR : NBT_LNGSTR, x_); \
+    checkliveness(L,io); }
+
+#define setuvalue(L,obj,x) \
+  { TValue *io = (obj); Udata *x_ = (x); \
+    nbsetgc(io, NBT_UDATA, x_); checkliveness(L,io); }
+
+#define setthvalue(L,obj,x) \
+  { TValue *io = (obj); lua_State *x_ = (x); \
+    nbsetgc(io, NBT_THREAD, x_); checkliveness(L,io); }
+
+#define setclLvalue(L,obj,x) \
+  { TValue *io = (obj); LClosure *x_ = (x); \
+    nbsetgc(io, NBT_LCL, x_); checkliveness(L,io); }
+
+#define setclCvalue(L,obj,x) \
+  { TValue *io = (obj); CClosure *x_ = (x); \
+    nbsetgc(io, NBT_CCL, x_); checkliveness(L,io); }
+
+#define sethvalue(L,obj,x) \
+  { TValue *io = (obj); Table *x_ = (x); \
+    nbsetgc(io, NBT_TABLE, x_); checkliveness(L,io); }
+
+#define setdeadvalue(obj)	nbset(obj, NBT_DEADKEY, nbpayload(obj))
+
+#endif				/* } */
+
+
+#define l_isfalse(o)	(ttisnil(o) || (ttisboolean(o) && bvalue(o) == 0))
+
+
+/* Macros for internal tests */
+#define righttt(obj)		(ttype(obj) == gcvalue(obj)->tt)
+
+#define checkliveness(L,obj) \
+	lua_longassert(!iscollectable(obj) || \
+		(righttt(obj) && (L == NULL || !isdead(G(L),gcvalue(obj)))))
+
 
 
 #define setobj(L,obj1,obj2) \
@@ -368,6 +590,8 @@ typedef union UUdata {
 #define getudatamem(u)  \
   check_exp(sizeof((u)->ttuv_), (cast(char*, (u)) + sizeof(UUdata)))
 
+#if !defined(LUA_USE_NANBOX)
+
 #define setuservalue(L,u,o) \
 	{ const TValue *io=(o); Udata *iu = (u); \
 	  iu->user_ = io->value_; iu->ttuv_ = rttype(io); \
@@ -379,6 +603,20 @@ typedef union UUdata {
 	  io->value_ = iu->user_; settt_(io, iu->ttuv_); \
 	  checkliveness(L,io); }
 
+#else
+
+/* ('user_' keeps the whole boxed value; 'ttuv_' is not used) */
+#define setuservalue(L,u,o) \
+	{ const TValue *io=(o); Udata *iu = (u); \
+	  iu->user_ = io->value_; checkliveness(L,io); }
+
+
+#define getuservalue(L,u,o) \
+	{ TValue *io=(o); const Udata *iu = (u); \
+	  io->value_ = iu->user_; checkliveness(L,io); }
+
+#endif
+
 
 /*
 ** Description of an upvalue for function prototypes
@@ -412,6 +650,7 @@ typedef struct Proto {
   int sizeupvalues;  /* size of 'upvalues' */
   int sizek;  /* size of 'k' */
   int sizecode;
+  int sizeicache;
   int sizelineinfo;
   int sizep;  /* size of 'p' */
   int sizelocvars;
@@ -419,6 +658,7 @@ typedef struct Proto {
   int lastlinedefined;  /* debug information  */
   TValue *k;  /* constants used by the function */
   Instruction *code;  /* opcodes */
+  unsigned int *icache;  /* inline caches of field accesses (one per opcode) */
   struct Proto **p;  /* functions defined inside the function */
   int *lineinfo;  /* map from opcodes to source lines (debug information) */
   LocVar *locvars;  /* information about local variables (debug information) */
@@ -484,9 +724,15 @@ typedef union TKey {
 /* copy a value into a key without messing up field 'next' */
 #define setnodekey(L,key,obj) \
 	{ TKey *k_=(key); const TValue *io_=(obj); \
-	  k_->nk.value_ = io_->value_; k_->nk.tt_ = io_->tt_; \
+	  k_->nk.value_ = io_->value_; setnodekeytt_(k_, io_); \
 	  (void)L; checkliveness(L,io_); }
 
+#if !defined(LUA_USE_NANBOX)
+#define setnodekeytt_(k,io)	((k)->nk.tt_ = (io)->tt_)
+#else
+#define setnodekeytt_(k,io)	((void)0)  /* tag is part of the value */
+#endif
+
 
 typedef struct Node {
   TValue i_val;
@@ -494,14 +740,73 @@ typedef struct Node {
 } Node;
 
 
+#if defined(LUA_USE_SHAPES)
+
+/*
+** Shape of a table: the ordered list of its (short string) keys. Tables
+** with the same keys added in the same order share one shape and keep
+** only their values, in 'slots' ('slots[i]' is the value of 'keys[i]').
+*/
+typedef struct Shape {
+  struct Shape *parent;  /* shape without the last key */
+  struct Shape *hnext;  /* chain in the transition table */
+  TString *key;  /* last key (NULL in the empty shape) */
+  TString **keys;  /* all keys, by slot */
+  lu_byte *index;  /* hash from keys to slot + 1 (NULL for few keys) */
+  int nkeys;  /* number of keys */
+  int sizeindex;  /* size of 'index' */
+  int nchildren;  /* number of shapes extending this one */
+  int refcount;  /* number of tables using this shape */
+  unsigned int hash;  /* hash of (parent, key) in the transition table */
+} Shape;
+
+#endif
+
+
+#if defined(LUA_USE_NUMARRAY)
+
+/*
+** Element of a packed array part: all elements of one such array are
+** integers or all are floats (see 'arraykind' in ltable.h)
+*/
+typedef union PackedNum {
+  lua_Integer i;
+  lua_Number n;
+} PackedNum;
+
+#endif
+
+
 typedef struct Table {
   CommonHeader;
   lu_byte flags;  /* 1<<p means tagmethod(p) is not present */
   lu_byte lsizenode;  /* log2 of size of 'node' array */
   unsigned int sizearray;  /* size of 'array' array */
+  unsigned int lenhint;  /* last boundary found by 'luaH_getn' */
+  unsigned int nextpos;  /* 1 + node of the last key given by 'luaH_next' */
   TValue *array;  /* array part */
   Node *node;
   Node *lastfree;  /* any free position is before this position */
+#if defined(LUA_USE_SWISSTABLE)
+  unsigned int growthleft;  /* number of new keys the hash part can take */
+#endif
+#if defined(LUA_USE_INCREHASH)
+  struct Table *oldhash;  /* hash part being moved into 'node' (or NULL) */
+  unsigned int rehashpos;  /* number of old nodes still to be moved */
+  unsigned int rehashroom;  /* new keys 'node' can take while moving */
+#endif
+#if defined(LUA_USE_SHAPES)
+  Shape *shape;  /* shape of hash part (NULL if it uses 'node') */
+  TValue *slots;  /* values of the keys in 'shape' */
+  unsigned int sizeslots;  /* size of 'slots' array */
+#endif
+#if defined(LUA_USE_NUMARRAY)
+  lu_byte arraykind;  /* how the array part is kept */
+  unsigned int sizeused;  /* packed array: elements 1..sizeused are set */
+  unsigned int packidx;  /* index of the element copied in 'packslot' */
+  PackedNum *packed;  /* packed array part (instead of 'array') */
+  TValue packslot;  /* copy of a packed element, as returned by 'get's */
+#endif
   struct Table *metatable;
   GCObject *gclist;
 } Table;
@@ -527,6 +832,11 @@ typedef struct Table {
 
 LUAI_DDEC const TValue luaO_nilobject_;
 
+#if defined(LUA_USE_NANBOX)
+/* raw type tags ('rttype') of the NaN-box tags */
+LUAI_DDEC const lu_byte luaO_nbtypes[16];
+#endif
+
 /* size of buffer for 'luaO_utf8esc' function */
 #define UTF8BUFFSZ	8
 
@@ -536,7 +846,12 @@ LUAI_FUNC int luaO_utf8esc (char *buff, unsigned long x);
 LUAI_FUNC int luaO_ceillog2 (unsigned int x);
 LUAI_FUNC void luaO_arith (lua_State *L, int op, const TValue *p1,
                            const TValue *p2, TValue *res);
-LUAI_FUNC size_t luaO_str2num (const char *s, TValue *o);
+LUAI_FUNC size_t luaO_str2num (lua_State *L, const char *s, TValue *o);
+LUAI_FUNC size_t luaO_rawstr2num (const char *s, lua_Integer *i,
+                                  lua_Number *n, int *isint);
+#if defined(LUA_USE_NANBOX)
+LUAI_FUNC void luaO_boxint (lua_State *L, TValue *o, lua_Integer i);
+#endif
 LUAI_FUNC int luaO_hexavalue (int c);
 LUAI_FUNC void luaO_tostring (lua_State *L, StkId obj);
 LUAI_FUNC const char *luaO_pushvfstring (lua_State *L, const char *fmt,
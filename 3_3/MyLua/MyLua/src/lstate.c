@@ -148,6 +148,33 @@ void luaE_shrinkCI (lua_State *L) {
 }
 
 
+static int addmonopolized (global_State *g, GCObject *o) {
+  hash_set_insert(g->monopolize, o);
+  return (hash_set_count(g->monopolize, o) > 0);  /* (may be there already) */
+}
+
+
+/*
+** register a new object of the exporting chunk. libcstl leaves the set
+** unchanged when it cannot get memory; then the object is anchored in the
+** stack while an emergency collection frees memory, and the insertion is
+** tried once more before raising a memory error.
+*/
+void luaE_monopolize (lua_State *L, GCObject *o) {
+  global_State *g = G(L);
+  if (!addmonopolized(g, o)) {
+    if (g->version) {  /* is state fully built? */
+      setgcovalue(L, L->top, o);  /* anchor 'o' (there is 'EXTRA_STACK') */
+      L->top++;
+      luaC_fullgc(L, 1);
+      L->top--;
+    }
+    if (!addmonopolized(g, o))
+      luaD_throw(L, LUA_ERRMEM);
+  }
+}
+
+
 static void stack_init (lua_State *L1, lua_State *L) {
   int i; CallInfo *ci;
   /* initialize stack array */
@@ -204,6 +231,13 @@ static void f_luaopen (lua_State *L, void *ud) {
   global_State *g = G(L);
   UNUSED(ud);
   stack_init(L, L);  /* init stack */
+  g->monopolize = create_hash_set_with_allocator(&g->cstlalloc, void*);
+  if (g->monopolize == NULL)
+    luaD_throw(L, LUA_ERRMEM);
+  hash_set_init(g->monopolize);  /* (refused buckets are retried later) */
+#if defined(LUA_USE_SHAPES)
+  luaH_initshapes(L);  /* before creating any table */
+#endif
   init_registry(L, g);
   luaS_init(L);
   luaT_init(L);
@@ -241,9 +275,13 @@ static void preinit_thread (lua_State *L, global_State *g) {
 
 static void close_state (lua_State *L) {
   global_State *g = G(L);
-  hash_set_destroy(g->monopolize);
   luaF_close(L, L->stack);  /* close all upvalues for this thread */
   luaC_freeallobjects(L);  /* collect all objects */
+  if (g->monopolize != NULL)  /* (finalizers above may still register objects) */
+    hash_set_destroy(g->monopolize);
+#if defined(LUA_USE_SHAPES)
+  luaH_freeshapes(L);  /* (all tables are gone) */
+#endif
   if (g->version)  /* closing a fully built state? */
     luai_userstateclose(L);
   luaM_freearray(L, G(L)->strt.hash, G(L)->strt.size);
@@ -330,8 +368,14 @@ LUA_API lua_State *lua_newstate (lua_Alloc f, void *ud) {
   g->gcpause = LUAI_GCPAUSE;
   g->gcstepmul = LUAI_GCMUL;
   g->exporting = 0;
-  g->monopolize = create_hash_set(void*);
-  hash_set_init(g->monopolize); 
+#if defined(LUA_USE_SHAPES)
+  g->shaperoot = NULL;
+  g->shapetab = NULL;
+  g->sizeshapetab = g->nshapes = 0;
+#endif
+  g->cstlalloc._pfun_realloc = luaM_cstlrealloc;
+  g->cstlalloc._pv_userdata = g;
+  g->monopolize = NULL;
   for (i=0; i < LUA_NUMTAGS; i++) g->mt[i] = NULL;
   if (luaD_rawrunprotected(L, f_luaopen, NULL) != LUA_OK) {
     /* memory allocation error: free partial state */
@@ -171,6 +171,13 @@ typedef struct global_State {
   struct Table *mt[LUA_NUMTAGS];  /* metatables for basic types */
   TString *strcache[STRCACHE_N][STRCACHE_M];  /* cache for strings in API */
   lu_byte exporting;  /* true if exporting table */
+#if defined(LUA_USE_SHAPES)
+  struct Shape *shaperoot;  /* shape of tables without hash keys */
+  struct Shape **shapetab;  /* transitions between shapes */
+  int sizeshapetab;
+  int nshapes;  /* number of shapes in 'shapetab' */
+#endif
+  alloc_context_t cstlalloc;  /* allocator for libcstl vector/hash containers */
   hash_set_t* monopolize;  /* store gcobjects only use by export table */
 } global_State;
 
@@ -219,6 +226,9 @@ union GCUnion {
   struct Table h;
   struct Proto p;
   struct lua_State th;  /* thread */
+#if defined(LUA_USE_NANBOX)
+  struct IntBox ib;
+#endif
 };
 
 
@@ -235,6 +245,7 @@ union GCUnion {
 #define gco2t(o)  check_exp((o)->tt == LUA_TTABLE, &((cast_u(o))->h))
 #define gco2p(o)  check_exp((o)->tt == LUA_TPROTO, &((cast_u(o))->p))
 #define gco2th(o)  check_exp((o)->tt == LUA_TTHREAD, &((cast_u(o))->th))
+#define gco2ib(o)  check_exp((o)->tt == LUA_TNUMINT, &((cast_u(o))->ib))
 
 
 /* macro to convert a Lua object into a GCObject */
@@ -250,6 +261,7 @@ LUAI_FUNC void luaE_freethread (lua_State *L, lua_State *L1);
 LUAI_FUNC CallInfo *luaE_extendCI (lua_State *L);
 LUAI_FUNC void luaE_freeCI (lua_State *L);
 LUAI_FUNC void luaE_shrinkCI (lua_State *L);
+LUAI_FUNC void luaE_monopolize (lua_State *L, GCObject *o);
 
 
 #endif
@@ -149,7 +149,7 @@ TString *luaS_createlngstrobj (lua_State *L, size_t l) {
   TString *ts = createstrobj(L, l, LUA_TLNGSTR, G(L)->seed);
   ts->u.lnglen = l;
   if (g->exporting == 1)
-    hash_set_insert(g->monopolize, ts);
+    luaE_monopolize(L, obj2gco(ts));
   return ts;
 }
 
@@ -187,13 +187,13 @@ static TString *internshrstr (lua_State *L, const char *str, size_t l) {
     list = &g->strt.hash[lmod(h, g->strt.size)];  /* recompute with new size */
   }
   ts = createstrobj(L, l, LUA_TSHRSTR, h);
-  if (g->exporting == 1)
-    hash_set_insert(g->monopolize, ts);
   memcpy(getstr(ts), str, l * sizeof(char));
   ts->shrlen = cast_byte(l);
   ts->u.hnext = *list;
   *list = ts;
   g->strt.nuse++;
+  if (g->exporting == 1)  /* (string is complete, a collection may run) */
+    luaE_monopolize(L, obj2gco(ts));
   return ts;
 }
 
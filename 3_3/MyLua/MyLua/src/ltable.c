@@ -16,7 +16,8 @@
 ** Non-negative integer keys are all candidates to be kept in the array
 ** part. The actual size of the array is the largest 'n' such that
 ** more than half the slots between 1 and n are in use.
-** Hash uses a mix of chained scatter table with Brent's variation.
+** Hash uses a mix of chained scatter table with Brent's variation
+** (or, with LUA_USE_SWISSTABLE, open addressing; see "Swiss tables").
 ** A main invariant of these tables is that, if an element is not
 ** in its main position (i.e. the 'original' position that its hash gives
 ** to it), then the colliding element is in its own main position.
@@ -25,6 +26,7 @@
 
 #include <math.h>
 #include <limits.h>
+#include <string.h>
 
 #include "lua.h"
 
@@ -38,6 +40,10 @@
 #include "ltable.h"
 #include "lvm.h"
 
+#if defined(LUA_USE_SWISSTABLE) && defined(LUAI_GROUPSSE2)
+#include <emmintrin.h>
+#endif
+
 
 /*
 ** Maximum size of array part (MAXASIZE) is 2^MAXABITS. MAXABITS is
@@ -72,6 +78,22 @@
 #define hashpointer(t,p)	hashmod(t, point2uint(p))
 
 
+#if defined(LUA_USE_SWISSTABLE)
+
+#define dummynode		(&dummynode_.node)
+
+/* the dummy node is followed by a group of empty control bytes */
+static const struct {
+  Node node;
+  lu_byte ctrl[GROUPWIDTH];
+} dummynode_ = {
+  {{NILCONSTANT},  /* value */
+   {{NILCONSTANT, 0}}},  /* key */
+  {0}  /* control bytes */
+};
+
+#else
+
 #define dummynode		(&dummynode_)
 
 static const Node dummynode_ = {
@@ -79,6 +101,61 @@ static const Node dummynode_ = {
   {{NILCONSTANT, 0}}  /* key */
 };
 
+#endif
+
+
+/* whether element 'i' (0-based) of the array part of 't' is not nil */
+#if defined(LUA_USE_NUMARRAY)
+#define arrayhas(t,i)  \
+	(ispacked(t) ? (i) < (t)->sizeused : !ttisnil(&(t)->array[i]))
+#else
+#define arrayhas(t,i)	(!ttisnil(&(t)->array[i]))
+#endif
+
+
+/*
+** result of a lookup that missed the hash part of 't': while 't' is
+** being rehashed, the key may still be in its old hash part, which is
+** searched with 'get' (see "Incremental rehash")
+*/
+#if defined(LUA_USE_INCREHASH)
+#define missed(t,get)	((t)->oldhash == NULL ? luaO_nilobject : (get))
+#else
+#define missed(t,get)	luaO_nilobject
+#endif
+
+
+#if defined(LUA_USE_SHAPES)
+
+/* shapes with more keys than this get a hash index */
+#define SHAPELINEAR	8
+
+/*
+** returns the slot of 'key' in shape 's', or -1 if 's' has no such key
+*/
+static int shapeindex (const Shape *s, const TString *key) {
+  if (s->index == NULL) {  /* few keys: linear search */
+    int i;
+    for (i = 0; i < s->nkeys; i++) {
+      if (s->keys[i] == key)
+        return i;
+    }
+  }
+  else {
+    unsigned int mask = cast(unsigned int, s->sizeindex - 1);
+    unsigned int h = key->hash & mask;
+    while (s->index[h] != 0) {
+      int i = s->index[h] - 1;
+      if (s->keys[i] == key)
+        return i;
+      h = (h + 1) & mask;
+    }
+  }
+  return -1;  /* not found */
+}
+
+#endif
+
 
 /*
 ** Hash for floating-point numbers.
@@ -110,6 +187,210 @@ static int l_hashfloat (lua_Number n) {
 #endif
 
 
+#if defined(LUA_USE_SWISSTABLE)
+
+/*
+** {=============================================================
+** Swiss tables
+** The hash part uses open addressing. Each node has a control byte,
+** kept in 'gctrl(t)': 0 for an empty node, or the high bit set plus
+** seven bits of the hash of its key. A search first checks the node at
+** the position given by the hash, where most keys are; then, from that
+** position, it matches the control bytes of a whole group of GROUPWIDTH
+** nodes at once against the byte of the key, comparing keys only for
+** the nodes that match, until it finds a group with an empty node.
+** Groups are probed in triangular steps; the first GROUPWIDTH
+** control bytes are repeated after the last one, so that groups can
+** wrap around. Keys are never removed from a hash part (their values
+** become nil, as in the chained version), so there are no deleted
+** nodes to skip, and 'growthleft' counts the empty nodes that can
+** still be used before a rehash.
+** ==============================================================
+*/
+
+#define CTRL_EMPTY	0
+
+/*
+** control byte of a key with hash 'h': the position of the key comes
+** from the low bits of 'h', so this one takes (the top seven bits of) a
+** Fibonacci hash of all of them
+*/
+#define ctrlbyte(h) \
+	cast_byte(0x80 | ((cast(unsigned int, h) * 0x9e3779b1u) >> 25))
+
+/* first position probed for hash 'h' (small hash parts are one group) */
+#define firstpos(t,h) \
+	(sizenode(t) <= GROUPWIDTH ? 0 : (h) & (sizenode(t) - 1))
+
+
+#if defined(__GNUC__)
+#define lowestbit(m)	__builtin_ctz(m)
+#else
+static int lowestbit (unsigned int m) {
+  int i = 0;
+  while (!(m & 1)) { m >>= 1; i++; }
+  return i;
+}
+#endif
+
+
+#if defined(LUAI_GROUPSSE2)
+
+/* a group is matched with SSE2; each node gives one bit of a match */
+typedef __m128i Group;
+
+#define loadgroup(p)	_mm_loadu_si128(cast(const __m128i *, (p)))
+#define matchbyte(g,c) cast(unsigned int, \
+	_mm_movemask_epi8(_mm_cmpeq_epi8(g, _mm_set1_epi8(cast(char, c)))))
+#define matchempty(g) cast(unsigned int, \
+	_mm_movemask_epi8(_mm_cmpeq_epi8(g, _mm_setzero_si128())))
+#define slotof(m)	lowestbit(m)
+
+#else
+
+/*
+** a group is matched inside an 'unsigned int'; each node gives the high
+** bit of its byte. ('matchbyte' may give false positives, which just
+** cost a key comparison.)
+*/
+typedef unsigned int Group;
+
+#define LSBS	0x01010101u
+#define MSBS	0x80808080u
+
+#define loadgroup(p) \
+	(cast(Group, (p)[0]) | (cast(Group, (p)[1]) << 8) | \
+	 (cast(Group, (p)[2]) << 16) | (cast(Group, (p)[3]) << 24))
+
+static unsigned int matchbyte (Group g, lu_byte c) {
+  Group x = g ^ (LSBS * c);
+  return (x - LSBS) & ~x & MSBS;
+}
+
+#define matchempty(g)	(((g) - LSBS) & ~(g) & MSBS)
+#define slotof(m)	(lowestbit(m) >> 3)
+
+#endif
+
+
+/*
+** Probe loop of the hash part: for each node 'n' of 't' whose control
+** byte matches hash 'h', runs 'found' (which returns if 'n' has the
+** key searched); stops at the first group with an empty node.
+*/
+#define probe(t,h,n,found) { \
+  unsigned int mask_ = sizenode(t) - 1; \
+  unsigned int pos_ = firstpos(t, h); \
+  unsigned int step_ = 0; \
+  lu_byte c_ = ctrlbyte(h); \
+  n = gnode(t, pos_);  /* first try the node where the key usually is */ \
+  found; \
+  for (;;) { \
+    Group g_ = loadgroup(gctrl(t) + pos_); \
+    unsigned int m_; \
+    for (m_ = matchbyte(g_, c_); m_ != 0; m_ &= m_ - 1) { \
+      n = gnode(t, (pos_ + slotof(m_)) & mask_); \
+      found; \
+    } \
+    if (matchempty(g_) != 0 || mask_ < GROUPWIDTH) break; \
+    step_ += GROUPWIDTH; \
+    pos_ = (pos_ + step_) & mask_; \
+  } }
+
+
+/*
+** mixes the bits of a hash whose low bits are poor (finalizer of
+** MurmurHash3); as with 'hashmod', floats and pointers need it
+*/
+static unsigned int mixhash (unsigned int h) {
+  h ^= h >> 16;
+  h *= 0x85ebca6bu;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35u;
+  h ^= h >> 16;
+  return h;
+}
+
+
+/* (like 'hashint', consecutive integers go to consecutive positions) */
+#define hashinteger(i)	cast(unsigned int, l_castS2U(i))
+
+
+/* returns the hash of a key, as used by the probe sequences */
+static unsigned int hashkey (const TValue *key) {
+  switch (ttype(key)) {
+    case LUA_TNUMINT:
+      return hashinteger(ivalue(key));
+    case LUA_TNUMFLT:
+      return mixhash(cast(unsigned int, l_hashfloat(fltvalue(key))));
+    case LUA_TSHRSTR:
+      return tsvalue(key)->hash;
+    case LUA_TLNGSTR:
+      return luaS_hashlongstr(tsvalue(key));
+    case LUA_TBOOLEAN:
+      return cast(unsigned int, bvalue(key));
+    case LUA_TLIGHTUSERDATA:
+      return mixhash(point2uint(pvalue(key)));
+    case LUA_TLCF:
+      return mixhash(point2uint(fvalue(key)));
+    default:
+      lua_assert(!ttisdeadkey(key));
+      return mixhash(point2uint(gcvalue(key)));
+  }
+}
+
+
+static void setctrl (Table *t, unsigned int i, lu_byte c) {
+  lu_byte *ctrl = gctrl(t);
+  ctrl[i] = c;
+  if (i < GROUPWIDTH && sizenode(t) > GROUPWIDTH)
+    ctrl[sizenode(t) + i] = c;  /* copy seen by groups that wrap around */
+}
+
+
+/*
+** returns the first empty node in the probe sequence of hash 'h' (there
+** must be one)
+*/
+static unsigned int emptynode (const Table *t, unsigned int h) {
+  unsigned int mask = sizenode(t) - 1;
+  unsigned int pos = firstpos(t, h);
+  unsigned int step = 0;
+  for (;;) {
+    unsigned int m = matchempty(loadgroup(gctrl(t) + pos));
+    if (m != 0)
+      return (pos + slotof(m)) & mask;
+    step += GROUPWIDTH;
+    pos = (pos + step) & mask;
+  }
+}
+
+
+/*
+** a full hash part may still reuse a node whose value was removed (as
+** the chained version reuses a free main position); looks for one in
+** the first group probed for hash 'h'
+*/
+static Node *freednode (Table *t, unsigned int h) {
+  unsigned int mask = sizenode(t) - 1;
+  unsigned int pos = firstpos(t, h);
+  unsigned int i;
+  if (isdummy(t))
+    return NULL;
+  for (i = 0; i < GROUPWIDTH && i <= mask; i++) {
+    unsigned int j = (pos + i) & mask;
+    if (gctrl(t)[j] != CTRL_EMPTY && ttisnil(gval(gnode(t, j)))) {
+      setctrl(t, j, ctrlbyte(h));
+      return gnode(t, j);
+    }
+  }
+  return NULL;
+}
+
+/* }============================================================= */
+
+#else
+
 /*
 ** returns the 'main' position of an element in a table (that is, the index
 ** of its hash value)
@@ -136,6 +417,8 @@ static Node *mainposition (const Table *t, const TValue *key) {
   }
 }
 
+#endif
+
 
 /*
 ** returns the index for 'key' if 'key' is an appropriate key to live in
@@ -151,10 +434,22 @@ static unsigned int arrayindex (const TValue *key) {
 }
 
 
+/*
+** whether node 'n' holds 'key' (which may be dead already, but it is ok
+** to use it in 'next')
+*/
+#define isnodekey(n,key) \
+	(luaV_rawequalobj(gkey(n), key) || \
+	 (ttisdeadkey(gkey(n)) && iscollectable(key) && \
+	  deadvalue(gkey(n)) == gcvalue(key)))
+
+
 /*
 ** returns the index of a 'key' for table traversals. First goes all
 ** elements in the array part, then elements in the hash part. The
-** beginning of a traversal is signaled by 0.
+** beginning of a traversal is signaled by 0. A traversal usually asks
+** for the key it got in its last step, so the node of that key (kept in
+** 'nextpos') is checked before searching the hash part.
 */
 static unsigned int findindex (lua_State *L, Table *t, StkId key) {
   unsigned int i;
@@ -162,23 +457,50 @@ static unsigned int findindex (lua_State *L, Table *t, StkId key) {
   i = arrayindex(key);
   if (i != 0 && i <= t->sizearray)  /* is 'key' inside array part? */
     return i;  /* yes; that's the index */
+#if defined(LUA_USE_SHAPES)
+  else if (t->shape != NULL && ttisshrstring(key) &&
+           (i = cast(unsigned int, shapeindex(t->shape, tsvalue(key)) + 1)) != 0)
+    /* slots are numbered after hash elements */
+    return i + t->sizearray + sizenode(t);
+#endif
+  else if ((i = t->nextpos - 1) < cast(unsigned int, sizenode(t)) &&
+           isnodekey(gnode(t, i), key))
+    /* hash elements are numbered after array ones */
+    return (i + 1) + t->sizearray;
   else {
+#if defined(LUA_USE_SWISSTABLE)
+    Node *n;
+    unsigned int h = hashkey(key);
+    probe(t, h, n,
+      if (luaV_rawequalobj(gkey(n), key))
+        /* hash elements are numbered after array ones */
+        return cast_int(n - gnode(t, 0)) + 1 + t->sizearray);
+    /* key may be dead already, but it is ok to use it in 'next'; the live
+       node goes first, as a key inserted again does not reuse its dead one */
+    if (iscollectable(key))
+      probe(t, h, n,
+        if (ttisdeadkey(gkey(n)) && deadvalue(gkey(n)) == gcvalue(key))
+          return cast_int(n - gnode(t, 0)) + 1 + t->sizearray);
+#else
     int nx;
     Node *n = mainposition(t, key);
     for (;;) {  /* check whether 'key' is somewhere in the chain */
-      /* key may be dead already, but it is ok to use it in 'next' */
-      if (luaV_rawequalobj(gkey(n), key) ||
-            (ttisdeadkey(gkey(n)) && iscollectable(key) &&
-             deadvalue(gkey(n)) == gcvalue(key))) {
+      if (isnodekey(n, key)) {
         i = cast_int(n - gnode(t, 0));  /* key index in hash table */
         /* hash elements are numbered after array ones */
         return (i + 1) + t->sizearray;
       }
       nx = gnext(n);
-      if (nx == 0)
-        luaG_runerror(L, "invalid key to 'next'");  /* key not found */
-      else n += nx;
+      if (nx == 0) break;
+      n += nx;
     }
+#endif
+#if defined(LUA_USE_INCREHASH)
+    if (t->oldhash != NULL)  /* old nodes are numbered after new ones */
+      return findindex(L, t->oldhash, key) + sizenode(t) + t->sizearray;
+#endif
+    luaG_runerror(L, "invalid key to 'next'");  /* key not found */
+    return 0;
   }
 }
 
@@ -186,8 +508,14 @@ static unsigned int findindex (lua_State *L, Table *t, StkId key) {
 int luaH_next (lua_State *L, Table *t, StkId key) {
   unsigned int i = findindex(L, t, key);  /* find original element */
   for (; i < t->sizearray; i++) {  /* try first array part */
-    if (!ttisnil(&t->array[i])) {  /* a non-nil value? */
-      setivalue(key, i + 1);
+    if (arrayhas(t, i)) {  /* a non-nil value? */
+      setivalue(L, key, i + 1);
+#if defined(LUA_USE_NUMARRAY)
+      if (ispacked(t)) {
+        getpacked(L, t, i, key+1);
+      }
+      else
+#endif
       setobj2s(L, key+1, &t->array[i]);
       return 1;
     }
@@ -196,9 +524,33 @@ int luaH_next (lua_State *L, Table *t, StkId key) {
     if (!ttisnil(gval(gnode(t, i)))) {  /* a non-nil value? */
       setobj2s(L, key, gkey(gnode(t, i)));
       setobj2s(L, key+1, gval(gnode(t, i)));
+      t->nextpos = i + 1;  /* where the next step will start */
       return 1;
     }
   }
+#if defined(LUA_USE_INCREHASH)
+  if (t->oldhash != NULL) {  /* then the old hash part */
+    Table *old = t->oldhash;
+    for (i -= sizenode(t); cast_int(i) < sizenode(old); i++) {
+      if (!ttisnil(gval(gnode(old, i)))) {  /* a non-nil value? */
+        setobj2s(L, key, gkey(gnode(old, i)));
+        setobj2s(L, key+1, gval(gnode(old, i)));
+        return 1;
+      }
+    }
+  }
+#endif
+#if defined(LUA_USE_SHAPES)
+  if (t->shape != NULL) {  /* then the slots */
+    for (i -= sizenode(t); cast_int(i) < t->shape->nkeys; i++) {
+      if (!ttisnil(&t->slots[i])) {  /* a non-nil value? */
+        setsvalue2s(L, key, t->shape->keys[i]);
+        setobj2s(L, key+1, &t->slots[i]);
+        return 1;
+      }
+    }
+  }
+#endif
   return 0;  /* no more elements */
 }
 
@@ -272,7 +624,7 @@ static unsigned int numusearray (const Table *t, unsigned int *nums) {
     }
     /* count elements in range (2^(lg - 1), 2^lg] */
     for (; i <= lim; i++) {
-      if (!ttisnil(&t->array[i-1]))
+      if (arrayhas(t, i - 1))
         lc++;
     }
     nums[lg] += lc;
@@ -300,6 +652,14 @@ static int numusehash (const Table *t, unsigned int *nums, unsigned int *pna) {
 
 static void setarrayvector (lua_State *L, Table *t, unsigned int size) {
   unsigned int i;
+#if defined(LUA_USE_NUMARRAY)
+  if (ispacked(t)) {  /* (slots after 'sizeused' are nil anyway) */
+    lua_assert(size >= t->sizeused);
+    luaM_reallocvector(L, t->packed, t->sizearray, size, PackedNum);
+    t->sizearray = size;
+    return;
+  }
+#endif
   luaM_reallocvector(L, t->array, t->sizearray, size, TValue);
   for (i=t->sizearray; i<size; i++)
      setnilvalue(&t->array[i]);
@@ -312,14 +672,27 @@ static void setnodevector (lua_State *L, Table *t, unsigned int size) {
     t->node = cast(Node *, dummynode);  /* use common 'dummynode' */
     t->lsizenode = 0;
     t->lastfree = NULL;  /* signal that it is using dummy node */
+#if defined(LUA_USE_SWISSTABLE)
+    t->growthleft = 0;
+#endif
   }
   else {
     int i;
     int lsize = luaO_ceillog2(size);
+#if defined(LUA_USE_SWISSTABLE)
+    if (lsize <= MAXHBITS && maxkeys(twoto(lsize)) < cast_int(size))
+      lsize++;  /* keep room for the empty nodes */
+#endif
     if (lsize > MAXHBITS)
       luaG_runerror(L, "table overflow");
     size = twoto(lsize);
+#if defined(LUA_USE_SWISSTABLE)
+    if (sizeof(Node) + 1 > (MAX_SIZET - GROUPWIDTH) / size)
+      luaM_toobig(L);
+    t->node = cast(Node *, luaM_malloc(L, sizenodevector(size)));
+#else
     t->node = luaM_newvector(L, size, Node);
+#endif
     for (i = 0; i < (int)size; i++) {
       Node *n = gnode(t, i);
       gnext(n) = 0;
@@ -328,6 +701,10 @@ static void setnodevector (lua_State *L, Table *t, unsigned int size) {
     }
     t->lsizenode = cast_byte(lsize);
     t->lastfree = gnode(t, size);  /* all positions are free */
+#if defined(LUA_USE_SWISSTABLE)
+    memset(gctrl(t), CTRL_EMPTY, size + GROUPWIDTH);
+    t->growthleft = maxkeys(size);
+#endif
   }
 }
 
@@ -344,14 +721,69 @@ static void auxsetnode (lua_State *L, void *ud) {
 }
 
 
+#if defined(LUA_USE_SHAPES)
+static void unshape (lua_State *L, Table *t, unsigned int extra);
+#endif
+
+#if defined(LUA_USE_NUMARRAY)
+static void unpackarray (lua_State *L, Table *t);
+static void packarray (lua_State *L, Table *t);
+#endif
+
+#if defined(LUA_USE_INCREHASH)
+static void startrehash (lua_State *L, Table *t, unsigned int nhsize);
+#endif
+
+
+/*
+** returns the slot for 'key' in 't', creating it if needed; unlike
+** 'luaH_set', it may be the copy of a packed element (see 'luaH_setslot')
+*/
+static TValue *getslot (lua_State *L, Table *t, const TValue *key) {
+  const TValue *p = luaH_get(t, key);
+  if (p != luaO_nilobject)
+    return cast(TValue *, p);
+  else return luaH_newkey(L, t, key);
+}
+
+
 void luaH_resize (lua_State *L, Table *t, unsigned int nasize,
                                           unsigned int nhsize) {
   unsigned int i;
   int j;
   AuxsetnodeT asn;
-  unsigned int oldasize = t->sizearray;
-  int oldhsize = allocsizenode(t);
-  Node *nold = t->node;  /* save old hash ... */
+  unsigned int oldasize;
+  int oldhsize;
+  Node *nold;
+#if defined(LUA_USE_INCREHASH)
+  luaH_finishrehash(L, t);  /* all entries must be in 'node' */
+#endif
+#if defined(LUA_USE_SHAPES)
+  if (t->shape != NULL) {
+    if (nasize >= t->sizearray && nhsize <= LUAI_MAXSHAPEKEYS) {
+      /* keep the shape; 'nhsize' is the number of slots to reserve */
+      if (nasize > t->sizearray)
+        setarrayvector(L, t, nasize);
+      if (nhsize > t->sizeslots) {
+        luaM_reallocvector(L, t->slots, t->sizeslots, nhsize, TValue);
+        t->sizeslots = nhsize;
+      }
+      return;
+    }
+    unshape(L, t, 0);  /* go back to a hash part and resize it */
+  }
+#endif
+  oldasize = t->sizearray;
+#if defined(LUA_USE_NUMARRAY)
+  if (ispacked(t)) {
+    if (nasize < t->sizeused)  /* some elements must go to the hash part? */
+      unpackarray(L, t);
+    else if (nasize < oldasize)  /* only nils go away */
+      setarrayvector(L, t, nasize);
+  }
+#endif
+  oldhsize = allocsizenode(t);
+  nold = t->node;  /* save old hash ... */
   if (nasize > oldasize)  /* array part must grow? */
     setarrayvector(L, t, nasize);
   /* create new hash part with appropriate size */
@@ -360,7 +792,7 @@ void luaH_resize (lua_State *L, Table *t, unsigned int nasize,
     setarrayvector(L, t, oldasize);  /* array back to its original size */
     luaD_throw(L, LUA_ERRMEM);  /* rethrow memory error */
   }
-  if (nasize < oldasize) {  /* array part must shrink? */
+  if (nasize < t->sizearray) {  /* array part must shrink? */
     t->sizearray = nasize;
     /* re-insert elements from vanishing slice */
     for (i=nasize; i<oldasize; i++) {
@@ -376,16 +808,21 @@ void luaH_resize (lua_State *L, Table *t, unsigned int nasize,
     if (!ttisnil(gval(old))) {
       /* doesn't need barrier/invalidate cache, as entry was
          already present in the table */
-      setobjt2t(L, luaH_set(L, t, gkey(old)), gval(old));
+      TValue *slot = getslot(L, t, gkey(old));
+      luaH_setslot(L, t, slot, gval(old));
     }
   }
   if (oldhsize > 0)  /* not the dummy node? */
-    luaM_freearray(L, nold, cast(size_t, oldhsize)); /* free old hash */
+    luaM_freemem(L, nold, sizenodevector(oldhsize)); /* free old hash */
+#if defined(LUA_USE_NUMARRAY)
+  if (!ispacked(t))
+    packarray(L, t);  /* elements may fit a packed array now */
+#endif
 }
 
 
 void luaH_resizearray (lua_State *L, Table *t, unsigned int nasize) {
-  int nsize = allocsizenode(t);
+  int nsize = allockeys(t);
   luaH_resize(L, t, nasize, nsize);
 }
 
@@ -398,6 +835,9 @@ static void rehash (lua_State *L, Table *t, const TValue *ek) {
   unsigned int nums[MAXABITS + 1];
   int i;
   int totaluse;
+#if defined(LUA_USE_INCREHASH)
+  lua_assert(t->oldhash == NULL);  /* (its room was enough) */
+#endif
   for (i = 0; i <= MAXABITS; i++) nums[i] = 0;  /* reset counts */
   na = numusearray(t, nums);  /* count keys in array part */
   totaluse = na;  /* all those keys are integer keys */
@@ -407,6 +847,12 @@ static void rehash (lua_State *L, Table *t, const TValue *ek) {
   totaluse++;
   /* compute new size for array part */
   asize = computesizes(nums, &na);
+#if defined(LUA_USE_INCREHASH)
+  if (asize == t->sizearray && allocsizenode(t) >= LUAI_REHASHMIN) {
+    startrehash(L, t, totaluse - na);  /* only the hash part changes */
+    return;
+  }
+#endif
   /* resize the table to new computed sizes */
   luaH_resize(L, t, asize, totaluse - na);
 }
@@ -418,6 +864,455 @@ static void rehash (lua_State *L, Table *t, const TValue *ek) {
 */
 
 
+#if defined(LUA_USE_INCREHASH)
+
+/*
+** {=============================================================
+** Incremental rehash
+** When a big hash part must be resized and the array part stays as it
+** is, the old nodes go to 'oldhash' (a bare table used only as a holder
+** for them, not a collectable object) and each new key moves a few of
+** them into the new hash part, from the last node down. 'rehashpos' is
+** the number of old nodes not moved yet and 'rehashroom' the number of
+** new keys the new hash part can still take; every step moves at least
+** 'rehashpos/rehashroom' nodes, so that the old part is empty before
+** the new one runs out of room. Lookups search the new part first and
+** then the old one; moved nodes lose their keys, so that no store can
+** land behind the cursor. A table that stops growing keeps its old part
+** until it gets another key or is resized.
+** ==============================================================
+*/
+
+
+static TValue *insertkey (lua_State *L, Table *t, const TValue *key);
+
+
+static void freeoldhash (lua_State *L, Table *t) {
+  Table *old = t->oldhash;
+  t->oldhash = NULL;
+  if (!isdummy(old))
+    luaM_freemem(L, old->node, sizenodevector(sizenode(old)));
+  luaM_free(L, old);
+}
+
+
+/*
+** moves the entries of old nodes 'lim' up to 'rehashpos - 1' into the
+** hash part of 't'
+*/
+static void moveold (lua_State *L, Table *t, unsigned int lim) {
+  Table *old = t->oldhash;
+  while (t->rehashpos > lim) {
+    Node *n = gnode(old, --t->rehashpos);
+    if (!ttisnil(gval(n))) {
+      TValue *slot = insertkey(L, t, gkey(n));
+      setobj2t(L, slot, gval(n));
+      setnilvalue(gval(n));
+    }
+    setnilvalue(wgkey(n));  /* lookups cannot find it anymore */
+  }
+}
+
+
+/*
+** starts moving the hash part of 't' into a new one for 'nhsize' keys
+** (counting the key being inserted)
+*/
+static void startrehash (lua_State *L, Table *t, unsigned int nhsize) {
+  AuxsetnodeT asn;
+  Table *old = luaM_new(L, Table);
+  *old = *t;  /* take the hash part ... */
+  old->sizearray = 0;  /* ... but no array part */
+  old->oldhash = NULL;
+  asn.t = t; asn.nhsize = nhsize;
+  if (luaD_rawrunprotected(L, auxsetnode, &asn) != LUA_OK) {  /* mem. error? */
+    luaM_free(L, old);  /* 't' still has its hash part */
+    luaD_throw(L, LUA_ERRMEM);  /* rethrow memory error */
+  }
+  t->oldhash = old;
+  t->rehashpos = sizenode(old);
+  t->rehashroom = allockeys(t) - (nhsize - 1);
+}
+
+
+/*
+** moves old nodes before a new key goes into 't'
+*/
+static void rehashstep (lua_State *L, Table *t) {
+  unsigned int n = (t->rehashpos + t->rehashroom - 1) / t->rehashroom;
+  if (n < LUAI_REHASHSTEP)
+    n = LUAI_REHASHSTEP;
+  lua_assert(t->rehashroom > 0);
+  t->rehashroom--;  /* for the new key */
+  moveold(L, t, (n < t->rehashpos) ? t->rehashpos - n : 0);
+  if (t->rehashpos == 0)
+    freeoldhash(L, t);
+}
+
+
+/*
+** moves all entries still in the old hash part of 't' (if any)
+*/
+void luaH_finishrehash (lua_State *L, Table *t) {
+  if (t->oldhash != NULL) {
+    moveold(L, t, 0);
+    freeoldhash(L, t);
+  }
+}
+
+/* }============================================================= */
+
+#endif
+
+
+#if defined(LUA_USE_SHAPES)
+
+/*
+** {=============================================================
+** Shapes
+** A new table starts with the empty shape. While all keys of its hash
+** part are short strings (and they are not too many), a new key moves
+** the table to the shape that extends its current one with that key
+** (a "transition") and its value goes to the next slot. Tables built
+** with the same keys in the same order share their shape, so they keep
+** no keys, hashes or chains of their own. Transitions are kept in
+** 'g->shapetab', hashed by (parent, key). A shape lives while some
+** table or child shape uses it; the collector keeps its keys alive
+** meanwhile (see 'markshapes' in lgc.c). Any other key, or passing the
+** limits in llimits.h, sends the table back to a regular hash part.
+** ==============================================================
+*/
+
+#define MINSHAPETAB	64
+
+#define shapehash(parent,key) \
+  ((key)->hash ^ cast(unsigned int, point2uint(parent)))
+
+/* size of the block holding a shape, its keys and its index */
+#define sizeshape(n,ni) \
+  (sizeof(Shape) + cast(size_t, n) * sizeof(TString *) + cast(size_t, ni))
+
+
+static Shape *newshape (lua_State *L, Shape *parent, TString *key) {
+  int n = (parent == NULL) ? 0 : parent->nkeys + 1;
+  int ni = (n > SHAPELINEAR) ? twoto(luaO_ceillog2(cast(unsigned int, 2 * n)))
+                             : 0;
+  Shape *s = cast(Shape *, luaM_malloc(L, sizeshape(n, ni)));
+  int i;
+  s->parent = parent;
+  s->hnext = NULL;
+  s->key = key;
+  s->keys = cast(TString **, s + 1);
+  s->index = (ni > 0) ? cast(lu_byte *, s->keys + n) : NULL;
+  s->nkeys = n;
+  s->sizeindex = ni;
+  s->nchildren = 0;
+  s->refcount = 0;
+  s->hash = (parent == NULL) ? 0 : shapehash(parent, key);
+  for (i = 0; i < n - 1; i++)
+    s->keys[i] = parent->keys[i];
+  if (n > 0)
+    s->keys[n - 1] = key;
+  if (ni > 0) {  /* build hash index (linear probing) */
+    memset(s->index, 0, cast(size_t, ni));
+    for (i = 0; i < n; i++) {
+      unsigned int h = s->keys[i]->hash & (ni - 1);
+      while (s->index[h] != 0)
+        h = (h + 1) & (ni - 1);
+      s->index[h] = cast_byte(i + 1);
+    }
+  }
+  return s;
+}
+
+
+static void freeshape (lua_State *L, Shape *s) {
+  luaM_freemem(L, s, sizeshape(s->nkeys, s->sizeindex));
+}
+
+
+static void resizeshapetab (lua_State *L, int newsize) {
+  global_State *g = G(L);
+  Shape **ntab = luaM_newvector(L, newsize, Shape *);
+  int i;
+  for (i = 0; i < newsize; i++)
+    ntab[i] = NULL;
+  for (i = 0; i < g->sizeshapetab; i++) {  /* rehash */
+    Shape *s = g->shapetab[i];
+    while (s != NULL) {
+      Shape *hnext = s->hnext;
+      Shape **list = &ntab[lmod(s->hash, newsize)];
+      s->hnext = *list;
+      *list = s;
+      s = hnext;
+    }
+  }
+  luaM_freearray(L, g->shapetab, g->sizeshapetab);
+  g->shapetab = ntab;
+  g->sizeshapetab = newsize;
+}
+
+
+/*
+** returns the shape extending 's' with 'key', creating it if needed;
+** NULL if that would pass the limits for shapes
+*/
+static Shape *transition (lua_State *L, Shape *s, TString *key) {
+  global_State *g = G(L);
+  unsigned int h = shapehash(s, key);
+  Shape *ns;
+  Shape **list;
+  for (ns = g->shapetab[lmod(h, g->sizeshapetab)]; ns != NULL; ns = ns->hnext) {
+    if (ns->parent == s && ns->key == key)
+      return ns;
+  }
+  if (s->nkeys >= LUAI_MAXSHAPEKEYS || g->nshapes >= LUAI_MAXSHAPES)
+    return NULL;
+  if (g->nshapes >= g->sizeshapetab)
+    resizeshapetab(L, g->sizeshapetab * 2);
+  ns = newshape(L, s, key);
+  list = &g->shapetab[lmod(h, g->sizeshapetab)];
+  ns->hnext = *list;
+  *list = ns;
+  g->nshapes++;
+  s->nchildren++;
+  return ns;
+}
+
+
+/*
+** a table stopped using 's': free it and the ancestors that are no
+** longer used. (Does not touch the keys, which may be dead already
+** when the state is closing.)
+*/
+static void releaseshape (lua_State *L, Shape *s) {
+  global_State *g = G(L);
+  s->refcount--;
+  while (s->refcount == 0 && s->nchildren == 0 && s->parent != NULL) {
+    Shape *parent = s->parent;
+    Shape **list = &g->shapetab[lmod(s->hash, g->sizeshapetab)];
+    while (*list != s)
+      list = &(*list)->hnext;
+    *list = s->hnext;  /* remove it from the transitions */
+    g->nshapes--;
+    parent->nchildren--;
+    freeshape(L, s);
+    s = parent;
+  }
+}
+
+
+/*
+** moves the entries of shaped table 't' to a regular hash part with
+** room for 'extra' more keys
+*/
+static void unshape (lua_State *L, Table *t, unsigned int extra) {
+  Shape *s = t->shape;
+  TValue *slots = t->slots;
+  unsigned int sizeslots = t->sizeslots;
+  unsigned int n = 0;
+  int i;
+  lua_assert(s != NULL && isdummy(t));
+  for (i = 0; i < s->nkeys; i++) {
+    if (!ttisnil(&slots[i]))
+      n++;
+  }
+  setnodevector(L, t, n + extra);
+  t->shape = NULL;
+  t->slots = NULL;
+  t->sizeslots = 0;
+  for (i = 0; i < s->nkeys; i++) {
+    if (!ttisnil(&slots[i])) {
+      TValue k;
+      setsvalue(L, &k, s->keys[i]);
+      setobjt2t(L, luaH_set(L, t, &k), &slots[i]);
+    }
+  }
+  luaM_freearray(L, slots, sizeslots);
+  releaseshape(L, s);
+}
+
+
+/*
+** tries to insert 'key' into shaped table 't' keeping its shape: a
+** short string gets a new slot; an integer key may still go to a grown
+** array part. Returns NULL when 't' has to leave its shape.
+*/
+static TValue *shapenewkey (lua_State *L, Table *t, const TValue *key) {
+  if (ttisshrstring(key)) {
+    Shape *s = t->shape;
+    Shape *ns;
+    int n = s->nkeys;
+    if (n >= LUAI_MAXSHAPEKEYS)
+      return NULL;
+    if (cast(unsigned int, n) >= t->sizeslots) {  /* grow slots */
+      unsigned int size = (t->sizeslots < 2) ? 4 : 2 * t->sizeslots;
+      if (size > LUAI_MAXSHAPEKEYS)
+        size = LUAI_MAXSHAPEKEYS;
+      luaM_reallocvector(L, t->slots, t->sizeslots, size, TValue);
+      t->sizeslots = size;
+    }
+    ns = transition(L, s, tsvalue(key));
+    if (ns == NULL)
+      return NULL;
+    ns->refcount++;
+    t->shape = ns;
+    releaseshape(L, s);  /* ('s' has a child now, so it stays) */
+    setnilvalue(&t->slots[n]);
+    return &t->slots[n];  /* key is kept alive by the shape */
+  }
+  else {
+    unsigned int k = arrayindex(key);
+    if (k > t->sizearray) {  /* might go to a grown array part? */
+      unsigned int nums[MAXABITS + 1];
+      unsigned int na;
+      unsigned int asize;
+      int i;
+      for (i = 0; i <= MAXABITS; i++) nums[i] = 0;  /* reset counts */
+      na = numusearray(t, nums);  /* no integer keys in the hash part */
+      na += countint(key, nums);
+      asize = computesizes(nums, &na);
+      if (k <= asize) {
+        setarrayvector(L, t, asize);
+        return cast(TValue *, luaH_getint(t, k));  /* (maybe 'packslot') */
+      }
+    }
+    return NULL;
+  }
+}
+
+
+void luaH_unshape (lua_State *L, Table *t) {
+  if (t->shape != NULL)
+    unshape(L, t, 0);
+}
+
+
+void luaH_initshapes (lua_State *L) {
+  global_State *g = G(L);
+  int i;
+  g->shapetab = luaM_newvector(L, MINSHAPETAB, Shape *);
+  g->sizeshapetab = MINSHAPETAB;
+  for (i = 0; i < MINSHAPETAB; i++)
+    g->shapetab[i] = NULL;
+  g->shaperoot = newshape(L, NULL, NULL);
+}
+
+
+void luaH_freeshapes (lua_State *L) {
+  global_State *g = G(L);
+  int i;
+  for (i = 0; i < g->sizeshapetab; i++) {
+    Shape *s = g->shapetab[i];
+    while (s != NULL) {
+      Shape *hnext = s->hnext;
+      freeshape(L, s);
+      s = hnext;
+    }
+  }
+  luaM_freearray(L, g->shapetab, g->sizeshapetab);
+  if (g->shaperoot != NULL)
+    freeshape(L, g->shaperoot);
+  g->shapetab = NULL;
+  g->sizeshapetab = 0;
+  g->nshapes = 0;
+  g->shaperoot = NULL;
+}
+
+/* }============================================================= */
+
+#endif
+
+
+#if defined(LUA_USE_NUMARRAY)
+
+/*
+** {=============================================================
+** Packed arrays
+** While the elements of the array part are numbers of one subtype
+** filling indices 1..sizeused (all later slots being nil), the table
+** keeps them in 'packed' as plain integers or floats. Gets return a
+** copy of the element in 'packslot'; storing through it (with
+** 'luaH_setslot') replaces an element, appends after the last one or
+** removes the last one in place, while any other store unpacks the
+** array into regular values. 'luaH_resize' packs it again when the
+** elements allow it. A new table, with an empty array part, is packed.
+** ==============================================================
+*/
+
+static void unpackarray (lua_State *L, Table *t) {
+  unsigned int size = t->sizearray;
+  TValue *array = luaM_newvector(L, size, TValue);
+  unsigned int i;
+  lua_assert(ispacked(t));
+  for (i = 0; i < t->sizeused; i++)
+    getpacked(L, t, i, &array[i]);
+  for (; i < size; i++)
+    setnilvalue(&array[i]);
+  luaM_freearray(L, t->packed, size);
+  t->packed = NULL;
+  t->array = array;
+  t->arraykind = ARRAY_VALUES;
+  t->sizeused = 0;
+}
+
+
+static void packarray (lua_State *L, Table *t) {
+  unsigned int size = t->sizearray;
+  TValue *array = t->array;
+  lu_byte kind = ARRAY_INTS;  /* (any kind for an empty array) */
+  unsigned int n, i;
+  lua_assert(!ispacked(t));
+  if (size > 0 && ttisfloat(&array[0]))
+    kind = ARRAY_FLOATS;
+  for (n = 0; n < size && !ttisnil(&array[n]); n++) {
+    if (kind == ARRAY_INTS ? !ttispackint(&array[n]) : !ttisfloat(&array[n]))
+      return;  /* not a number of that subtype */
+  }
+  for (i = n; i < size; i++) {
+    if (!ttisnil(&array[i]))
+      return;  /* elements after a nil */
+  }
+  t->packed = luaM_newvector(L, size, PackedNum);
+  t->arraykind = kind;
+  for (i = 0; i < n; i++)
+    setpacked(t, i, &array[i]);
+  luaM_freearray(L, array, size);
+  t->array = NULL;
+  t->sizeused = n;
+}
+
+
+void luaH_setpacked (lua_State *L, Table *t, const TValue *value) {
+  unsigned int i = t->packidx - 1;  /* element written (0-based) */
+  lua_assert(ispacked(t) && i < t->sizearray);
+  if (ttisnil(value)) {
+    if (i + 1 == t->sizeused) {  /* removing the last element? */
+      t->sizeused--;
+      return;
+    }
+    else if (i >= t->sizeused)
+      return;  /* element is nil already */
+  }
+  else if (i <= t->sizeused) {  /* replacing or appending? */
+    if (t->sizeused == 0)  /* no elements yet: choose the subtype */
+      t->arraykind = ttisfloat(value) ? ARRAY_FLOATS : ARRAY_INTS;
+    if (packable(t, value)) {
+      setpacked(t, i, value);
+      if (i == t->sizeused)
+        t->sizeused++;
+      return;
+    }
+  }
+  unpackarray(L, t);  /* anything else needs regular values */
+  setobj2t(L, &t->array[i], value);
+}
+
+/* }============================================================= */
+
+#endif
+
+
 Table *luaH_new (lua_State *L) {
   GCObject *o = luaC_newobj(L, LUA_TTABLE, sizeof(Table));
   Table *t = gco2t(o);
@@ -425,19 +1320,55 @@ Table *luaH_new (lua_State *L) {
   t->flags = cast_byte(~0);
   t->array = NULL;
   t->sizearray = 0;
+  t->lenhint = 0;
+  t->nextpos = 0;
   setnodevector(L, t, 0);
+#if defined(LUA_USE_INCREHASH)
+  t->oldhash = NULL;
+#endif
+#if defined(LUA_USE_NUMARRAY)
+  t->arraykind = ARRAY_INTS;  /* empty array part is packed */
+  t->sizeused = 0;
+  t->packidx = 0;
+  t->packed = NULL;
+  setnilvalue(&t->packslot);
+#endif
+#if defined(LUA_USE_SHAPES)
+  t->shape = G(L)->shaperoot;  /* no keys yet */
+  t->slots = NULL;
+  t->sizeslots = 0;
+  if (t->shape != NULL)
+    t->shape->refcount++;
+#endif
   return t;
 }
 
 
 void luaH_free (lua_State *L, Table *t) {
   if (!isdummy(t))
-    luaM_freearray(L, t->node, cast(size_t, sizenode(t)));
+    luaM_freemem(L, t->node, sizenodevector(sizenode(t)));
+#if defined(LUA_USE_INCREHASH)
+  if (t->oldhash != NULL)
+    freeoldhash(L, t);
+#endif
+#if defined(LUA_USE_SHAPES)
+  if (t->shape != NULL) {
+    luaM_freearray(L, t->slots, t->sizeslots);
+    releaseshape(L, t->shape);
+  }
+#endif
+#if defined(LUA_USE_NUMARRAY)
+  if (ispacked(t))
+    luaM_freearray(L, t->packed, t->sizearray);
+  else
+#endif
   luaM_freearray(L, t->array, t->sizearray);
   luaM_free(L, t);
 }
 
 
+#if !defined(LUA_USE_SWISSTABLE)
+
 static Node *getfreepos (Table *t) {
   if (!isdummy(t)) {
     while (t->lastfree > t->node) {
@@ -449,6 +1380,7 @@ static Node *getfreepos (Table *t) {
   return NULL;  /* could not find a free place */
 }
 
+#endif
 
 
 /*
@@ -456,21 +1388,25 @@ static Node *getfreepos (Table *t) {
 ** position is free. If not, check whether colliding node is in its main
 ** position or not: if it is not, move colliding node to an empty place and
 ** put new key in its main position; otherwise (colliding node is in its main
-** position), new key goes to an empty position.
+** position), new key goes to an empty position. (With LUA_USE_SWISSTABLE,
+** the new key goes to the first empty node of its probe sequence.)
 */
-TValue *luaH_newkey (lua_State *L, Table *t, const TValue *key) {
+static TValue *insertkey (lua_State *L, Table *t, const TValue *key) {
   Node *mp;
-  TValue aux;
-  if (ttisnil(key)) luaG_runerror(L, "table index is nil");
-  else if (ttisfloat(key)) {
-    lua_Integer k;
-    if (luaV_tointeger(key, &k, 0)) {  /* does index fit in an integer? */
-      setivalue(&aux, k);
-      key = &aux;  /* insert it as an integer */
-    }
-    else if (luai_numisnan(fltvalue(key)))
-      luaG_runerror(L, "table index is NaN");
+#if defined(LUA_USE_SWISSTABLE)
+  unsigned int h = hashkey(key);
+  if (t->growthleft > 0) {  /* take an empty node */
+    unsigned int i = emptynode(t, h);
+    setctrl(t, i, ctrlbyte(h));
+    t->growthleft--;
+    mp = gnode(t, i);
+  }
+  else if ((mp = freednode(t, h)) == NULL) {  /* no free node? */
+    rehash(L, t, key);  /* grow table */
+    /* whatever called 'newkey' takes care of TM cache */
+    return getslot(L, t, key);  /* insert key into grown table */
   }
+#else
   mp = mainposition(t, key);
   if (!ttisnil(gval(mp)) || isdummy(t)) {  /* main position is taken? */
     Node *othern;
@@ -478,7 +1414,7 @@ TValue *luaH_newkey (lua_State *L, Table *t, const TValue *key) {
     if (f == NULL) {  /* cannot find a free place? */
       rehash(L, t, key);  /* grow table */
       /* whatever called 'newkey' takes care of TM cache */
-      return luaH_set(L, t, key);  /* insert key into grown table */
+      return getslot(L, t, key);  /* insert key into grown table */
     }
     lua_assert(!isdummy(t));
     othern = mainposition(t, gkey(mp));
@@ -503,6 +1439,7 @@ TValue *luaH_newkey (lua_State *L, Table *t, const TValue *key) {
       mp = f;
     }
   }
+#endif
   setnodekey(L, &mp->i_key, key);
   luaC_barrierback(L, t, key);
   lua_assert(ttisnil(gval(mp)));
@@ -510,13 +1447,65 @@ TValue *luaH_newkey (lua_State *L, Table *t, const TValue *key) {
 }
 
 
+/*
+** inserts a new key into table 't' (which must not have it yet) and
+** returns its (empty) slot
+*/
+TValue *luaH_newkey (lua_State *L, Table *t, const TValue *key) {
+  TValue aux;
+  if (ttisnil(key)) luaG_runerror(L, "table index is nil");
+  else if (ttisfloat(key)) {
+    lua_Integer k;
+    if (luaV_tointeger(key, &k, 0)) {  /* does index fit in an integer? */
+      setivalue(L, &aux, k);
+      key = &aux;  /* insert it as an integer */
+    }
+    else if (luai_numisnan(fltvalue(key)))
+      luaG_runerror(L, "table index is NaN");
+  }
+#if defined(LUA_USE_SHAPES)
+  if (t->shape != NULL) {
+    TValue *slot = shapenewkey(L, t, key);
+    if (slot != NULL)
+      return slot;
+    unshape(L, t, 1);  /* cannot keep the shape; use a hash part */
+  }
+#endif
+#if defined(LUA_USE_INCREHASH)
+  if (t->oldhash != NULL)
+    rehashstep(L, t);  /* move some old nodes first */
+#endif
+  return insertkey(L, t, key);
+}
+
+
 /*
 ** search function for integers
 */
 const TValue *luaH_getint (Table *t, lua_Integer key) {
   /* (1 <= key && key <= t->sizearray) */
-  if (l_castS2U(key) - 1 < t->sizearray)
+  if (l_castS2U(key) - 1 < t->sizearray) {
+#if defined(LUA_USE_NUMARRAY)
+    if (ispacked(t)) {  /* return a copy of the element */
+      t->packidx = cast(unsigned int, key);
+      if (l_castS2U(key) <= t->sizeused) {
+        getpacked(cast(lua_State *, NULL), t, key - 1, &t->packslot);
+      }
+      else setnilvalue(&t->packslot);
+      return &t->packslot;
+    }
+#endif
     return &t->array[key - 1];
+  }
+#if defined(LUA_USE_SWISSTABLE)
+  else {
+    Node *n;
+    probe(t, hashinteger(key), n,
+      if (ttisinteger(gkey(n)) && ivalue(gkey(n)) == key)
+        return gval(n));
+    return missed(t, luaH_getint(t->oldhash, key));
+  }
+#else
   else {
     Node *n = hashint(t, key);
     for (;;) {  /* check whether 'key' is somewhere in the chain */
@@ -528,8 +1517,9 @@ const TValue *luaH_getint (Table *t, lua_Integer key) {
         n += nx;
       }
     }
-    return luaO_nilobject;
+    return missed(t, luaH_getint(t->oldhash, key));
   }
+#endif
 }
 
 
@@ -537,8 +1527,21 @@ const TValue *luaH_getint (Table *t, lua_Integer key) {
 ** search function for short strings
 */
 const TValue *luaH_getshortstr (Table *t, TString *key) {
-  Node *n = hashstr(t, key);
+  Node *n;
   lua_assert(key->tt == LUA_TSHRSTR);
+#if defined(LUA_USE_SHAPES)
+  if (t->shape != NULL) {  /* keys are in the shape */
+    int i = shapeindex(t->shape, key);
+    return (i < 0) ? luaO_nilobject : &t->slots[i];
+  }
+#endif
+#if defined(LUA_USE_SWISSTABLE)
+  probe(t, key->hash, n,
+    if (ttisshrstring(gkey(n)) && eqshrstr(tsvalue(gkey(n)), key))
+      return gval(n));
+  return missed(t, luaH_getshortstr(t->oldhash, key));
+#else
+  n = hashstr(t, key);
   for (;;) {  /* check whether 'key' is somewhere in the chain */
     const TValue *k = gkey(n);
     if (ttisshrstring(k) && eqshrstr(tsvalue(k), key))
@@ -546,10 +1549,56 @@ const TValue *luaH_getshortstr (Table *t, TString *key) {
     else {
       int nx = gnext(n);
       if (nx == 0)
-        return luaO_nilobject;  /* not found */
+        return missed(t, luaH_getshortstr(t->oldhash, key));
+      n += nx;
+    }
+  }
+#endif
+}
+
+
+/*
+** same as 'luaH_getshortstr', but also stores in '*slot' the index of
+** the node holding 'key' (or of its slot, in a shaped table), for the
+** inline caches of the VM. '*slot' is left untouched when the key is
+** absent or still in an old hash part.
+*/
+const TValue *luaH_getshortstrslot (Table *t, TString *key,
+                                                unsigned int *slot) {
+  Node *n;
+  lua_assert(key->tt == LUA_TSHRSTR);
+#if defined(LUA_USE_SHAPES)
+  if (t->shape != NULL) {  /* for shaped tables, cache the slot */
+    int i = shapeindex(t->shape, key);
+    if (i < 0)
+      return luaO_nilobject;
+    *slot = cast(unsigned int, i);
+    return &t->slots[i];
+  }
+#endif
+#if defined(LUA_USE_SWISSTABLE)
+  probe(t, key->hash, n,
+    if (ttisshrstring(gkey(n)) && eqshrstr(tsvalue(gkey(n)), key)) {
+      *slot = cast(unsigned int, n - t->node);
+      return gval(n);
+    });
+  return missed(t, luaH_getshortstr(t->oldhash, key));
+#else
+  n = hashstr(t, key);
+  for (;;) {  /* check whether 'key' is somewhere in the chain */
+    const TValue *k = gkey(n);
+    if (ttisshrstring(k) && eqshrstr(tsvalue(k), key)) {
+      *slot = cast(unsigned int, n - t->node);
+      return gval(n);  /* that's it */
+    }
+    else {
+      int nx = gnext(n);
+      if (nx == 0)
+        return missed(t, luaH_getshortstr(t->oldhash, key));
       n += nx;
     }
   }
+#endif
 }
 
 
@@ -558,6 +1607,13 @@ const TValue *luaH_getshortstr (Table *t, TString *key) {
 ** which may be in array part, nor for floats with integral values.)
 */
 static const TValue *getgeneric (Table *t, const TValue *key) {
+#if defined(LUA_USE_SWISSTABLE)
+  Node *n;
+  probe(t, hashkey(key), n,
+    if (luaV_rawequalobj(gkey(n), key))
+      return gval(n));
+  return missed(t, getgeneric(t->oldhash, key));
+#else
   Node *n = mainposition(t, key);
   for (;;) {  /* check whether 'key' is somewhere in the chain */
     if (luaV_rawequalobj(gkey(n), key))
@@ -565,10 +1621,11 @@ static const TValue *getgeneric (Table *t, const TValue *key) {
     else {
       int nx = gnext(n);
       if (nx == 0)
-        return luaO_nilobject;  /* not found */
+        return missed(t, getgeneric(t->oldhash, key));
       n += nx;
     }
   }
+#endif
 }
 
 
@@ -608,24 +1665,28 @@ const TValue *luaH_get (Table *t, const TValue *key) {
 ** barrier and invalidate the TM cache.
 */
 TValue *luaH_set (lua_State *L, Table *t, const TValue *key) {
-  const TValue *p = luaH_get(t, key);
-  if (p != luaO_nilobject)
-    return cast(TValue *, p);
-  else return luaH_newkey(L, t, key);
+  TValue *p = getslot(L, t, key);
+#if defined(LUA_USE_NUMARRAY)
+  if (p == &t->packslot) {  /* caller will write into the slot? */
+    unpackarray(L, t);
+    p = &t->array[t->packidx - 1];
+  }
+#endif
+  return p;
 }
 
 
 void luaH_setint (lua_State *L, Table *t, lua_Integer key, TValue *value) {
   const TValue *p = luaH_getint(t, key);
-  TValue *cell;
+  const TValue *cell;
   if (p != luaO_nilobject)
-    cell = cast(TValue *, p);
+    cell = p;
   else {
     TValue k;
-    setivalue(&k, key);
+    setivalue(L, &k, key);
     cell = luaH_newkey(L, t, &k);
   }
-  setobj2t(L, cell, value);
+  luaH_setslot(L, t, cell, value);
 }
 
 
@@ -653,26 +1714,65 @@ static lua_Unsigned unbound_search (Table *t, lua_Unsigned j) {
 }
 
 
+/*
+** whether 't[k]' is not nil (with 't[0]' counting as present)
+*/
+static int hasint (Table *t, lua_Unsigned k) {
+  if (k == 0)
+    return 1;
+  else if (k - 1 < t->sizearray)
+    return arrayhas(t, k - 1);
+  else
+    return !ttisnil(luaH_getint(t, l_castU2S(k)));
+}
+
+
+/*
+** keeps boundary 'n' of 't' as the hint for its next length
+*/
+static lua_Unsigned sethint (Table *t, lua_Unsigned n) {
+  if (n <= UINT_MAX)
+    t->lenhint = cast(unsigned int, n);
+  return n;
+}
+
+
 /*
 ** Try to find a boundary in table 't'. A 'boundary' is an integer index
 ** such that t[i] is non-nil and t[i+1] is nil (and 0 if t[1] is nil).
+** The last boundary found is checked first: appends and removals at the
+** end of a sequence move it by one at most. (It is only a hint, checked
+** against the contents, so stores never need to update it.)
 */
 lua_Unsigned luaH_getn (Table *t) {
   unsigned int j = t->sizearray;
-  if (j > 0 && ttisnil(&t->array[j - 1])) {
+  lua_Unsigned h = t->lenhint;
+#if defined(LUA_USE_NUMARRAY)
+  if (ispacked(t) && t->sizeused < j)
+    return t->sizeused;  /* the only boundary in a packed array */
+#endif
+  if (hasint(t, h)) {
+    if (!hasint(t, h + 1))
+      return h;  /* hint is still a boundary */
+    else if (!hasint(t, h + 2))
+      return sethint(t, h + 1);  /* one element was appended */
+  }
+  else if (hasint(t, h - 1))  /* (h > 0) */
+    return sethint(t, h - 1);  /* last element was removed */
+  if (j > 0 && !arrayhas(t, j - 1)) {
     /* there is a boundary in the array part: (binary) search for it */
     unsigned int i = 0;
     while (j - i > 1) {
       unsigned int m = (i+j)/2;
-      if (ttisnil(&t->array[m - 1])) j = m;
+      if (!arrayhas(t, m - 1)) j = m;
       else i = m;
     }
-    return i;
+    return sethint(t, i);
   }
   /* else must find a boundary in hash part */
   else if (isdummy(t))  /* hash part is empty? */
-    return j;  /* that is easy... */
-  else return unbound_search(t, j);
+    return sethint(t, j);  /* that is easy... */
+  else return sethint(t, unbound_search(t, j));
 }
 
 
@@ -680,7 +1780,11 @@ lua_Unsigned luaH_getn (Table *t) {
 #if defined(LUA_DEBUG)
 
 Node *luaH_mainposition (const Table *t, const TValue *key) {
+#if defined(LUA_USE_SWISSTABLE)
+  return gnode(t, firstpos(t, hashkey(key)));
+#else
   return mainposition(t, key);
+#endif
 }
 
 int luaH_isdummy (const Table *t) { return isdummy(t); }
@@ -35,15 +35,109 @@
 #define allocsizenode(t)	(isdummy(t) ? 0 : sizenode(t))
 
 
+#if defined(LUA_USE_SWISSTABLE)
+
+/* SSE2 matches a group (MSVC does not define '__SSE2__', even on x64) */
+#if defined(__SSE2__) || (defined(_MSC_VER) && \
+    (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)))
+#define LUAI_GROUPSSE2
+#endif
+
+/* number of control bytes matched at once (see ltable.c) */
+#if defined(LUAI_GROUPSSE2)
+#define GROUPWIDTH	16
+#else
+#define GROUPWIDTH	4
+#endif
+
+/* control bytes of the hash part, kept right after its nodes */
+#define gctrl(t)	cast(lu_byte *, gnode(t, sizenode(t)))
+
+/* size in bytes of a hash part with 'n' nodes */
+#define sizenodevector(n) \
+	(cast(size_t, n) * (sizeof(Node) + 1) + GROUPWIDTH)
+
+/*
+** number of keys a hash part with 'n' nodes can take: bigger ones keep
+** some empty slots, so that every probe sequence ends
+*/
+#define maxkeys(n)	((n) <= GROUPWIDTH ? (n) : (n) - ((n) >> 3))
+
+#else
+
+#define sizenodevector(n)	(cast(size_t, n) * sizeof(Node))
+#define maxkeys(n)	(n)
+
+#endif
+
+
+/* number of keys the allocated hash part of 't' can take */
+#define allockeys(t)	(isdummy(t) ? 0 : maxkeys(sizenode(t)))
+
+
 /* returns the key, given the value of a table entry */
 #define keyfromval(v) \
   (gkey(cast(Node *, cast(char *, (v)) - offsetof(Node, i_val))))
 
 
+#if defined(LUA_USE_NUMARRAY)
+
+/* values for 'arraykind' */
+#define ARRAY_VALUES	0	/* elements are the TValues in 'array' */
+#define ARRAY_INTS	1	/* elements are the integers in 'packed' */
+#define ARRAY_FLOATS	2	/* elements are the floats in 'packed' */
+
+#define ispacked(t)	((t)->arraykind != ARRAY_VALUES)
+
+/* number of TValues in 'array' */
+#define sizevalarray(t)	(ispacked(t) ? 0 : (t)->sizearray)
+
+#if defined(LUA_USE_NANBOX)
+/* (integers that need a box are not packed) */
+#define ttispackint(o)	nbis(o, NBT_INT)
+#else
+#define ttispackint(o)	ttisinteger(o)
+#endif
+
+/* whether value 'o' can be an element of the packed array of 't' */
+#define packable(t,o)  \
+	((t)->arraykind == ARRAY_INTS ? ttispackint(o) : ttisfloat(o))
+
+/* copy packed element 'k' (0-based) of 't' into 'o' */
+#define getpacked(L,t,k,o) \
+  { if ((t)->arraykind == ARRAY_INTS) { setivalue(L, o, (t)->packed[k].i); } \
+    else { setfltvalue(o, (t)->packed[k].n); } }
+
+/* set packed element 'k' (0-based) of 't' to (packable) value 'o' */
+#define setpacked(t,k,o) \
+  { if ((t)->arraykind == ARRAY_INTS) (t)->packed[k].i = ivalue(o); \
+    else (t)->packed[k].n = fltvalue(o); }
+
+/*
+** 'luaH_getint' and 'luaH_get' return elements of a packed array as a
+** copy in 'packslot'; a store through a slot they returned must go
+** through this macro, which writes the copy back. ('luaH_set' never
+** returns such a copy.)
+*/
+#define luaH_setslot(L,t,slot,o) \
+	((slot) == &(t)->packslot ? luaH_setpacked(L, t, o) \
+	                          : (void)setobj2t(L, cast(TValue *, slot), o))
+
+#else
+
+#define sizevalarray(t)	((t)->sizearray)
+
+#define luaH_setslot(L,t,slot,o)	setobj2t(L, cast(TValue *, slot), o)
+
+#endif
+
+
 LUAI_FUNC const TValue *luaH_getint (Table *t, lua_Integer key);
 LUAI_FUNC void luaH_setint (lua_State *L, Table *t, lua_Integer key,
                                                     TValue *value);
 LUAI_FUNC const TValue *luaH_getshortstr (Table *t, TString *key);
+LUAI_FUNC const TValue *luaH_getshortstrslot (Table *t, TString *key,
+                                                        unsigned int *slot);
 LUAI_FUNC const TValue *luaH_getstr (Table *t, TString *key);
 LUAI_FUNC const TValue *luaH_get (Table *t, const TValue *key);
 LUAI_FUNC TValue *luaH_newkey (lua_State *L, Table *t, const TValue *key);
@@ -53,6 +147,17 @@ LUAI_FUNC void luaH_resize (lua_State *L, Table *t, unsigned int nasize,
                                                     unsigned int nhsize);
 LUAI_FUNC void luaH_resizearray (lua_State *L, Table *t, unsigned int nasize);
 LUAI_FUNC void luaH_free (lua_State *L, Table *t);
+#if defined(LUA_USE_NUMARRAY)
+LUAI_FUNC void luaH_setpacked (lua_State *L, Table *t, const TValue *value);
+#endif
+#if defined(LUA_USE_SHAPES)
+LUAI_FUNC void luaH_unshape (lua_State *L, Table *t);
+LUAI_FUNC void luaH_initshapes (lua_State *L);
+LUAI_FUNC void luaH_freeshapes (lua_State *L);
+#endif
+#if defined(LUA_USE_INCREHASH)
+LUAI_FUNC void luaH_finishrehash (lua_State *L, Table *t);
+#endif
 LUAI_FUNC int luaH_next (lua_State *L, Table *t, StkId key);
 LUAI_FUNC lua_Unsigned luaH_getn (Table *t);
 
@@ -11,7 +11,9 @@
 
 
 #include <limits.h>
+#include <locale.h>
 #include <stddef.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "lua.h"
@@ -119,6 +121,25 @@ static int tremove (lua_State *L) {
 }
 
 
+/*
+** When all elements involved are in packed arrays of the same kind (see
+** 'lua_numarray'), both ranges are present, so no metamethod can be
+** called: copy the numbers directly.
+*/
+static int movenumarray (lua_State *L, lua_Integer f, lua_Integer e,
+                                       lua_Integer t, int tt) {
+  void *src, *dst;
+  lua_Integer ns, nd;
+  int kind = lua_numarray(L, 1, &src, &ns);
+  if (kind == 0 || lua_numarray(L, tt, &dst, &nd) != kind ||
+      f < 1 || e > ns || t < 1 || t + (e - f) > nd)
+    return 0;
+  memmove((lua_Integer *)dst + (t - 1), (lua_Integer *)src + (f - 1),
+          (size_t)(e - f + 1) * sizeof(lua_Integer));
+  return 1;
+}
+
+
 /*
 ** Copy elements (1[f], ..., 1[e]) into (tt[t], tt[t+1], ...). Whenever
 ** possible, copy in increasing order, which is better for rehashing.
@@ -139,7 +160,9 @@ static int tmove (lua_State *L) {
     n = e - f + 1;  /* number of elements to move */
     luaL_argcheck(L, t <= LUA_MAXINTEGER - n + 1, 4,
                   "destination wrap around");
-    if (t > e || t <= f || (tt != 1 && !lua_compare(L, 1, tt, LUA_OPEQ))) {
+    if (movenumarray(L, f, e, t, tt))
+      ;  /* done */
+    else if (t > e || t <= f || (tt != 1 && !lua_compare(L, 1, tt, LUA_OPEQ))) {
       for (i = 0; i < n; i++) {
         lua_geti(L, 1, f + i);
         lua_seti(L, tt, t + i);
@@ -157,7 +180,30 @@ static int tmove (lua_State *L) {
 }
 
 
+/* space for the string of a number (cf. 'MAXNUMBER2STR' in lobject.c) */
+#define MAXNUMSTR	44
+
+
 static void addfield (lua_State *L, luaL_Buffer *b, lua_Integer i) {
+  void *p;
+  lua_Integer n;
+  int kind = lua_numarray(L, 1, &p, &n);
+  if (kind != 0 && 1 <= i && i <= n) {  /* element of a packed array? */
+    /* format it as 'tostring' does, without creating a string */
+    char *buff = luaL_prepbuffsize(b, MAXNUMSTR);
+    int len;
+    if (kind == LUA_NUMARRAYINT)
+      len = lua_integer2str(buff, MAXNUMSTR, ((lua_Integer *)p)[i - 1]);
+    else {
+      len = lua_number2str(buff, MAXNUMSTR, ((lua_Number *)p)[i - 1]);
+      if (buff[strspn(buff, "-0123456789")] == '\0') {  /* looks like an int? */
+        buff[len++] = lua_getlocaledecpoint();
+        buff[len++] = '0';  /* adds '.0' to result */
+      }
+    }
+    luaL_addsize(b, len);
+    return;
+  }
   lua_geti(L, 1, i);
   if (!lua_isstring(L, -1))
     luaL_error(L, "invalid value (%s) at index %d in table for 'concat'",
@@ -408,12 +454,54 @@ static void auxsort (lua_State *L, IdxT lo, IdxT up,
 }
 
 
+/*
+** A packed array (see 'lua_numarray') with the default order is sorted
+** in place. (Floats go this way only without NaNs, for which '<' is
+** not an order.)
+*/
+static int cmpint (const void *a, const void *b) {
+  lua_Integer x = *(const lua_Integer *)a;
+  lua_Integer y = *(const lua_Integer *)b;
+  return (x > y) - (x < y);
+}
+
+
+static int cmpnum (const void *a, const void *b) {
+  lua_Number x = *(const lua_Number *)a;
+  lua_Number y = *(const lua_Number *)b;
+  return (x > y) - (x < y);
+}
+
+
+static int sortnumarray (lua_State *L, lua_Integer n) {
+  void *p;
+  lua_Integer np;
+  int kind = lua_numarray(L, 1, &p, &np);
+  if (kind == 0 || np != n)
+    return 0;
+  if (kind == LUA_NUMARRAYINT)
+    qsort(p, (size_t)n, sizeof(lua_Integer), cmpint);
+  else {
+    lua_Number *a = (lua_Number *)p;
+    lua_Integer i;
+    for (i = 0; i < n; i++) {
+      if (a[i] != a[i])  /* NaN? */
+        return 0;
+    }
+    qsort(p, (size_t)n, sizeof(lua_Number), cmpnum);
+  }
+  return 1;
+}
+
+
 static int sort (lua_State *L) {
   lua_Integer n = aux_getn(L, 1, TAB_RW);
   if (n > 1) {  /* non-trivial interval? */
     luaL_argcheck(L, n < INT_MAX, 1, "array too big");
     if (!lua_isnoneornil(L, 2))  /* is there a 2nd argument? */
       luaL_checktype(L, 2, LUA_TFUNCTION);  /* must be a function */
+    else if (sortnumarray(L, n))
+      return 0;
     lua_settop(L, 2);  /* make sure there are two arguments */
     auxsort(L, 1, (IdxT)n, 0);
   }
@@ -189,6 +189,16 @@ LUA_API lua_State      *(lua_tothread) (lua_State *L, int idx);
 LUA_API const void     *(lua_topointer) (lua_State *L, int idx);
 
 
+/*
+** raw access to the packed array part of a table (see LUA_USE_NUMARRAY)
+*/
+#define LUA_NUMARRAYINT	1	/* elements are 'lua_Integer's */
+#define LUA_NUMARRAYFLT	2	/* elements are 'lua_Number's */
+
+LUA_API int             (lua_numarray) (lua_State *L, int idx, void **p,
+                                        lua_Integer *n);
+
+
 /*
 ** Comparison and arithmetic functions
 */
@@ -44,6 +44,57 @@
 /* #define LUA_USE_C89 */
 
 
+/*
+** The next options change the layout of internal structures, so all of
+** Lua must be compiled with the same setting for each of them.
+*/
+
+/*
+@@ LUA_USE_SHAPES lets tables whose hash keys are all short strings
+** share a 'shape' (the list of their keys) and keep only a vector of
+** values (see ltable.c).
+*/
+/* #define LUA_USE_SHAPES */
+
+
+/*
+@@ LUA_USE_NANBOX packs every value into 8 bytes ("NaN boxing"): floats
+** are stored as themselves and all other values go in the payload of
+** the NaN space, with a 4-bit tag and a 47-bit payload (see lobject.h).
+** Integers that do not fit in 47 bits are boxed in a collectable
+** object, so the full 64-bit range keeps working. It needs 64-bit
+** integers, double floats and pointers whose significant bits fit in
+** 47 bits (true for user space in current 64-bit systems).
+*/
+/* #define LUA_USE_NANBOX */
+
+
+/*
+@@ LUA_USE_NUMARRAY keeps the array part of a table as a plain array of
+** integers or of floats while all its elements are numbers of the same
+** subtype, going back to regular values on the first store of anything
+** else (see ltable.c).
+*/
+/* #define LUA_USE_NUMARRAY */
+
+
+/*
+@@ LUA_USE_SWISSTABLE replaces the chained scatter table of the hash
+** part of tables by open addressing over groups of control bytes, one
+** byte per node, which are matched a whole group at a time (with SSE2
+** when available; see ltable.c).
+*/
+/* #define LUA_USE_SWISSTABLE */
+
+
+/*
+@@ LUA_USE_INCREHASH spreads the rehash of a big hash part over the
+** insertions that follow it: the old nodes are kept aside and each new
+** key moves a few of them into the new hash part (see ltable.c).
+*/
+/* #define LUA_USE_INCREHASH */
+
+
 /*
 ** By default, Lua on Windows use (some) specific Windows features
 */
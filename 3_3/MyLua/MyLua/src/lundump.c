@@ -109,6 +109,7 @@ static void LoadCode (LoadState *S, Proto *f) {
   f->code = luaM_newvector(S->L, n, Instruction);
   f->sizecode = n;
   LoadVector(S, f->code, n);
+  luaF_initicache(S->L, f);
 }
 
 
@@ -136,7 +137,7 @@ static void LoadConstants (LoadState *S, Proto *f) {
       setfltvalue(o, LoadNumber(S));
       break;
     case LUA_TNUMINT:
-      setivalue(o, LoadInteger(S));
+      setivalue(S->L, o, LoadInteger(S));
       break;
     case LUA_TSHRSTR:
     case LUA_TLNGSTR:
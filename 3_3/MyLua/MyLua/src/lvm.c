@@ -35,6 +35,17 @@
 #define MAXTAGLOOP	2000
 
 
+/*
+** 'LUA_USE_JUMPTABLE' selects a computed-goto dispatch (see ljumptab.h)
+** for the main interpreter loop. It is off by default; it needs the
+** labels-as-values extension of gcc and compatible compilers.
+*/
+#if !defined(LUA_USE_JUMPTABLE) || !defined(__GNUC__)
+#undef LUA_USE_JUMPTABLE
+#define LUA_USE_JUMPTABLE	0
+#endif
+
+
 
 /*
 ** 'l_intfitsf' checks whether a given integer can be converted to a
@@ -70,14 +81,14 @@
 ** by the macro 'tonumber'.
 */
 int luaV_tonumber_ (const TValue *obj, lua_Number *n) {
-  TValue v;
+  lua_Integer i; int isint;
   if (ttisinteger(obj)) {
     *n = cast_num(ivalue(obj));
     return 1;
   }
   else if (cvt2num(obj) &&  /* string convertible to number? */
-            luaO_str2num(svalue(obj), &v) == vslen(obj) + 1) {
-    *n = nvalue(&v);  /* convert result of 'luaO_str2num' to a float */
+            luaO_rawstr2num(svalue(obj), &i, n, &isint) == vslen(obj) + 1) {
+    if (isint) *n = cast_num(i);  /* convert an integer result to a float */
     return 1;
   }
   else
@@ -93,6 +104,7 @@ int luaV_tonumber_ (const TValue *obj, lua_Number *n) {
 */
 int luaV_tointeger (const TValue *obj, lua_Integer *p, int mode) {
   TValue v;
+  lua_Number n; int isint;
  again:
   if (ttisfloat(obj)) {
     lua_Number n = fltvalue(obj);
@@ -109,9 +121,11 @@ int luaV_tointeger (const TValue *obj, lua_Integer *p, int mode) {
     return 1;
   }
   else if (cvt2num(obj) &&
-            luaO_str2num(svalue(obj), &v) == vslen(obj) + 1) {
+            luaO_rawstr2num(svalue(obj), p, &n, &isint) == vslen(obj) + 1) {
+    if (isint) return 1;  /* integer result already in '*p' */
+    setfltvalue(&v, n);
     obj = &v;
-    goto again;  /* convert result from 'luaO_str2num' to an integer */
+    goto again;  /* convert float result to an integer */
   }
   return 0;  /* conversion failed */
 }
@@ -213,7 +227,7 @@ void luaV_finishset (lua_State *L, const TValue *t, TValue *key,
         if (slot == luaO_nilobject)  /* no previous entry? */
           slot = luaH_newkey(L, h, key);  /* create one */
         /* no metamethod and (now) there is an entry with given key */
-        setobj2t(L, cast(TValue *, slot), val);  /* set its new value */
+        luaH_setslot(L, h, slot, val);  /* set its new value */
         invalidateTMcache(h);
         luaC_barrierback(L, h, val);
         return;
@@ -521,15 +535,15 @@ void luaV_objlen (lua_State *L, StkId ra, const TValue *rb) {
       Table *h = hvalue(rb);
       tm = fasttm(L, h->metatable, TM_LEN);
       if (tm) break;  /* metamethod? break switch to call it */
-      setivalue(ra, luaH_getn(h));  /* else primitive len */
+      setivalue(L, ra, luaH_getn(h));  /* else primitive len */
       return;
     }
     case LUA_TSHRSTR: {
-      setivalue(ra, tsvalue(rb)->shrlen);
+      setivalue(L, ra, tsvalue(rb)->shrlen);
       return;
     }
     case LUA_TLNGSTR: {
-      setivalue(ra, tsvalue(rb)->u.lnglen);
+      setivalue(L, ra, tsvalue(rb)->u.lnglen);
       return;
     }
     default: {  /* try metamethod */
@@ -738,13 +752,13 @@ void luaV_finishOp (lua_State *L) {
 #define dojump(ci,i,e) \
   { int a = GETARG_A(i); \
     if (a != 0) luaF_close(L, ci->u.l.base + a - 1); \
-    ci->u.l.savedpc += GETARG_sBx(i) + e; }
+    ci->u.l.savedpc += GETARG_sBx(i) + e; updatedisp(L); }
 
 /* for test instructions, execute the jump instruction that follows it */
 #define donextjump(ci)	{ i = *ci->u.l.savedpc; dojump(ci, i, 1); }
 
 
-#define Protect(x)	{ {x;}; base = ci->u.l.base; }
+#define Protect(x)	{ {x;}; base = ci->u.l.base; updatedisp(L); }
 
 #define checkGC(L,c)  \
 	{ luaC_condGC(L, L->top = (c),  /* limit of live values */ \
@@ -752,11 +766,23 @@ void luaV_finishOp (lua_State *L) {
            luai_threadyield(L); }
 
 
+#if LUA_USE_JUMPTABLE
+/* choose the dispatch table; hooks are handled by 'hooktab' */
+#define updatedisp(L)  \
+  (disp = (L->hookmask & (LUA_MASKLINE | LUA_MASKCOUNT)) ? hooktab : disptab)
+#define vmhook()	((void)0)
+#else
+#define updatedisp(L)	((void)0)
+#define vmhook()  \
+  { if (L->hookmask & (LUA_MASKLINE | LUA_MASKCOUNT)) \
+      Protect(luaG_traceexec(L)); }
+#endif
+
+
 /* fetch an instruction and prepare its execution */
 #define vmfetch()	{ \
   i = *(ci->u.l.savedpc++); \
-  if (L->hookmask & (LUA_MASKLINE | LUA_MASKCOUNT)) \
-    Protect(luaG_traceexec(L)); \
+  vmhook(); \
   ra = RA(i); /* WARNING: any stack reallocation invalidates 'ra' */ \
   lua_assert(base == ci->u.l.base); \
   lua_assert(base <= L->top && L->top < L->stack + L->stacksize); \
@@ -782,24 +808,119 @@ void luaV_finishOp (lua_State *L) {
     Protect(luaV_finishset(L,t,k,v,slot)); }
 
 
+/*
+** Inline caches: 'p->icache[pc]' is the node index where the short
+** string key of the table access at 'pc' was found last time. A hit
+** checks that single node; a stale index (another table, a rehash, a
+** removed key) just misses, searches the chain and refreshes the entry.
+*/
+#define icache(ci,cl)	(cl->p->icache + (ci->u.l.savedpc - 1 - cl->p->code))
+
+#define icachenode(t,key,ic) \
+  (*(ic) < cast(unsigned int, sizenode(t)) && \
+   ttisshrstring(gkey(gnode(t, *(ic)))) && \
+   eqshrstr(tsvalue(gkey(gnode(t, *(ic)))), key))
+
+#if defined(LUA_USE_SHAPES)
+/* for a shaped table, the entry is the slot of the key in its shape */
+#define icacheshape(t,key,ic) \
+  ((t)->shape != NULL && *(ic) < cast(unsigned int, (t)->shape->nkeys) && \
+   (t)->shape->keys[*(ic)] == (key))
+
+#define icacheget(t,key,ic) \
+  (icachenode(t,key,ic) ? gval(gnode(t, *(ic))) \
+   : icacheshape(t,key,ic) ? cast(const TValue *, &(t)->slots[*(ic)]) \
+   : luaH_getshortstrslot(t, key, ic))
+#else
+#define icacheget(t,key,ic) \
+  (icachenode(t,key,ic) ? gval(gnode(t, *(ic))) \
+   : luaH_getshortstrslot(t, key, ic))
+#endif
+
+
+#if defined(LUA_USE_NUMARRAY)
+/*
+** Integer keys in the used part of a packed array reach the element
+** directly; so does a store right after the last element (an append),
+** if there is no '__newindex' to call.
+*/
+#define packedget(h,k) \
+  (ttisinteger(k) && ispacked(h) && l_castS2U(ivalue(k)) - 1 < (h)->sizeused)
+
+#define packedset(L,h,k,v) \
+  (ttisinteger(k) && ispacked(h) && packable(h, v) && \
+   (l_castS2U(ivalue(k)) - 1 < (h)->sizeused || \
+    (l_castS2U(ivalue(k)) - 1 == (h)->sizeused && \
+     (h)->sizeused < (h)->sizearray && \
+     fasttm(L, (h)->metatable, TM_NEWINDEX) == NULL)))
+
+#define getpackedint(L,h,k,v)	getpacked(L, h, ivalue(k) - 1, v)
+
+#define setpackedint(h,k,v) { \
+  unsigned int i_ = cast(unsigned int, ivalue(k)) - 1; \
+  setpacked(h, i_, v); \
+  if (i_ == (h)->sizeused) { (h)->sizeused++; invalidateTMcache(h); } }
+#else
+#define packedget(h,k)		0
+#define packedset(L,h,k,v)	0
+#define getpackedint(L,h,k,v)	{ }
+#define setpackedint(h,k,v)	{ }
+#endif
+
+
+/* 'gettableProtected' through the inline cache of the instruction */
+#define gettableCached(L,t,k,v) { \
+  if (ttistable(t) && ttisshrstring(k)) { \
+    const TValue *slot = icacheget(hvalue(t), tsvalue(k), icache(ci,cl)); \
+    if (!ttisnil(slot)) { setobj2s(L, v, slot); } \
+    else Protect(luaV_finishget(L,t,k,v,slot)); } \
+  else if (ttistable(t) && packedget(hvalue(t), k)) { \
+    getpackedint(L, hvalue(t), k, v); } \
+  else gettableProtected(L,t,k,v); }
+
+
+/* 'settableProtected' through the inline cache of the instruction */
+#define settableCached(L,t,k,v) { \
+  if (ttistable(t) && ttisshrstring(k)) { \
+    const TValue *slot = icacheget(hvalue(t), tsvalue(k), icache(ci,cl)); \
+    if (!ttisnil(slot)) { \
+      luaC_barrierback(L, hvalue(t), v); \
+      setobj2t(L, cast(TValue *, slot), v); } \
+    else Protect(luaV_finishset(L,t,k,v,slot)); } \
+  else if (ttistable(t) && packedset(L, hvalue(t), k, v)) { \
+    setpackedint(hvalue(t), k, v); } \
+  else settableProtected(L,t,k,v); }
+
+
 
 void luaV_execute (lua_State *L) {
   CallInfo *ci = L->ci;
   LClosure *cl;
   TValue *k;
   StkId base;
+#if LUA_USE_JUMPTABLE
+#include "ljumptab.h"
+#endif
   ci->callstatus |= CIST_FRESH;  /* fresh invocation of 'luaV_execute" */
  newframe:  /* reentry point when frame changes (call/return) */
   lua_assert(ci == L->ci);
   cl = clLvalue(ci->func);  /* local reference to function's closure */
   k = cl->p->k;  /* local reference to function's constant table */
   base = ci->u.l.base;  /* local copy of function's base */
+  updatedisp(L);
   /* main loop of interpreter */
   for (;;) {
     Instruction i;
     StkId ra;
     vmfetch();
     vmdispatch (GET_OPCODE(i)) {
+#if LUA_USE_JUMPTABLE
+      L_hook: {  /* a line/count hook is on: call it, then dispatch */
+        Protect(luaG_traceexec(L));
+        ra = RA(i);  /* hook may have changed the stack */
+        goto *disptab[GET_OPCODE(i)];
+      }
+#endif
       vmcase(OP_MOVE) {
         setobjs2s(L, ra, RB(i));
         vmbreak;
@@ -836,20 +957,20 @@ void luaV_execute (lua_State *L) {
       vmcase(OP_GETTABUP) {
         TValue *upval = cl->upvals[GETARG_B(i)]->v;
         TValue *rc = RKC(i);
-        gettableProtected(L, upval, rc, ra);
+        gettableCached(L, upval, rc, ra);  /* globals: cached '_ENV' slot */
         vmbreak;
       }
       vmcase(OP_GETTABLE) {
         StkId rb = RB(i);
         TValue *rc = RKC(i);
-        gettableProtected(L, rb, rc, ra);
+        gettableCached(L, rb, rc, ra);
         vmbreak;
       }
       vmcase(OP_SETTABUP) {
         TValue *upval = cl->upvals[GETARG_A(i)]->v;
         TValue *rb = RKB(i);
         TValue *rc = RKC(i);
-        settableProtected(L, upval, rb, rc);
+        settableCached(L, upval, rb, rc);
         vmbreak;
       }
       vmcase(OP_SETUPVAL) {
@@ -861,7 +982,7 @@ void luaV_execute (lua_State *L) {
       vmcase(OP_SETTABLE) {
         TValue *rb = RKB(i);
         TValue *rc = RKC(i);
-        settableProtected(L, ra, rb, rc);
+        settableCached(L, ra, rb, rc);
         vmbreak;
       }
       vmcase(OP_NEWTABLE) {
@@ -869,9 +990,9 @@ void luaV_execute (lua_State *L) {
         int c = GETARG_C(i);
         Table *t = luaH_new(L);
         global_State *g = G(L);
+        sethvalue(L, ra, t);  /* anchor it before registering it */
         if (g->exporting == 1)
-          hash_set_insert(g->monopolize, t);
-        sethvalue(L, ra, t);
+          luaE_monopolize(L, obj2gco(t));
         if (b != 0 || c != 0)
           luaH_resize(L, t, luaO_fb2int(b), luaO_fb2int(c));
         checkGC(L, ra + 1);
@@ -883,7 +1004,13 @@ void luaV_execute (lua_State *L) {
         TValue *rc = RKC(i);
         TString *key = tsvalue(rc);  /* key must be a string */
         setobjs2s(L, ra + 1, rb);
-        if (luaV_fastget(L, rb, key, aux, luaH_getstr)) {
+        if (!ttistable(rb))
+          aux = NULL;  /* not a table; 'luaV_finishget' handles it */
+        else if (ttisshrstring(rc))  /* raw access through the inline cache */
+          aux = icacheget(hvalue(rb), key, icache(ci, cl));
+        else
+          aux = luaH_getstr(hvalue(rb), key);
+        if (aux != NULL && !ttisnil(aux)) {
           setobj2s(L, ra, aux);
         }
         else Protect(luaV_finishget(L, rb, rc, ra, aux));
@@ -895,7 +1022,7 @@ void luaV_execute (lua_State *L) {
         lua_Number nb; lua_Number nc;
         if (ttisinteger(rb) && ttisinteger(rc)) {
           lua_Integer ib = ivalue(rb); lua_Integer ic = ivalue(rc);
-          setivalue(ra, intop(+, ib, ic));
+          setivalue(L, ra, intop(+, ib, ic));
         }
         else if (tonumber(rb, &nb) && tonumber(rc, &nc)) {
           setfltvalue(ra, luai_numadd(L, nb, nc));
@@ -909,7 +1036,7 @@ void luaV_execute (lua_State *L) {
         lua_Number nb; lua_Number nc;
         if (ttisinteger(rb) && ttisinteger(rc)) {
           lua_Integer ib = ivalue(rb); lua_Integer ic = ivalue(rc);
-          setivalue(ra, intop(-, ib, ic));
+          setivalue(L, ra, intop(-, ib, ic));
         }
         else if (tonumber(rb, &nb) && tonumber(rc, &nc)) {
           setfltvalue(ra, luai_numsub(L, nb, nc));
@@ -923,7 +1050,7 @@ void luaV_execute (lua_State *L) {
         lua_Number nb; lua_Number nc;
         if (ttisinteger(rb) && ttisinteger(rc)) {
           lua_Integer ib = ivalue(rb); lua_Integer ic = ivalue(rc);
-          setivalue(ra, intop(*, ib, ic));
+          setivalue(L, ra, intop(*, ib, ic));
         }
         else if (tonumber(rb, &nb) && tonumber(rc, &nc)) {
           setfltvalue(ra, luai_nummul(L, nb, nc));
@@ -946,7 +1073,7 @@ void luaV_execute (lua_State *L) {
         TValue *rc = RKC(i);
         lua_Integer ib; lua_Integer ic;
         if (tointeger(rb, &ib) && tointeger(rc, &ic)) {
-          setivalue(ra, intop(&, ib, ic));
+          setivalue(L, ra, intop(&, ib, ic));
         }
         else { Protect(luaT_trybinTM(L, rb, rc, ra, TM_BAND)); }
         vmbreak;
@@ -956,7 +1083,7 @@ void luaV_execute (lua_State *L) {
         TValue *rc = RKC(i);
         lua_Integer ib; lua_Integer ic;
         if (tointeger(rb, &ib) && tointeger(rc, &ic)) {
-          setivalue(ra, intop(|, ib, ic));
+          setivalue(L, ra, intop(|, ib, ic));
         }
         else { Protect(luaT_trybinTM(L, rb, rc, ra, TM_BOR)); }
         vmbreak;
@@ -966,7 +1093,7 @@ void luaV_execute (lua_State *L) {
         TValue *rc = RKC(i);
         lua_Integer ib; lua_Integer ic;
         if (tointeger(rb, &ib) && tointeger(rc, &ic)) {
-          setivalue(ra, intop(^, ib, ic));
+          setivalue(L, ra, intop(^, ib, ic));
         }
         else { Protect(luaT_trybinTM(L, rb, rc, ra, TM_BXOR)); }
         vmbreak;
@@ -976,7 +1103,7 @@ void luaV_execute (lua_State *L) {
         TValue *rc = RKC(i);
         lua_Integer ib; lua_Integer ic;
         if (tointeger(rb, &ib) && tointeger(rc, &ic)) {
-          setivalue(ra, luaV_shiftl(ib, ic));
+          setivalue(L, ra, luaV_shiftl(ib, ic));
         }
         else { Protect(luaT_trybinTM(L, rb, rc, ra, TM_SHL)); }
         vmbreak;
@@ -986,7 +1113,7 @@ void luaV_execute (lua_State *L) {
         TValue *rc = RKC(i);
         lua_Integer ib; lua_Integer ic;
         if (tointeger(rb, &ib) && tointeger(rc, &ic)) {
-          setivalue(ra, luaV_shiftl(ib, -ic));
+          setivalue(L, ra, luaV_shiftl(ib, -ic));
         }
         else { Protect(luaT_trybinTM(L, rb, rc, ra, TM_SHR)); }
         vmbreak;
@@ -997,7 +1124,7 @@ void luaV_execute (lua_State *L) {
         lua_Number nb; lua_Number nc;
         if (ttisinteger(rb) && ttisinteger(rc)) {
           lua_Integer ib = ivalue(rb); lua_Integer ic = ivalue(rc);
-          setivalue(ra, luaV_mod(L, ib, ic));
+          setivalue(L, ra, luaV_mod(L, ib, ic));
         }
         else if (tonumber(rb, &nb) && tonumber(rc, &nc)) {
           lua_Number m;
@@ -1013,7 +1140,7 @@ void luaV_execute (lua_State *L) {
         lua_Number nb; lua_Number nc;
         if (ttisinteger(rb) && ttisinteger(rc)) {
           lua_Integer ib = ivalue(rb); lua_Integer ic = ivalue(rc);
-          setivalue(ra, luaV_div(L, ib, ic));
+          setivalue(L, ra, luaV_div(L, ib, ic));
         }
         else if (tonumber(rb, &nb) && tonumber(rc, &nc)) {
           setfltvalue(ra, luai_numidiv(L, nb, nc));
@@ -1036,7 +1163,7 @@ void luaV_execute (lua_State *L) {
         lua_Number nb;
         if (ttisinteger(rb)) {
           lua_Integer ib = ivalue(rb);
-          setivalue(ra, intop(-, 0, ib));
+          setivalue(L, ra, intop(-, 0, ib));
         }
         else if (tonumber(rb, &nb)) {
           setfltvalue(ra, luai_numunm(L, nb));
@@ -1050,7 +1177,7 @@ void luaV_execute (lua_State *L) {
         TValue *rb = RB(i);
         lua_Integer ib;
         if (tointeger(rb, &ib)) {
-          setivalue(ra, intop(^, ~l_castS2U(0), ib));
+          setivalue(L, ra, intop(^, ~l_castS2U(0), ib));
         }
         else {
           Protect(luaT_trybinTM(L, rb, rb, ra, TM_BNOT));
@@ -1197,8 +1324,9 @@ void luaV_execute (lua_State *L) {
           lua_Integer limit = ivalue(ra + 1);
           if ((0 < step) ? (idx <= limit) : (limit <= idx)) {
             ci->u.l.savedpc += GETARG_sBx(i);  /* jump back */
-            chgivalue(ra, idx);  /* update internal index... */
-            setivalue(ra + 3, idx);  /* ...and external index */
+            updatedisp(L);  /* allows a signal to break the loop */
+            chgivalue(L, ra, idx);  /* update internal index... */
+            setobjs2s(L, ra + 3, ra);  /* ...and external index */
           }
         }
         else {  /* floating loop */
@@ -1208,6 +1336,7 @@ void luaV_execute (lua_State *L) {
           if (luai_numlt(0, step) ? luai_numle(idx, limit)
                                   : luai_numle(limit, idx)) {
             ci->u.l.savedpc += GETARG_sBx(i);  /* jump back */
+            updatedisp(L);  /* allows a signal to break the loop */
             chgfltvalue(ra, idx);  /* update internal index... */
             setfltvalue(ra + 3, idx);  /* ...and external index */
           }
@@ -1224,8 +1353,8 @@ void luaV_execute (lua_State *L) {
             forlimit(plimit, &ilimit, ivalue(pstep), &stopnow)) {
           /* all values are integer */
           lua_Integer initv = (stopnow ? 0 : ivalue(init));
-          setivalue(plimit, ilimit);
-          setivalue(init, intop(-, initv, ivalue(pstep)));
+          setivalue(L, plimit, ilimit);
+          setivalue(L, init, intop(-, initv, ivalue(pstep)));
         }
         else {  /* try making all values floats */
           lua_Number ninit; lua_Number nlimit; lua_Number nstep;
@@ -1260,12 +1389,14 @@ void luaV_execute (lua_State *L) {
         if (!ttisnil(ra + 1)) {  /* continue loop? */
           setobjs2s(L, ra, ra + 1);  /* save control variable */
            ci->u.l.savedpc += GETARG_sBx(i);  /* jump back */
+           updatedisp(L);  /* allows a signal to break the loop */
         }
         vmbreak;
       }
       vmcase(OP_SETLIST) {
         int n = GETARG_B(i);
         int c = GETARG_C(i);
+        int j;
         unsigned int last;
         Table *h;
         if (n == 0) n = cast_int(L->top - ra) - 1;
@@ -1277,9 +1408,10 @@ void luaV_execute (lua_State *L) {
         last = ((c-1)*LFIELDS_PER_FLUSH) + n;
         if (last > h->sizearray)  /* needs more space? */
           luaH_resizearray(L, h, last);  /* preallocate it at once */
-        for (; n > 0; n--) {
-          TValue *val = ra+n;
-          luaH_setint(L, h, last--, val);
+        last -= n;  /* (in ascending order, so a packed array only appends) */
+        for (j = 1; j <= n; j++) {
+          TValue *val = ra+j;
+          luaH_setint(L, h, ++last, val);
           luaC_barrierback(L, h, val);
         }
         L->top = ci->top;  /* correct top (in case of previous open call) */
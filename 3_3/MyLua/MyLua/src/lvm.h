@@ -71,7 +71,8 @@
 
 /*
 ** Fast track for set table. If 't' is a table and 't[k]' is not nil,
-** call GC barrier, do a raw 't[k]=v', and return true; otherwise,
+** call GC barrier, do a raw 't[k]=v' (through 'luaH_setslot', as 'slot'
+** may be a copy of a packed element), and return true; otherwise,
 ** return false with 'slot' equal to NULL (if 't' is not a table) or
 ** 'nil'. (This is needed by 'luaV_finishget'.) Note that, if the macro
 ** returns true, there is no need to 'invalidateTMcache', because the
@@ -83,7 +84,7 @@
    : (slot = f(hvalue(t), k), \
      ttisnil(slot) ? 0 \
      : (luaC_barrierback(L, hvalue(t), v), \
-        setobj2t(L, cast(TValue *,slot), v), \
+        luaH_setslot(L, hvalue(t), slot, v), \
         1)))
 
 
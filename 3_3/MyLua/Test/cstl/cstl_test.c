@@ -0,0 +1,65 @@
+/*
+ *  The driver of libcstl tests.
+ */
+
+/** include section **/
+#include <stdio.h>
+
+#include "cstl_test.h"
+
+/** local data type declaration and local struct, union, enum section **/
+typedef struct _tagtestcase
+{
+    const char* _s_name;
+    void      (*_pfun_test)(void);
+}_testcase_t;
+
+/** local global variable definition section **/
+static const _testcase_t _gat_testcase[] = {
+    {"bp_tree", test_bp_tree},
+    {"priority_queue", test_priority_queue},
+    {"list_pool", test_list_pool}
+};
+static unsigned long _gt_failcount = 0;
+static unsigned long _gt_seed = 1;
+
+/** exported function implementation section **/
+/**
+ * Report a failed check.
+ */
+void test_fail(const char* s_expression, const char* s_file, int n_line)
+{
+    /* a broken container fails the same check many times, the first ones are enough */
+    if (_gt_failcount++ < 20) {
+        fprintf(stderr, "%s:%d: check failed: %s\n", s_file, n_line, s_expression);
+    }
+}
+
+/**
+ * Get the next pseudo random number.
+ */
+unsigned long test_random(void)
+{
+    _gt_seed = (_gt_seed * 1103515245UL + 12345UL) & 0xffffffffUL;
+    return _gt_seed >> 1;
+}
+
+/**
+ * Run all tests.
+ */
+int cstl_test_run(void)
+{
+    size_t        i = 0;
+    unsigned long t_failcount = 0;
+
+    for (i = 0; i < sizeof(_gat_testcase) / sizeof(_gat_testcase[0]); ++i) {
+        t_failcount = _gt_failcount;
+        _gt_seed = 1;
+        _gat_testcase[i]._pfun_test();
+        printf("%-16s %s\n", _gat_testcase[i]._s_name, _gt_failcount == t_failcount ? "ok" : "FAILED");
+    }
+
+    return _gt_failcount == 0 ? 0 : 1;
+}
+
+/** eof **/
@@ -0,0 +1,55 @@
+/*
+ *  The tests of libcstl containers and algorithms.
+ *
+ *  They are built into the Test program and run by "Test cstl", the exit status is 0 when all checks pass.
+ *  The library options of the test (CSTL_MEMORY_MANAGEMENT, CSTL_SET_BP_TREE, ...) must be the same as MyLua.
+ */
+
+#ifndef _CSTL_TEST_H_
+#define _CSTL_TEST_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** include section **/
+#include <stddef.h>
+
+/** constant declaration and macro section **/
+/* count the failed check and report where it is */
+#define test_check(expression)\
+    ((expression) ? (void)0 : test_fail(#expression, __FILE__, __LINE__))
+
+/** exported function prototype section **/
+/**
+ * Report a failed check.
+ * @param s_expression  the expression that is false.
+ * @param s_file        source file.
+ * @param n_line        source line.
+ * @return void.
+ */
+extern void test_fail(const char* s_expression, const char* s_file, int n_line);
+
+/**
+ * Get the next pseudo random number, the sequence is the same on all platforms.
+ * @return random number in [0, 2^31).
+ */
+extern unsigned long test_random(void);
+
+/**
+ * Run all tests.
+ * @return 0 if all checks pass, otherwise 1.
+ */
+extern int cstl_test_run(void);
+
+/* the tests, one for each source file */
+extern void test_bp_tree(void);
+extern void test_priority_queue(void);
+extern void test_list_pool(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CSTL_TEST_H_ */
+/** eof **/
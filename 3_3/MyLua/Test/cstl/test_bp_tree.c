@@ -0,0 +1,168 @@
+/*
+ *  Differential test of the b+ tree against the red black tree.
+ *
+ *  The same random insert and erase sequence is applied to both trees, the bounds, the counts and the iteration in
+ *  both directions must be the same. CSTL_SET_BP_TREE and the other tree options only select between these trees.
+ */
+
+/** include section **/
+#include "cset.h"
+
+#include "cstl_test.h"
+
+/** local constant declaration and local macro section **/
+#define _TEST_KEY_RANGE     10000   /* keys are in [0, _TEST_KEY_RANGE), three levels of b+ tree for int */
+#define _TEST_STEP_COUNT    20000
+
+/** local function prototype section **/
+static void _test_same_position(
+    _bp_tree_t* pt_bp_tree, _bp_tree_iterator_t it_bp, _rb_tree_t* pt_rb_tree, _rb_tree_iterator_t it_rb);
+static void _test_same_tree(_bp_tree_t* pt_bp_tree, _rb_tree_t* pt_rb_tree);
+static void _test_tree(bool_t t_unique);
+
+/** exported function implementation section **/
+/**
+ * Test b+ tree with unique and equal keys.
+ */
+void test_bp_tree(void)
+{
+    _test_tree(true);
+    _test_tree(false);
+}
+
+/** local function implementation section **/
+/**
+ * Check the two iterators refer to the same key, or both are end.
+ */
+static void _test_same_position(
+    _bp_tree_t* pt_bp_tree, _bp_tree_iterator_t it_bp, _rb_tree_t* pt_rb_tree, _rb_tree_iterator_t it_rb)
+{
+    bool_t t_bpend = _bp_tree_iterator_equal(it_bp, _bp_tree_end(pt_bp_tree));
+    bool_t t_rbend = _rb_tree_iterator_equal(it_rb, _rb_tree_end(pt_rb_tree));
+
+    test_check(t_bpend == t_rbend);
+    if (!t_bpend && !t_rbend) {
+        test_check(*(int*)_bp_tree_iterator_get_pointer(it_bp) == *(int*)_rb_tree_iterator_get_pointer(it_rb));
+    }
+}
+
+/**
+ * Check the two trees hold the same keys in the same order.
+ */
+static void _test_same_tree(_bp_tree_t* pt_bp_tree, _rb_tree_t* pt_rb_tree)
+{
+    _bp_tree_iterator_t it_bp = _bp_tree_begin(pt_bp_tree);
+    _rb_tree_iterator_t it_rb = _rb_tree_begin(pt_rb_tree);
+    size_t              t_count = 0;
+
+    test_check(_bp_tree_size(pt_bp_tree) == _rb_tree_size(pt_rb_tree));
+    test_check(_bp_tree_empty(pt_bp_tree) == _rb_tree_empty(pt_rb_tree));
+
+    while (!_rb_tree_iterator_equal(it_rb, _rb_tree_end(pt_rb_tree)) &&
+           !_bp_tree_iterator_equal(it_bp, _bp_tree_end(pt_bp_tree))) {
+        test_check(*(int*)_bp_tree_iterator_get_pointer(it_bp) == *(int*)_rb_tree_iterator_get_pointer(it_rb));
+        it_bp = _bp_tree_iterator_next(it_bp);
+        it_rb = _rb_tree_iterator_next(it_rb);
+        t_count++;
+    }
+    _test_same_position(pt_bp_tree, it_bp, pt_rb_tree, it_rb);
+    test_check(t_count == _rb_tree_size(pt_rb_tree));
+
+    /* backward from end */
+    it_bp = _bp_tree_end(pt_bp_tree);
+    it_rb = _rb_tree_end(pt_rb_tree);
+    while (!_rb_tree_iterator_equal(it_rb, _rb_tree_begin(pt_rb_tree)) &&
+           !_bp_tree_iterator_equal(it_bp, _bp_tree_begin(pt_bp_tree))) {
+        it_bp = _bp_tree_iterator_prev(it_bp);
+        it_rb = _rb_tree_iterator_prev(it_rb);
+        test_check(*(int*)_bp_tree_iterator_get_pointer(it_bp) == *(int*)_rb_tree_iterator_get_pointer(it_rb));
+        t_count--;
+    }
+    test_check(_bp_tree_iterator_equal(it_bp, _bp_tree_begin(pt_bp_tree)));
+    test_check(t_count == 0);
+    test_check(_bp_tree_iterator_distance(_bp_tree_begin(pt_bp_tree), _bp_tree_end(pt_bp_tree)) ==
+               (int)_rb_tree_size(pt_rb_tree));
+}
+
+/**
+ * Apply the same random steps to both trees.
+ */
+static void _test_tree(bool_t t_unique)
+{
+    _bp_tree_t* pt_bp_tree = _create_bp_tree("int");
+    _rb_tree_t* pt_rb_tree = _create_rb_tree("int");
+    size_t      i = 0;
+    int         n_key = 0;
+    int         n_last = 0;
+
+    _bp_tree_init(pt_bp_tree, NULL);
+    _rb_tree_init(pt_rb_tree, NULL);
+
+    for (i = 0; i < _TEST_STEP_COUNT; ++i) {
+        unsigned long t_step = test_random() % 100;
+
+        n_key = (int)(test_random() % _TEST_KEY_RANGE);
+        /* insert more than erase in the first half, so the tree grows and then shrinks */
+        if (t_step < (i < _TEST_STEP_COUNT / 2 ? 60U : 30U)) {
+            if (t_unique) {
+                _test_same_position(pt_bp_tree, _bp_tree_insert_unique(pt_bp_tree, &n_key),
+                                    pt_rb_tree, _rb_tree_insert_unique(pt_rb_tree, &n_key));
+            } else {
+                _test_same_position(pt_bp_tree, _bp_tree_insert_equal(pt_bp_tree, &n_key),
+                                    pt_rb_tree, _rb_tree_insert_equal(pt_rb_tree, &n_key));
+            }
+        } else if (t_step < 75) {
+            test_check(_bp_tree_erase(pt_bp_tree, &n_key) == _rb_tree_erase(pt_rb_tree, &n_key));
+        } else if (t_step < 85) {
+            _bp_tree_iterator_t it_bp = _bp_tree_lower_bound(pt_bp_tree, &n_key);
+            _rb_tree_iterator_t it_rb = _rb_tree_lower_bound(pt_rb_tree, &n_key);
+
+            _test_same_position(pt_bp_tree, it_bp, pt_rb_tree, it_rb);
+            if (!_rb_tree_iterator_equal(it_rb, _rb_tree_end(pt_rb_tree))) {
+                _bp_tree_erase_pos(pt_bp_tree, it_bp);
+                _rb_tree_erase_pos(pt_rb_tree, it_rb);
+            }
+        } else if (t_step < 87) {
+            /* erase a short range */
+            n_last = n_key + (int)(test_random() % 200);
+            _bp_tree_erase_range(pt_bp_tree, _bp_tree_lower_bound(pt_bp_tree, &n_key),
+                                 _bp_tree_lower_bound(pt_bp_tree, &n_last));
+            _rb_tree_erase_range(pt_rb_tree, _rb_tree_lower_bound(pt_rb_tree, &n_key),
+                                 _rb_tree_lower_bound(pt_rb_tree, &n_last));
+        } else {
+            range_t r_bp = _bp_tree_equal_range(pt_bp_tree, &n_key);
+            range_t r_rb = _rb_tree_equal_range(pt_rb_tree, &n_key);
+
+            _test_same_position(pt_bp_tree, _bp_tree_find(pt_bp_tree, &n_key),
+                                pt_rb_tree, _rb_tree_find(pt_rb_tree, &n_key));
+            _test_same_position(pt_bp_tree, _bp_tree_upper_bound(pt_bp_tree, &n_key),
+                                pt_rb_tree, _rb_tree_upper_bound(pt_rb_tree, &n_key));
+            _test_same_position(pt_bp_tree, r_bp.it_begin, pt_rb_tree, r_rb.it_begin);
+            _test_same_position(pt_bp_tree, r_bp.it_end, pt_rb_tree, r_rb.it_end);
+            test_check(_bp_tree_count(pt_bp_tree, &n_key) == _rb_tree_count(pt_rb_tree, &n_key));
+        }
+
+        if (i % 5000 == 0) {
+            _test_same_tree(pt_bp_tree, pt_rb_tree);
+        }
+    }
+    _test_same_tree(pt_bp_tree, pt_rb_tree);
+
+    /* erase everything in random order, the merges of nodes run down to an empty tree */
+    while (!_rb_tree_empty(pt_rb_tree)) {
+        size_t t_erased = 0;
+
+        n_key = (int)(test_random() % _TEST_KEY_RANGE);
+        t_erased = _rb_tree_erase(pt_rb_tree, &n_key);
+        test_check(_bp_tree_erase(pt_bp_tree, &n_key) == t_erased);
+        if (t_erased > 0 && _rb_tree_size(pt_rb_tree) % 1000 == 0) {
+            _test_same_tree(pt_bp_tree, pt_rb_tree);
+        }
+    }
+    _test_same_tree(pt_bp_tree, pt_rb_tree);
+
+    _bp_tree_destroy(pt_bp_tree);
+    _rb_tree_destroy(pt_rb_tree);
+}
+
+/** eof **/
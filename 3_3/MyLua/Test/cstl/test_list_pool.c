@@ -0,0 +1,377 @@
+/*
+ *  Test of the node pools of list and slist.
+ *
+ *  Splice and merge move nodes between containers and share their pools, the containers must still be destroyed in
+ *  any order, and compact must detach the container from the shared pool. Run with ASan to catch the chunks that are
+ *  released too early.
+ */
+
+/** include section **/
+#include <stdio.h>
+#include <string.h>
+
+#include "clist.h"
+#include "cslist.h"
+#include "cstring.h"
+#include "citerator.h"
+
+#include "cstl_test.h"
+
+/** local function prototype section **/
+static void _test_is_odd(const void* cpv_input, void* pv_output);
+static void _test_list_same(const list_t* cplist_list, const int* cpn_value, size_t t_count);
+static void _test_slist_same(const slist_t* cpslist_slist, const int* cpn_value, size_t t_count);
+static void _test_list_compacted(const list_t* cplist_list);
+static void _test_slist_compacted(const slist_t* cpslist_slist);
+static void _test_list_destroy_source(void);
+static void _test_list_destroy_dest(void);
+static void _test_list_string(void);
+static void _test_slist_destroy_source(void);
+static void _test_slist_destroy_dest(void);
+
+/** exported function implementation section **/
+/**
+ * Test node pools of list and slist.
+ */
+void test_list_pool(void)
+{
+    _test_list_destroy_source();
+    _test_list_destroy_dest();
+    _test_list_string();
+    _test_slist_destroy_source();
+    _test_slist_destroy_dest();
+}
+
+/** local function implementation section **/
+/**
+ * Test the int is odd.
+ */
+static void _test_is_odd(const void* cpv_input, void* pv_output)
+{
+    *(bool_t*)pv_output = *(const int*)cpv_input % 2 != 0 ? true : false;
+}
+
+/**
+ * Check the list holds the values in order.
+ */
+static void _test_list_same(const list_t* cplist_list, const int* cpn_value, size_t t_count)
+{
+    list_iterator_t it_iter;
+    size_t          i = 0;
+
+    test_check(list_size(cplist_list) == t_count);
+    for (it_iter = list_begin(cplist_list);
+         !iterator_equal(it_iter, list_end(cplist_list)) && i < t_count;
+         it_iter = iterator_next(it_iter), ++i) {
+        test_check(*(int*)iterator_get_pointer(it_iter) == cpn_value[i]);
+    }
+    test_check(i == t_count);
+}
+
+/**
+ * Check the slist holds the values in order.
+ */
+static void _test_slist_same(const slist_t* cpslist_slist, const int* cpn_value, size_t t_count)
+{
+    slist_iterator_t it_iter;
+    size_t           i = 0;
+
+    test_check(slist_size(cpslist_slist) == t_count);
+    for (it_iter = slist_begin(cpslist_slist);
+         !iterator_equal(it_iter, slist_end(cpslist_slist)) && i < t_count;
+         it_iter = iterator_next(it_iter), ++i) {
+        test_check(*(int*)iterator_get_pointer(it_iter) == cpn_value[i]);
+    }
+    test_check(i == t_count);
+}
+
+/**
+ * Check the elements of compact list are in address order.
+ */
+static void _test_list_compacted(const list_t* cplist_list)
+{
+    list_iterator_t it_iter;
+    _byte_t*        pby_prev = NULL;
+
+    for (it_iter = list_begin(cplist_list);
+         !iterator_equal(it_iter, list_end(cplist_list));
+         it_iter = iterator_next(it_iter)) {
+        test_check(pby_prev < (_byte_t*)iterator_get_pointer(it_iter));
+        pby_prev = (_byte_t*)iterator_get_pointer(it_iter);
+    }
+}
+
+/**
+ * Check the elements of compact slist are in address order.
+ */
+static void _test_slist_compacted(const slist_t* cpslist_slist)
+{
+    slist_iterator_t it_iter;
+    _byte_t*         pby_prev = NULL;
+
+    for (it_iter = slist_begin(cpslist_slist);
+         !iterator_equal(it_iter, slist_end(cpslist_slist));
+         it_iter = iterator_next(it_iter)) {
+        test_check(pby_prev < (_byte_t*)iterator_get_pointer(it_iter));
+        pby_prev = (_byte_t*)iterator_get_pointer(it_iter);
+    }
+}
+
+/**
+ * Splice and merge from source list, destroy the source first, then use and compact the destination.
+ */
+static void _test_list_destroy_source(void)
+{
+    list_t* plist_dest = create_list(int);
+    list_t* plist_src = create_list(int);
+    int     an_value[220];
+    size_t  t_usage = 0;
+    int     i = 0;
+
+    list_init(plist_dest);
+    list_init(plist_src);
+    /* dest is 0..99 and src is 100..199, the nodes of the two pools are allocated in turn */
+    for (i = 0; i < 100; ++i) {
+        list_push_back(plist_dest, i);
+        list_push_back(plist_src, 100 + i);
+    }
+
+    /* dest: 150, 0..99, 100..119 */
+    list_splice_pos(plist_dest, list_begin(plist_dest), plist_src, iterator_advance(list_begin(plist_src), 50));
+    list_splice_range(plist_dest, list_end(plist_dest),
+                      plist_src, list_begin(plist_src), iterator_advance(list_begin(plist_src), 20));
+    test_check(list_size(plist_src) == 79);
+    test_check(*(int*)list_front(plist_dest) == 150 && *(int*)list_back(plist_dest) == 119);
+
+    /* merge the sorted lists, dest is 0..199 */
+    list_sort(plist_dest);
+    list_sort(plist_src);
+    list_merge(plist_dest, plist_src);
+    test_check(list_empty(plist_src));
+    for (i = 0; i < 200; ++i) {
+        an_value[i] = i;
+    }
+    _test_list_same(plist_dest, an_value, 200);
+
+    /* the source gets nodes from the shared pool and gives them to dest, dest is 0..199, 300..309 */
+    for (i = 0; i < 10; ++i) {
+        list_push_back(plist_src, 300 + i);
+        an_value[200 + i] = 300 + i;
+    }
+    list_splice(plist_dest, list_end(plist_dest), plist_src);
+    list_push_back(plist_src, 999);
+    list_destroy(plist_src);
+    _test_list_same(plist_dest, an_value, 210);
+
+    /* the shared pool is still used by dest, erase the odd numbers and append 400..409 */
+    list_remove_if(plist_dest, _test_is_odd);
+    for (i = 0; i < 105; ++i) {
+        an_value[i] = an_value[i * 2];
+    }
+    for (i = 0; i < 10; ++i) {
+        list_push_back(plist_dest, 400 + i);
+        an_value[105 + i] = 400 + i;
+    }
+    _test_list_same(plist_dest, an_value, 115);
+
+    t_usage = list_memory_usage(plist_dest);
+    list_compact(plist_dest);
+    _test_list_same(plist_dest, an_value, 115);
+    _test_list_compacted(plist_dest);
+    test_check(list_memory_usage(plist_dest) < t_usage);
+    list_push_front(plist_dest, -1);
+    test_check(*(int*)list_front(plist_dest) == -1 && list_size(plist_dest) == 116);
+
+    list_destroy(plist_dest);
+}
+
+/**
+ * Splice from source list, destroy the destination first, then use and compact the source.
+ */
+static void _test_list_destroy_dest(void)
+{
+    list_t* plist_first = create_list(int);
+    list_t* plist_second = create_list(int);
+    list_t* plist_third = create_list(int);
+    int     an_value[100];
+    int     i = 0;
+
+    list_init(plist_first);
+    list_init(plist_second);
+    list_init(plist_third);
+    for (i = 0; i < 100; ++i) {
+        list_push_back(plist_first, i);
+        list_push_back(plist_second, 1000 + i);
+        list_push_back(plist_third, 2000 + i);
+    }
+
+    /* the three pools are merged through second */
+    list_splice_range(plist_second, list_end(plist_second),
+                      plist_first, list_begin(plist_first), iterator_advance(list_begin(plist_first), 50));
+    list_splice_range(plist_third, list_begin(plist_third),
+                      plist_second, list_begin(plist_second), iterator_advance(list_begin(plist_second), 100));
+    list_destroy(plist_second);
+
+    /* first is 50..99, third is 1000..1099, 2000..2099 */
+    for (i = 0; i < 50; ++i) {
+        an_value[i] = 50 + i;
+    }
+    _test_list_same(plist_first, an_value, 50);
+    test_check(list_size(plist_third) == 200);
+    test_check(*(int*)list_front(plist_third) == 1000 && *(int*)list_back(plist_third) == 2099);
+
+    list_compact(plist_third);
+    _test_list_compacted(plist_third);
+    list_destroy(plist_third);
+
+    list_push_back(plist_first, 100);
+    an_value[50] = 100;
+    _test_list_same(plist_first, an_value, 51);
+    list_destroy(plist_first);
+}
+
+/**
+ * Elements that own memory are copied by compact and moved by splice.
+ */
+static void _test_list_string(void)
+{
+    list_t*         plist_dest = create_list(string_t);
+    list_t*         plist_src = create_list(string_t);
+    string_t*       pstr_value = create_string();
+    list_iterator_t it_iter;
+    char            s_buffer[32];
+    int             i = 0;
+
+    list_init(plist_dest);
+    list_init(plist_src);
+    string_init(pstr_value);
+    for (i = 0; i < 64; ++i) {
+        sprintf(s_buffer, "element %d with a long text", i);
+        string_assign_cstr(pstr_value, s_buffer);
+        list_push_back(i % 2 == 0 ? plist_dest : plist_src, pstr_value);
+    }
+
+    list_sort(plist_dest);
+    list_sort(plist_src);
+    list_merge(plist_dest, plist_src);
+    list_destroy(plist_src);
+    list_compact(plist_dest);
+    _test_list_compacted(plist_dest);
+
+    test_check(list_size(plist_dest) == 64);
+    it_iter = list_begin(plist_dest);
+    test_check(strcmp(string_c_str((string_t*)iterator_get_pointer(it_iter)), "element 0 with a long text") == 0);
+    it_iter = iterator_prev(list_end(plist_dest));
+    test_check(strcmp(string_c_str((string_t*)iterator_get_pointer(it_iter)), "element 9 with a long text") == 0);
+
+    string_destroy(pstr_value);
+    list_destroy(plist_dest);
+}
+
+/**
+ * Splice and merge from source slist, destroy the source first, then use and compact the destination.
+ */
+static void _test_slist_destroy_source(void)
+{
+    slist_t* pslist_dest = create_slist(int);
+    slist_t* pslist_src = create_slist(int);
+    int      an_value[210];
+    size_t   t_usage = 0;
+    int      i = 0;
+
+    slist_init(pslist_dest);
+    slist_init(pslist_src);
+    /* dest is 0..99 and src is 100..199 */
+    for (i = 99; i >= 0; --i) {
+        slist_push_front(pslist_dest, i);
+        slist_push_front(pslist_src, 100 + i);
+    }
+
+    /* dest: 150, 0..99, 100..119, 121 */
+    slist_splice_pos(pslist_dest, slist_begin(pslist_dest), pslist_src, iterator_advance(slist_begin(pslist_src), 50));
+    slist_splice_range(pslist_dest, slist_end(pslist_dest),
+                       pslist_src, slist_begin(pslist_src), iterator_advance(slist_begin(pslist_src), 20));
+    slist_splice_after_pos(pslist_dest, slist_previous(pslist_dest, slist_end(pslist_dest)),
+                           pslist_src, slist_begin(pslist_src));
+    test_check(slist_size(pslist_src) == 78);
+    test_check(*(int*)slist_front(pslist_dest) == 150);
+
+    /* merge the sorted slists, dest is 0..199 */
+    slist_sort(pslist_dest);
+    slist_sort(pslist_src);
+    slist_merge(pslist_dest, pslist_src);
+    test_check(slist_empty(pslist_src));
+    for (i = 0; i < 200; ++i) {
+        an_value[i] = i;
+    }
+    _test_slist_same(pslist_dest, an_value, 200);
+
+    /* dest is 300..318 step 2, 0..199 */
+    for (i = 9; i >= 0; --i) {
+        slist_push_front(pslist_src, 300 + i * 2);
+    }
+    slist_splice(pslist_dest, slist_begin(pslist_dest), pslist_src);
+    slist_push_front(pslist_src, 999);
+    slist_destroy(pslist_src);
+    for (i = 199; i >= 0; --i) {
+        an_value[10 + i] = i;
+    }
+    for (i = 0; i < 10; ++i) {
+        an_value[i] = 300 + i * 2;
+    }
+    _test_slist_same(pslist_dest, an_value, 210);
+
+    /* dest is 300..318 step 2, 0..198 step 2 */
+    slist_remove_if(pslist_dest, _test_is_odd);
+    for (i = 0; i < 100; ++i) {
+        an_value[10 + i] = i * 2;
+    }
+    _test_slist_same(pslist_dest, an_value, 110);
+
+    t_usage = slist_memory_usage(pslist_dest);
+    slist_compact(pslist_dest);
+    _test_slist_same(pslist_dest, an_value, 110);
+    _test_slist_compacted(pslist_dest);
+    test_check(slist_memory_usage(pslist_dest) < t_usage);
+    slist_push_front(pslist_dest, -1);
+    test_check(*(int*)slist_front(pslist_dest) == -1 && slist_size(pslist_dest) == 111);
+
+    slist_destroy(pslist_dest);
+}
+
+/**
+ * Splice from source slist, destroy the destination first, then use and compact the source.
+ */
+static void _test_slist_destroy_dest(void)
+{
+    slist_t* pslist_dest = create_slist(int);
+    slist_t* pslist_src = create_slist(int);
+    int      an_value[51];
+    int      i = 0;
+
+    slist_init(pslist_dest);
+    slist_init(pslist_src);
+    for (i = 99; i >= 0; --i) {
+        slist_push_front(pslist_dest, 1000 + i);
+        slist_push_front(pslist_src, i);
+    }
+
+    /* (it_begin, it_end] is moved, src is 0, 51..99 */
+    slist_splice_after_range(pslist_dest, slist_begin(pslist_dest),
+                             pslist_src, slist_begin(pslist_src), iterator_advance(slist_begin(pslist_src), 50));
+    test_check(slist_size(pslist_dest) == 150);
+    slist_destroy(pslist_dest);
+
+    an_value[0] = 0;
+    for (i = 1; i < 50; ++i) {
+        an_value[i] = 50 + i;
+    }
+    _test_slist_same(pslist_src, an_value, 50);
+    slist_compact(pslist_src);
+    _test_slist_compacted(pslist_src);
+    slist_push_front(pslist_src, -1);
+    test_check(slist_size(pslist_src) == 51 && *(int*)slist_front(pslist_src) == -1);
+    slist_destroy(pslist_src);
+}
+
+/** eof **/
@@ -0,0 +1,217 @@
+/*
+ *  Test of priority queue heap order, push_n and the indexed priority queue.
+ *
+ *  The heap order is checked on the underlying vector with the arity selected by CSTL_PRIORITY_QUEUE_4ARY_HEAP.
+ */
+
+/** include section **/
+#include <stdlib.h>
+
+#include "cqueue.h"
+#include "cfunctional.h"
+#include "cstl_priority_queue_aux.h"
+
+#include "cstl_test.h"
+
+/** local constant declaration and local macro section **/
+#define _TEST_KEY_COUNT     500
+#define _TEST_STEP_COUNT    20000
+
+/** local function prototype section **/
+static void _test_heap_order(priority_queue_t* ppque_pqueue, bool_t t_greater);
+static void _test_indexed_same(priority_queue_t* ppque_pqueue, const int* pn_value, const bool_t* pt_used);
+static int _test_compare_int(const void* cpv_first, const void* cpv_second);
+static void _test_push_n(bool_t t_greater);
+static void _test_indexed(void);
+
+/** exported function implementation section **/
+/**
+ * Test priority queue.
+ */
+void test_priority_queue(void)
+{
+    _test_push_n(false);
+    _test_push_n(true);
+    _test_indexed();
+}
+
+/** local function implementation section **/
+/**
+ * Check no element has higher priority than its parent.
+ */
+static void _test_heap_order(priority_queue_t* ppque_pqueue, bool_t t_greater)
+{
+    int*   pn_heap = (int*)vector_data(&ppque_pqueue->_vec_base);
+    size_t t_size = vector_size(&ppque_pqueue->_vec_base);
+    size_t i = 0;
+
+    for (i = 1; i < t_size; ++i) {
+        int n_parent = pn_heap[(i - 1) / _PRIORITY_QUEUE_HEAP_ARITY];
+        test_check(t_greater ? n_parent <= pn_heap[i] : n_parent >= pn_heap[i]);
+    }
+}
+
+/**
+ * Check the indexed priority queue holds the keys and values of the model, and the key maps are consistent.
+ */
+static void _test_indexed_same(priority_queue_t* ppque_pqueue, const int* pn_value, const bool_t* pt_used)
+{
+    size_t t_size = priority_queue_size(ppque_pqueue);
+    size_t t_used = 0;
+    size_t i = 0;
+
+    _test_heap_order(ppque_pqueue, false);
+    for (i = 0; i < t_size; ++i) {
+        test_check(ppque_pqueue->_pt_keypos[ppque_pqueue->_pt_poskey[i]] == i);
+    }
+    for (i = 0; i < _TEST_KEY_COUNT; ++i) {
+        test_check(priority_queue_contain_indexed(ppque_pqueue, i) == pt_used[i]);
+        if (pt_used[i]) {
+            test_check(*(int*)priority_queue_at_indexed(ppque_pqueue, i) == pn_value[i]);
+            t_used++;
+        }
+    }
+    test_check(t_used == t_size);
+}
+
+/**
+ * Compare int for sorting in descending order.
+ */
+static int _test_compare_int(const void* cpv_first, const void* cpv_second)
+{
+    int n_first = *(const int*)cpv_first;
+    int n_second = *(const int*)cpv_second;
+
+    return n_first > n_second ? -1 : (n_first < n_second ? 1 : 0);
+}
+
+/**
+ * Push batches of different sizes, both the sift up and the bottom up heapify of push_n are used.
+ */
+static void _test_push_n(bool_t t_greater)
+{
+    static const size_t at_batch[] = {1000, 0, 1, 7, 3, 50, 200, 5, 2000, 2, 4000, 9};
+    priority_queue_t* ppque_pqueue = create_priority_queue(int);
+    int*              pn_all = NULL;
+    size_t            t_total = 0;
+    size_t            t_count = 0;
+    size_t            i = 0;
+    size_t            j = 0;
+
+    for (i = 0; i < sizeof(at_batch) / sizeof(at_batch[0]); ++i) {
+        t_total += at_batch[i];
+    }
+    pn_all = (int*)malloc(t_total * sizeof(int));
+    if (pn_all == NULL || ppque_pqueue == NULL) {
+        test_check(!"out of memory");
+        free(pn_all);
+        return;
+    }
+    if (t_greater) {
+        priority_queue_init_ex(ppque_pqueue, fun_greater_int);
+    } else {
+        priority_queue_init(ppque_pqueue);
+    }
+
+    for (i = 0; i < sizeof(at_batch) / sizeof(at_batch[0]); ++i) {
+        for (j = 0; j < at_batch[i]; ++j) {
+            /* few distinct values, so equal elements are compared too */
+            pn_all[t_count + j] = (int)(test_random() % 1000) - 500;
+        }
+        priority_queue_push_n(ppque_pqueue, pn_all + t_count, at_batch[i]);
+        t_count += at_batch[i];
+        test_check(priority_queue_size(ppque_pqueue) == t_count);
+        _test_heap_order(ppque_pqueue, t_greater);
+    }
+
+    /* pop in priority order */
+    qsort(pn_all, t_total, sizeof(int), _test_compare_int);
+    for (i = 0; i < t_total; ++i) {
+        test_check(*(int*)priority_queue_top(ppque_pqueue) == pn_all[t_greater ? t_total - 1 - i : i]);
+        priority_queue_pop(ppque_pqueue);
+        if (i % 1000 == 0) {
+            _test_heap_order(ppque_pqueue, t_greater);
+        }
+    }
+    test_check(priority_queue_empty(ppque_pqueue));
+
+    priority_queue_destroy(ppque_pqueue);
+    free(pn_all);
+}
+
+/**
+ * Apply random push, decrease and increase key, erase and pop to indexed priority queue and a model.
+ */
+static void _test_indexed(void)
+{
+    priority_queue_t* ppque_pqueue = create_priority_queue(int);
+    int               an_value[_TEST_KEY_COUNT] = {0};
+    bool_t            at_used[_TEST_KEY_COUNT] = {false};
+    size_t            t_key = 0;
+    size_t            i = 0;
+    size_t            j = 0;
+
+    if (ppque_pqueue == NULL) {
+        test_check(!"out of memory");
+        return;
+    }
+    priority_queue_init_indexed(ppque_pqueue, _TEST_KEY_COUNT);
+
+    for (i = 0; i < _TEST_STEP_COUNT; ++i) {
+        unsigned long t_step = test_random() % 100;
+        int           n_value = (int)(test_random() % 10000);
+
+        t_key = test_random() % _TEST_KEY_COUNT;
+        if (!at_used[t_key]) {
+            if (t_step < 60) {
+                priority_queue_push_indexed(ppque_pqueue, t_key, n_value);
+                an_value[t_key] = n_value;
+                at_used[t_key] = true;
+            }
+        } else if (t_step < 35) {
+            /* decrease key, the element moves down */
+            an_value[t_key] -= (int)(test_random() % 2000);
+            priority_queue_update_indexed(ppque_pqueue, t_key, an_value[t_key]);
+        } else if (t_step < 70) {
+            /* increase key, the element moves up */
+            an_value[t_key] += (int)(test_random() % 2000);
+            priority_queue_update_indexed(ppque_pqueue, t_key, an_value[t_key]);
+        } else if (t_step < 85) {
+            priority_queue_erase_indexed(ppque_pqueue, t_key);
+            at_used[t_key] = false;
+        } else {
+            /* top is the key of the max value */
+            bool_t t_higher = false;
+
+            t_key = priority_queue_top_indexed(ppque_pqueue);
+            test_check(at_used[t_key]);
+            for (j = 0; j < _TEST_KEY_COUNT; ++j) {
+                if (at_used[j] && an_value[j] > an_value[t_key]) {
+                    t_higher = true;
+                }
+            }
+            test_check(!t_higher);
+            test_check(*(int*)priority_queue_top(ppque_pqueue) == an_value[t_key]);
+            priority_queue_pop(ppque_pqueue);
+            at_used[t_key] = false;
+        }
+
+        if (i % 500 == 0) {
+            _test_indexed_same(ppque_pqueue, an_value, at_used);
+        }
+    }
+    _test_indexed_same(ppque_pqueue, an_value, at_used);
+
+    /* a key can be used again after it is erased */
+    while (!priority_queue_empty(ppque_pqueue)) {
+        t_key = priority_queue_top_indexed(ppque_pqueue);
+        priority_queue_erase_indexed(ppque_pqueue, t_key);
+        at_used[t_key] = false;
+    }
+    priority_queue_push_indexed(ppque_pqueue, t_key, 7);
+    test_check(priority_queue_size(ppque_pqueue) == 1 && priority_queue_top_indexed(ppque_pqueue) == t_key);
+
+    priority_queue_destroy(ppque_pqueue);
+}
+
+/** eof **/
@@ -1,9 +1,15 @@
 #include "lua.hpp"
 #include <iostream>
 #include <string>
+#include "cstl/cstl_test.h"
 
 
-int main() {
+int main(int argc, char* argv[]) {
+	//Test cstl ֻlibcstlĲ, ֵ0ʾȫͨ
+	if (argc > 1 && std::string(argv[1]) == "cstl") {
+		return cstl_test_run();
+	}
+
 	//LuaL1еtestTable
 	lua_State* L1 = luaL_newstate();
 	luaL_openlibs(L1);